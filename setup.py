@@ -11,7 +11,7 @@ setup(
     install_requires=[
         "unreal_core==0.0.1"
     ],
-    python_requires=">=3.6",
+    python_requires=">=3.7",
     package_data={
         "": ["*"]
     },
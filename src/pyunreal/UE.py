@@ -1,5 +1,7 @@
 import unreal_core 
 from unreal_core import ClassProp, Argument, UnrealObject
+# USTRUCT values, passed by value inside the call message
+from unreal_core import Vector2D, Vector, Rotator, Quat, Transform
 from enum import Enum
 from typing import TypeVar, MutableSequence
 
@@ -81,40 +83,6 @@ class MyObject:
         arg = Argument("Enum", self._ue_class, enum, 'enum')
         return unreal_core.call_function(self, self._ue_obj, self._ue_class, "TestEnum", [arg])
     
-class Vector2D:
-    def __init__(self, X, Y):
-        self._ue_class = ClassProp("Vector2D")
-        arg1 = Argument("X", self._ue_class, X)
-        arg2 = Argument("Y", self._ue_class, Y)
-        self._ue_obj = unreal_core.new_object(self, self._ue_class, "test_vector", 0, [arg1, arg2])
-        # print("Vector2D object: ", hex(id(self)))
-
-    def __del__(self):
-        # print("destory object: ", hex(id(self)))
-        unreal_core.destory_object(self)
-
-    @property
-    def ue_obj(self):
-        return self._ue_obj
-    
-    @property
-    def X(self):
-        return unreal_core.get_property(self, self._ue_class, "X")
-    
-    @property
-    def Y(self):
-        return unreal_core.get_property(self, self._ue_class, "Y")
-    
-    @X.setter
-    def X(self, value):
-        arg = Argument("X", self._ue_class, value)
-        unreal_core.set_property(self, self._ue_class, arg)
-    
-    @Y.setter
-    def Y(self, value):
-        arg = Argument("Y", self._ue_class, value)
-        unreal_core.set_property(self, self._ue_class, arg)
-
 class MyEnum(Enum):
     """
     Test enum
@@ -0,0 +1,342 @@
+"""
+Generate typed python bindings from a reflection dump of the engine.
+
+    python generate_bindings.py OUT_DIR [--dump reflection.json] [--synthetic N] [--eager]
+
+without --dump the dump is requested from the server with unreal_core.dump_reflection, the stand-in
+server (UNREAL_CORE_LOOPBACK=1) answers with the UE.py test classes.
+
+OUT_DIR becomes a package with one module and one .pyi stub per class in _classes, plus _enums and _structs.
+the package imports a class module on first access of the class through a module __getattr__, so
+importing the bindings of thousands of classes stays cheap, --eager imports all of them up front.
+classes bind their properties and functions with UProperty and UFunction, whose signatures and
+conversion plans are compiled when the module is imported, so calls make no name lookups.
+the manifest in OUT_DIR remembers a hash of the dump entry behind every file, regenerating only
+rewrites the files whose entry changed and removes the ones of deleted entries.
+generate into a package named py_unreal to have objects returned by the engine use these classes.
+"""
+import argparse
+import hashlib
+import json
+import keyword
+import os
+import sys
+
+# bump when the emitted code changes, so every file is regenerated
+GENERATOR_VERSION = 4
+MANIFEST_NAME = ".bindings_manifest.json"
+HEADER = "# generated by generate_bindings.py from a reflection dump, do not edit\n"
+# class modules live in a subpackage, so importing one does not bind the module over the class in the package
+CLASSES_PACKAGE = "_classes"
+
+# dump types passed by value, with their param kind
+VALUE_KINDS = {
+    "bool": "bool",
+    "int": "int",
+    "float": "float",
+    "str": "str",
+    "Vector2D": "Vector2D",
+    "Vector": "Vector",
+    "Rotator": "Rotator",
+    "Quat": "Quat",
+    "Transform": "Transform",
+}
+VALUE_STRUCTS = {"Vector2D", "Vector", "Rotator", "Quat", "Transform"}
+
+
+class Reflection:
+    """
+    the dump with its names indexed, to tell classes, enums and structs apart
+    """
+    def __init__(self, dump):
+        self.classes = {entry["name"]: entry for entry in dump.get("classes", [])}
+        self.enums = {entry["name"]: entry for entry in dump.get("enums", [])}
+        self.structs = {entry["name"]: entry for entry in dump.get("structs", [])}
+
+    def category(self, type_name):
+        for category, names in (("class", self.classes), ("enum", self.enums), ("struct", self.structs)):
+            if type_name in names:
+                return category
+        return None
+
+    def kind(self, type_name):
+        """
+        param kind of a dump type, None keeps the per value dispatch (registered structs)
+        """
+        if type_name in VALUE_KINDS:
+            return VALUE_KINDS[type_name]
+        if type_name in self.enums:
+            return "enum"
+        if type_name in self.classes:
+            return "object"
+        return None
+
+    def annotation(self, type_name):
+        if type_name is None:
+            return "None"
+        if type_name in VALUE_KINDS and type_name not in VALUE_STRUCTS:
+            return type_name
+        if type_name in VALUE_STRUCTS or type_name in self.enums or type_name in self.structs or type_name in self.classes:
+            return type_name
+        return "Any"
+
+    def stub_imports(self, type_names, own_name, in_classes):
+        """
+        import lines of a module that annotates with type_names, in_classes for modules of CLASSES_PACKAGE
+        """
+        value_structs = sorted({name for name in type_names if name in VALUE_STRUCTS})
+        enums = sorted({name for name in type_names if name in self.enums})
+        structs = sorted({name for name in type_names if name in self.structs})
+        classes = sorted({name for name in type_names if name in self.classes and name != own_name})
+        lines = ["from typing import Any"]
+        if value_structs:
+            lines.append(f"from unreal_core import {', '.join(value_structs)}")
+        package = ".." if in_classes else "."
+        if enums:
+            lines.append(f"from {package}_enums import {', '.join(enums)}")
+        if structs:
+            lines.append(f"from {package}_structs import {', '.join(structs)}")
+        for name in classes:
+            lines.append(f"from .{name} import {name}" if in_classes else f"from .{CLASSES_PACKAGE}.{name} import {name}")
+        return lines
+
+
+def python_name(name):
+    return name + "_" if keyword.iskeyword(name) else name
+
+
+def entry_hash(*entries):
+    text = json.dumps([GENERATOR_VERSION, entries], sort_keys=True)
+    return hashlib.sha1(text.encode("utf-8")).hexdigest()
+
+
+def signature_literal(reflection, params):
+    pairs = ", ".join(f"({param['name']!r}, {reflection.kind(param['type'])!r})" for param in params)
+    return f"({pairs},)" if len(params) == 1 else f"({pairs})"
+
+
+def argument_literal(reflection, param, arg):
+    kind = reflection.kind(param["type"])
+    if kind is None:
+        return f"Argument({param['name']!r}, _ue_class, {arg})"
+    return f"Argument({param['name']!r}, _ue_class, {arg}, {kind!r})"
+
+
+def render_class(reflection, entry):
+    name = entry["name"]
+    parent = entry.get("parent")
+    lines = [HEADER, "import unreal_core", "from unreal_core import ClassProp, Argument, UProperty, UFunction"]
+    if parent in reflection.classes:
+        lines.append(f"from .{parent} import {parent}")
+    lines += ["", f"_ue_class = ClassProp({name!r})", "", ""]
+
+    # no instance dict, the extension stores the unreal object of returned objects at the slot offset
+    if parent in reflection.classes:
+        lines += [f"class {name}({parent}):", "    __slots__ = ()"]
+    else:
+        lines += [f"class {name}:", "    __slots__ = (\"unreal_object\",)"]
+    lines.append("    ue_class = _ue_class")
+    for prop in entry.get("properties", []):
+        lines.append(f"    {python_name(prop['name'])} = UProperty(_ue_class, {reflection.kind(prop['type'])!r}, {prop['name']!r})")
+    for function in entry.get("functions", []):
+        params = function.get("params", [])
+        if not function.get("static", False):
+            lines.append(f"    {python_name(function['name'])} = UFunction(_ue_class, {function['name']!r}, "
+                         f"{signature_literal(reflection, params)})")
+            continue
+        # static functions have no instance to bind, they keep the Argument path of call_static_function
+        # with the param kinds as value types, so values convert as in the UFunction signatures
+        names = [python_name(param["name"]) for param in params]
+        arguments = ", ".join(argument_literal(reflection, param, arg) for param, arg in zip(params, names))
+        lines += ["", "    @staticmethod", f"    def {python_name(function['name'])}({', '.join(names)}):",
+                  f"        return unreal_core.call_static_function(_ue_class, {function['name']!r}, [{arguments}])"]
+    return "\n".join(lines) + "\n"
+
+
+def render_class_stub(reflection, entry):
+    name = entry["name"]
+    parent = entry.get("parent")
+    type_names = [parent] + [prop["type"] for prop in entry.get("properties", [])]
+    for function in entry.get("functions", []):
+        type_names += [param["type"] for param in function.get("params", [])] + [function.get("return")]
+    lines = [HEADER.rstrip("\n")] + reflection.stub_imports(type_names, name, True) + ["from unreal_core import ClassProp, ResultView", "", ""]
+
+    lines.append(f"class {name}({parent}):" if parent in reflection.classes else f"class {name}:")
+    lines.append("    ue_class: ClassProp")
+    for prop in entry.get("properties", []):
+        lines.append(f"    {python_name(prop['name'])}: {reflection.annotation(prop['type'])}")
+    for function in entry.get("functions", []):
+        params = [f"{python_name(param['name'])}: {reflection.annotation(param['type'])}" for param in function.get("params", [])]
+        # calls return (return_value, *out_params): UFunction an empty tuple for void and a ResultView with
+        # lazy results, call_static_function always a tuple with None for void
+        returns = reflection.annotation(function.get("return"))
+        if function.get("static", False):
+            lines += ["    @staticmethod", f"    def {python_name(function['name'])}({', '.join(params)}) -> tuple[{returns}]: ..."]
+        else:
+            returns = "tuple[()]" if function.get("return") is None else f"tuple[{returns}]"
+            lines.append(f"    def {python_name(function['name'])}({', '.join(['self'] + params)}) -> {returns} | ResultView: ...")
+    return "\n".join(lines) + "\n"
+
+
+def render_enums(reflection):
+    lines = [HEADER, "from enum import Enum"]
+    for name, entry in sorted(reflection.enums.items()):
+        lines += ["", "", f"class {name}(Enum):"]
+        values = entry.get("values", {})
+        lines += [f"    {python_name(key)} = {value}" for key, value in values.items()] or ["    pass"]
+    return "\n".join(lines) + "\n"
+
+
+def render_structs(reflection):
+    """
+    structs are dataclasses registered as field layouts, see unreal_core.register_converter
+    """
+    type_names = [field["type"] for entry in reflection.structs.values() for field in entry.get("fields", [])]
+    lines = [HEADER, "from __future__ import annotations", "", "from dataclasses import dataclass",
+             "from typing import TYPE_CHECKING", "", "import unreal_core", "", "if TYPE_CHECKING:"]
+    lines += ["    " + line for line in reflection.stub_imports(type_names, None, False)]
+    for name, entry in sorted(reflection.structs.items()):
+        lines += ["", "", "@dataclass", f"class {name}:"]
+        fields = entry.get("fields", [])
+        lines += [f"    {python_name(field['name'])}: {reflection.annotation(field['type'])}" for field in fields] or ["    pass"]
+        lines += ["", "", f"unreal_core.register_converter({name}, None, None, \"fields\")"]
+    return "\n".join(lines) + "\n"
+
+
+def render_package(reflection):
+    lines = [HEADER, "from ._enums import *", "from ._structs import *"]
+    lines += [f"from .{CLASSES_PACKAGE}.{name} import {name}" for name in sorted(reflection.classes)]
+    return "\n".join(lines) + "\n"
+
+
+def render_lazy_package(reflection):
+    """
+    classes are imported by the module __getattr__ on first access, importing the package only
+    reads the table of names
+    """
+    lines = [HEADER, "import importlib", "", "from ._enums import *", "from ._structs import *", "",
+             "_CLASSES = frozenset((", *[f"    {name!r}," for name in sorted(reflection.classes)], "))", "", "",
+             "def __getattr__(name):",
+             "    if name not in _CLASSES:",
+             "        raise AttributeError(f\"module {__name__!r} has no attribute {name!r}\")",
+             f"    value = getattr(importlib.import_module(\".{CLASSES_PACKAGE}.\" + name, __name__), name)",
+             "    globals()[name] = value",
+             "    return value",
+             "", "",
+             "def __dir__():",
+             "    return sorted(set(globals()) | _CLASSES)"]
+    return "\n".join(lines) + "\n"
+
+
+def synthetic_dump(count):
+    """
+    count actor classes under Object / Actor, to measure the bindings of a large engine without one
+    """
+    functions = [
+        {"name": "GetActorLocation", "params": [], "return": "Vector"},
+        {"name": "SetActorLocation", "params": [{"name": "NewLocation", "type": "Vector"}], "return": "bool"},
+    ]
+    classes = [
+        {"name": "Object", "parent": None, "interfaces": [], "properties": [], "functions": []},
+        {"name": "Actor", "parent": "Object", "interfaces": [], "properties": [{"name": "Tags", "type": "str"}],
+         "functions": functions},
+    ]
+    for i in range(count):
+        classes.append({"name": f"SyntheticActor{i}", "parent": "Actor", "interfaces": [],
+                        "properties": [{"name": "Health", "type": "float"}, {"name": "Level", "type": "int"}],
+                        "functions": [{"name": "Damage", "params": [{"name": "Amount", "type": "float"}], "return": "float"}]})
+    return {"classes": classes, "enums": [], "structs": []}
+
+
+def referenced_types(entry):
+    types = [entry.get("parent")] + [prop["type"] for prop in entry.get("properties", [])]
+    for function in entry.get("functions", []):
+        types += [param["type"] for param in function.get("params", [])] + [function.get("return")]
+    return sorted({type_name for type_name in types if type_name is not None})
+
+
+def plan_files(reflection, lazy):
+    """
+    (file name, dump hash, render) of every generated file, rendering is deferred so unchanged entries
+    cost only their hash
+    """
+    files = []
+    for name, entry in reflection.classes.items():
+        # a class module also depends on whether the types it refers to are classes, enums or structs
+        categories = [(type_name, reflection.category(type_name)) for type_name in referenced_types(entry)]
+        digest = entry_hash(entry, categories)
+        files.append((f"{CLASSES_PACKAGE}/{name}.py", digest, lambda entry=entry: render_class(reflection, entry)))
+        files.append((f"{CLASSES_PACKAGE}/{name}.pyi", digest, lambda entry=entry: render_class_stub(reflection, entry)))
+    files.append((f"{CLASSES_PACKAGE}/__init__.py", entry_hash(), lambda: HEADER))
+    files.append(("_enums.py", entry_hash(reflection.enums), lambda: render_enums(reflection)))
+    files.append(("_structs.py", entry_hash(reflection.structs, sorted(reflection.classes), sorted(reflection.enums)),
+                  lambda: render_structs(reflection)))
+    package_hash = entry_hash(sorted(reflection.classes))
+    files.append(("__init__.py", entry_hash(sorted(reflection.classes), lazy),
+                  lambda: render_lazy_package(reflection) if lazy else render_package(reflection)))
+    files.append(("__init__.pyi", package_hash, lambda: render_package(reflection)))
+    return files
+
+
+def generate(dump, out_dir, lazy=True):
+    """
+    write the bindings of dump into out_dir, returns (written, unchanged, removed) file counts.
+    lazy packages import a class module on first access of the class, eager ones all of them
+    """
+    os.makedirs(os.path.join(out_dir, CLASSES_PACKAGE), exist_ok=True)
+    manifest_path = os.path.join(out_dir, MANIFEST_NAME)
+    try:
+        with open(manifest_path, "r", encoding="utf-8") as manifest_file:
+            manifest = json.load(manifest_file)
+    except (OSError, ValueError):
+        manifest = {}
+
+    reflection = Reflection(dump)
+    written = unchanged = 0
+    new_manifest = {}
+    for file_name, digest, render in plan_files(reflection, lazy):
+        new_manifest[file_name] = digest
+        path = os.path.join(out_dir, file_name)
+        if manifest.get(file_name) == digest and os.path.exists(path):
+            unchanged += 1
+            continue
+        with open(path, "w", encoding="utf-8", newline="\n") as out_file:
+            out_file.write(render())
+        written += 1
+
+    removed = 0
+    for file_name in manifest:
+        if file_name not in new_manifest and os.path.exists(os.path.join(out_dir, file_name)):
+            os.remove(os.path.join(out_dir, file_name))
+            removed += 1
+
+    with open(manifest_path, "w", encoding="utf-8") as manifest_file:
+        json.dump(new_manifest, manifest_file, indent=0, sort_keys=True)
+    return written, unchanged, removed
+
+
+def load_dump(path, synthetic):
+    if synthetic is not None:
+        return synthetic_dump(synthetic)
+    if path is not None:
+        with open(path, "r", encoding="utf-8") as dump_file:
+            return json.load(dump_file)
+    import unreal_core
+    return json.loads(unreal_core.dump_reflection())
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Generate python bindings from a reflection dump")
+    parser.add_argument("out_dir", help="package directory to generate")
+    parser.add_argument("--dump", help="reflection dump JSON file, asks the server when omitted")
+    parser.add_argument("--synthetic", type=int, metavar="N", help="generate N synthetic actor classes instead of a dump")
+    parser.add_argument("--eager", action="store_true", help="import every class with the package")
+    options = parser.parse_args(argv)
+
+    written, unchanged, removed = generate(load_dump(options.dump, options.synthetic), options.out_dir, not options.eager)
+    print(f"{written} written, {unchanged} unchanged, {removed} removed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -54,6 +54,12 @@ else:  # Linux and macOS
         '-fexceptions'  # Enable exception handling
     ])
 
+# UNREAL_CORE_TESTING=1 also builds the in-process stand-in server that tests/ and the benchmarks run against,
+# release builds leave it out
+define_macros = []
+if os.environ.get("UNREAL_CORE_TESTING"):
+    define_macros.append(("UNREAL_CORE_TESTING", "1"))
+
 # Define the extension module
 unreal_core = Extension(
     'unreal_core',
@@ -62,6 +68,7 @@ unreal_core = Extension(
     library_dirs=library_dirs,
     libraries=libraries,
     extra_compile_args=extra_compile_args,
+    define_macros=define_macros,
     language='c++'
 )
 
@@ -70,5 +77,7 @@ setup(
     name='unreal_core',
     version='0.0.1',
     description='Python bindings for Unreal Core rpc framework',
-    ext_modules=[unreal_core]
+    ext_modules=[unreal_core],
+    # C API for compiled extensions, see unreal_core_capi.h
+    headers=['unreal_core_capi.h']
 )
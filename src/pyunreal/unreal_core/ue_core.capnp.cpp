@@ -5,7 +5,7 @@
 
 namespace capnp {
 namespace schemas {
-static const ::capnp::_::AlignedData<246> b_8e1737faadc1c8be = {
+static const ::capnp::_::AlignedData<321> b_8e1737faadc1c8be = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
     190, 200, 193, 173, 250,  55,  23, 142,
      14,   0,   0,   0,   3,   0,   0,   0,
@@ -13,183 +13,244 @@ static const ::capnp::_::AlignedData<246> b_8e1737faadc1c8be = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      21,   0,   0,   0, 202,   0,   0,   0,
-     33,   0,   0,   0, 103,   0,   0,   0,
+     33,   0,   0,   0, 231,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117,   0,   0,   0, 135,   4,   0,   0,
-    169,   3,   0,   0,   7,   0,   0,   0,
+    233,   0,   0,   0, 135,   5,   0,   0,
+    213,   4,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
       0,   0,   0,   0,   0,   0,   0,   0,
-     24,   0,   0,   0,   1,   0,   1,   0,
+     56,   0,   0,   0,   1,   0,   1,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
-     41,   0,   0,   0,  58,   0,   0,   0,
+    105,   0,   0,   0,  58,   0,   0,   0,
     189, 192, 116, 130,  96,   6, 166, 189,
-     37,   0,   0,   0,  50,   0,   0,   0,
+    101,   0,   0,   0,  50,   0,   0,   0,
+     39,  86, 187,  56, 193, 172, 164, 253,
+     97,   0,   0,   0,  74,   0,   0,   0,
+    170, 156, 116, 160, 161, 248,   2, 249,
+     97,   0,   0,   0,  58,   0,   0,   0,
+    180, 164, 112,  74, 115, 100,  60, 231,
+     93,   0,   0,   0,  66,   0,   0,   0,
+    247, 148, 139, 120, 146, 248, 241, 194,
+     89,   0,   0,   0,  42,   0,   0,   0,
+    214, 240,  52,  47, 153,  19, 192, 166,
+     85,   0,   0,   0,  82,   0,   0,   0,
     230, 193, 195, 135, 232,  92,  60, 165,
-     33,   0,   0,   0,  74,   0,   0,   0,
+     85,   0,   0,   0,  74,   0,   0,   0,
+    125, 141, 156, 158,  58, 162,  28, 212,
+     85,   0,   0,   0,  98,   0,   0,   0,
+     19, 233, 138,   9, 123,   5,  34, 194,
+     85,   0,   0,   0,  82,   0,   0,   0,
+    232, 232, 226,   1, 144,  88, 140, 170,
+     85,   0,   0,   0, 106,   0,   0,   0,
      54, 231, 165,  52, 216, 119,  45, 143,
-     33,   0,   0,   0,  58,   0,   0,   0,
+     85,   0,   0,   0,  58,   0,   0,   0,
     151, 226, 117, 205,  18, 158, 110, 164,
-     29,   0,   0,   0, 122,   0,   0,   0,
+     81,   0,   0,   0, 122,   0,   0,   0,
     255, 207,  40,  47, 243, 127, 123, 158,
-     29,   0,   0,   0, 138,   0,   0,   0,
+     81,   0,   0,   0, 138,   0,   0,   0,
      79,  98, 106, 101,  99, 116,   0,   0,
      67, 108,  97, 115, 115,   0,   0,   0,
+     86, 101,  99, 116, 111, 114,  50,  68,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     86, 101,  99, 116, 111, 114,   0,   0,
+     82, 111, 116,  97, 116, 111, 114,   0,
+     81, 117,  97, 116,   0,   0,   0,   0,
+     84, 114,  97, 110, 115, 102, 111, 114,
+    109,   0,   0,   0,   0,   0,   0,   0,
      65, 114, 103, 117, 109, 101, 110, 116,
       0,   0,   0,   0,   0,   0,   0,   0,
+     83, 116, 114, 117,  99, 116,  86,  97,
+    108, 117, 101,   0,   0,   0,   0,   0,
+     80,  97,  99, 107, 101, 100,  84,  97,
+    103,   0,   0,   0,   0,   0,   0,   0,
+     80,  97,  99, 107, 101, 100,  80,  97,
+    114,  97, 109, 115,   0,   0,   0,   0,
      77, 101, 116, 104, 111, 100,   0,   0,
      77, 101, 116, 104, 111, 100,  67,  97,
     108, 108,  97,  98, 108, 101,   0,   0,
      68, 101, 108, 101, 103,  97, 116, 101,
      67,  97, 108, 108,  98,  97,  99, 107,
       0,   0,   0,   0,   0,   0,   0,   0,
-     72,   0,   0,   0,   3,   0,   5,   0,
+     88,   0,   0,   0,   3,   0,   5,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     135, 140, 225, 156, 144,  40,  48, 233,
     144,  21,  81,  96,  37, 115, 174, 232,
-     49,   2,   0,   0,  82,   0,   0,   0,
+    177,   2,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   2,   0,   0,   7,   0,   0,   0,
+    169,   2,   0,   0,   7,   0,   0,   0,
       1,   0,   0,   0,   0,   0,   0,   0,
      69,  26, 239,  22,  23,  99,  63, 216,
     144,  81,  96, 209, 212, 141,  54, 155,
-     29,   2,   0,   0, 114,   0,   0,   0,
+    157,   2,   0,   0, 114,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   2,   0,   0,   7,   0,   0,   0,
+    149,   2,   0,   0,   7,   0,   0,   0,
       2,   0,   0,   0,   0,   0,   0,   0,
     136, 130, 123, 175, 219, 142, 135, 251,
     134, 126, 122, 191, 203, 105, 226, 193,
-      9,   2,   0,   0, 106,   0,   0,   0,
+    137,   2,   0,   0, 106,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   2,   0,   0,   7,   0,   0,   0,
+    129,   2,   0,   0,   7,   0,   0,   0,
       3,   0,   0,   0,   0,   0,   0,   0,
     144, 176, 252, 206, 228,  16, 132, 215,
     169,  66,   3,  76, 147, 215, 116, 232,
-    245,   1,   0,   0, 154,   0,   0,   0,
+    117,   2,   0,   0, 154,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    241,   1,   0,   0,   7,   0,   0,   0,
+    113,   2,   0,   0,   7,   0,   0,   0,
       4,   0,   0,   0,   0,   0,   0,   0,
      15, 239, 178,  82,  89, 116,  26, 237,
     242, 107,  23,  87, 132,  28, 228, 229,
-    229,   1,   0,   0,  82,   0,   0,   0,
+    101,   2,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    221,   1,   0,   0,   7,   0,   0,   0,
+     93,   2,   0,   0,   7,   0,   0,   0,
       5,   0,   0,   0,   0,   0,   0,   0,
     125, 163, 252,  13,  11, 175, 192, 243,
     221, 189,  43, 220, 252, 121, 191, 154,
-    209,   1,   0,   0,  82,   0,   0,   0,
+     81,   2,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    201,   1,   0,   0,   7,   0,   0,   0,
+     73,   2,   0,   0,   7,   0,   0,   0,
       6,   0,   0,   0,   0,   0,   0,   0,
     242,  88, 215,  12, 225, 109,  42, 183,
      79, 211,  74, 145, 188, 197, 243, 204,
-    189,   1,   0,   0,  98,   0,   0,   0,
+     61,   2,   0,   0,  98,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    181,   1,   0,   0,   7,   0,   0,   0,
+     53,   2,   0,   0,   7,   0,   0,   0,
       7,   0,   0,   0,   0,   0,   0,   0,
     191, 166, 155, 158,  38,  38, 255, 239,
      64, 198, 169, 190, 129, 140,  73, 223,
-    169,   1,   0,   0, 106,   0,   0,   0,
+     41,   2,   0,   0, 106,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    161,   1,   0,   0,   7,   0,   0,   0,
+     33,   2,   0,   0,   7,   0,   0,   0,
       8,   0,   0,   0,   0,   0,   0,   0,
     239,  84,  56,  20, 158, 127, 185, 147,
      65,  11, 104, 101,  85, 166, 176, 232,
-    149,   1,   0,   0, 122,   0,   0,   0,
+     21,   2,   0,   0, 122,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    141,   1,   0,   0,   7,   0,   0,   0,
+     13,   2,   0,   0,   7,   0,   0,   0,
       9,   0,   0,   0,   0,   0,   0,   0,
     222,  30, 116, 115,  95, 130, 161, 240,
     110, 125, 138, 169, 171, 134,  40, 187,
-    129,   1,   0,   0, 138,   0,   0,   0,
+      1,   2,   0,   0, 138,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    125,   1,   0,   0,   7,   0,   0,   0,
+    253,   1,   0,   0,   7,   0,   0,   0,
      10,   0,   0,   0,   0,   0,   0,   0,
     150,   8, 167, 183,  60,  87, 150, 229,
      83, 102, 194,  47, 170, 184,  36, 245,
-    113,   1,   0,   0, 162,   0,   0,   0,
+    241,   1,   0,   0, 162,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    109,   1,   0,   0,   7,   0,   0,   0,
+    237,   1,   0,   0,   7,   0,   0,   0,
      11,   0,   0,   0,   0,   0,   0,   0,
      37,  94,  69, 198, 227, 212, 169, 225,
      71,  46,  10,   1, 237,  54, 248, 216,
-     97,   1,   0,   0, 178,   0,   0,   0,
+    225,   1,   0,   0, 178,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     93,   1,   0,   0,   7,   0,   0,   0,
+    221,   1,   0,   0,   7,   0,   0,   0,
      12,   0,   0,   0,   0,   0,   0,   0,
      87, 124, 203, 132, 140, 110,  79, 216,
     250,  83, 212,  86, 255,  16, 145, 177,
-     81,   1,   0,   0, 194,   0,   0,   0,
+    209,   1,   0,   0, 194,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     77,   1,   0,   0,   7,   0,   0,   0,
+    205,   1,   0,   0,   7,   0,   0,   0,
      13,   0,   0,   0,   0,   0,   0,   0,
     130, 130,   9, 137,   1, 136, 141, 185,
      91, 167, 165, 223,  66,  88, 226, 167,
-     65,   1,   0,   0,  98,   0,   0,   0,
+    193,   1,   0,   0,  98,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     57,   1,   0,   0,   7,   0,   0,   0,
+    185,   1,   0,   0,   7,   0,   0,   0,
      14,   0,   0,   0,   0,   0,   0,   0,
      75, 134,  48, 157, 107, 236, 231, 227,
     174, 255,  36, 237, 112,  74,  73, 255,
-     45,   1,   0,   0,  98,   0,   0,   0,
+    173,   1,   0,   0,  98,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   1,   0,   0,   7,   0,   0,   0,
+    165,   1,   0,   0,   7,   0,   0,   0,
      15,   0,   0,   0,   0,   0,   0,   0,
      50,  25, 100,  93,  84,  84, 204, 149,
     160, 127, 243, 190, 147,  18,   5, 146,
-     25,   1,   0,   0, 194,   0,   0,   0,
+    153,   1,   0,   0, 194,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   1,   0,   0,   7,   0,   0,   0,
+    149,   1,   0,   0,   7,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     242,  62, 207, 245,  52, 224, 242, 165,
     192, 209, 130,  64,   8, 204, 127, 174,
-      9,   1,   0,   0, 106,   0,   0,   0,
+    137,   1,   0,   0, 106,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   1,   0,   0,   7,   0,   0,   0,
+    129,   1,   0,   0,   7,   0,   0,   0,
      17,   0,   0,   0,   0,   0,   0,   0,
      39,  88, 176,  40, 126,  58,  32, 153,
     125, 122, 217, 106, 198, 158,  16, 191,
-    245,   0,   0,   0, 138,   0,   0,   0,
+    117,   1,   0,   0, 138,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    113,   1,   0,   0,   7,   0,   0,   0,
+     18,   0,   0,   0,   0,   0,   0,   0,
+    221,  73, 183,  95,  28,  23, 196, 244,
+     94,  46, 185, 189, 177, 250, 114, 216,
+    101,   1,   0,   0, 154,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     97,   1,   0,   0,   7,   0,   0,   0,
+     19,   0,   0,   0,   0,   0,   0,   0,
+     81, 201,  18, 215,  41, 231, 245, 209,
+    121, 160,  35, 176, 164,  40, 106, 221,
+     85,   1,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   1,   0,   0,   7,   0,   0,   0,
+     20,   0,   0,   0,   0,   0,   0,   0,
+     27,  99, 148, 112,  28, 118, 230, 192,
+     24, 199,  99, 129,  30,  48,  89, 217,
+     65,   1,   0,   0, 122,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     57,   1,   0,   0,   7,   0,   0,   0,
+     21,   0,   0,   0,   0,   0,   0,   0,
+    236,  93, 236, 196,  69,  44, 117, 132,
+    165,  80, 235, 180, 145, 172, 250, 250,
+     45,   1,   0,   0, 146,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    241,   0,   0,   0,   7,   0,   0,   0,
+     41,   1,   0,   0,   7,   0,   0,   0,
     110, 101, 119,  79,  98, 106, 101,  99,
     116,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   1,   0,
@@ -251,11 +312,26 @@ static const ::capnp::_::AlignedData<246> b_8e1737faadc1c8be = {
     111, 110, 116,  97, 105, 110, 101, 114,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   1,   0,
+     99,  97, 108, 108,  70, 117, 110,  99,
+    116, 105, 111, 110,  80,  97,  99, 107,
+    101, 100,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    103, 101, 116,  70, 101,  97, 116, 117,
+    114, 101, 115,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    100, 117, 109, 112,  82, 101, 102, 108,
+    101,  99, 116, 105, 111, 110,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    103, 101, 116,  67, 108,  97, 115, 115,
+     72, 105, 101, 114,  97, 114,  99, 104,
+    121,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
       0,   0,   0,   0,   1,   0,   1,   0, }
 };
 ::capnp::word const* const bp_8e1737faadc1c8be = b_8e1737faadc1c8be.words;
 #if !CAPNP_LITE
 static const ::capnp::_::RawSchema* const d_8e1737faadc1c8be[] = {
+  &s_84752c45c4ec5dec,
   &s_92051293bef37fa0,
   &s_93b97f9e143854ef,
   &s_95cc54545d641932,
@@ -270,12 +346,17 @@ static const ::capnp::_::RawSchema* const d_8e1737faadc1c8be[] = {
   &s_b98d880189098282,
   &s_bb2886aba98a7d6e,
   &s_bf109ec66ad97a7d,
+  &s_c0e6761c7094631b,
   &s_c1e269cbbf7a7e86,
   &s_ccf3c5bc914ad34f,
+  &s_d1f5e729d712c951,
   &s_d78410e4cefcb090,
   &s_d83f631716ef1a45,
   &s_d84f6e8c84cb7c57,
+  &s_d872fab1bdb92e5e,
   &s_d8f836ed010a2e47,
+  &s_d959301e8163c718,
+  &s_dd6a28a4b023a079,
   &s_df498c81bea9c640,
   &s_e1a9d4e3c6455e25,
   &s_e3e7ec6b9d30864b,
@@ -289,14 +370,16 @@ static const ::capnp::_::RawSchema* const d_8e1737faadc1c8be[] = {
   &s_efff26269e9ba6bf,
   &s_f0a1825f73741ede,
   &s_f3c0af0b0dfca37d,
+  &s_f4c4171c5fb749dd,
   &s_f524b8aa2fc26653,
+  &s_fafaac91b4eb50a5,
   &s_fb878edbaf7b8288,
   &s_ff494a70ed24ffae,
 };
-static const uint16_t m_8e1737faadc1c8be[] = {9, 7, 2, 3, 17, 1, 4, 14, 5, 16, 0, 15, 11, 10, 13, 6, 8, 12};
+static const uint16_t m_8e1737faadc1c8be[] = {9, 7, 2, 18, 3, 17, 1, 20, 4, 21, 19, 14, 5, 16, 0, 15, 11, 10, 13, 6, 8, 12};
 const ::capnp::_::RawSchema s_8e1737faadc1c8be = {
-  0x8e1737faadc1c8be, b_8e1737faadc1c8be.words, 246, d_8e1737faadc1c8be, m_8e1737faadc1c8be,
-  36, 18, nullptr, nullptr, nullptr, { &s_8e1737faadc1c8be, nullptr, nullptr, 0, 0, nullptr }, false
+  0x8e1737faadc1c8be, b_8e1737faadc1c8be.words, 321, d_8e1737faadc1c8be, m_8e1737faadc1c8be,
+  44, 22, nullptr, nullptr, nullptr, { &s_8e1737faadc1c8be, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
 static const ::capnp::_::AlignedData<48> b_bbbd9ab104716176 = {
@@ -403,143 +486,182 @@ const ::capnp::_::RawSchema s_bda606608274c0bd = {
   0, 1, i_bda606608274c0bd, nullptr, nullptr, { &s_bda606608274c0bd, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<160> b_a53c5ce887c3c1e6 = {
+static const ::capnp::_::AlignedData<49> b_fda4acc138bb5627 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+     39,  86, 187,  56, 193, 172, 164, 253,
      25,   0,   0,   0,   1,   0,   2,   0,
     190, 200, 193, 173, 250,  55,  23, 142,
-      3,   0,   7,   0,   0,   0,   7,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
      21,   0,   0,   0,  18,   1,   0,   0,
      37,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 255,   1,   0,   0,
+     33,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  65, 114, 103, 117, 109, 101, 110,
-    116,   0,   0,   0,   0,   0,   0,   0,
+     46,  86, 101,  99, 116, 111, 114,  50,
+     68,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   1,   0,   1,   0,
-     36,   0,   0,   0,   3,   0,   4,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    237,   0,   0,   0,  66,   0,   0,   0,
+     41,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    232,   0,   0,   0,   3,   0,   1,   0,
-    244,   0,   0,   0,   2,   0,   1,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    241,   0,   0,   0,  42,   0,   0,   0,
+     45,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    236,   0,   0,   0,   3,   0,   1,   0,
-    248,   0,   0,   0,   2,   0,   1,   0,
-      2,   0, 255, 255,   0,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+    120,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    245,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    244,   0,   0,   0,   3,   0,   1,   0,
-      0,   1,   0,   0,   2,   0,   1,   0,
-      3,   0, 254, 255,   1,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    253,   0,   0,   0,  82,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    252,   0,   0,   0,   3,   0,   1,   0,
-      8,   1,   0,   0,   2,   0,   1,   0,
-      4,   0, 253, 255,   1,   0,   0,   0,
-      0,   0,   1,   0,   4,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   1,   0,   0,  74,   0,   0,   0,
+    121,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      4,   1,   0,   0,   3,   0,   1,   0,
-     16,   1,   0,   0,   2,   0,   1,   0,
-      5,   0, 252, 255,   2,   0,   0,   0,
-      0,   0,   1,   0,   5,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   1,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   1,   0,   0,   3,   0,   1,   0,
-     24,   1,   0,   0,   2,   0,   1,   0,
-      6,   0, 251, 255,   1,   0,   0,   0,
-      0,   0,   1,   0,   6,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   1,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_fda4acc138bb5627 = b_fda4acc138bb5627.words;
+#if !CAPNP_LITE
+static const uint16_t m_fda4acc138bb5627[] = {0, 1};
+static const uint16_t i_fda4acc138bb5627[] = {0, 1};
+const ::capnp::_::RawSchema s_fda4acc138bb5627 = {
+  0xfda4acc138bb5627, b_fda4acc138bb5627.words, 49, nullptr, m_fda4acc138bb5627,
+  0, 2, i_fda4acc138bb5627, nullptr, nullptr, { &s_fda4acc138bb5627, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<63> b_f902f8a1a0749caa = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    170, 156, 116, 160, 161, 248,   2, 249,
+     25,   0,   0,   0,   1,   0,   3,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     20,   1,   0,   0,   3,   0,   1,   0,
-     32,   1,   0,   0,   2,   0,   1,   0,
-      7,   0, 250, 255,   2,   0,   0,   0,
-      0,   0,   1,   0,   7,   0,   0,   0,
+     21,   0,   0,   0,   2,   1,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     29,   1,   0,   0,  58,   0,   0,   0,
+     29,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     24,   1,   0,   0,   3,   0,   1,   0,
-     36,   1,   0,   0,   2,   0,   1,   0,
-      8,   0, 249, 255,   1,   0,   0,   0,
-      0,   0,   1,   0,   8,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   1,   0,   0,  82,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  86, 101,  99, 116, 111, 114,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     32,   1,   0,   0,   3,   0,   1,   0,
-     44,   1,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     73,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    110,  97, 109, 101,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     72,   0,   0,   0,   3,   0,   1,   0,
+     84,   0,   0,   0,   2,   0,   1,   0,
+    120,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     98, 111, 111, 108,  86,  97, 108, 117,
-    101,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    121,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 105, 110, 116,  86,  97, 108, 117,
-    101,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    122,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    105, 110, 116,  86,  97, 108, 117, 101,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_f902f8a1a0749caa = b_f902f8a1a0749caa.words;
+#if !CAPNP_LITE
+static const uint16_t m_f902f8a1a0749caa[] = {0, 1, 2};
+static const uint16_t i_f902f8a1a0749caa[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_f902f8a1a0749caa = {
+  0xf902f8a1a0749caa, b_f902f8a1a0749caa.words, 63, nullptr, m_f902f8a1a0749caa,
+  0, 3, i_f902f8a1a0749caa, nullptr, nullptr, { &s_f902f8a1a0749caa, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<64> b_e73c64734a70a4b4 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    180, 164, 112,  74, 115, 100,  60, 231,
+     25,   0,   0,   0,   1,   0,   3,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  10,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  82, 111, 116,  97, 116, 111, 114,
       0,   0,   0,   0,   0,   0,   0,   0,
-    115, 116, 114,  86,  97, 108, 117, 101,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     73,   0,   0,   0,  34,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  42,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    102, 108, 111,  97, 116,  86,  97, 108,
-    117, 101,   0,   0,   0,   0,   0,   0,
+     72,   0,   0,   0,   3,   0,   1,   0,
+     84,   0,   0,   0,   2,   0,   1,   0,
+    112, 105, 116,  99, 104,   0,   0,   0,
      11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -547,267 +669,1588 @@ static const ::capnp::_::AlignedData<160> b_a53c5ce887c3c1e6 = {
      11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    121,  97, 119,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    101, 110, 117, 109,  86,  97, 108, 117,
-    101,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    114, 111, 108, 108,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_a53c5ce887c3c1e6 = b_a53c5ce887c3c1e6.words;
+::capnp::word const* const bp_e73c64734a70a4b4 = b_e73c64734a70a4b4.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_a53c5ce887c3c1e6[] = {
-  &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_a53c5ce887c3c1e6[] = {2, 8, 6, 4, 1, 7, 5, 0, 3};
-static const uint16_t i_a53c5ce887c3c1e6[] = {2, 3, 4, 5, 6, 7, 8, 0, 1};
-const ::capnp::_::RawSchema s_a53c5ce887c3c1e6 = {
-  0xa53c5ce887c3c1e6, b_a53c5ce887c3c1e6.words, 160, d_a53c5ce887c3c1e6, m_a53c5ce887c3c1e6,
-  2, 9, i_a53c5ce887c3c1e6, nullptr, nullptr, { &s_a53c5ce887c3c1e6, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_e73c64734a70a4b4[] = {0, 2, 1};
+static const uint16_t i_e73c64734a70a4b4[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_e73c64734a70a4b4 = {
+  0xe73c64734a70a4b4, b_e73c64734a70a4b4.words, 64, nullptr, m_e73c64734a70a4b4,
+  0, 3, i_e73c64734a70a4b4, nullptr, nullptr, { &s_e73c64734a70a4b4, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<33> b_8f2d77d834a5e736 = {
+static const ::capnp::_::AlignedData<78> b_c2f1f892788b94f7 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     54, 231, 165,  52, 216, 119,  45, 143,
-     25,   0,   0,   0,   1,   0,   0,   0,
+    247, 148, 139, 120, 146, 248, 241, 194,
+     25,   0,   0,   0,   1,   0,   4,   0,
     190, 200, 193, 173, 250,  55,  23, 142,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,   2,   1,   0,   0,
+     21,   0,   0,   0, 242,   0,   0,   0,
      33,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     29,   0,   0,   0,  63,   0,   0,   0,
+     29,   0,   0,   0, 231,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  77, 101, 116, 104, 111, 100,   0,
+     46,  81, 117,  97, 116,   0,   0,   0,
       0,   0,   0,   0,   1,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     16,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  42,   0,   0,   0,
+     97,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    110,  97, 109, 101,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     92,   0,   0,   0,   3,   0,   1,   0,
+    104,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101,   0,   0,   0,  18,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     96,   0,   0,   0,   3,   0,   1,   0,
+    108,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    105,   0,   0,   0,  18,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,   0,   0,   0,   3,   0,   1,   0,
+    112,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    109,   0,   0,   0,  18,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    104,   0,   0,   0,   3,   0,   1,   0,
+    116,   0,   0,   0,   2,   0,   1,   0,
+    120,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    121,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    122,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    119,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_8f2d77d834a5e736 = b_8f2d77d834a5e736.words;
+::capnp::word const* const bp_c2f1f892788b94f7 = b_c2f1f892788b94f7.words;
 #if !CAPNP_LITE
-static const uint16_t m_8f2d77d834a5e736[] = {0};
-static const uint16_t i_8f2d77d834a5e736[] = {0};
-const ::capnp::_::RawSchema s_8f2d77d834a5e736 = {
-  0x8f2d77d834a5e736, b_8f2d77d834a5e736.words, 33, nullptr, m_8f2d77d834a5e736,
-  0, 1, i_8f2d77d834a5e736, nullptr, nullptr, { &s_8f2d77d834a5e736, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_c2f1f892788b94f7[] = {3, 0, 1, 2};
+static const uint16_t i_c2f1f892788b94f7[] = {0, 1, 2, 3};
+const ::capnp::_::RawSchema s_c2f1f892788b94f7 = {
+  0xc2f1f892788b94f7, b_c2f1f892788b94f7.words, 78, nullptr, m_c2f1f892788b94f7,
+  0, 4, i_c2f1f892788b94f7, nullptr, nullptr, { &s_c2f1f892788b94f7, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<30> b_a46e9e12cd75e297 = {
+static const ::capnp::_::AlignedData<66> b_a6c013992f34f0d6 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    151, 226, 117, 205,  18, 158, 110, 164,
-     25,   0,   0,   0,   3,   0,   0,   0,
+    214, 240,  52,  47, 153,  19, 192, 166,
+     25,   0,   0,   0,   1,   0,   0,   0,
     190, 200, 193, 173, 250,  55,  23, 142,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  66,   1,   0,   0,
+     21,   0,   0,   0,  26,   1,   0,   0,
      37,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  71,   0,   0,   0,
-     73,   0,   0,   0,   7,   0,   0,   0,
+     33,   0,   0,   0, 175,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  77, 101, 116, 104, 111, 100,  67,
-     97, 108, 108,  97,  98, 108, 101,   0,
+     46,  84, 114,  97, 110, 115, 102, 111,
+    114, 109,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   1,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   5,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111, 163,  28,  39, 195, 204,  83, 136,
-    109, 223,  57, 101,  28, 220,  54, 168,
-     17,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   7,   0,   0,   0,
-    105, 110, 118, 111, 107, 101,   0,   0,
-      0,   0,   0,   0,   0,   0,   1,   0,
-      0,   0,   0,   0,   1,   0,   1,   0, }
-};
-::capnp::word const* const bp_a46e9e12cd75e297 = b_a46e9e12cd75e297.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_a46e9e12cd75e297[] = {
+     77,   0,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     85,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     80,   0,   0,   0,   3,   0,   1,   0,
+     92,   0,   0,   0,   2,   0,   1,   0,
+    114, 111, 116,  97, 116, 105, 111, 110,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    247, 148, 139, 120, 146, 248, 241, 194,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    116, 114,  97, 110, 115, 108,  97, 116,
+    105, 111, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    170, 156, 116, 160, 161, 248,   2, 249,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115,  99,  97, 108, 101,  51,  68,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    170, 156, 116, 160, 161, 248,   2, 249,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_a6c013992f34f0d6 = b_a6c013992f34f0d6.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_a6c013992f34f0d6[] = {
+  &s_c2f1f892788b94f7,
+  &s_f902f8a1a0749caa,
+};
+static const uint16_t m_a6c013992f34f0d6[] = {0, 2, 1};
+static const uint16_t i_a6c013992f34f0d6[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_a6c013992f34f0d6 = {
+  0xa6c013992f34f0d6, b_a6c013992f34f0d6.words, 66, d_a6c013992f34f0d6, m_a6c013992f34f0d6,
+  2, 3, i_a6c013992f34f0d6, nullptr, nullptr, { &s_a6c013992f34f0d6, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<368> b_a53c5ce887c3c1e6 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+     25,   0,   0,   0,   1,   0,   2,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      3,   0,   7,   0,   0,   0,  19,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  18,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0, 159,   4,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  65, 114, 103, 117, 109, 101, 110,
+    116,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     84,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     61,   2,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     56,   2,   0,   0,   3,   0,   1,   0,
+     68,   2,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     65,   2,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     60,   2,   0,   0,   3,   0,   1,   0,
+     72,   2,   0,   0,   2,   0,   1,   0,
+      2,   0, 255, 255,   0,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     69,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     68,   2,   0,   0,   3,   0,   1,   0,
+     80,   2,   0,   0,   2,   0,   1,   0,
+      3,   0, 254, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   2,   0,   0,   3,   0,   1,   0,
+     88,   2,   0,   0,   2,   0,   1,   0,
+      4,   0, 253, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     85,   2,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     84,   2,   0,   0,   3,   0,   1,   0,
+     96,   2,   0,   0,   2,   0,   1,   0,
+      5,   0, 252, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,   5,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     93,   2,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     92,   2,   0,   0,   3,   0,   1,   0,
+    104,   2,   0,   0,   2,   0,   1,   0,
+      6,   0, 251, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   6,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101,   2,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,   2,   0,   0,   3,   0,   1,   0,
+    112,   2,   0,   0,   2,   0,   1,   0,
+      7,   0, 250, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    109,   2,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    104,   2,   0,   0,   3,   0,   1,   0,
+    116,   2,   0,   0,   2,   0,   1,   0,
+      8,   0, 249, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   8,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    113,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,   2,   0,   0,   3,   0,   1,   0,
+    124,   2,   0,   0,   2,   0,   1,   0,
+      9,   0, 248, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,   9,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    121,   2,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    120,   2,   0,   0,   3,   0,   1,   0,
+    148,   2,   0,   0,   2,   0,   1,   0,
+     10,   0, 247, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  10,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    145,   2,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    144,   2,   0,   0,   3,   0,   1,   0,
+    172,   2,   0,   0,   2,   0,   1,   0,
+     11,   0, 246, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  11,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    169,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    168,   2,   0,   0,   3,   0,   1,   0,
+    196,   2,   0,   0,   2,   0,   1,   0,
+     12,   0, 245, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  12,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    193,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    192,   2,   0,   0,   3,   0,   1,   0,
+    220,   2,   0,   0,   2,   0,   1,   0,
+     13,   0, 244, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  13,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    217,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    216,   2,   0,   0,   3,   0,   1,   0,
+    228,   2,   0,   0,   2,   0,   1,   0,
+     14,   0, 243, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  14,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    225,   2,   0,   0, 114,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    224,   2,   0,   0,   3,   0,   1,   0,
+    236,   2,   0,   0,   2,   0,   1,   0,
+     15,   0, 242, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  15,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    233,   2,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    232,   2,   0,   0,   3,   0,   1,   0,
+    244,   2,   0,   0,   2,   0,   1,   0,
+     16,   0, 241, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  16,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    241,   2,   0,   0, 106,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    240,   2,   0,   0,   3,   0,   1,   0,
+    252,   2,   0,   0,   2,   0,   1,   0,
+     17,   0, 240, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  17,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    249,   2,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    248,   2,   0,   0,   3,   0,   1,   0,
+      4,   3,   0,   0,   2,   0,   1,   0,
+     18,   0, 239, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  18,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   3,   0,   0, 122,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   3,   0,   0,   3,   0,   1,   0,
+     12,   3,   0,   0,   2,   0,   1,   0,
+     19,   0, 238, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  19,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   3,   0,   0, 114,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   3,   0,   0,   3,   0,   1,   0,
+     20,   3,   0,   0,   2,   0,   1,   0,
+     20,   0, 237, 255,   2,   0,   0,   0,
+      0,   0,   1,   0,  20,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     17,   3,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   3,   0,   0,   3,   0,   1,   0,
+     28,   3,   0,   0,   2,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110,  97, 109, 101,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     98, 111, 111, 108,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 105, 110, 116,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116,  86,  97, 108, 117, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 116, 114,  86,  97, 108, 117, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108, 111,  97, 116,  86,  97, 108,
+    117, 101,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 110, 117, 109,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108, 111,  97, 116,  51,  50,  76,
+    105, 115, 116,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     10,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108, 111,  97, 116,  54,  52,  76,
+    105, 115, 116,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116,  51,  50,  76, 105, 115,
+    116,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+      4,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116,  54,  52,  76, 105, 115,
+    116,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,  97, 116,  97,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    118, 101,  99, 116, 111, 114,  50,  68,
+     86,  97, 108, 117, 101,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     39,  86, 187,  56, 193, 172, 164, 253,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    118, 101,  99, 116, 111, 114,  86,  97,
+    108, 117, 101,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    170, 156, 116, 160, 161, 248,   2, 249,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    114, 111, 116,  97, 116, 111, 114,  86,
+     97, 108, 117, 101,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    180, 164, 112,  74, 115, 100,  60, 231,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    113, 117,  97, 116,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    247, 148, 139, 120, 146, 248, 241, 194,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    116, 114,  97, 110, 115, 102, 111, 114,
+    109,  86,  97, 108, 117, 101,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    214, 240,  52,  47, 153,  19, 192, 166,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 116, 114,  85, 116, 102,  49,  54,
+     86,  97, 108, 117, 101,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 116, 114, 117,  99, 116,  86,  97,
+    108, 117, 101,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    125, 141, 156, 158,  58, 162,  28, 212,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_a53c5ce887c3c1e6 = b_a53c5ce887c3c1e6.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_a53c5ce887c3c1e6[] = {
+  &s_a6c013992f34f0d6,
+  &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
+  &s_c2f1f892788b94f7,
+  &s_d41ca23a9e9c8d7d,
+  &s_e73c64734a70a4b4,
+  &s_f902f8a1a0749caa,
+  &s_fda4acc138bb5627,
+};
+static const uint16_t m_a53c5ce887c3c1e6[] = {2, 13, 8, 9, 10, 6, 11, 12, 4, 1, 7, 17, 16, 19, 5, 20, 18, 0, 3, 14, 15};
+static const uint16_t i_a53c5ce887c3c1e6[] = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 1};
+const ::capnp::_::RawSchema s_a53c5ce887c3c1e6 = {
+  0xa53c5ce887c3c1e6, b_a53c5ce887c3c1e6.words, 368, d_a53c5ce887c3c1e6, m_a53c5ce887c3c1e6,
+  8, 21, i_a53c5ce887c3c1e6, nullptr, nullptr, { &s_a53c5ce887c3c1e6, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<54> b_d41ca23a9e9c8d7d = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    125, 141, 156, 158,  58, 162,  28, 212,
+     25,   0,   0,   0,   1,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  42,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  83, 116, 114, 117,  99, 116,  86,
+     97, 108, 117, 101,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     41,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     49,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     72,   0,   0,   0,   2,   0,   1,   0,
+    116, 121, 112, 101,  78,  97, 109, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 105, 101, 108, 100, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_d41ca23a9e9c8d7d = b_d41ca23a9e9c8d7d.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_d41ca23a9e9c8d7d[] = {
+  &s_a53c5ce887c3c1e6,
+};
+static const uint16_t m_d41ca23a9e9c8d7d[] = {1, 0};
+static const uint16_t i_d41ca23a9e9c8d7d[] = {0, 1};
+const ::capnp::_::RawSchema s_d41ca23a9e9c8d7d = {
+  0xd41ca23a9e9c8d7d, b_d41ca23a9e9c8d7d.words, 54, d_d41ca23a9e9c8d7d, m_d41ca23a9e9c8d7d,
+  1, 2, i_d41ca23a9e9c8d7d, nullptr, nullptr, { &s_d41ca23a9e9c8d7d, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<53> b_c222057b098ae913 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     19, 233, 138,   9, 123,   5,  34, 194,
+     25,   0,   0,   0,   2,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  26,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0, 175,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  80,  97,  99, 107, 101, 100,  84,
+     97, 103,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     28,   0,   0,   0,   1,   0,   2,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+     73,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      2,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      3,   0,   0,   0,   0,   0,   0,   0,
+     65,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   0,   0,   0,   0,
+     61,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+     57,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      6,   0,   0,   0,   0,   0,   0,   0,
+     49,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     98, 111, 111, 108,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+    117, 105, 110, 116,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116,  86,  97, 108, 117, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 116, 114,  86,  97, 108, 117, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108, 111,  97, 116,  86,  97, 108,
+    117, 101,   0,   0,   0,   0,   0,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
+    101, 110, 117, 109,  86,  97, 108, 117,
+    101,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_c222057b098ae913 = b_c222057b098ae913.words;
+#if !CAPNP_LITE
+static const uint16_t m_c222057b098ae913[] = {0, 6, 4, 2, 5, 3, 1};
+const ::capnp::_::RawSchema s_c222057b098ae913 = {
+  0xc222057b098ae913, b_c222057b098ae913.words, 53, nullptr, m_c222057b098ae913,
+  0, 7, nullptr, nullptr, nullptr, { &s_c222057b098ae913, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+CAPNP_DEFINE_ENUM(PackedTag_c222057b098ae913, c222057b098ae913);
+static const ::capnp::_::AlignedData<152> b_aa8c589001e2e8e8 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    232, 232, 226,   1, 144,  88, 140, 170,
+     25,   0,   0,   0,   1,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      7,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  50,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0, 143,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  80,  97,  99, 107, 101, 100,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     28,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    181,   0,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    176,   0,   0,   0,   3,   0,   1,   0,
+    204,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    201,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    196,   0,   0,   0,   3,   0,   1,   0,
+    224,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    221,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    216,   0,   0,   0,   3,   0,   1,   0,
+    244,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    241,   0,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    236,   0,   0,   0,   3,   0,   1,   0,
+      8,   1,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   4,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   1,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   1,   0,   0,   3,   0,   1,   0,
+     28,   1,   0,   0,   2,   0,   1,   0,
+      5,   0,   0,   0,   5,   0,   0,   0,
+      0,   0,   1,   0,   5,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     25,   1,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     20,   1,   0,   0,   3,   0,   1,   0,
+     48,   1,   0,   0,   2,   0,   1,   0,
+      6,   0,   0,   0,   6,   0,   0,   0,
+      0,   0,   1,   0,   6,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   1,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   1,   0,   0,   3,   0,   1,   0,
+     68,   1,   0,   0,   2,   0,   1,   0,
+    116,  97, 103, 115,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     15,   0,   0,   0,   0,   0,   0,   0,
+     19, 233, 138,   9, 123,   5,  34, 194,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110,  97, 109, 101, 115,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     99, 108,  97, 115, 115, 101, 115,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116, 115,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+      5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108, 111,  97, 116, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 116, 114, 115,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    111,  98, 106, 101,  99, 116, 115,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_aa8c589001e2e8e8 = b_aa8c589001e2e8e8.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_aa8c589001e2e8e8[] = {
+  &s_c222057b098ae913,
+};
+static const uint16_t m_aa8c589001e2e8e8[] = {2, 4, 3, 1, 6, 5, 0};
+static const uint16_t i_aa8c589001e2e8e8[] = {0, 1, 2, 3, 4, 5, 6};
+const ::capnp::_::RawSchema s_aa8c589001e2e8e8 = {
+  0xaa8c589001e2e8e8, b_aa8c589001e2e8e8.words, 152, d_aa8c589001e2e8e8, m_aa8c589001e2e8e8,
+  1, 7, i_aa8c589001e2e8e8, nullptr, nullptr, { &s_aa8c589001e2e8e8, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<33> b_8f2d77d834a5e736 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     54, 231, 165,  52, 216, 119,  45, 143,
+     25,   0,   0,   0,   1,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,   2,   1,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  77, 101, 116, 104, 111, 100,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    110,  97, 109, 101,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_8f2d77d834a5e736 = b_8f2d77d834a5e736.words;
+#if !CAPNP_LITE
+static const uint16_t m_8f2d77d834a5e736[] = {0};
+static const uint16_t i_8f2d77d834a5e736[] = {0};
+const ::capnp::_::RawSchema s_8f2d77d834a5e736 = {
+  0x8f2d77d834a5e736, b_8f2d77d834a5e736.words, 33, nullptr, m_8f2d77d834a5e736,
+  0, 1, i_8f2d77d834a5e736, nullptr, nullptr, { &s_8f2d77d834a5e736, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<30> b_a46e9e12cd75e297 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    151, 226, 117, 205,  18, 158, 110, 164,
+     25,   0,   0,   0,   3,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  66,   1,   0,   0,
+     37,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  71,   0,   0,   0,
+     73,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  77, 101, 116, 104, 111, 100,  67,
+     97, 108, 108,  97,  98, 108, 101,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   5,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    111, 163,  28,  39, 195, 204,  83, 136,
+    109, 223,  57, 101,  28, 220,  54, 168,
+     17,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   7,   0,   0,   0,
+    105, 110, 118, 111, 107, 101,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+      0,   0,   0,   0,   1,   0,   1,   0, }
+};
+::capnp::word const* const bp_a46e9e12cd75e297 = b_a46e9e12cd75e297.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_a46e9e12cd75e297[] = {
   &s_8853ccc3271ca36f,
   &s_a836dc1c6539df6d,
 };
-static const uint16_t m_a46e9e12cd75e297[] = {0};
-const ::capnp::_::RawSchema s_a46e9e12cd75e297 = {
-  0xa46e9e12cd75e297, b_a46e9e12cd75e297.words, 30, d_a46e9e12cd75e297, m_a46e9e12cd75e297,
-  2, 1, nullptr, nullptr, nullptr, { &s_a46e9e12cd75e297, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_a46e9e12cd75e297[] = {0};
+const ::capnp::_::RawSchema s_a46e9e12cd75e297 = {
+  0xa46e9e12cd75e297, b_a46e9e12cd75e297.words, 30, d_a46e9e12cd75e297, m_a46e9e12cd75e297,
+  2, 1, nullptr, nullptr, nullptr, { &s_a46e9e12cd75e297, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<35> b_8853ccc3271ca36f = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    111, 163,  28,  39, 195, 204,  83, 136,
+     40,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 178,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  77, 101, 116, 104, 111, 100,  67,
+     97, 108, 108,  97,  98, 108, 101,  46,
+    105, 110, 118, 111, 107, 101,  36,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    109, 101, 116, 104, 111, 100,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     54, 231, 165,  52, 216, 119,  45, 143,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_8853ccc3271ca36f = b_8853ccc3271ca36f.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_8853ccc3271ca36f[] = {
+  &s_8f2d77d834a5e736,
+};
+static const uint16_t m_8853ccc3271ca36f[] = {0};
+static const uint16_t i_8853ccc3271ca36f[] = {0};
+const ::capnp::_::RawSchema s_8853ccc3271ca36f = {
+  0x8853ccc3271ca36f, b_8853ccc3271ca36f.words, 35, d_8853ccc3271ca36f, m_8853ccc3271ca36f,
+  1, 1, i_8853ccc3271ca36f, nullptr, nullptr, { &s_8853ccc3271ca36f, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<19> b_a836dc1c6539df6d = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    109, 223,  57, 101,  28, 220,  54, 168,
+     40,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 186,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  77, 101, 116, 104, 111, 100,  67,
+     97, 108, 108,  97,  98, 108, 101,  46,
+    105, 110, 118, 111, 107, 101,  36,  82,
+    101, 115, 117, 108, 116, 115,   0,   0, }
+};
+::capnp::word const* const bp_a836dc1c6539df6d = b_a836dc1c6539df6d.words;
+#if !CAPNP_LITE
+const ::capnp::_::RawSchema s_a836dc1c6539df6d = {
+  0xa836dc1c6539df6d, b_a836dc1c6539df6d.words, 19, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_a836dc1c6539df6d, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<31> b_9e7b7ff32f28cfff = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    255, 207,  40,  47, 243, 127, 123, 158,
+     25,   0,   0,   0,   3,   0,   0,   0,
+    190, 200, 193, 173, 250,  55,  23, 142,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  82,   1,   0,   0,
+     41,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0,  71,   0,   0,   0,
+     77,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  68, 101, 108, 101, 103,  97, 116,
+    101,  67,  97, 108, 108,  98,  97,  99,
+    107,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   5,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    207,  77,  11, 227, 165,  45, 175, 133,
+     35,  64, 249, 178, 116,  39,   4, 132,
+     17,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   0,   0,   7,   0,   0,   0,
+    111, 110,  67,  97, 108, 108,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+      0,   0,   0,   0,   1,   0,   1,   0, }
+};
+::capnp::word const* const bp_9e7b7ff32f28cfff = b_9e7b7ff32f28cfff.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_9e7b7ff32f28cfff[] = {
+  &s_84042774b2f94023,
+  &s_85af2da5e30b4dcf,
+};
+static const uint16_t m_9e7b7ff32f28cfff[] = {0};
+const ::capnp::_::RawSchema s_9e7b7ff32f28cfff = {
+  0x9e7b7ff32f28cfff, b_9e7b7ff32f28cfff.words, 31, d_9e7b7ff32f28cfff, m_9e7b7ff32f28cfff,
+  2, 1, nullptr, nullptr, nullptr, { &s_9e7b7ff32f28cfff, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<54> b_85af2da5e30b4dcf = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    207,  77,  11, 227, 165,  45, 175, 133,
+     42,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 194,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  68, 101, 108, 101, 103,  97, 116,
+    101,  67,  97, 108, 108,  98,  97,  99,
+    107,  46, 111, 110,  67,  97, 108, 108,
+     36,  80,  97, 114,  97, 109, 115,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     41,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     68,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,  97, 114,  97, 109, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_85af2da5e30b4dcf = b_85af2da5e30b4dcf.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_85af2da5e30b4dcf[] = {
+  &s_a53c5ce887c3c1e6,
+  &s_bbbd9ab104716176,
+};
+static const uint16_t m_85af2da5e30b4dcf[] = {0, 1};
+static const uint16_t i_85af2da5e30b4dcf[] = {0, 1};
+const ::capnp::_::RawSchema s_85af2da5e30b4dcf = {
+  0x85af2da5e30b4dcf, b_85af2da5e30b4dcf.words, 54, d_85af2da5e30b4dcf, m_85af2da5e30b4dcf,
+  2, 2, i_85af2da5e30b4dcf, nullptr, nullptr, { &s_85af2da5e30b4dcf, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<20> b_84042774b2f94023 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     35,  64, 249, 178, 116,  39,   4, 132,
+     42,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 202,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  68, 101, 108, 101, 103,  97, 116,
+    101,  67,  97, 108, 108,  98,  97,  99,
+    107,  46, 111, 110,  67,  97, 108, 108,
+     36,  82, 101, 115, 117, 108, 116, 115,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_84042774b2f94023 = b_84042774b2f94023.words;
+#if !CAPNP_LITE
+const ::capnp::_::RawSchema s_84042774b2f94023 = {
+  0x84042774b2f94023, b_84042774b2f94023.words, 20, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_84042774b2f94023, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<99> b_e93028909ce18c87 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    135, 140, 225, 156, 144,  40,  48, 233,
+     25,   0,   0,   0,   1,   0,   1,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      4,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  82,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  31,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 110, 101, 119,  79,  98, 106, 101,
+     99, 116,  36,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
+     20,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    125,   0,   0,   0,  34,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    120,   0,   0,   0,   3,   0,   1,   0,
+    132,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    129,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    124,   0,   0,   0,   3,   0,   1,   0,
+    136,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    133,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    128,   0,   0,   0,   3,   0,   1,   0,
+    140,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    137,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    132,   0,   0,   0,   3,   0,   1,   0,
+    144,   0,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    141,   0,   0,   0, 114,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    140,   0,   0,   0,   3,   0,   1,   0,
+    168,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    111,  98, 106,  78,  97, 109, 101,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 108,  97, 103, 115,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     99, 111, 110, 115, 116, 114, 117,  99,
+    116,  65, 114, 103, 115,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_e93028909ce18c87 = b_e93028909ce18c87.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_e93028909ce18c87[] = {
+  &s_a53c5ce887c3c1e6,
+  &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
+};
+static const uint16_t m_e93028909ce18c87[] = {4, 3, 2, 0, 1};
+static const uint16_t i_e93028909ce18c87[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_e93028909ce18c87 = {
+  0xe93028909ce18c87, b_e93028909ce18c87.words, 99, d_e93028909ce18c87, m_e93028909ce18c87,
+  3, 5, i_e93028909ce18c87, nullptr, nullptr, { &s_e93028909ce18c87, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<35> b_8853ccc3271ca36f = {
+static const ::capnp::_::AlignedData<34> b_e8ae732560511590 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    111, 163,  28,  39, 195, 204,  83, 136,
-     40,   0,   0,   0,   1,   0,   0,   0,
+    144,  21,  81,  96,  37, 115, 174, 232,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 178,   1,   0,   0,
+     21,   0,   0,   0,  90,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 110, 101, 119,  79,  98, 106, 101,
+     99, 116,  36,  82, 101, 115, 117, 108,
+    116, 115,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_e8ae732560511590 = b_e8ae732560511590.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_e8ae732560511590[] = {
+  &s_bbbd9ab104716176,
+};
+static const uint16_t m_e8ae732560511590[] = {0};
+static const uint16_t i_e8ae732560511590[] = {0};
+const ::capnp::_::RawSchema s_e8ae732560511590 = {
+  0xe8ae732560511590, b_e8ae732560511590.words, 34, d_e8ae732560511590, m_e8ae732560511590,
+  1, 1, i_e8ae732560511590, nullptr, nullptr, { &s_e8ae732560511590, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<34> b_d83f631716ef1a45 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     69,  26, 239,  22,  23,  99,  63, 216,
+     25,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 114,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 100, 101, 115, 116, 114, 111, 121,
+     79,  98, 106, 101,  99, 116,  36,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  34,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_d83f631716ef1a45 = b_d83f631716ef1a45.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_d83f631716ef1a45[] = {
+  &s_bbbd9ab104716176,
+};
+static const uint16_t m_d83f631716ef1a45[] = {0};
+static const uint16_t i_d83f631716ef1a45[] = {0};
+const ::capnp::_::RawSchema s_d83f631716ef1a45 = {
+  0xd83f631716ef1a45, b_d83f631716ef1a45.words, 34, d_d83f631716ef1a45, m_d83f631716ef1a45,
+  1, 1, i_d83f631716ef1a45, nullptr, nullptr, { &s_d83f631716ef1a45, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<34> b_9b368dd4d1605190 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    144,  81,  96, 209, 212, 141,  54, 155,
+     25,   0,   0,   0,   1,   0,   1,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 122,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 100, 101, 115, 116, 114, 111, 121,
+     79,  98, 106, 101,  99, 116,  36,  82,
+    101, 115, 117, 108, 116, 115,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    114, 101, 115, 117, 108, 116,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0,  63,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_9b368dd4d1605190 = b_9b368dd4d1605190.words;
+#if !CAPNP_LITE
+static const uint16_t m_9b368dd4d1605190[] = {0};
+static const uint16_t i_9b368dd4d1605190[] = {0};
+const ::capnp::_::RawSchema s_9b368dd4d1605190 = {
+  0x9b368dd4d1605190, b_9b368dd4d1605190.words, 34, nullptr, m_9b368dd4d1605190,
+  0, 1, i_9b368dd4d1605190, nullptr, nullptr, { &s_9b368dd4d1605190, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<100> b_fb878edbaf7b8288 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    136, 130, 123, 175, 219, 142, 135, 251,
+     25,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  31,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  99,  97, 108, 108,  70, 117, 110,
+     99, 116, 105, 111, 110,  36,  80,  97,
+    114,  97, 109, 115,   0,   0,   0,   0,
+     20,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    125,   0,   0,   0,  34,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    120,   0,   0,   0,   3,   0,   1,   0,
+    132,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    129,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    128,   0,   0,   0,   3,   0,   1,   0,
+    140,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    137,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    132,   0,   0,   0,   3,   0,   1,   0,
+    144,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    141,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    140,   0,   0,   0,   3,   0,   1,   0,
+    152,   0,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   4,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    149,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    144,   0,   0,   0,   3,   0,   1,   0,
+    172,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46,  77, 101, 116, 104, 111, 100,  67,
-     97, 108, 108,  97,  98, 108, 101,  46,
-    105, 110, 118, 111, 107, 101,  36,  80,
-     97, 114,  97, 109, 115,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    109, 101, 116, 104, 111, 100,   0,   0,
+     99,  97, 108, 108,  79,  98, 106, 101,
+     99, 116,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-     54, 231, 165,  52, 216, 119,  45, 143,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_8853ccc3271ca36f = b_8853ccc3271ca36f.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_8853ccc3271ca36f[] = {
-  &s_8f2d77d834a5e736,
-};
-static const uint16_t m_8853ccc3271ca36f[] = {0};
-static const uint16_t i_8853ccc3271ca36f[] = {0};
-const ::capnp::_::RawSchema s_8853ccc3271ca36f = {
-  0x8853ccc3271ca36f, b_8853ccc3271ca36f.words, 35, d_8853ccc3271ca36f, m_8853ccc3271ca36f,
-  1, 1, i_8853ccc3271ca36f, nullptr, nullptr, { &s_8853ccc3271ca36f, nullptr, nullptr, 0, 0, nullptr }, false
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<19> b_a836dc1c6539df6d = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    109, 223,  57, 101,  28, 220,  54, 168,
-     40,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 186,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    102, 117, 110,  99,  78,  97, 109, 101,
       0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46,  77, 101, 116, 104, 111, 100,  67,
-     97, 108, 108,  97,  98, 108, 101,  46,
-    105, 110, 118, 111, 107, 101,  36,  82,
-    101, 115, 117, 108, 116, 115,   0,   0, }
-};
-::capnp::word const* const bp_a836dc1c6539df6d = b_a836dc1c6539df6d.words;
-#if !CAPNP_LITE
-const ::capnp::_::RawSchema s_a836dc1c6539df6d = {
-  0xa836dc1c6539df6d, b_a836dc1c6539df6d.words, 19, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_a836dc1c6539df6d, nullptr, nullptr, 0, 0, nullptr }, false
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<31> b_9e7b7ff32f28cfff = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    255, 207,  40,  47, 243, 127, 123, 158,
-     25,   0,   0,   0,   3,   0,   0,   0,
-    190, 200, 193, 173, 250,  55,  23, 142,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  82,   1,   0,   0,
-     41,   0,   0,   0,   7,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0,  71,   0,   0,   0,
-     77,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46,  68, 101, 108, 101, 103,  97, 116,
-    101,  67,  97, 108, 108,  98,  97,  99,
-    107,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   5,   0,
+    112,  97, 114,  97, 109, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    207,  77,  11, 227, 165,  45, 175, 133,
-     35,  64, 249, 178, 116,  39,   4, 132,
-     17,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   0,   0,   7,   0,   0,   0,
-    111, 110,  67,  97, 108, 108,   0,   0,
-      0,   0,   0,   0,   0,   0,   1,   0,
-      0,   0,   0,   0,   1,   0,   1,   0, }
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_9e7b7ff32f28cfff = b_9e7b7ff32f28cfff.words;
+::capnp::word const* const bp_fb878edbaf7b8288 = b_fb878edbaf7b8288.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_9e7b7ff32f28cfff[] = {
-  &s_84042774b2f94023,
-  &s_85af2da5e30b4dcf,
+static const ::capnp::_::RawSchema* const d_fb878edbaf7b8288[] = {
+  &s_a53c5ce887c3c1e6,
+  &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_9e7b7ff32f28cfff[] = {0};
-const ::capnp::_::RawSchema s_9e7b7ff32f28cfff = {
-  0x9e7b7ff32f28cfff, b_9e7b7ff32f28cfff.words, 31, d_9e7b7ff32f28cfff, m_9e7b7ff32f28cfff,
-  2, 1, nullptr, nullptr, nullptr, { &s_9e7b7ff32f28cfff, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_fb878edbaf7b8288[] = {1, 3, 0, 4, 2};
+static const uint16_t i_fb878edbaf7b8288[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_fb878edbaf7b8288 = {
+  0xfb878edbaf7b8288, b_fb878edbaf7b8288.words, 100, d_fb878edbaf7b8288, m_fb878edbaf7b8288,
+  3, 5, i_fb878edbaf7b8288, nullptr, nullptr, { &s_fb878edbaf7b8288, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<54> b_85af2da5e30b4dcf = {
+static const ::capnp::_::AlignedData<54> b_c1e269cbbf7a7e86 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    207,  77,  11, 227, 165,  45, 175, 133,
-     42,   0,   0,   0,   1,   0,   0,   0,
+    134, 126, 122, 191, 203, 105, 226, 193,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 194,   1,   0,   0,
+     21,   0,   0,   0, 114,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  68, 101, 108, 101, 103,  97, 116,
-    101,  67,  97, 108, 108,  98,  97,  99,
-    107,  46, 111, 110,  67,  97, 108, 108,
-     36,  80,  97, 114,  97, 109, 115,   0,
+     46,  99,  97, 108, 108,  70, 117, 110,
+     99, 116, 105, 111, 110,  36,  82, 101,
+    115, 117, 108, 116, 115,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
@@ -819,19 +2262,20 @@ static const ::capnp::_::AlignedData<54> b_85af2da5e30b4dcf = {
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  58,   0,   0,   0,
+     45,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     40,   0,   0,   0,   3,   0,   1,   0,
-     68,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     72,   0,   0,   0,   2,   0,   1,   0,
+    114, 101, 116, 117, 114, 110,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    230, 193, 195, 135, 232,  92,  60, 165,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112,  97, 114,  97, 109, 115,   0,   0,
+    111, 117, 116,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
      14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -844,111 +2288,60 @@ static const ::capnp::_::AlignedData<54> b_85af2da5e30b4dcf = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_85af2da5e30b4dcf = b_85af2da5e30b4dcf.words;
+::capnp::word const* const bp_c1e269cbbf7a7e86 = b_c1e269cbbf7a7e86.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_85af2da5e30b4dcf[] = {
+static const ::capnp::_::RawSchema* const d_c1e269cbbf7a7e86[] = {
   &s_a53c5ce887c3c1e6,
-  &s_bbbd9ab104716176,
-};
-static const uint16_t m_85af2da5e30b4dcf[] = {0, 1};
-static const uint16_t i_85af2da5e30b4dcf[] = {0, 1};
-const ::capnp::_::RawSchema s_85af2da5e30b4dcf = {
-  0x85af2da5e30b4dcf, b_85af2da5e30b4dcf.words, 54, d_85af2da5e30b4dcf, m_85af2da5e30b4dcf,
-  2, 2, i_85af2da5e30b4dcf, nullptr, nullptr, { &s_85af2da5e30b4dcf, nullptr, nullptr, 0, 0, nullptr }, false
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<20> b_84042774b2f94023 = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-     35,  64, 249, 178, 116,  39,   4, 132,
-     42,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 202,   1,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46,  68, 101, 108, 101, 103,  97, 116,
-    101,  67,  97, 108, 108,  98,  97,  99,
-    107,  46, 111, 110,  67,  97, 108, 108,
-     36,  82, 101, 115, 117, 108, 116, 115,
-      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_84042774b2f94023 = b_84042774b2f94023.words;
-#if !CAPNP_LITE
-const ::capnp::_::RawSchema s_84042774b2f94023 = {
-  0x84042774b2f94023, b_84042774b2f94023.words, 20, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_84042774b2f94023, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_c1e269cbbf7a7e86[] = {1, 0};
+static const uint16_t i_c1e269cbbf7a7e86[] = {0, 1};
+const ::capnp::_::RawSchema s_c1e269cbbf7a7e86 = {
+  0xc1e269cbbf7a7e86, b_c1e269cbbf7a7e86.words, 54, d_c1e269cbbf7a7e86, m_c1e269cbbf7a7e86,
+  1, 2, i_c1e269cbbf7a7e86, nullptr, nullptr, { &s_c1e269cbbf7a7e86, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<99> b_e93028909ce18c87 = {
+static const ::capnp::_::AlignedData<70> b_d78410e4cefcb090 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    135, 140, 225, 156, 144,  40,  48, 233,
-     25,   0,   0,   0,   1,   0,   1,   0,
+    144, 176, 252, 206, 228,  16, 132, 215,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   7,   0,   0,   0,   0,   0,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  82,   1,   0,   0,
+     21,   0,   0,   0, 154,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  31,   1,   0,   0,
+     37,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 110, 101, 119,  79,  98, 106, 101,
-     99, 116,  36,  80,  97, 114,  97, 109,
-    115,   0,   0,   0,   0,   0,   0,   0,
-     20,   0,   0,   0,   3,   0,   4,   0,
+     46,  99,  97, 108, 108,  83, 116,  97,
+    116, 105,  99,  70, 117, 110,  99, 116,
+    105, 111, 110,  36,  80,  97, 114,  97,
+    109, 115,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    125,   0,   0,   0,  34,   0,   0,   0,
+     69,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    120,   0,   0,   0,   3,   0,   1,   0,
-    132,   0,   0,   0,   2,   0,   1,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    129,   0,   0,   0,  66,   0,   0,   0,
+     73,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    124,   0,   0,   0,   3,   0,   1,   0,
-    136,   0,   0,   0,   2,   0,   1,   0,
+     72,   0,   0,   0,   3,   0,   1,   0,
+     84,   0,   0,   0,   2,   0,   1,   0,
       2,   0,   0,   0,   2,   0,   0,   0,
       0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    133,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    128,   0,   0,   0,   3,   0,   1,   0,
-    140,   0,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    137,   0,   0,   0,  50,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    132,   0,   0,   0,   3,   0,   1,   0,
-    144,   0,   0,   0,   2,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   0,   0,
-      0,   0,   1,   0,   4,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    141,   0,   0,   0, 114,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    140,   0,   0,   0,   3,   0,   1,   0,
-    168,   0,   0,   0,   2,   0,   1,   0,
-    111, 119, 110,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     81,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+    104,   0,   0,   0,   2,   0,   1,   0,
     117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     189, 192, 116, 130,  96,   6, 166, 189,
@@ -957,24 +2350,16 @@ static const ::capnp::_::AlignedData<99> b_e93028909ce18c87 = {
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111,  98, 106,  78,  97, 109, 101,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+    102, 117, 110,  99,  78,  97, 109, 101,
       0,   0,   0,   0,   0,   0,   0,   0,
      12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    102, 108,  97, 103, 115,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     99, 111, 110, 115, 116, 114, 117,  99,
-    116,  65, 114, 103, 115,   0,   0,   0,
+    112,  97, 114,  97, 109, 115,   0,   0,
      14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -987,76 +2372,96 @@ static const ::capnp::_::AlignedData<99> b_e93028909ce18c87 = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e93028909ce18c87 = b_e93028909ce18c87.words;
+::capnp::word const* const bp_d78410e4cefcb090 = b_d78410e4cefcb090.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e93028909ce18c87[] = {
+static const ::capnp::_::RawSchema* const d_d78410e4cefcb090[] = {
   &s_a53c5ce887c3c1e6,
-  &s_bbbd9ab104716176,
   &s_bda606608274c0bd,
 };
-static const uint16_t m_e93028909ce18c87[] = {4, 3, 2, 0, 1};
-static const uint16_t i_e93028909ce18c87[] = {0, 1, 2, 3, 4};
-const ::capnp::_::RawSchema s_e93028909ce18c87 = {
-  0xe93028909ce18c87, b_e93028909ce18c87.words, 99, d_e93028909ce18c87, m_e93028909ce18c87,
-  3, 5, i_e93028909ce18c87, nullptr, nullptr, { &s_e93028909ce18c87, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_d78410e4cefcb090[] = {1, 2, 0};
+static const uint16_t i_d78410e4cefcb090[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_d78410e4cefcb090 = {
+  0xd78410e4cefcb090, b_d78410e4cefcb090.words, 70, d_d78410e4cefcb090, m_d78410e4cefcb090,
+  2, 3, i_d78410e4cefcb090, nullptr, nullptr, { &s_d78410e4cefcb090, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_e8ae732560511590 = {
+static const ::capnp::_::AlignedData<55> b_e874d7934c0342a9 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    144,  21,  81,  96,  37, 115, 174, 232,
+    169,  66,   3,  76, 147, 215, 116, 232,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  90,   1,   0,   0,
+     21,   0,   0,   0, 162,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 110, 101, 119,  79,  98, 106, 101,
-     99, 116,  36,  82, 101, 115, 117, 108,
-    116, 115,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     46,  99,  97, 108, 108,  83, 116,  97,
+    116, 105,  99,  70, 117, 110,  99, 116,
+    105, 111, 110,  36,  82, 101, 115, 117,
+    108, 116, 115,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
+     41,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     72,   0,   0,   0,   2,   0,   1,   0,
+    114, 101, 116, 117, 114, 110,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    111, 117, 116,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e8ae732560511590 = b_e8ae732560511590.words;
+::capnp::word const* const bp_e874d7934c0342a9 = b_e874d7934c0342a9.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e8ae732560511590[] = {
-  &s_bbbd9ab104716176,
+static const ::capnp::_::RawSchema* const d_e874d7934c0342a9[] = {
+  &s_a53c5ce887c3c1e6,
 };
-static const uint16_t m_e8ae732560511590[] = {0};
-static const uint16_t i_e8ae732560511590[] = {0};
-const ::capnp::_::RawSchema s_e8ae732560511590 = {
-  0xe8ae732560511590, b_e8ae732560511590.words, 34, d_e8ae732560511590, m_e8ae732560511590,
-  1, 1, i_e8ae732560511590, nullptr, nullptr, { &s_e8ae732560511590, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_e874d7934c0342a9[] = {1, 0};
+static const uint16_t i_e874d7934c0342a9[] = {0, 1};
+const ::capnp::_::RawSchema s_e874d7934c0342a9 = {
+  0xe874d7934c0342a9, b_e874d7934c0342a9.words, 55, d_e874d7934c0342a9, m_e874d7934c0342a9,
+  1, 2, i_e874d7934c0342a9, nullptr, nullptr, { &s_e874d7934c0342a9, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_d83f631716ef1a45 = {
+static const ::capnp::_::AlignedData<34> b_ed1a745952b2ef0f = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     69,  26, 239,  22,  23,  99,  63, 216,
+     15, 239, 178,  82,  89, 116,  26, 237,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 114,   1,   0,   0,
+     21,   0,   0,   0,  82,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      33,   0,   0,   0,  63,   0,   0,   0,
@@ -1065,46 +2470,46 @@ static const ::capnp::_::AlignedData<34> b_d83f631716ef1a45 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 100, 101, 115, 116, 114, 111, 121,
-     79,  98, 106, 101,  99, 116,  36,  80,
-     97, 114,  97, 109, 115,   0,   0,   0,
+     46, 102, 105, 110, 100,  67, 108,  97,
+    115, 115,  36,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  34,   0,   0,   0,
+     13,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   1,   0,
      20,   0,   0,   0,   2,   0,   1,   0,
-    111, 119, 110,   0,   0,   0,   0,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_d83f631716ef1a45 = b_d83f631716ef1a45.words;
+::capnp::word const* const bp_ed1a745952b2ef0f = b_ed1a745952b2ef0f.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_d83f631716ef1a45[] = {
-  &s_bbbd9ab104716176,
+static const ::capnp::_::RawSchema* const d_ed1a745952b2ef0f[] = {
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_d83f631716ef1a45[] = {0};
-static const uint16_t i_d83f631716ef1a45[] = {0};
-const ::capnp::_::RawSchema s_d83f631716ef1a45 = {
-  0xd83f631716ef1a45, b_d83f631716ef1a45.words, 34, d_d83f631716ef1a45, m_d83f631716ef1a45,
-  1, 1, i_d83f631716ef1a45, nullptr, nullptr, { &s_d83f631716ef1a45, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_ed1a745952b2ef0f[] = {0};
+static const uint16_t i_ed1a745952b2ef0f[] = {0};
+const ::capnp::_::RawSchema s_ed1a745952b2ef0f = {
+  0xed1a745952b2ef0f, b_ed1a745952b2ef0f.words, 34, d_ed1a745952b2ef0f, m_ed1a745952b2ef0f,
+  1, 1, i_ed1a745952b2ef0f, nullptr, nullptr, { &s_ed1a745952b2ef0f, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_9b368dd4d1605190 = {
+static const ::capnp::_::AlignedData<34> b_e5e41c8457176bf2 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    144,  81,  96, 209, 212, 141,  54, 155,
-     25,   0,   0,   0,   1,   0,   1,   0,
+    242, 107,  23,  87, 132,  28, 228, 229,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 122,   1,   0,   0,
+     21,   0,   0,   0,  90,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      33,   0,   0,   0,  63,   0,   0,   0,
@@ -1113,9 +2518,9 @@ static const ::capnp::_::AlignedData<34> b_9b368dd4d1605190 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 100, 101, 115, 116, 114, 111, 121,
-     79,  98, 106, 101,  99, 116,  36,  82,
-    101, 115, 117, 108, 116, 115,   0,   0,
+     46, 102, 105, 110, 100,  67, 108,  97,
+    115, 115,  36,  82, 101, 115, 117, 108,
+    116, 115,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
@@ -1124,96 +2529,54 @@ static const ::capnp::_::AlignedData<34> b_9b368dd4d1605190 = {
       0,   0,   0,   0,   0,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   1,   0,
      20,   0,   0,   0,   2,   0,   1,   0,
-    114, 101, 115, 117, 108, 116,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_9b368dd4d1605190 = b_9b368dd4d1605190.words;
+::capnp::word const* const bp_e5e41c8457176bf2 = b_e5e41c8457176bf2.words;
 #if !CAPNP_LITE
-static const uint16_t m_9b368dd4d1605190[] = {0};
-static const uint16_t i_9b368dd4d1605190[] = {0};
-const ::capnp::_::RawSchema s_9b368dd4d1605190 = {
-  0x9b368dd4d1605190, b_9b368dd4d1605190.words, 34, nullptr, m_9b368dd4d1605190,
-  0, 1, i_9b368dd4d1605190, nullptr, nullptr, { &s_9b368dd4d1605190, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_e5e41c8457176bf2[] = {
+  &s_bbbd9ab104716176,
+};
+static const uint16_t m_e5e41c8457176bf2[] = {0};
+static const uint16_t i_e5e41c8457176bf2[] = {0};
+const ::capnp::_::RawSchema s_e5e41c8457176bf2 = {
+  0xe5e41c8457176bf2, b_e5e41c8457176bf2.words, 34, d_e5e41c8457176bf2, m_e5e41c8457176bf2,
+  1, 1, i_e5e41c8457176bf2, nullptr, nullptr, { &s_e5e41c8457176bf2, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<100> b_fb878edbaf7b8288 = {
+static const ::capnp::_::AlignedData<34> b_f3c0af0b0dfca37d = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    136, 130, 123, 175, 219, 142, 135, 251,
+    125, 163, 252,  13,  11, 175, 192, 243,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      5,   0,   7,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 106,   1,   0,   0,
+     21,   0,   0,   0,  82,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  31,   1,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  99,  97, 108, 108,  70, 117, 110,
-     99, 116, 105, 111, 110,  36,  80,  97,
-    114,  97, 109, 115,   0,   0,   0,   0,
-     20,   0,   0,   0,   3,   0,   4,   0,
+     46, 108, 111,  97, 100,  67, 108,  97,
+    115, 115,  36,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    125,   0,   0,   0,  34,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    120,   0,   0,   0,   3,   0,   1,   0,
-    132,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    129,   0,   0,   0,  90,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    128,   0,   0,   0,   3,   0,   1,   0,
-    140,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    137,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    132,   0,   0,   0,   3,   0,   1,   0,
-    144,   0,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,   3,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    141,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    140,   0,   0,   0,   3,   0,   1,   0,
-    152,   0,   0,   0,   2,   0,   1,   0,
-      4,   0,   0,   0,   4,   0,   0,   0,
-      0,   0,   1,   0,   4,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    149,   0,   0,   0,  58,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    144,   0,   0,   0,   3,   0,   1,   0,
-    172,   0,   0,   0,   2,   0,   1,   0,
-    111, 119, 110,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     99,  97, 108, 108,  79,  98, 106, 101,
-     99, 116,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
     117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     189, 192, 116, 130,  96,   6, 166, 189,
@@ -1221,216 +2584,183 @@ static const ::capnp::_::AlignedData<100> b_fb878edbaf7b8288 = {
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_f3c0af0b0dfca37d = b_f3c0af0b0dfca37d.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_f3c0af0b0dfca37d[] = {
+  &s_bda606608274c0bd,
+};
+static const uint16_t m_f3c0af0b0dfca37d[] = {0};
+static const uint16_t i_f3c0af0b0dfca37d[] = {0};
+const ::capnp::_::RawSchema s_f3c0af0b0dfca37d = {
+  0xf3c0af0b0dfca37d, b_f3c0af0b0dfca37d.words, 34, d_f3c0af0b0dfca37d, m_f3c0af0b0dfca37d,
+  1, 1, i_f3c0af0b0dfca37d, nullptr, nullptr, { &s_f3c0af0b0dfca37d, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<34> b_9abf79fcdc2bbddd = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    221, 189,  43, 220, 252, 121, 191, 154,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    102, 117, 110,  99,  78,  97, 109, 101,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  90,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 108, 111,  97, 100,  67, 108,  97,
+    115, 115,  36,  82, 101, 115, 117, 108,
+    116, 115,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112,  97, 114,  97, 109, 115,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_fb878edbaf7b8288 = b_fb878edbaf7b8288.words;
+::capnp::word const* const bp_9abf79fcdc2bbddd = b_9abf79fcdc2bbddd.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_fb878edbaf7b8288[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_9abf79fcdc2bbddd[] = {
   &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
 };
-static const uint16_t m_fb878edbaf7b8288[] = {1, 3, 0, 4, 2};
-static const uint16_t i_fb878edbaf7b8288[] = {0, 1, 2, 3, 4};
-const ::capnp::_::RawSchema s_fb878edbaf7b8288 = {
-  0xfb878edbaf7b8288, b_fb878edbaf7b8288.words, 100, d_fb878edbaf7b8288, m_fb878edbaf7b8288,
-  3, 5, i_fb878edbaf7b8288, nullptr, nullptr, { &s_fb878edbaf7b8288, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_9abf79fcdc2bbddd[] = {0};
+static const uint16_t i_9abf79fcdc2bbddd[] = {0};
+const ::capnp::_::RawSchema s_9abf79fcdc2bbddd = {
+  0x9abf79fcdc2bbddd, b_9abf79fcdc2bbddd.words, 34, d_9abf79fcdc2bbddd, m_9abf79fcdc2bbddd,
+  1, 1, i_9abf79fcdc2bbddd, nullptr, nullptr, { &s_9abf79fcdc2bbddd, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<54> b_c1e269cbbf7a7e86 = {
+static const ::capnp::_::AlignedData<34> b_b72a6de10cd758f2 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    134, 126, 122, 191, 203, 105, 226, 193,
+    242,  88, 215,  12, 225, 109,  42, 183,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      2,   0,   7,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 114,   1,   0,   0,
+     21,   0,   0,   0,  98,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  99,  97, 108, 108,  70, 117, 110,
-     99, 116, 105, 111, 110,  36,  82, 101,
-    115, 117, 108, 116, 115,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     46, 115, 116,  97, 116, 105,  99,  67,
+    108,  97, 115, 115,  36,  80,  97, 114,
+     97, 109, 115,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  58,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     36,   0,   0,   0,   3,   0,   1,   0,
-     48,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  82,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     44,   0,   0,   0,   3,   0,   1,   0,
-     72,   0,   0,   0,   2,   0,   1,   0,
-    114, 101, 116, 117, 114, 110,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111, 117, 116,  80,  97, 114,  97, 109,
-    115,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_c1e269cbbf7a7e86 = b_c1e269cbbf7a7e86.words;
+::capnp::word const* const bp_b72a6de10cd758f2 = b_b72a6de10cd758f2.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_c1e269cbbf7a7e86[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_b72a6de10cd758f2[] = {
+  &s_bbbd9ab104716176,
 };
-static const uint16_t m_c1e269cbbf7a7e86[] = {1, 0};
-static const uint16_t i_c1e269cbbf7a7e86[] = {0, 1};
-const ::capnp::_::RawSchema s_c1e269cbbf7a7e86 = {
-  0xc1e269cbbf7a7e86, b_c1e269cbbf7a7e86.words, 54, d_c1e269cbbf7a7e86, m_c1e269cbbf7a7e86,
-  1, 2, i_c1e269cbbf7a7e86, nullptr, nullptr, { &s_c1e269cbbf7a7e86, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_b72a6de10cd758f2[] = {0};
+static const uint16_t i_b72a6de10cd758f2[] = {0};
+const ::capnp::_::RawSchema s_b72a6de10cd758f2 = {
+  0xb72a6de10cd758f2, b_b72a6de10cd758f2.words, 34, d_b72a6de10cd758f2, m_b72a6de10cd758f2,
+  1, 1, i_b72a6de10cd758f2, nullptr, nullptr, { &s_b72a6de10cd758f2, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<70> b_d78410e4cefcb090 = {
+static const ::capnp::_::AlignedData<34> b_ccf3c5bc914ad34f = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    144, 176, 252, 206, 228,  16, 132, 215,
+     79, 211,  74, 145, 188, 197, 243, 204,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      3,   0,   7,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 154,   1,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 175,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  99,  97, 108, 108,  83, 116,  97,
-    116, 105,  99,  70, 117, 110,  99, 116,
-    105, 111, 110,  36,  80,  97, 114,  97,
-    109, 115,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   4,   0,
+     46, 115, 116,  97, 116, 105,  99,  67,
+    108,  97, 115, 115,  36,  82, 101, 115,
+    117, 108, 116, 115,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     64,   0,   0,   0,   3,   0,   1,   0,
-     76,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     73,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     72,   0,   0,   0,   3,   0,   1,   0,
-     84,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     81,   0,   0,   0,  58,   0,   0,   0,
+     13,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     76,   0,   0,   0,   3,   0,   1,   0,
-    104,   0,   0,   0,   2,   0,   1,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
     117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    102, 117, 110,  99,  78,  97, 109, 101,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112,  97, 114,  97, 109, 115,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_d78410e4cefcb090 = b_d78410e4cefcb090.words;
+::capnp::word const* const bp_ccf3c5bc914ad34f = b_ccf3c5bc914ad34f.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_d78410e4cefcb090[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_ccf3c5bc914ad34f[] = {
   &s_bda606608274c0bd,
 };
-static const uint16_t m_d78410e4cefcb090[] = {1, 2, 0};
-static const uint16_t i_d78410e4cefcb090[] = {0, 1, 2};
-const ::capnp::_::RawSchema s_d78410e4cefcb090 = {
-  0xd78410e4cefcb090, b_d78410e4cefcb090.words, 70, d_d78410e4cefcb090, m_d78410e4cefcb090,
-  2, 3, i_d78410e4cefcb090, nullptr, nullptr, { &s_d78410e4cefcb090, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_ccf3c5bc914ad34f[] = {0};
+static const uint16_t i_ccf3c5bc914ad34f[] = {0};
+const ::capnp::_::RawSchema s_ccf3c5bc914ad34f = {
+  0xccf3c5bc914ad34f, b_ccf3c5bc914ad34f.words, 34, d_ccf3c5bc914ad34f, m_ccf3c5bc914ad34f,
+  1, 1, i_ccf3c5bc914ad34f, nullptr, nullptr, { &s_ccf3c5bc914ad34f, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<55> b_e874d7934c0342a9 = {
+static const ::capnp::_::AlignedData<50> b_efff26269e9ba6bf = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    169,  66,   3,  76, 147, 215, 116, 232,
+    191, 166, 155, 158,  38,  38, 255, 239,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 162,   1,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  99,  97, 108, 108,  83, 116,  97,
-    116, 105,  99,  70, 117, 110,  99, 116,
-    105, 111, 110,  36,  82, 101, 115, 117,
-    108, 116, 115,   0,   0,   0,   0,   0,
+     46,  98, 105, 110, 100,  68, 101, 108,
+    101, 103,  97, 116, 101,  36,  80,  97,
+    114,  97, 109, 115,   0,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
@@ -1442,100 +2772,76 @@ static const ::capnp::_::AlignedData<55> b_e874d7934c0342a9 = {
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  82,   0,   0,   0,
+     45,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      44,   0,   0,   0,   3,   0,   1,   0,
-     72,   0,   0,   0,   2,   0,   1,   0,
-    114, 101, 116, 117, 114, 110,   0,   0,
+     56,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111, 117, 116,  80,  97, 114,  97, 109,
-    115,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     99,  97, 108, 108,  98,  97,  99, 107,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+     17,   0,   0,   0,   0,   0,   0,   0,
+    255, 207,  40,  47, 243, 127, 123, 158,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
+     17,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e874d7934c0342a9 = b_e874d7934c0342a9.words;
+::capnp::word const* const bp_efff26269e9ba6bf = b_efff26269e9ba6bf.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e874d7934c0342a9[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_efff26269e9ba6bf[] = {
+  &s_9e7b7ff32f28cfff,
+  &s_bbbd9ab104716176,
 };
-static const uint16_t m_e874d7934c0342a9[] = {1, 0};
-static const uint16_t i_e874d7934c0342a9[] = {0, 1};
-const ::capnp::_::RawSchema s_e874d7934c0342a9 = {
-  0xe874d7934c0342a9, b_e874d7934c0342a9.words, 55, d_e874d7934c0342a9, m_e874d7934c0342a9,
-  1, 2, i_e874d7934c0342a9, nullptr, nullptr, { &s_e874d7934c0342a9, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_efff26269e9ba6bf[] = {1, 0};
+static const uint16_t i_efff26269e9ba6bf[] = {0, 1};
+const ::capnp::_::RawSchema s_efff26269e9ba6bf = {
+  0xefff26269e9ba6bf, b_efff26269e9ba6bf.words, 50, d_efff26269e9ba6bf, m_efff26269e9ba6bf,
+  2, 2, i_efff26269e9ba6bf, nullptr, nullptr, { &s_efff26269e9ba6bf, nullptr, nullptr, 0, 0, nullptr }, true
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_ed1a745952b2ef0f = {
+static const ::capnp::_::AlignedData<18> b_df498c81bea9c640 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     15, 239, 178,  82,  89, 116,  26, 237,
+     64, 198, 169, 190, 129, 140,  73, 223,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 114,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  82,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46, 102, 105, 110, 100,  67, 108,  97,
-    115, 115,  36,  80,  97, 114,  97, 109,
-    115,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  98, 105, 110, 100,  68, 101, 108,
+    101, 103,  97, 116, 101,  36,  82, 101,
+    115, 117, 108, 116, 115,   0,   0,   0, }
 };
-::capnp::word const* const bp_ed1a745952b2ef0f = b_ed1a745952b2ef0f.words;
+::capnp::word const* const bp_df498c81bea9c640 = b_df498c81bea9c640.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_ed1a745952b2ef0f[] = {
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_ed1a745952b2ef0f[] = {0};
-static const uint16_t i_ed1a745952b2ef0f[] = {0};
-const ::capnp::_::RawSchema s_ed1a745952b2ef0f = {
-  0xed1a745952b2ef0f, b_ed1a745952b2ef0f.words, 34, d_ed1a745952b2ef0f, m_ed1a745952b2ef0f,
-  1, 1, i_ed1a745952b2ef0f, nullptr, nullptr, { &s_ed1a745952b2ef0f, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_df498c81bea9c640 = {
+  0xdf498c81bea9c640, b_df498c81bea9c640.words, 18, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_df498c81bea9c640, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_e5e41c8457176bf2 = {
+static const ::capnp::_::AlignedData<34> b_93b97f9e143854ef = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    242, 107,  23,  87, 132,  28, 228, 229,
+    239,  84,  56,  20, 158, 127, 185, 147,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  90,   1,   0,   0,
+     21,   0,   0,   0, 122,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      33,   0,   0,   0,  63,   0,   0,   0,
@@ -1544,9 +2850,9 @@ static const ::capnp::_::AlignedData<34> b_e5e41c8457176bf2 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 102, 105, 110, 100,  67, 108,  97,
-    115, 115,  36,  82, 101, 115, 117, 108,
-    116, 115,   0,   0,   0,   0,   0,   0,
+     46, 117, 110,  98, 105, 110, 100,  68,
+    101, 108, 101, 103,  97, 116, 101,  36,
+     80,  97, 114,  97, 109, 115,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
@@ -1564,94 +2870,141 @@ static const ::capnp::_::AlignedData<34> b_e5e41c8457176bf2 = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e5e41c8457176bf2 = b_e5e41c8457176bf2.words;
+::capnp::word const* const bp_93b97f9e143854ef = b_93b97f9e143854ef.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e5e41c8457176bf2[] = {
+static const ::capnp::_::RawSchema* const d_93b97f9e143854ef[] = {
   &s_bbbd9ab104716176,
 };
-static const uint16_t m_e5e41c8457176bf2[] = {0};
-static const uint16_t i_e5e41c8457176bf2[] = {0};
-const ::capnp::_::RawSchema s_e5e41c8457176bf2 = {
-  0xe5e41c8457176bf2, b_e5e41c8457176bf2.words, 34, d_e5e41c8457176bf2, m_e5e41c8457176bf2,
-  1, 1, i_e5e41c8457176bf2, nullptr, nullptr, { &s_e5e41c8457176bf2, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_93b97f9e143854ef[] = {0};
+static const uint16_t i_93b97f9e143854ef[] = {0};
+const ::capnp::_::RawSchema s_93b97f9e143854ef = {
+  0x93b97f9e143854ef, b_93b97f9e143854ef.words, 34, d_93b97f9e143854ef, m_93b97f9e143854ef,
+  1, 1, i_93b97f9e143854ef, nullptr, nullptr, { &s_93b97f9e143854ef, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_f3c0af0b0dfca37d = {
+static const ::capnp::_::AlignedData<18> b_e8b0a65565680b41 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    125, 163, 252,  13,  11, 175, 192, 243,
+     65,  11, 104, 101,  85, 166, 176, 232,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 130,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  82,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 108, 111,  97, 100,  67, 108,  97,
-    115, 115,  36,  80,  97, 114,  97, 109,
-    115,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     46, 117, 110,  98, 105, 110, 100,  68,
+    101, 108, 101, 103,  97, 116, 101,  36,
+     82, 101, 115, 117, 108, 116, 115,   0, }
+};
+::capnp::word const* const bp_e8b0a65565680b41 = b_e8b0a65565680b41.words;
+#if !CAPNP_LITE
+const ::capnp::_::RawSchema s_e8b0a65565680b41 = {
+  0xe8b0a65565680b41, b_e8b0a65565680b41.words, 18, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_e8b0a65565680b41, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<51> b_f0a1825f73741ede = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    222,  30, 116, 115,  95, 130, 161, 240,
+     25,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 138,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46,  97, 100, 100,  77, 117, 108, 116,
+    105,  68, 101, 108, 101, 103,  97, 116,
+    101,  36,  80,  97, 114,  97, 109, 115,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  66,   0,   0,   0,
+     41,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     56,   0,   0,   0,   2,   0,   1,   0,
+    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     99,  97, 108, 108,  98,  97,  99, 107,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     17,   0,   0,   0,   0,   0,   0,   0,
+    255, 207,  40,  47, 243, 127, 123, 158,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     17,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_f3c0af0b0dfca37d = b_f3c0af0b0dfca37d.words;
+::capnp::word const* const bp_f0a1825f73741ede = b_f0a1825f73741ede.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_f3c0af0b0dfca37d[] = {
-  &s_bda606608274c0bd,
+static const ::capnp::_::RawSchema* const d_f0a1825f73741ede[] = {
+  &s_9e7b7ff32f28cfff,
+  &s_bbbd9ab104716176,
 };
-static const uint16_t m_f3c0af0b0dfca37d[] = {0};
-static const uint16_t i_f3c0af0b0dfca37d[] = {0};
-const ::capnp::_::RawSchema s_f3c0af0b0dfca37d = {
-  0xf3c0af0b0dfca37d, b_f3c0af0b0dfca37d.words, 34, d_f3c0af0b0dfca37d, m_f3c0af0b0dfca37d,
-  1, 1, i_f3c0af0b0dfca37d, nullptr, nullptr, { &s_f3c0af0b0dfca37d, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_f0a1825f73741ede[] = {1, 0};
+static const uint16_t i_f0a1825f73741ede[] = {0, 1};
+const ::capnp::_::RawSchema s_f0a1825f73741ede = {
+  0xf0a1825f73741ede, b_f0a1825f73741ede.words, 51, d_f0a1825f73741ede, m_f0a1825f73741ede,
+  2, 2, i_f0a1825f73741ede, nullptr, nullptr, { &s_f0a1825f73741ede, nullptr, nullptr, 0, 0, nullptr }, true
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_9abf79fcdc2bbddd = {
+static const ::capnp::_::AlignedData<36> b_bb2886aba98a7d6e = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    221, 189,  43, 220, 252, 121, 191, 154,
+    110, 125, 138, 169, 171, 134,  40, 187,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  90,   1,   0,   0,
+     21,   0,   0,   0, 146,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
+     37,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 108, 111,  97, 100,  67, 108,  97,
-    115, 115,  36,  82, 101, 115, 117, 108,
-    116, 115,   0,   0,   0,   0,   0,   0,
+     46,  97, 100, 100,  77, 117, 108, 116,
+    105,  68, 101, 108, 101, 103,  97, 116,
+    101,  36,  82, 101, 115, 117, 108, 116,
+    115,   0,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
+     13,   0,   0,   0, 122,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
+     12,   0,   0,   0,   3,   0,   1,   0,
+     24,   0,   0,   0,   2,   0,   1,   0,
+    100, 101, 108, 101, 103,  97, 116, 101,
+     79,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -1660,47 +3013,64 @@ static const ::capnp::_::AlignedData<34> b_9abf79fcdc2bbddd = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_9abf79fcdc2bbddd = b_9abf79fcdc2bbddd.words;
+::capnp::word const* const bp_bb2886aba98a7d6e = b_bb2886aba98a7d6e.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_9abf79fcdc2bbddd[] = {
+static const ::capnp::_::RawSchema* const d_bb2886aba98a7d6e[] = {
   &s_bbbd9ab104716176,
 };
-static const uint16_t m_9abf79fcdc2bbddd[] = {0};
-static const uint16_t i_9abf79fcdc2bbddd[] = {0};
-const ::capnp::_::RawSchema s_9abf79fcdc2bbddd = {
-  0x9abf79fcdc2bbddd, b_9abf79fcdc2bbddd.words, 34, d_9abf79fcdc2bbddd, m_9abf79fcdc2bbddd,
-  1, 1, i_9abf79fcdc2bbddd, nullptr, nullptr, { &s_9abf79fcdc2bbddd, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_bb2886aba98a7d6e[] = {0};
+static const uint16_t i_bb2886aba98a7d6e[] = {0};
+const ::capnp::_::RawSchema s_bb2886aba98a7d6e = {
+  0xbb2886aba98a7d6e, b_bb2886aba98a7d6e.words, 36, d_bb2886aba98a7d6e, m_bb2886aba98a7d6e,
+  1, 1, i_bb2886aba98a7d6e, nullptr, nullptr, { &s_bb2886aba98a7d6e, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_b72a6de10cd758f2 = {
+static const ::capnp::_::AlignedData<51> b_e596573cb7a70896 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    242,  88, 215,  12, 225, 109,  42, 183,
+    150,   8, 167, 183,  60,  87, 150, 229,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  98,   1,   0,   0,
+     21,   0,   0,   0, 162,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 115, 116,  97, 116, 105,  99,  67,
-    108,  97, 115, 115,  36,  80,  97, 114,
+     46, 114, 101, 109, 111, 118, 101,  77,
+    117, 108, 116, 105,  68, 101, 108, 101,
+    103,  97, 116, 101,  36,  80,  97, 114,
      97, 109, 115,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
+     41,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0, 122,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     56,   0,   0,   0,   2,   0,   1,   0,
     111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100, 101, 108, 101, 103,  97, 116, 101,
+     79,  98, 106, 101,  99, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -1708,139 +3078,138 @@ static const ::capnp::_::AlignedData<34> b_b72a6de10cd758f2 = {
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_b72a6de10cd758f2 = b_b72a6de10cd758f2.words;
+::capnp::word const* const bp_e596573cb7a70896 = b_e596573cb7a70896.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_b72a6de10cd758f2[] = {
+static const ::capnp::_::RawSchema* const d_e596573cb7a70896[] = {
   &s_bbbd9ab104716176,
 };
-static const uint16_t m_b72a6de10cd758f2[] = {0};
-static const uint16_t i_b72a6de10cd758f2[] = {0};
-const ::capnp::_::RawSchema s_b72a6de10cd758f2 = {
-  0xb72a6de10cd758f2, b_b72a6de10cd758f2.words, 34, d_b72a6de10cd758f2, m_b72a6de10cd758f2,
-  1, 1, i_b72a6de10cd758f2, nullptr, nullptr, { &s_b72a6de10cd758f2, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_e596573cb7a70896[] = {1, 0};
+static const uint16_t i_e596573cb7a70896[] = {0, 1};
+const ::capnp::_::RawSchema s_e596573cb7a70896 = {
+  0xe596573cb7a70896, b_e596573cb7a70896.words, 51, d_e596573cb7a70896, m_e596573cb7a70896,
+  1, 2, i_e596573cb7a70896, nullptr, nullptr, { &s_e596573cb7a70896, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_ccf3c5bc914ad34f = {
+static const ::capnp::_::AlignedData<19> b_f524b8aa2fc26653 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     79, 211,  74, 145, 188, 197, 243, 204,
+     83, 102, 194,  47, 170, 184,  36, 245,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 170,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 115, 116,  97, 116, 105,  99,  67,
-    108,  97, 115, 115,  36,  82, 101, 115,
-    117, 108, 116, 115,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+     46, 114, 101, 109, 111, 118, 101,  77,
+    117, 108, 116, 105,  68, 101, 108, 101,
+    103,  97, 116, 101,  36,  82, 101, 115,
+    117, 108, 116, 115,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_ccf3c5bc914ad34f = b_ccf3c5bc914ad34f.words;
+::capnp::word const* const bp_f524b8aa2fc26653 = b_f524b8aa2fc26653.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_ccf3c5bc914ad34f[] = {
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_ccf3c5bc914ad34f[] = {0};
-static const uint16_t i_ccf3c5bc914ad34f[] = {0};
-const ::capnp::_::RawSchema s_ccf3c5bc914ad34f = {
-  0xccf3c5bc914ad34f, b_ccf3c5bc914ad34f.words, 34, d_ccf3c5bc914ad34f, m_ccf3c5bc914ad34f,
-  1, 1, i_ccf3c5bc914ad34f, nullptr, nullptr, { &s_ccf3c5bc914ad34f, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_f524b8aa2fc26653 = {
+  0xf524b8aa2fc26653, b_f524b8aa2fc26653.words, 19, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_f524b8aa2fc26653, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<50> b_efff26269e9ba6bf = {
+static const ::capnp::_::AlignedData<69> b_e1a9d4e3c6455e25 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    191, 166, 155, 158,  38,  38, 255, 239,
+     37,  94,  69, 198, 227, 212, 169, 225,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      2,   0,   7,   0,   0,   0,   0,   0,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 106,   1,   0,   0,
+     21,   0,   0,   0, 178,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 119,   0,   0,   0,
+     37,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  98, 105, 110, 100,  68, 101, 108,
-    101, 103,  97, 116, 101,  36,  80,  97,
-    114,  97, 109, 115,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     46, 114, 101, 103, 105, 115, 116, 101,
+    114,  79, 118, 101, 114, 114, 105, 100,
+    101,  67, 108,  97, 115, 115,  36,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  58,   0,   0,   0,
+     69,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     36,   0,   0,   0,   3,   0,   1,   0,
-     48,   0,   0,   0,   2,   0,   1,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  74,   0,   0,   0,
+     73,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     44,   0,   0,   0,   3,   0,   1,   0,
-     56,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     72,   0,   0,   0,   3,   0,   1,   0,
+    100,   0,   0,   0,   2,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     99,  97, 108, 108,  98,  97,  99, 107,
+    112,  97, 114, 101, 110, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
-     17,   0,   0,   0,   0,   0,   0,   0,
-    255, 207,  40,  47, 243, 127, 123, 158,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     17,   0,   0,   0,   0,   0,   0,   0,
+    109, 101, 116, 104, 111, 100, 115,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     54, 231, 165,  52, 216, 119,  45, 143,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_efff26269e9ba6bf = b_efff26269e9ba6bf.words;
+::capnp::word const* const bp_e1a9d4e3c6455e25 = b_e1a9d4e3c6455e25.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_efff26269e9ba6bf[] = {
-  &s_9e7b7ff32f28cfff,
-  &s_bbbd9ab104716176,
+static const ::capnp::_::RawSchema* const d_e1a9d4e3c6455e25[] = {
+  &s_8f2d77d834a5e736,
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_efff26269e9ba6bf[] = {1, 0};
-static const uint16_t i_efff26269e9ba6bf[] = {0, 1};
-const ::capnp::_::RawSchema s_efff26269e9ba6bf = {
-  0xefff26269e9ba6bf, b_efff26269e9ba6bf.words, 50, d_efff26269e9ba6bf, m_efff26269e9ba6bf,
-  2, 2, i_efff26269e9ba6bf, nullptr, nullptr, { &s_efff26269e9ba6bf, nullptr, nullptr, 0, 0, nullptr }, true
+static const uint16_t m_e1a9d4e3c6455e25[] = {2, 1, 0};
+static const uint16_t i_e1a9d4e3c6455e25[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_e1a9d4e3c6455e25 = {
+  0xe1a9d4e3c6455e25, b_e1a9d4e3c6455e25.words, 69, d_e1a9d4e3c6455e25, m_e1a9d4e3c6455e25,
+  2, 3, i_e1a9d4e3c6455e25, nullptr, nullptr, { &s_e1a9d4e3c6455e25, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<18> b_df498c81bea9c640 = {
+static const ::capnp::_::AlignedData<19> b_d8f836ed010a2e47 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     64, 198, 169, 190, 129, 140,  73, 223,
+     71,  46,  10,   1, 237,  54, 248, 216,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 114,   1,   0,   0,
+     21,   0,   0,   0, 186,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -1849,73 +3218,90 @@ static const ::capnp::_::AlignedData<18> b_df498c81bea9c640 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  98, 105, 110, 100,  68, 101, 108,
-    101, 103,  97, 116, 101,  36,  82, 101,
-    115, 117, 108, 116, 115,   0,   0,   0, }
+     46, 114, 101, 103, 105, 115, 116, 101,
+    114,  79, 118, 101, 114, 114, 105, 100,
+    101,  67, 108,  97, 115, 115,  36,  82,
+    101, 115, 117, 108, 116, 115,   0,   0, }
 };
-::capnp::word const* const bp_df498c81bea9c640 = b_df498c81bea9c640.words;
+::capnp::word const* const bp_d8f836ed010a2e47 = b_d8f836ed010a2e47.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_df498c81bea9c640 = {
-  0xdf498c81bea9c640, b_df498c81bea9c640.words, 18, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_df498c81bea9c640, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_d8f836ed010a2e47 = {
+  0xd8f836ed010a2e47, b_d8f836ed010a2e47.words, 19, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_d8f836ed010a2e47, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_93b97f9e143854ef = {
+static const ::capnp::_::AlignedData<50> b_d84f6e8c84cb7c57 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    239,  84,  56,  20, 158, 127, 185, 147,
+     87, 124, 203, 132, 140, 110,  79, 216,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 122,   1,   0,   0,
+     21,   0,   0,   0, 194,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 117, 110,  98, 105, 110, 100,  68,
-    101, 108, 101, 103,  97, 116, 101,  36,
-     80,  97, 114,  97, 109, 115,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     46, 117, 110, 114, 101, 103, 105, 115,
+    116, 101, 114,  79, 118, 101, 114, 114,
+    105, 100, 101,  67, 108,  97, 115, 115,
+     36,  80,  97, 114,  97, 109, 115,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
+     41,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,  97, 114, 101, 110, 116,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_93b97f9e143854ef = b_93b97f9e143854ef.words;
+::capnp::word const* const bp_d84f6e8c84cb7c57 = b_d84f6e8c84cb7c57.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_93b97f9e143854ef[] = {
-  &s_bbbd9ab104716176,
+static const ::capnp::_::RawSchema* const d_d84f6e8c84cb7c57[] = {
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_93b97f9e143854ef[] = {0};
-static const uint16_t i_93b97f9e143854ef[] = {0};
-const ::capnp::_::RawSchema s_93b97f9e143854ef = {
-  0x93b97f9e143854ef, b_93b97f9e143854ef.words, 34, d_93b97f9e143854ef, m_93b97f9e143854ef,
-  1, 1, i_93b97f9e143854ef, nullptr, nullptr, { &s_93b97f9e143854ef, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_d84f6e8c84cb7c57[] = {1, 0};
+static const uint16_t i_d84f6e8c84cb7c57[] = {0, 1};
+const ::capnp::_::RawSchema s_d84f6e8c84cb7c57 = {
+  0xd84f6e8c84cb7c57, b_d84f6e8c84cb7c57.words, 50, d_d84f6e8c84cb7c57, m_d84f6e8c84cb7c57,
+  1, 2, i_d84f6e8c84cb7c57, nullptr, nullptr, { &s_d84f6e8c84cb7c57, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<18> b_e8b0a65565680b41 = {
+static const ::capnp::_::AlignedData<20> b_b19110ff56d453fa = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     65,  11, 104, 101,  85, 166, 176, 232,
+    250,  83, 212,  86, 255,  16, 145, 177,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 130,   1,   0,   0,
+     21,   0,   0,   0, 202,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -1924,53 +3310,69 @@ static const ::capnp::_::AlignedData<18> b_e8b0a65565680b41 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 117, 110,  98, 105, 110, 100,  68,
-    101, 108, 101, 103,  97, 116, 101,  36,
-     82, 101, 115, 117, 108, 116, 115,   0, }
+     46, 117, 110, 114, 101, 103, 105, 115,
+    116, 101, 114,  79, 118, 101, 114, 114,
+    105, 100, 101,  67, 108,  97, 115, 115,
+     36,  82, 101, 115, 117, 108, 116, 115,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e8b0a65565680b41 = b_e8b0a65565680b41.words;
+::capnp::word const* const bp_b19110ff56d453fa = b_b19110ff56d453fa.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_e8b0a65565680b41 = {
-  0xe8b0a65565680b41, b_e8b0a65565680b41.words, 18, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_e8b0a65565680b41, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_b19110ff56d453fa = {
+  0xb19110ff56d453fa, b_b19110ff56d453fa.words, 20, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_b19110ff56d453fa, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<51> b_f0a1825f73741ede = {
+static const ::capnp::_::AlignedData<65> b_b98d880189098282 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    222,  30, 116, 115,  95, 130, 161, 240,
+    130, 130,   9, 137,   1, 136, 141, 185,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      2,   0,   7,   0,   0,   0,   0,   0,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 138,   1,   0,   0,
+     21,   0,   0,   0,  98,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  97, 100, 100,  77, 117, 108, 116,
-    105,  68, 101, 108, 101, 103,  97, 116,
-    101,  36,  80,  97, 114,  97, 109, 115,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     46, 115, 101, 116,  80, 114, 111, 112,
+    101, 114, 116, 121,  36,  80,  97, 114,
+     97, 109, 115,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  58,   0,   0,   0,
+     69,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     36,   0,   0,   0,   3,   0,   1,   0,
-     48,   0,   0,   0,   2,   0,   1,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  74,   0,   0,   0,
+     73,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     44,   0,   0,   0,   3,   0,   1,   0,
-     56,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    111, 119, 110, 101, 114,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -1978,180 +3380,194 @@ static const ::capnp::_::AlignedData<51> b_f0a1825f73741ede = {
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     99,  97, 108, 108,  98,  97,  99, 107,
+    112, 114, 111, 112, 101, 114, 116, 121,
       0,   0,   0,   0,   0,   0,   0,   0,
-     17,   0,   0,   0,   0,   0,   0,   0,
-    255, 207,  40,  47, 243, 127, 123, 158,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     17,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_f0a1825f73741ede = b_f0a1825f73741ede.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_f0a1825f73741ede[] = {
-  &s_9e7b7ff32f28cfff,
+::capnp::word const* const bp_b98d880189098282 = b_b98d880189098282.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_b98d880189098282[] = {
+  &s_a53c5ce887c3c1e6,
   &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_f0a1825f73741ede[] = {1, 0};
-static const uint16_t i_f0a1825f73741ede[] = {0, 1};
-const ::capnp::_::RawSchema s_f0a1825f73741ede = {
-  0xf0a1825f73741ede, b_f0a1825f73741ede.words, 51, d_f0a1825f73741ede, m_f0a1825f73741ede,
-  2, 2, i_f0a1825f73741ede, nullptr, nullptr, { &s_f0a1825f73741ede, nullptr, nullptr, 0, 0, nullptr }, true
+static const uint16_t m_b98d880189098282[] = {1, 2, 0};
+static const uint16_t i_b98d880189098282[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_b98d880189098282 = {
+  0xb98d880189098282, b_b98d880189098282.words, 65, d_b98d880189098282, m_b98d880189098282,
+  3, 3, i_b98d880189098282, nullptr, nullptr, { &s_b98d880189098282, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<36> b_bb2886aba98a7d6e = {
+static const ::capnp::_::AlignedData<18> b_a7e25842dfa5a75b = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    110, 125, 138, 169, 171, 134,  40, 187,
+     91, 167, 165, 223,  66,  88, 226, 167,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 146,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46,  97, 100, 100,  77, 117, 108, 116,
-    105,  68, 101, 108, 101, 103,  97, 116,
-    101,  36,  82, 101, 115, 117, 108, 116,
-    115,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0, 122,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     24,   0,   0,   0,   2,   0,   1,   0,
-    100, 101, 108, 101, 103,  97, 116, 101,
-     79,  98, 106, 101,  99, 116,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+     46, 115, 101, 116,  80, 114, 111, 112,
+    101, 114, 116, 121,  36,  82, 101, 115,
+    117, 108, 116, 115,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_bb2886aba98a7d6e = b_bb2886aba98a7d6e.words;
+::capnp::word const* const bp_a7e25842dfa5a75b = b_a7e25842dfa5a75b.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_bb2886aba98a7d6e[] = {
-  &s_bbbd9ab104716176,
-};
-static const uint16_t m_bb2886aba98a7d6e[] = {0};
-static const uint16_t i_bb2886aba98a7d6e[] = {0};
-const ::capnp::_::RawSchema s_bb2886aba98a7d6e = {
-  0xbb2886aba98a7d6e, b_bb2886aba98a7d6e.words, 36, d_bb2886aba98a7d6e, m_bb2886aba98a7d6e,
-  1, 1, i_bb2886aba98a7d6e, nullptr, nullptr, { &s_bb2886aba98a7d6e, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_a7e25842dfa5a75b = {
+  0xa7e25842dfa5a75b, b_a7e25842dfa5a75b.words, 18, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_a7e25842dfa5a75b, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<51> b_e596573cb7a70896 = {
+static const ::capnp::_::AlignedData<65> b_e3e7ec6b9d30864b = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    150,   8, 167, 183,  60,  87, 150, 229,
+     75, 134,  48, 157, 107, 236, 231, 227,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      2,   0,   7,   0,   0,   0,   0,   0,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 162,   1,   0,   0,
+     21,   0,   0,   0,  98,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0, 175,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 114, 101, 109, 111, 118, 101,  77,
-    117, 108, 116, 105,  68, 101, 108, 101,
-    103,  97, 116, 101,  36,  80,  97, 114,
+     46, 103, 101, 116,  80, 114, 111, 112,
+    101, 114, 116, 121,  36,  80,  97, 114,
      97, 109, 115,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  58,   0,   0,   0,
+     69,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     36,   0,   0,   0,   3,   0,   1,   0,
-     48,   0,   0,   0,   2,   0,   1,   0,
+     64,   0,   0,   0,   3,   0,   1,   0,
+     76,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0, 122,   0,   0,   0,
+     73,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     44,   0,   0,   0,   3,   0,   1,   0,
-     56,   0,   0,   0,   2,   0,   1,   0,
-    111,  98, 106, 101,  99, 116,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0, 106,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    100, 101, 108, 101, 103,  97, 116, 101,
-     79,  98, 106, 101,  99, 116,   0,   0,
+    111, 119, 110, 101, 114,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112, 114, 111, 112, 101, 114, 116, 121,
+     78,  97, 109, 101,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e596573cb7a70896 = b_e596573cb7a70896.words;
+::capnp::word const* const bp_e3e7ec6b9d30864b = b_e3e7ec6b9d30864b.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e596573cb7a70896[] = {
+static const ::capnp::_::RawSchema* const d_e3e7ec6b9d30864b[] = {
   &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_e596573cb7a70896[] = {1, 0};
-static const uint16_t i_e596573cb7a70896[] = {0, 1};
-const ::capnp::_::RawSchema s_e596573cb7a70896 = {
-  0xe596573cb7a70896, b_e596573cb7a70896.words, 51, d_e596573cb7a70896, m_e596573cb7a70896,
-  1, 2, i_e596573cb7a70896, nullptr, nullptr, { &s_e596573cb7a70896, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_e3e7ec6b9d30864b[] = {1, 2, 0};
+static const uint16_t i_e3e7ec6b9d30864b[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_e3e7ec6b9d30864b = {
+  0xe3e7ec6b9d30864b, b_e3e7ec6b9d30864b.words, 65, d_e3e7ec6b9d30864b, m_e3e7ec6b9d30864b,
+  2, 3, i_e3e7ec6b9d30864b, nullptr, nullptr, { &s_e3e7ec6b9d30864b, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<19> b_f524b8aa2fc26653 = {
+static const ::capnp::_::AlignedData<35> b_ff494a70ed24ffae = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     83, 102, 194,  47, 170, 184,  36, 245,
+    174, 255,  36, 237, 112,  74,  73, 255,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 170,   1,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 114, 101, 109, 111, 118, 101,  77,
-    117, 108, 116, 105,  68, 101, 108, 101,
-    103,  97, 116, 101,  36,  82, 101, 115,
-    117, 108, 116, 115,   0,   0,   0,   0, }
+     46, 103, 101, 116,  80, 114, 111, 112,
+    101, 114, 116, 121,  36,  82, 101, 115,
+    117, 108, 116, 115,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   1,   0,
+     24,   0,   0,   0,   2,   0,   1,   0,
+    112, 114, 111, 112, 101, 114, 116, 121,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_f524b8aa2fc26653 = b_f524b8aa2fc26653.words;
+::capnp::word const* const bp_ff494a70ed24ffae = b_ff494a70ed24ffae.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_f524b8aa2fc26653 = {
-  0xf524b8aa2fc26653, b_f524b8aa2fc26653.words, 19, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_f524b8aa2fc26653, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_ff494a70ed24ffae[] = {
+  &s_a53c5ce887c3c1e6,
+};
+static const uint16_t m_ff494a70ed24ffae[] = {0};
+static const uint16_t i_ff494a70ed24ffae[] = {0};
+const ::capnp::_::RawSchema s_ff494a70ed24ffae = {
+  0xff494a70ed24ffae, b_ff494a70ed24ffae.words, 35, d_ff494a70ed24ffae, m_ff494a70ed24ffae,
+  1, 1, i_ff494a70ed24ffae, nullptr, nullptr, { &s_ff494a70ed24ffae, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<69> b_e1a9d4e3c6455e25 = {
+static const ::capnp::_::AlignedData<67> b_95cc54545d641932 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     37,  94,  69, 198, 227, 212, 169, 225,
+     50,  25, 100,  93,  84,  84, 204, 149,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 178,   1,   0,   0,
+     21,   0,   0,   0, 194,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      37,   0,   0,   0, 175,   0,   0,   0,
@@ -2161,81 +3577,79 @@ static const ::capnp::_::AlignedData<69> b_e1a9d4e3c6455e25 = {
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
      46, 114, 101, 103, 105, 115, 116, 101,
-    114,  79, 118, 101, 114, 114, 105, 100,
-    101,  67, 108,  97, 115, 115,  36,  80,
-     97, 114,  97, 109, 115,   0,   0,   0,
+    114,  67, 114, 101,  97, 116, 101, 100,
+     80, 121,  79,  98, 106, 101,  99, 116,
+     36,  80,  97, 114,  97, 109, 115,   0,
      12,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,  66,   0,   0,   0,
+     69,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     64,   0,   0,   0,   3,   0,   1,   0,
-     76,   0,   0,   0,   2,   0,   1,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     73,   0,   0,   0,  58,   0,   0,   0,
+     77,   0,   0,   0, 106,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     68,   0,   0,   0,   3,   0,   1,   0,
-     80,   0,   0,   0,   2,   0,   1,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
       2,   0,   0,   0,   2,   0,   0,   0,
       0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     77,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     72,   0,   0,   0,   3,   0,   1,   0,
-    100,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+     85,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     80,   0,   0,   0,   3,   0,   1,   0,
+     92,   0,   0,   0,   2,   0,   1,   0,
+    112, 121,  79,  98, 106, 101,  99, 116,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112,  97, 114, 101, 110, 116,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    117, 110, 114, 101,  97, 108,  79,  98,
+    106, 101,  99, 116,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    109, 101, 116, 104, 111, 100, 115,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-     54, 231, 165,  52, 216, 119,  45, 143,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_e1a9d4e3c6455e25 = b_e1a9d4e3c6455e25.words;
+::capnp::word const* const bp_95cc54545d641932 = b_95cc54545d641932.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e1a9d4e3c6455e25[] = {
-  &s_8f2d77d834a5e736,
+static const ::capnp::_::RawSchema* const d_95cc54545d641932[] = {
+  &s_bbbd9ab104716176,
   &s_bda606608274c0bd,
 };
-static const uint16_t m_e1a9d4e3c6455e25[] = {2, 1, 0};
-static const uint16_t i_e1a9d4e3c6455e25[] = {0, 1, 2};
-const ::capnp::_::RawSchema s_e1a9d4e3c6455e25 = {
-  0xe1a9d4e3c6455e25, b_e1a9d4e3c6455e25.words, 69, d_e1a9d4e3c6455e25, m_e1a9d4e3c6455e25,
-  2, 3, i_e1a9d4e3c6455e25, nullptr, nullptr, { &s_e1a9d4e3c6455e25, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_95cc54545d641932[] = {0, 2, 1};
+static const uint16_t i_95cc54545d641932[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_95cc54545d641932 = {
+  0x95cc54545d641932, b_95cc54545d641932.words, 67, d_95cc54545d641932, m_95cc54545d641932,
+  2, 3, i_95cc54545d641932, nullptr, nullptr, { &s_95cc54545d641932, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<19> b_d8f836ed010a2e47 = {
+static const ::capnp::_::AlignedData<20> b_92051293bef37fa0 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     71,  46,  10,   1, 237,  54, 248, 216,
+    160, 127, 243, 190, 147,  18,   5, 146,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 186,   1,   0,   0,
+     21,   0,   0,   0, 202,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -2245,268 +3659,315 @@ static const ::capnp::_::AlignedData<19> b_d8f836ed010a2e47 = {
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
      46, 114, 101, 103, 105, 115, 116, 101,
-    114,  79, 118, 101, 114, 114, 105, 100,
-    101,  67, 108,  97, 115, 115,  36,  82,
-    101, 115, 117, 108, 116, 115,   0,   0, }
+    114,  67, 114, 101,  97, 116, 101, 100,
+     80, 121,  79,  98, 106, 101,  99, 116,
+     36,  82, 101, 115, 117, 108, 116, 115,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_d8f836ed010a2e47 = b_d8f836ed010a2e47.words;
+::capnp::word const* const bp_92051293bef37fa0 = b_92051293bef37fa0.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_d8f836ed010a2e47 = {
-  0xd8f836ed010a2e47, b_d8f836ed010a2e47.words, 19, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_d8f836ed010a2e47, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_92051293bef37fa0 = {
+  0x92051293bef37fa0, b_92051293bef37fa0.words, 20, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_92051293bef37fa0, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<50> b_d84f6e8c84cb7c57 = {
+static const ::capnp::_::AlignedData<81> b_a5f2e034f5cf3ef2 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     87, 124, 203, 132, 140, 110,  79, 216,
+    242,  62, 207, 245,  52, 224, 242, 165,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      2,   0,   7,   0,   0,   0,   0,   0,
+      4,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 194,   1,   0,   0,
+     21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 119,   0,   0,   0,
+     33,   0,   0,   0, 231,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 117, 110, 114, 101, 103, 105, 115,
-    116, 101, 114,  79, 118, 101, 114, 114,
-    105, 100, 101,  67, 108,  97, 115, 115,
-     36,  80,  97, 114,  97, 109, 115,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     46, 110, 101, 119,  67, 111, 110, 116,
+     97, 105, 110, 101, 114,  36,  80,  97,
+    114,  97, 109, 115,   0,   0,   0,   0,
+     16,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  66,   0,   0,   0,
+     97,   0,   0,   0,  34,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     36,   0,   0,   0,   3,   0,   1,   0,
-     48,   0,   0,   0,   2,   0,   1,   0,
+     92,   0,   0,   0,   3,   0,   1,   0,
+    104,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,  58,   0,   0,   0,
+    101,   0,   0,   0, 114,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     40,   0,   0,   0,   3,   0,   1,   0,
-     52,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
+    100,   0,   0,   0,   3,   0,   1,   0,
+    112,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    109,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    108,   0,   0,   0,   3,   0,   1,   0,
+    120,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,   0,   0,   0,   3,   0,   1,   0,
+    124,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112,  97, 114, 101, 110, 116,   0,   0,
+     99, 111, 110, 116,  97, 105, 110, 101,
+    114,  84, 121, 112, 101,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_d84f6e8c84cb7c57 = b_d84f6e8c84cb7c57.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_d84f6e8c84cb7c57[] = {
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_d84f6e8c84cb7c57[] = {1, 0};
-static const uint16_t i_d84f6e8c84cb7c57[] = {0, 1};
-const ::capnp::_::RawSchema s_d84f6e8c84cb7c57 = {
-  0xd84f6e8c84cb7c57, b_d84f6e8c84cb7c57.words, 50, d_d84f6e8c84cb7c57, m_d84f6e8c84cb7c57,
-  1, 2, i_d84f6e8c84cb7c57, nullptr, nullptr, { &s_d84f6e8c84cb7c57, nullptr, nullptr, 0, 0, nullptr }, false
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<20> b_b19110ff56d453fa = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    250,  83, 212,  86, 255,  16, 145, 177,
-     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
+    118,  97, 108, 117, 101,  84, 121, 112,
+    101,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 202,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    107, 101, 121,  84, 121, 112, 101,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46, 117, 110, 114, 101, 103, 105, 115,
-    116, 101, 114,  79, 118, 101, 114, 114,
-    105, 100, 101,  67, 108,  97, 115, 115,
-     36,  82, 101, 115, 117, 108, 116, 115,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_b19110ff56d453fa = b_b19110ff56d453fa.words;
+::capnp::word const* const bp_a5f2e034f5cf3ef2 = b_a5f2e034f5cf3ef2.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_b19110ff56d453fa = {
-  0xb19110ff56d453fa, b_b19110ff56d453fa.words, 20, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_b19110ff56d453fa, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_a5f2e034f5cf3ef2[] = {
+  &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
+};
+static const uint16_t m_a5f2e034f5cf3ef2[] = {1, 3, 0, 2};
+static const uint16_t i_a5f2e034f5cf3ef2[] = {0, 1, 2, 3};
+const ::capnp::_::RawSchema s_a5f2e034f5cf3ef2 = {
+  0xa5f2e034f5cf3ef2, b_a5f2e034f5cf3ef2.words, 81, d_a5f2e034f5cf3ef2, m_a5f2e034f5cf3ef2,
+  2, 4, i_a5f2e034f5cf3ef2, nullptr, nullptr, { &s_a5f2e034f5cf3ef2, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<65> b_b98d880189098282 = {
+static const ::capnp::_::AlignedData<35> b_ae7fcc084082d1c0 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    130, 130,   9, 137,   1, 136, 141, 185,
+    192, 209, 130,  64,   8, 204, 127, 174,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      3,   0,   7,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  98,   1,   0,   0,
+     21,   0,   0,   0, 114,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 175,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 115, 101, 116,  80, 114, 111, 112,
-    101, 114, 116, 121,  36,  80,  97, 114,
-     97, 109, 115,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   4,   0,
+     46, 110, 101, 119,  67, 111, 110, 116,
+     97, 105, 110, 101, 114,  36,  82, 101,
+    115, 117, 108, 116, 115,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,  66,   0,   0,   0,
+     13,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     64,   0,   0,   0,   3,   0,   1,   0,
-     76,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   1,   0,
+     24,   0,   0,   0,   2,   0,   1,   0,
+     99, 111, 110, 116,  97, 105, 110, 101,
+    114,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
-     73,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     68,   0,   0,   0,   3,   0,   1,   0,
-     80,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     77,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_ae7fcc084082d1c0 = b_ae7fcc084082d1c0.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_ae7fcc084082d1c0[] = {
+  &s_bbbd9ab104716176,
+};
+static const uint16_t m_ae7fcc084082d1c0[] = {0};
+static const uint16_t i_ae7fcc084082d1c0[] = {0};
+const ::capnp::_::RawSchema s_ae7fcc084082d1c0 = {
+  0xae7fcc084082d1c0, b_ae7fcc084082d1c0.words, 35, d_ae7fcc084082d1c0, m_ae7fcc084082d1c0,
+  1, 1, i_ae7fcc084082d1c0, nullptr, nullptr, { &s_ae7fcc084082d1c0, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<35> b_99203a7e28b05827 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     39,  88, 176,  40, 126,  58,  32, 153,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     76,   0,   0,   0,   3,   0,   1,   0,
-     88,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 138,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111, 119, 110, 101, 114,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 100, 101, 115, 116, 114, 111, 121,
+     67, 111, 110, 116,  97, 105, 110, 101,
+    114,  36,  80,  97, 114,  97, 109, 115,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112, 114, 111, 112, 101, 114, 116, 121,
+     13,   0,   0,   0,  34,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_b98d880189098282 = b_b98d880189098282.words;
+::capnp::word const* const bp_99203a7e28b05827 = b_99203a7e28b05827.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_b98d880189098282[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_99203a7e28b05827[] = {
   &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
 };
-static const uint16_t m_b98d880189098282[] = {1, 2, 0};
-static const uint16_t i_b98d880189098282[] = {0, 1, 2};
-const ::capnp::_::RawSchema s_b98d880189098282 = {
-  0xb98d880189098282, b_b98d880189098282.words, 65, d_b98d880189098282, m_b98d880189098282,
-  3, 3, i_b98d880189098282, nullptr, nullptr, { &s_b98d880189098282, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_99203a7e28b05827[] = {0};
+static const uint16_t i_99203a7e28b05827[] = {0};
+const ::capnp::_::RawSchema s_99203a7e28b05827 = {
+  0x99203a7e28b05827, b_99203a7e28b05827.words, 35, d_99203a7e28b05827, m_99203a7e28b05827,
+  1, 1, i_99203a7e28b05827, nullptr, nullptr, { &s_99203a7e28b05827, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<18> b_a7e25842dfa5a75b = {
+static const ::capnp::_::AlignedData<35> b_bf109ec66ad97a7d = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     91, 167, 165, 223,  66,  88, 226, 167,
-     25,   0,   0,   0,   1,   0,   0,   0,
+    125, 122, 217, 106, 198, 158,  16, 191,
+     25,   0,   0,   0,   1,   0,   1,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 106,   1,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 146,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     37,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 115, 101, 116,  80, 114, 111, 112,
-    101, 114, 116, 121,  36,  82, 101, 115,
-    117, 108, 116, 115,   0,   0,   0,   0, }
+     46, 100, 101, 115, 116, 114, 111, 121,
+     67, 111, 110, 116,  97, 105, 110, 101,
+    114,  36,  82, 101, 115, 117, 108, 116,
+    115,   0,   0,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    114, 101, 115, 117, 108, 116,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_a7e25842dfa5a75b = b_a7e25842dfa5a75b.words;
+::capnp::word const* const bp_bf109ec66ad97a7d = b_bf109ec66ad97a7d.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_a7e25842dfa5a75b = {
-  0xa7e25842dfa5a75b, b_a7e25842dfa5a75b.words, 18, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_a7e25842dfa5a75b, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_bf109ec66ad97a7d[] = {0};
+static const uint16_t i_bf109ec66ad97a7d[] = {0};
+const ::capnp::_::RawSchema s_bf109ec66ad97a7d = {
+  0xbf109ec66ad97a7d, b_bf109ec66ad97a7d.words, 35, nullptr, m_bf109ec66ad97a7d,
+  0, 1, i_bf109ec66ad97a7d, nullptr, nullptr, { &s_bf109ec66ad97a7d, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<65> b_e3e7ec6b9d30864b = {
+static const ::capnp::_::AlignedData<97> b_f4c4171c5fb749dd = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     75, 134,  48, 157, 107, 236, 231, 227,
+    221,  73, 183,  95,  28,  23, 196, 244,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      3,   0,   7,   0,   0,   0,   0,   0,
+      5,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  98,   1,   0,   0,
+     21,   0,   0,   0, 154,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 175,   0,   0,   0,
+     37,   0,   0,   0,  31,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 103, 101, 116,  80, 114, 111, 112,
-    101, 114, 116, 121,  36,  80,  97, 114,
-     97, 109, 115,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   4,   0,
+     46,  99,  97, 108, 108,  70, 117, 110,
+     99, 116, 105, 111, 110,  80,  97,  99,
+    107, 101, 100,  36,  80,  97, 114,  97,
+    109, 115,   0,   0,   0,   0,   0,   0,
+     20,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,  66,   0,   0,   0,
+    125,   0,   0,   0,  34,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     64,   0,   0,   0,   3,   0,   1,   0,
-     76,   0,   0,   0,   2,   0,   1,   0,
+    120,   0,   0,   0,   3,   0,   1,   0,
+    132,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     73,   0,   0,   0,  50,   0,   0,   0,
+    129,   0,   0,   0,  90,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     68,   0,   0,   0,   3,   0,   1,   0,
-     80,   0,   0,   0,   2,   0,   1,   0,
+    128,   0,   0,   0,   3,   0,   1,   0,
+    140,   0,   0,   0,   2,   0,   1,   0,
       2,   0,   0,   0,   2,   0,   0,   0,
       0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     77,   0,   0,   0, 106,   0,   0,   0,
+    137,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     76,   0,   0,   0,   3,   0,   1,   0,
-     88,   0,   0,   0,   2,   0,   1,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+    132,   0,   0,   0,   3,   0,   1,   0,
+    144,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   3,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    141,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+    140,   0,   0,   0,   3,   0,   1,   0,
+    152,   0,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   4,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    149,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    111, 119, 110, 101, 114,   0,   0,   0,
+    144,   0,   0,   0,   3,   0,   1,   0,
+    156,   0,   0,   0,   2,   0,   1,   0,
+    111, 119, 110,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
     118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -2514,168 +3975,132 @@ static const ::capnp::_::AlignedData<65> b_e3e7ec6b9d30864b = {
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    112, 114, 111, 112, 101, 114, 116, 121,
-     78,  97, 109, 101,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     99,  97, 108, 108,  79,  98, 106, 101,
+     99, 116,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_e3e7ec6b9d30864b = b_e3e7ec6b9d30864b.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e3e7ec6b9d30864b[] = {
-  &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_e3e7ec6b9d30864b[] = {1, 2, 0};
-static const uint16_t i_e3e7ec6b9d30864b[] = {0, 1, 2};
-const ::capnp::_::RawSchema s_e3e7ec6b9d30864b = {
-  0xe3e7ec6b9d30864b, b_e3e7ec6b9d30864b.words, 65, d_e3e7ec6b9d30864b, m_e3e7ec6b9d30864b,
-  2, 3, i_e3e7ec6b9d30864b, nullptr, nullptr, { &s_e3e7ec6b9d30864b, nullptr, nullptr, 0, 0, nullptr }, false
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<35> b_ff494a70ed24ffae = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    174, 255,  36, 237, 112,  74,  73, 255,
-     25,   0,   0,   0,   1,   0,   0,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 106,   1,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0,  63,   0,   0,   0,
+    102, 117, 110,  99,  78,  97, 109, 101,
       0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  95,  99, 111, 114, 101,  46,
-     99,  97, 112, 110, 112,  58,  85, 110,
-    114, 101,  97, 108,  67, 111, 114, 101,
-     46, 103, 101, 116,  80, 114, 111, 112,
-    101, 114, 116, 121,  36,  82, 101, 115,
-    117, 108, 116, 115,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  74,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     24,   0,   0,   0,   2,   0,   1,   0,
-    112, 114, 111, 112, 101, 114, 116, 121,
       0,   0,   0,   0,   0,   0,   0,   0,
+    112,  97, 114,  97, 109, 115,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    230, 193, 195, 135, 232,  92,  60, 165,
+    232, 232, 226,   1, 144,  88, 140, 170,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_ff494a70ed24ffae = b_ff494a70ed24ffae.words;
+::capnp::word const* const bp_f4c4171c5fb749dd = b_f4c4171c5fb749dd.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_ff494a70ed24ffae[] = {
-  &s_a53c5ce887c3c1e6,
+static const ::capnp::_::RawSchema* const d_f4c4171c5fb749dd[] = {
+  &s_aa8c589001e2e8e8,
+  &s_bbbd9ab104716176,
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_ff494a70ed24ffae[] = {0};
-static const uint16_t i_ff494a70ed24ffae[] = {0};
-const ::capnp::_::RawSchema s_ff494a70ed24ffae = {
-  0xff494a70ed24ffae, b_ff494a70ed24ffae.words, 35, d_ff494a70ed24ffae, m_ff494a70ed24ffae,
-  1, 1, i_ff494a70ed24ffae, nullptr, nullptr, { &s_ff494a70ed24ffae, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_f4c4171c5fb749dd[] = {1, 3, 0, 4, 2};
+static const uint16_t i_f4c4171c5fb749dd[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_f4c4171c5fb749dd = {
+  0xf4c4171c5fb749dd, b_f4c4171c5fb749dd.words, 97, d_f4c4171c5fb749dd, m_f4c4171c5fb749dd,
+  3, 5, i_f4c4171c5fb749dd, nullptr, nullptr, { &s_f4c4171c5fb749dd, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<67> b_95cc54545d641932 = {
+static const ::capnp::_::AlignedData<55> b_d872fab1bdb92e5e = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     50,  25, 100,  93,  84,  84, 204, 149,
+     94,  46, 185, 189, 177, 250, 114, 216,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      3,   0,   7,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 194,   1,   0,   0,
+     21,   0,   0,   0, 162,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 175,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 114, 101, 103, 105, 115, 116, 101,
-    114,  67, 114, 101,  97, 116, 101, 100,
-     80, 121,  79,  98, 106, 101,  99, 116,
-     36,  80,  97, 114,  97, 109, 115,   0,
-     12,   0,   0,   0,   3,   0,   4,   0,
+     46,  99,  97, 108, 108,  70, 117, 110,
+     99, 116, 105, 111, 110,  80,  97,  99,
+    107, 101, 100,  36,  82, 101, 115, 117,
+    108, 116, 115,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,  74,   0,   0,   0,
+     41,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     68,   0,   0,   0,   3,   0,   1,   0,
-     80,   0,   0,   0,   2,   0,   1,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     48,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     77,   0,   0,   0, 106,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     76,   0,   0,   0,   3,   0,   1,   0,
-     88,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     85,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     80,   0,   0,   0,   3,   0,   1,   0,
-     92,   0,   0,   0,   2,   0,   1,   0,
-    112, 121,  79,  98, 106, 101,  99, 116,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     45,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     72,   0,   0,   0,   2,   0,   1,   0,
+    114, 101, 116, 117, 114, 110,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
+    230, 193, 195, 135, 232,  92,  60, 165,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 110, 114, 101,  97, 108,  79,  98,
-    106, 101,  99, 116,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+    111, 117, 116,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    117, 101,  67, 108,  97, 115, 115,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+    230, 193, 195, 135, 232,  92,  60, 165,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_95cc54545d641932 = b_95cc54545d641932.words;
+::capnp::word const* const bp_d872fab1bdb92e5e = b_d872fab1bdb92e5e.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_95cc54545d641932[] = {
-  &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
+static const ::capnp::_::RawSchema* const d_d872fab1bdb92e5e[] = {
+  &s_a53c5ce887c3c1e6,
 };
-static const uint16_t m_95cc54545d641932[] = {0, 2, 1};
-static const uint16_t i_95cc54545d641932[] = {0, 1, 2};
-const ::capnp::_::RawSchema s_95cc54545d641932 = {
-  0x95cc54545d641932, b_95cc54545d641932.words, 67, d_95cc54545d641932, m_95cc54545d641932,
-  2, 3, i_95cc54545d641932, nullptr, nullptr, { &s_95cc54545d641932, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_d872fab1bdb92e5e[] = {1, 0};
+static const uint16_t i_d872fab1bdb92e5e[] = {0, 1};
+const ::capnp::_::RawSchema s_d872fab1bdb92e5e = {
+  0xd872fab1bdb92e5e, b_d872fab1bdb92e5e.words, 55, d_d872fab1bdb92e5e, m_d872fab1bdb92e5e,
+  1, 2, i_d872fab1bdb92e5e, nullptr, nullptr, { &s_d872fab1bdb92e5e, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<20> b_92051293bef37fa0 = {
+static const ::capnp::_::AlignedData<18> b_d1f5e729d712c951 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    160, 127, 243, 190, 147,  18,   5, 146,
+     81, 201,  18, 215,  41, 231, 245, 209,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 202,   1,   0,   0,
+     21,   0,   0,   0,  98,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
@@ -2684,123 +4109,98 @@ static const ::capnp::_::AlignedData<20> b_92051293bef37fa0 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 114, 101, 103, 105, 115, 116, 101,
-    114,  67, 114, 101,  97, 116, 101, 100,
-     80, 121,  79,  98, 106, 101,  99, 116,
-     36,  82, 101, 115, 117, 108, 116, 115,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+     46, 103, 101, 116,  70, 101,  97, 116,
+    117, 114, 101, 115,  36,  80,  97, 114,
+     97, 109, 115,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_92051293bef37fa0 = b_92051293bef37fa0.words;
+::capnp::word const* const bp_d1f5e729d712c951 = b_d1f5e729d712c951.words;
 #if !CAPNP_LITE
-const ::capnp::_::RawSchema s_92051293bef37fa0 = {
-  0x92051293bef37fa0, b_92051293bef37fa0.words, 20, nullptr, nullptr,
-  0, 0, nullptr, nullptr, nullptr, { &s_92051293bef37fa0, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_d1f5e729d712c951 = {
+  0xd1f5e729d712c951, b_d1f5e729d712c951.words, 18, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_d1f5e729d712c951, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<81> b_a5f2e034f5cf3ef2 = {
+static const ::capnp::_::AlignedData<35> b_dd6a28a4b023a079 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    242,  62, 207, 245,  52, 224, 242, 165,
-     25,   0,   0,   0,   1,   0,   0,   0,
+    121, 160,  35, 176, 164,  40, 106, 221,
+     25,   0,   0,   0,   1,   0,   1,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      21,   0,   0,   0, 106,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 231,   0,   0,   0,
+     33,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 110, 101, 119,  67, 111, 110, 116,
-     97, 105, 110, 101, 114,  36,  80,  97,
-    114,  97, 109, 115,   0,   0,   0,   0,
-     16,   0,   0,   0,   3,   0,   4,   0,
+     46, 103, 101, 116,  70, 101,  97, 116,
+    117, 114, 101, 115,  36,  82, 101, 115,
+    117, 108, 116, 115,   0,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     97,   0,   0,   0,  34,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     92,   0,   0,   0,   3,   0,   1,   0,
-    104,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    101,   0,   0,   0, 114,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    100,   0,   0,   0,   3,   0,   1,   0,
-    112,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    109,   0,   0,   0,  82,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    108,   0,   0,   0,   3,   0,   1,   0,
-    120,   0,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,   3,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    117,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112,   0,   0,   0,   3,   0,   1,   0,
-    124,   0,   0,   0,   2,   0,   1,   0,
-    111, 119, 110,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     99, 111, 110, 116,  97, 105, 110, 101,
-    114,  84, 121, 112, 101,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+     12,   0,   0,   0,   3,   0,   1,   0,
+     24,   0,   0,   0,   2,   0,   1,   0,
+    102, 101,  97, 116, 117, 114, 101, 115,
       0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 108, 117, 101,  84, 121, 112,
-    101,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
+      9,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_dd6a28a4b023a079 = b_dd6a28a4b023a079.words;
+#if !CAPNP_LITE
+static const uint16_t m_dd6a28a4b023a079[] = {0};
+static const uint16_t i_dd6a28a4b023a079[] = {0};
+const ::capnp::_::RawSchema s_dd6a28a4b023a079 = {
+  0xdd6a28a4b023a079, b_dd6a28a4b023a079.words, 35, nullptr, m_dd6a28a4b023a079,
+  0, 1, i_dd6a28a4b023a079, nullptr, nullptr, { &s_dd6a28a4b023a079, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<18> b_c0e6761c7094631b = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     27,  99, 148, 112,  28, 118, 230, 192,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 122,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    107, 101, 121,  84, 121, 112, 101,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+      0,   0,   0,   0,   0,   0,   0,   0,
+    117, 101,  95,  99, 111, 114, 101,  46,
+     99,  97, 112, 110, 112,  58,  85, 110,
+    114, 101,  97, 108,  67, 111, 114, 101,
+     46, 100, 117, 109, 112,  82, 101, 102,
+    108, 101,  99, 116, 105, 111, 110,  36,
+     80,  97, 114,  97, 109, 115,   0,   0, }
 };
-::capnp::word const* const bp_a5f2e034f5cf3ef2 = b_a5f2e034f5cf3ef2.words;
+::capnp::word const* const bp_c0e6761c7094631b = b_c0e6761c7094631b.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_a5f2e034f5cf3ef2[] = {
-  &s_bbbd9ab104716176,
-  &s_bda606608274c0bd,
-};
-static const uint16_t m_a5f2e034f5cf3ef2[] = {1, 3, 0, 2};
-static const uint16_t i_a5f2e034f5cf3ef2[] = {0, 1, 2, 3};
-const ::capnp::_::RawSchema s_a5f2e034f5cf3ef2 = {
-  0xa5f2e034f5cf3ef2, b_a5f2e034f5cf3ef2.words, 81, d_a5f2e034f5cf3ef2, m_a5f2e034f5cf3ef2,
-  2, 4, i_a5f2e034f5cf3ef2, nullptr, nullptr, { &s_a5f2e034f5cf3ef2, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_c0e6761c7094631b = {
+  0xc0e6761c7094631b, b_c0e6761c7094631b.words, 18, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_c0e6761c7094631b, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<35> b_ae7fcc084082d1c0 = {
+static const ::capnp::_::AlignedData<34> b_d959301e8163c718 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    192, 209, 130,  64,   8, 204, 127, 174,
+     24, 199,  99, 129,  30,  48,  89, 217,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 114,   1,   0,   0,
+     21,   0,   0,   0, 130,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      33,   0,   0,   0,  63,   0,   0,   0,
@@ -2809,47 +4209,43 @@ static const ::capnp::_::AlignedData<35> b_ae7fcc084082d1c0 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 110, 101, 119,  67, 111, 110, 116,
-     97, 105, 110, 101, 114,  36,  82, 101,
-    115, 117, 108, 116, 115,   0,   0,   0,
+     46, 100, 117, 109, 112,  82, 101, 102,
+    108, 101,  99, 116, 105, 111, 110,  36,
+     82, 101, 115, 117, 108, 116, 115,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  82,   0,   0,   0,
+     13,   0,   0,   0,  42,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     24,   0,   0,   0,   2,   0,   1,   0,
-     99, 111, 110, 116,  97, 105, 110, 101,
-    114,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    100, 117, 109, 112,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_ae7fcc084082d1c0 = b_ae7fcc084082d1c0.words;
+::capnp::word const* const bp_d959301e8163c718 = b_d959301e8163c718.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_ae7fcc084082d1c0[] = {
-  &s_bbbd9ab104716176,
-};
-static const uint16_t m_ae7fcc084082d1c0[] = {0};
-static const uint16_t i_ae7fcc084082d1c0[] = {0};
-const ::capnp::_::RawSchema s_ae7fcc084082d1c0 = {
-  0xae7fcc084082d1c0, b_ae7fcc084082d1c0.words, 35, d_ae7fcc084082d1c0, m_ae7fcc084082d1c0,
-  1, 1, i_ae7fcc084082d1c0, nullptr, nullptr, { &s_ae7fcc084082d1c0, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_d959301e8163c718[] = {0};
+static const uint16_t i_d959301e8163c718[] = {0};
+const ::capnp::_::RawSchema s_d959301e8163c718 = {
+  0xd959301e8163c718, b_d959301e8163c718.words, 34, nullptr, m_d959301e8163c718,
+  0, 1, i_d959301e8163c718, nullptr, nullptr, { &s_d959301e8163c718, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<35> b_99203a7e28b05827 = {
+static const ::capnp::_::AlignedData<35> b_84752c45c4ec5dec = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     39,  88, 176,  40, 126,  58,  32, 153,
+    236,  93, 236, 196,  69,  44, 117, 132,
      25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 138,   1,   0,   0,
+     21,   0,   0,   0, 146,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      37,   0,   0,   0,  63,   0,   0,   0,
@@ -2858,83 +4254,107 @@ static const ::capnp::_::AlignedData<35> b_99203a7e28b05827 = {
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 100, 101, 115, 116, 114, 111, 121,
-     67, 111, 110, 116,  97, 105, 110, 101,
-    114,  36,  80,  97, 114,  97, 109, 115,
-      0,   0,   0,   0,   0,   0,   0,   0,
+     46, 103, 101, 116,  67, 108,  97, 115,
+    115,  72, 105, 101, 114,  97, 114,  99,
+    104, 121,  36,  80,  97, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  34,   0,   0,   0,
+     13,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   1,   0,
      20,   0,   0,   0,   2,   0,   1,   0,
-    111, 119, 110,   0,   0,   0,   0,   0,
+    117, 101,  67, 108,  97, 115, 115,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    118,  97, 113,   4, 177, 154, 189, 187,
+    189, 192, 116, 130,  96,   6, 166, 189,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_99203a7e28b05827 = b_99203a7e28b05827.words;
+::capnp::word const* const bp_84752c45c4ec5dec = b_84752c45c4ec5dec.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_99203a7e28b05827[] = {
-  &s_bbbd9ab104716176,
+static const ::capnp::_::RawSchema* const d_84752c45c4ec5dec[] = {
+  &s_bda606608274c0bd,
 };
-static const uint16_t m_99203a7e28b05827[] = {0};
-static const uint16_t i_99203a7e28b05827[] = {0};
-const ::capnp::_::RawSchema s_99203a7e28b05827 = {
-  0x99203a7e28b05827, b_99203a7e28b05827.words, 35, d_99203a7e28b05827, m_99203a7e28b05827,
-  1, 1, i_99203a7e28b05827, nullptr, nullptr, { &s_99203a7e28b05827, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_84752c45c4ec5dec[] = {0};
+static const uint16_t i_84752c45c4ec5dec[] = {0};
+const ::capnp::_::RawSchema s_84752c45c4ec5dec = {
+  0x84752c45c4ec5dec, b_84752c45c4ec5dec.words, 35, d_84752c45c4ec5dec, m_84752c45c4ec5dec,
+  1, 1, i_84752c45c4ec5dec, nullptr, nullptr, { &s_84752c45c4ec5dec, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<35> b_bf109ec66ad97a7d = {
+static const ::capnp::_::AlignedData<59> b_fafaac91b4eb50a5 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    125, 122, 217, 106, 198, 158,  16, 191,
-     25,   0,   0,   0,   1,   0,   1,   0,
+    165,  80, 235, 180, 145, 172, 250, 250,
+     25,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   7,   0,   0,   0,   0,   0,
+      2,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 146,   1,   0,   0,
+     21,   0,   0,   0, 154,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0,  63,   0,   0,   0,
+     37,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     117, 101,  95,  99, 111, 114, 101,  46,
      99,  97, 112, 110, 112,  58,  85, 110,
     114, 101,  97, 108,  67, 111, 114, 101,
-     46, 100, 101, 115, 116, 114, 111, 121,
-     67, 111, 110, 116,  97, 105, 110, 101,
-    114,  36,  82, 101, 115, 117, 108, 116,
-    115,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     46, 103, 101, 116,  67, 108,  97, 115,
+    115,  72, 105, 101, 114,  97, 114,  99,
+    104, 121,  36,  82, 101, 115, 117, 108,
+    116, 115,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  58,   0,   0,   0,
+     41,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     20,   0,   0,   0,   2,   0,   1,   0,
-    114, 101, 115, 117, 108, 116,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
+     36,   0,   0,   0,   3,   0,   1,   0,
+     64,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     61,   0,   0,   0,  90,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     60,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+    112,  97, 114, 101, 110, 116, 115,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 116, 101, 114, 102,  97,  99,
+    101, 115,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_bf109ec66ad97a7d = b_bf109ec66ad97a7d.words;
+::capnp::word const* const bp_fafaac91b4eb50a5 = b_fafaac91b4eb50a5.words;
 #if !CAPNP_LITE
-static const uint16_t m_bf109ec66ad97a7d[] = {0};
-static const uint16_t i_bf109ec66ad97a7d[] = {0};
-const ::capnp::_::RawSchema s_bf109ec66ad97a7d = {
-  0xbf109ec66ad97a7d, b_bf109ec66ad97a7d.words, 35, nullptr, m_bf109ec66ad97a7d,
-  0, 1, i_bf109ec66ad97a7d, nullptr, nullptr, { &s_bf109ec66ad97a7d, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_fafaac91b4eb50a5[] = {1, 0};
+static const uint16_t i_fafaac91b4eb50a5[] = {0, 1};
+const ::capnp::_::RawSchema s_fafaac91b4eb50a5 = {
+  0xfafaac91b4eb50a5, b_fafaac91b4eb50a5.words, 59, nullptr, m_fafaac91b4eb50a5,
+  0, 2, i_fafaac91b4eb50a5, nullptr, nullptr, { &s_fafaac91b4eb50a5, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
 }  // namespace schemas
@@ -3124,6 +4544,46 @@ UnrealCore::Client::destroyContainerRequest(::kj::Maybe< ::capnp::MessageSize> s
       "ue_core.capnp:UnrealCore", "destroyContainer",
       0x8e1737faadc1c8beull, 17);
 }
+::capnp::Request< ::UnrealCore::CallFunctionPackedParams,  ::UnrealCore::CallFunctionPackedResults>
+UnrealCore::Client::callFunctionPackedRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::UnrealCore::CallFunctionPackedParams,  ::UnrealCore::CallFunctionPackedResults>(
+      0x8e1737faadc1c8beull, 18, sizeHint, {true});
+}
+::kj::Promise<void> UnrealCore::Server::callFunctionPacked(CallFunctionPackedContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "ue_core.capnp:UnrealCore", "callFunctionPacked",
+      0x8e1737faadc1c8beull, 18);
+}
+::capnp::Request< ::UnrealCore::GetFeaturesParams,  ::UnrealCore::GetFeaturesResults>
+UnrealCore::Client::getFeaturesRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::UnrealCore::GetFeaturesParams,  ::UnrealCore::GetFeaturesResults>(
+      0x8e1737faadc1c8beull, 19, sizeHint, {true});
+}
+::kj::Promise<void> UnrealCore::Server::getFeatures(GetFeaturesContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "ue_core.capnp:UnrealCore", "getFeatures",
+      0x8e1737faadc1c8beull, 19);
+}
+::capnp::Request< ::UnrealCore::DumpReflectionParams,  ::UnrealCore::DumpReflectionResults>
+UnrealCore::Client::dumpReflectionRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::UnrealCore::DumpReflectionParams,  ::UnrealCore::DumpReflectionResults>(
+      0x8e1737faadc1c8beull, 20, sizeHint, {true});
+}
+::kj::Promise<void> UnrealCore::Server::dumpReflection(DumpReflectionContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "ue_core.capnp:UnrealCore", "dumpReflection",
+      0x8e1737faadc1c8beull, 20);
+}
+::capnp::Request< ::UnrealCore::GetClassHierarchyParams,  ::UnrealCore::GetClassHierarchyResults>
+UnrealCore::Client::getClassHierarchyRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::UnrealCore::GetClassHierarchyParams,  ::UnrealCore::GetClassHierarchyResults>(
+      0x8e1737faadc1c8beull, 21, sizeHint, {true});
+}
+::kj::Promise<void> UnrealCore::Server::getClassHierarchy(GetClassHierarchyContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "ue_core.capnp:UnrealCore", "getClassHierarchy",
+      0x8e1737faadc1c8beull, 21);
+}
 ::capnp::Capability::Server::DispatchCallResult UnrealCore::Server::dispatchCall(
     uint64_t interfaceId, uint16_t methodId,
     ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context) {
@@ -3264,6 +4724,34 @@ UnrealCore::Client::destroyContainerRequest(::kj::Maybe< ::capnp::MessageSize> s
         false,
         false
       };
+    case 18:
+      return {
+        callFunctionPacked(::capnp::Capability::Server::internalGetTypedContext<
+             ::UnrealCore::CallFunctionPackedParams,  ::UnrealCore::CallFunctionPackedResults>(context)),
+        false,
+        false
+      };
+    case 19:
+      return {
+        getFeatures(::capnp::Capability::Server::internalGetTypedContext<
+             ::UnrealCore::GetFeaturesParams,  ::UnrealCore::GetFeaturesResults>(context)),
+        false,
+        false
+      };
+    case 20:
+      return {
+        dumpReflection(::capnp::Capability::Server::internalGetTypedContext<
+             ::UnrealCore::DumpReflectionParams,  ::UnrealCore::DumpReflectionResults>(context)),
+        false,
+        false
+      };
+    case 21:
+      return {
+        getClassHierarchy(::capnp::Capability::Server::internalGetTypedContext<
+             ::UnrealCore::GetClassHierarchyParams,  ::UnrealCore::GetClassHierarchyResults>(context)),
+        false,
+        false
+      };
     default:
       (void)context;
       return ::capnp::Capability::Server::internalUnimplemented(
@@ -3305,6 +4793,66 @@ constexpr ::capnp::_::RawSchema const* UnrealCore::Class::_capnpPrivate::schema;
 #endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 #endif  // !CAPNP_LITE
 
+// UnrealCore::Vector2D
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::Vector2D::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::Vector2D::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::Vector2D::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::Vector2D::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::Vector
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::Vector::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::Vector::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::Vector::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::Vector::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::Rotator
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::Rotator::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::Rotator::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::Rotator::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::Rotator::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::Quat
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::Quat::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::Quat::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::Quat::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::Quat::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::Transform
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::Transform::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::Transform::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::Transform::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::Transform::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
 // UnrealCore::Argument
 #if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 constexpr uint16_t UnrealCore::Argument::_capnpPrivate::dataWordSize;
@@ -3317,6 +4865,30 @@ constexpr ::capnp::_::RawSchema const* UnrealCore::Argument::_capnpPrivate::sche
 #endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 #endif  // !CAPNP_LITE
 
+// UnrealCore::StructValue
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::StructValue::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::StructValue::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::StructValue::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::StructValue::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::PackedParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::PackedParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::PackedParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::PackedParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::PackedParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
 // UnrealCore::Method
 #if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 constexpr uint16_t UnrealCore::Method::_capnpPrivate::dataWordSize;
@@ -3907,5 +5479,101 @@ constexpr ::capnp::_::RawSchema const* UnrealCore::DestroyContainerResults::_cap
 #endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 #endif  // !CAPNP_LITE
 
+// UnrealCore::CallFunctionPackedParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::CallFunctionPackedParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::CallFunctionPackedParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::CallFunctionPackedParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::CallFunctionPackedParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::CallFunctionPackedResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::CallFunctionPackedResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::CallFunctionPackedResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::CallFunctionPackedResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::CallFunctionPackedResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::GetFeaturesParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::GetFeaturesParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::GetFeaturesParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::GetFeaturesParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::GetFeaturesParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::GetFeaturesResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::GetFeaturesResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::GetFeaturesResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::GetFeaturesResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::GetFeaturesResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::DumpReflectionParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::DumpReflectionParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::DumpReflectionParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::DumpReflectionParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::DumpReflectionParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::DumpReflectionResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::DumpReflectionResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::DumpReflectionResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::DumpReflectionResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::DumpReflectionResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::GetClassHierarchyParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::GetClassHierarchyParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::GetClassHierarchyParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::GetClassHierarchyParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::GetClassHierarchyParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// UnrealCore::GetClassHierarchyResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t UnrealCore::GetClassHierarchyResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t UnrealCore::GetClassHierarchyResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind UnrealCore::GetClassHierarchyResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* UnrealCore::GetClassHierarchyResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
 
 
@@ -24,7 +24,25 @@ namespace schemas {
 CAPNP_DECLARE_SCHEMA(8e1737faadc1c8be);
 CAPNP_DECLARE_SCHEMA(bbbd9ab104716176);
 CAPNP_DECLARE_SCHEMA(bda606608274c0bd);
+CAPNP_DECLARE_SCHEMA(fda4acc138bb5627);
+CAPNP_DECLARE_SCHEMA(f902f8a1a0749caa);
+CAPNP_DECLARE_SCHEMA(e73c64734a70a4b4);
+CAPNP_DECLARE_SCHEMA(c2f1f892788b94f7);
+CAPNP_DECLARE_SCHEMA(a6c013992f34f0d6);
 CAPNP_DECLARE_SCHEMA(a53c5ce887c3c1e6);
+CAPNP_DECLARE_SCHEMA(d41ca23a9e9c8d7d);
+CAPNP_DECLARE_SCHEMA(c222057b098ae913);
+enum class PackedTag_c222057b098ae913: uint16_t {
+  BOOL_VALUE,
+  UINT_VALUE,
+  INT_VALUE,
+  STR_VALUE,
+  FLOAT_VALUE,
+  OBJECT,
+  ENUM_VALUE,
+};
+CAPNP_DECLARE_ENUM(PackedTag, c222057b098ae913);
+CAPNP_DECLARE_SCHEMA(aa8c589001e2e8e8);
 CAPNP_DECLARE_SCHEMA(8f2d77d834a5e736);
 CAPNP_DECLARE_SCHEMA(a46e9e12cd75e297);
 CAPNP_DECLARE_SCHEMA(8853ccc3271ca36f);
@@ -68,6 +86,14 @@ CAPNP_DECLARE_SCHEMA(a5f2e034f5cf3ef2);
 CAPNP_DECLARE_SCHEMA(ae7fcc084082d1c0);
 CAPNP_DECLARE_SCHEMA(99203a7e28b05827);
 CAPNP_DECLARE_SCHEMA(bf109ec66ad97a7d);
+CAPNP_DECLARE_SCHEMA(f4c4171c5fb749dd);
+CAPNP_DECLARE_SCHEMA(d872fab1bdb92e5e);
+CAPNP_DECLARE_SCHEMA(d1f5e729d712c951);
+CAPNP_DECLARE_SCHEMA(dd6a28a4b023a079);
+CAPNP_DECLARE_SCHEMA(c0e6761c7094631b);
+CAPNP_DECLARE_SCHEMA(d959301e8163c718);
+CAPNP_DECLARE_SCHEMA(84752c45c4ec5dec);
+CAPNP_DECLARE_SCHEMA(fafaac91b4eb50a5);
 
 }  // namespace schemas
 }  // namespace capnp
@@ -83,7 +109,14 @@ struct UnrealCore {
 
   struct Object;
   struct Class;
+  struct Vector2D;
+  struct Vector;
+  struct Rotator;
+  struct Quat;
+  struct Transform;
   struct Argument;
+  struct StructValue;
+  struct PackedParams;
   struct Method;
   struct MethodCallable;
   struct DelegateCallback;
@@ -123,6 +156,16 @@ struct UnrealCore {
   struct NewContainerResults;
   struct DestroyContainerParams;
   struct DestroyContainerResults;
+  struct CallFunctionPackedParams;
+  struct CallFunctionPackedResults;
+  struct GetFeaturesParams;
+  struct GetFeaturesResults;
+  struct DumpReflectionParams;
+  struct DumpReflectionResults;
+  struct GetClassHierarchyParams;
+  struct GetClassHierarchyResults;
+
+  typedef ::capnp::schemas::PackedTag_c222057b098ae913 PackedTag;
 
   #if !CAPNP_LITE
   struct _capnpPrivate {
@@ -162,6 +205,81 @@ struct UnrealCore::Class {
   };
 };
 
+struct UnrealCore::Vector2D {
+  Vector2D() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(fda4acc138bb5627, 2, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::Vector {
+  Vector() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(f902f8a1a0749caa, 3, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::Rotator {
+  Rotator() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(e73c64734a70a4b4, 3, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::Quat {
+  Quat() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(c2f1f892788b94f7, 4, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::Transform {
+  Transform() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(a6c013992f34f0d6, 0, 3)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
 struct UnrealCore::Argument {
   Argument() = delete;
 
@@ -176,6 +294,18 @@ struct UnrealCore::Argument {
     FLOAT_VALUE,
     OBJECT,
     ENUM_VALUE,
+    FLOAT32_LIST,
+    FLOAT64_LIST,
+    INT32_LIST,
+    INT64_LIST,
+    DATA_VALUE,
+    VECTOR2_D_VALUE,
+    VECTOR_VALUE,
+    ROTATOR_VALUE,
+    QUAT_VALUE,
+    TRANSFORM_VALUE,
+    STR_UTF16_VALUE,
+    STRUCT_VALUE,
   };
 
   struct _capnpPrivate {
@@ -186,6 +316,36 @@ struct UnrealCore::Argument {
   };
 };
 
+struct UnrealCore::StructValue {
+  StructValue() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(d41ca23a9e9c8d7d, 0, 2)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::PackedParams {
+  PackedParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(aa8c589001e2e8e8, 0, 7)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
 struct UnrealCore::Method {
   Method() = delete;
 
@@ -839,6 +999,126 @@ struct UnrealCore::DestroyContainerResults {
   };
 };
 
+struct UnrealCore::CallFunctionPackedParams {
+  CallFunctionPackedParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(f4c4171c5fb749dd, 0, 5)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::CallFunctionPackedResults {
+  CallFunctionPackedResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(d872fab1bdb92e5e, 0, 2)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::GetFeaturesParams {
+  GetFeaturesParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(d1f5e729d712c951, 0, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::GetFeaturesResults {
+  GetFeaturesResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(dd6a28a4b023a079, 1, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::DumpReflectionParams {
+  DumpReflectionParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(c0e6761c7094631b, 0, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::DumpReflectionResults {
+  DumpReflectionResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(d959301e8163c718, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::GetClassHierarchyParams {
+  GetClassHierarchyParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(84752c45c4ec5dec, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct UnrealCore::GetClassHierarchyResults {
+  GetClassHierarchyResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(fafaac91b4eb50a5, 0, 2)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
 // =======================================================================================
 
 #if !CAPNP_LITE
@@ -896,6 +1176,14 @@ public:
       ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
   ::capnp::Request< ::UnrealCore::DestroyContainerParams,  ::UnrealCore::DestroyContainerResults> destroyContainerRequest(
       ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::UnrealCore::CallFunctionPackedParams,  ::UnrealCore::CallFunctionPackedResults> callFunctionPackedRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::UnrealCore::GetFeaturesParams,  ::UnrealCore::GetFeaturesResults> getFeaturesRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::UnrealCore::DumpReflectionParams,  ::UnrealCore::DumpReflectionResults> dumpReflectionRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::UnrealCore::GetClassHierarchyParams,  ::UnrealCore::GetClassHierarchyResults> getClassHierarchyRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
 
 protected:
   Client() = default;
@@ -984,6 +1272,22 @@ protected:
   typedef  ::UnrealCore::DestroyContainerResults DestroyContainerResults;
   typedef ::capnp::CallContext<DestroyContainerParams, DestroyContainerResults> DestroyContainerContext;
   virtual ::kj::Promise<void> destroyContainer(DestroyContainerContext context);
+  typedef  ::UnrealCore::CallFunctionPackedParams CallFunctionPackedParams;
+  typedef  ::UnrealCore::CallFunctionPackedResults CallFunctionPackedResults;
+  typedef ::capnp::CallContext<CallFunctionPackedParams, CallFunctionPackedResults> CallFunctionPackedContext;
+  virtual ::kj::Promise<void> callFunctionPacked(CallFunctionPackedContext context);
+  typedef  ::UnrealCore::GetFeaturesParams GetFeaturesParams;
+  typedef  ::UnrealCore::GetFeaturesResults GetFeaturesResults;
+  typedef ::capnp::CallContext<GetFeaturesParams, GetFeaturesResults> GetFeaturesContext;
+  virtual ::kj::Promise<void> getFeatures(GetFeaturesContext context);
+  typedef  ::UnrealCore::DumpReflectionParams DumpReflectionParams;
+  typedef  ::UnrealCore::DumpReflectionResults DumpReflectionResults;
+  typedef ::capnp::CallContext<DumpReflectionParams, DumpReflectionResults> DumpReflectionContext;
+  virtual ::kj::Promise<void> dumpReflection(DumpReflectionContext context);
+  typedef  ::UnrealCore::GetClassHierarchyParams GetClassHierarchyParams;
+  typedef  ::UnrealCore::GetClassHierarchyResults GetClassHierarchyResults;
+  typedef ::capnp::CallContext<GetClassHierarchyParams, GetClassHierarchyResults> GetClassHierarchyContext;
+  virtual ::kj::Promise<void> getClassHierarchy(GetClassHierarchyContext context);
 
   inline  ::UnrealCore::Client thisCap() {
     return ::capnp::Capability::Server::thisCap()
@@ -1163,9 +1467,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::Argument::Reader {
+class UnrealCore::Vector2D::Reader {
 public:
-  typedef Argument Reads;
+  typedef Vector2D Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1180,35 +1484,9 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline Which which() const;
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasName() const;
-  inline  ::capnp::Text::Reader getName() const;
-
-  inline bool isBoolValue() const;
-  inline bool getBoolValue() const;
-
-  inline bool isUintValue() const;
-  inline  ::uint64_t getUintValue() const;
-
-  inline bool isIntValue() const;
-  inline  ::int64_t getIntValue() const;
-
-  inline bool isStrValue() const;
-  inline bool hasStrValue() const;
-  inline  ::capnp::Text::Reader getStrValue() const;
-
-  inline bool isFloatValue() const;
-  inline double getFloatValue() const;
-
-  inline bool isObject() const;
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline double getX() const;
 
-  inline bool isEnumValue() const;
-  inline  ::int64_t getEnumValue() const;
+  inline double getY() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1222,9 +1500,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::Argument::Builder {
+class UnrealCore::Vector2D::Builder {
 public:
-  typedef Argument Builds;
+  typedef Vector2D Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1238,76 +1516,30 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline Which which();
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+  inline double getX();
+  inline void setX(double value);
 
-  inline bool hasName();
-  inline  ::capnp::Text::Builder getName();
-  inline void setName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initName(unsigned int size);
-  inline void adoptName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownName();
+  inline double getY();
+  inline void setY(double value);
 
-  inline bool isBoolValue();
-  inline bool getBoolValue();
-  inline void setBoolValue(bool value);
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
 
-  inline bool isUintValue();
-  inline  ::uint64_t getUintValue();
-  inline void setUintValue( ::uint64_t value);
+#if !CAPNP_LITE
+class UnrealCore::Vector2D::Pipeline {
+public:
+  typedef Vector2D Pipelines;
 
-  inline bool isIntValue();
-  inline  ::int64_t getIntValue();
-  inline void setIntValue( ::int64_t value);
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
 
-  inline bool isStrValue();
-  inline bool hasStrValue();
-  inline  ::capnp::Text::Builder getStrValue();
-  inline void setStrValue( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initStrValue(unsigned int size);
-  inline void adoptStrValue(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownStrValue();
-
-  inline bool isFloatValue();
-  inline double getFloatValue();
-  inline void setFloatValue(double value);
-
-  inline bool isObject();
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
-
-  inline bool isEnumValue();
-  inline  ::int64_t getEnumValue();
-  inline void setEnumValue( ::int64_t value);
-
-private:
-  ::capnp::_::StructBuilder _builder;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::ToDynamic_;
-  friend class ::capnp::Orphanage;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::_::PointerHelpers;
-};
-
-#if !CAPNP_LITE
-class UnrealCore::Argument::Pipeline {
-public:
-  typedef Argument Pipelines;
-
-  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
-  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
-      : _typeless(kj::mv(typeless)) {}
-
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1316,9 +1548,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::Method::Reader {
+class UnrealCore::Vector::Reader {
 public:
-  typedef Method Reads;
+  typedef Vector Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1333,8 +1565,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasName() const;
-  inline  ::capnp::Text::Reader getName() const;
+  inline double getX() const;
+
+  inline double getY() const;
+
+  inline double getZ() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1348,9 +1583,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::Method::Builder {
+class UnrealCore::Vector::Builder {
 public:
-  typedef Method Builds;
+  typedef Vector Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1364,12 +1599,14 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasName();
-  inline  ::capnp::Text::Builder getName();
-  inline void setName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initName(unsigned int size);
-  inline void adoptName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownName();
+  inline double getX();
+  inline void setX(double value);
+
+  inline double getY();
+  inline void setY(double value);
+
+  inline double getZ();
+  inline void setZ(double value);
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1381,9 +1618,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::Method::Pipeline {
+class UnrealCore::Vector::Pipeline {
 public:
-  typedef Method Pipelines;
+  typedef Vector Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -1397,62 +1634,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-#if !CAPNP_LITE
-class UnrealCore::MethodCallable::Client
-    : public virtual ::capnp::Capability::Client {
-public:
-  typedef MethodCallable Calls;
-  typedef MethodCallable Reads;
-
-  Client(decltype(nullptr));
-  explicit Client(::kj::Own< ::capnp::ClientHook>&& hook);
-  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Server*>()>>
-  Client(::kj::Own<_t>&& server);
-  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Client*>()>>
-  Client(::kj::Promise<_t>&& promise);
-  Client(::kj::Exception&& exception);
-  Client(Client&) = default;
-  Client(Client&&) = default;
-  Client& operator=(Client& other);
-  Client& operator=(Client&& other);
-
-  ::capnp::Request< ::UnrealCore::MethodCallable::InvokeParams,  ::UnrealCore::MethodCallable::InvokeResults> invokeRequest(
-      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
-
-protected:
-  Client() = default;
-};
-
-class UnrealCore::MethodCallable::Server
-    : public virtual ::capnp::Capability::Server {
-public:
-  typedef MethodCallable Serves;
-
-  ::capnp::Capability::Server::DispatchCallResult dispatchCall(
-      uint64_t interfaceId, uint16_t methodId,
-      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context)
-      override;
-
-protected:
-  typedef  ::UnrealCore::MethodCallable::InvokeParams InvokeParams;
-  typedef  ::UnrealCore::MethodCallable::InvokeResults InvokeResults;
-  typedef ::capnp::CallContext<InvokeParams, InvokeResults> InvokeContext;
-  virtual ::kj::Promise<void> invoke(InvokeContext context);
-
-  inline  ::UnrealCore::MethodCallable::Client thisCap() {
-    return ::capnp::Capability::Server::thisCap()
-        .template castAs< ::UnrealCore::MethodCallable>();
-  }
-
-  ::capnp::Capability::Server::DispatchCallResult dispatchCallInternal(
-      uint16_t methodId,
-      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context);
-};
-#endif  // !CAPNP_LITE
-
-class UnrealCore::MethodCallable::InvokeParams::Reader {
+class UnrealCore::Rotator::Reader {
 public:
-  typedef InvokeParams Reads;
+  typedef Rotator Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1467,8 +1651,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasMethod() const;
-  inline  ::UnrealCore::Method::Reader getMethod() const;
+  inline double getPitch() const;
+
+  inline double getYaw() const;
+
+  inline double getRoll() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1482,9 +1669,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::MethodCallable::InvokeParams::Builder {
+class UnrealCore::Rotator::Builder {
 public:
-  typedef InvokeParams Builds;
+  typedef Rotator Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1498,12 +1685,14 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasMethod();
-  inline  ::UnrealCore::Method::Builder getMethod();
-  inline void setMethod( ::UnrealCore::Method::Reader value);
-  inline  ::UnrealCore::Method::Builder initMethod();
-  inline void adoptMethod(::capnp::Orphan< ::UnrealCore::Method>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Method> disownMethod();
+  inline double getPitch();
+  inline void setPitch(double value);
+
+  inline double getYaw();
+  inline void setYaw(double value);
+
+  inline double getRoll();
+  inline void setRoll(double value);
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1515,15 +1704,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::MethodCallable::InvokeParams::Pipeline {
+class UnrealCore::Rotator::Pipeline {
 public:
-  typedef InvokeParams Pipelines;
+  typedef Rotator Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Method::Pipeline getMethod();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1532,9 +1720,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::MethodCallable::InvokeResults::Reader {
+class UnrealCore::Quat::Reader {
 public:
-  typedef InvokeResults Reads;
+  typedef Quat Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1549,6 +1737,14 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline double getX() const;
+
+  inline double getY() const;
+
+  inline double getZ() const;
+
+  inline double getW() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -1561,9 +1757,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::MethodCallable::InvokeResults::Builder {
+class UnrealCore::Quat::Builder {
 public:
-  typedef InvokeResults Builds;
+  typedef Quat Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1577,6 +1773,18 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline double getX();
+  inline void setX(double value);
+
+  inline double getY();
+  inline void setY(double value);
+
+  inline double getZ();
+  inline void setZ(double value);
+
+  inline double getW();
+  inline void setW(double value);
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -1587,9 +1795,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::MethodCallable::InvokeResults::Pipeline {
+class UnrealCore::Quat::Pipeline {
 public:
-  typedef InvokeResults Pipelines;
+  typedef Quat Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -1603,62 +1811,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-#if !CAPNP_LITE
-class UnrealCore::DelegateCallback::Client
-    : public virtual ::capnp::Capability::Client {
-public:
-  typedef DelegateCallback Calls;
-  typedef DelegateCallback Reads;
-
-  Client(decltype(nullptr));
-  explicit Client(::kj::Own< ::capnp::ClientHook>&& hook);
-  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Server*>()>>
-  Client(::kj::Own<_t>&& server);
-  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Client*>()>>
-  Client(::kj::Promise<_t>&& promise);
-  Client(::kj::Exception&& exception);
-  Client(Client&) = default;
-  Client(Client&&) = default;
-  Client& operator=(Client& other);
-  Client& operator=(Client&& other);
-
-  ::capnp::Request< ::UnrealCore::DelegateCallback::OnCallParams,  ::UnrealCore::DelegateCallback::OnCallResults> onCallRequest(
-      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
-
-protected:
-  Client() = default;
-};
-
-class UnrealCore::DelegateCallback::Server
-    : public virtual ::capnp::Capability::Server {
-public:
-  typedef DelegateCallback Serves;
-
-  ::capnp::Capability::Server::DispatchCallResult dispatchCall(
-      uint64_t interfaceId, uint16_t methodId,
-      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context)
-      override;
-
-protected:
-  typedef  ::UnrealCore::DelegateCallback::OnCallParams OnCallParams;
-  typedef  ::UnrealCore::DelegateCallback::OnCallResults OnCallResults;
-  typedef ::capnp::CallContext<OnCallParams, OnCallResults> OnCallContext;
-  virtual ::kj::Promise<void> onCall(OnCallContext context);
-
-  inline  ::UnrealCore::DelegateCallback::Client thisCap() {
-    return ::capnp::Capability::Server::thisCap()
-        .template castAs< ::UnrealCore::DelegateCallback>();
-  }
-
-  ::capnp::Capability::Server::DispatchCallResult dispatchCallInternal(
-      uint16_t methodId,
-      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context);
-};
-#endif  // !CAPNP_LITE
-
-class UnrealCore::DelegateCallback::OnCallParams::Reader {
+class UnrealCore::Transform::Reader {
 public:
-  typedef OnCallParams Reads;
+  typedef Transform Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1673,11 +1828,14 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool hasRotation() const;
+  inline  ::UnrealCore::Quat::Reader getRotation() const;
 
-  inline bool hasParams() const;
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getParams() const;
+  inline bool hasTranslation() const;
+  inline  ::UnrealCore::Vector::Reader getTranslation() const;
+
+  inline bool hasScale3D() const;
+  inline  ::UnrealCore::Vector::Reader getScale3D() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1691,9 +1849,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::DelegateCallback::OnCallParams::Builder {
+class UnrealCore::Transform::Builder {
 public:
-  typedef OnCallParams Builds;
+  typedef Transform Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1707,19 +1865,26 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+  inline bool hasRotation();
+  inline  ::UnrealCore::Quat::Builder getRotation();
+  inline void setRotation( ::UnrealCore::Quat::Reader value);
+  inline  ::UnrealCore::Quat::Builder initRotation();
+  inline void adoptRotation(::capnp::Orphan< ::UnrealCore::Quat>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Quat> disownRotation();
 
-  inline bool hasParams();
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getParams();
-  inline void setParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initParams(unsigned int size);
-  inline void adoptParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownParams();
+  inline bool hasTranslation();
+  inline  ::UnrealCore::Vector::Builder getTranslation();
+  inline void setTranslation( ::UnrealCore::Vector::Reader value);
+  inline  ::UnrealCore::Vector::Builder initTranslation();
+  inline void adoptTranslation(::capnp::Orphan< ::UnrealCore::Vector>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Vector> disownTranslation();
+
+  inline bool hasScale3D();
+  inline  ::UnrealCore::Vector::Builder getScale3D();
+  inline void setScale3D( ::UnrealCore::Vector::Reader value);
+  inline  ::UnrealCore::Vector::Builder initScale3D();
+  inline void adoptScale3D(::capnp::Orphan< ::UnrealCore::Vector>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Vector> disownScale3D();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1731,15 +1896,17 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::DelegateCallback::OnCallParams::Pipeline {
+class UnrealCore::Transform::Pipeline {
 public:
-  typedef OnCallParams Pipelines;
+  typedef Transform Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::Quat::Pipeline getRotation();
+  inline  ::UnrealCore::Vector::Pipeline getTranslation();
+  inline  ::UnrealCore::Vector::Pipeline getScale3D();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1748,9 +1915,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::DelegateCallback::OnCallResults::Reader {
+class UnrealCore::Argument::Reader {
 public:
-  typedef OnCallResults Reads;
+  typedef Argument Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1765,90 +1932,83 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-private:
-  ::capnp::_::StructReader _reader;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::ToDynamic_;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::_::PointerHelpers;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::List;
-  friend class ::capnp::MessageBuilder;
-  friend class ::capnp::Orphanage;
-};
+  inline Which which() const;
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
 
-class UnrealCore::DelegateCallback::OnCallResults::Builder {
-public:
-  typedef OnCallResults Builds;
+  inline bool hasName() const;
+  inline  ::capnp::Text::Reader getName() const;
 
-  Builder() = delete;  // Deleted to discourage incorrect usage.
-                       // You can explicitly initialize to nullptr instead.
-  inline Builder(decltype(nullptr)) {}
-  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
-  inline operator Reader() const { return Reader(_builder.asReader()); }
-  inline Reader asReader() const { return *this; }
+  inline bool isBoolValue() const;
+  inline bool getBoolValue() const;
 
-  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
-#if !CAPNP_LITE
-  inline ::kj::StringTree toString() const { return asReader().toString(); }
-#endif  // !CAPNP_LITE
+  inline bool isUintValue() const;
+  inline  ::uint64_t getUintValue() const;
 
-private:
-  ::capnp::_::StructBuilder _builder;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::ToDynamic_;
-  friend class ::capnp::Orphanage;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::_::PointerHelpers;
-};
+  inline bool isIntValue() const;
+  inline  ::int64_t getIntValue() const;
 
-#if !CAPNP_LITE
-class UnrealCore::DelegateCallback::OnCallResults::Pipeline {
-public:
-  typedef OnCallResults Pipelines;
+  inline bool isStrValue() const;
+  inline bool hasStrValue() const;
+  inline  ::capnp::Text::Reader getStrValue() const;
 
-  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
-  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
-      : _typeless(kj::mv(typeless)) {}
+  inline bool isFloatValue() const;
+  inline double getFloatValue() const;
 
-private:
-  ::capnp::AnyPointer::Pipeline _typeless;
-  friend class ::capnp::PipelineHook;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::ToDynamic_;
-};
-#endif  // !CAPNP_LITE
+  inline bool isObject() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
-class UnrealCore::NewObjectParams::Reader {
-public:
-  typedef NewObjectParams Reads;
+  inline bool isEnumValue() const;
+  inline  ::int64_t getEnumValue() const;
 
-  Reader() = default;
-  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+  inline bool isFloat32List() const;
+  inline bool hasFloat32List() const;
+  inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Reader getFloat32List() const;
 
-  inline ::capnp::MessageSize totalSize() const {
-    return _reader.totalSize().asPublic();
-  }
+  inline bool isFloat64List() const;
+  inline bool hasFloat64List() const;
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader getFloat64List() const;
 
-#if !CAPNP_LITE
-  inline ::kj::StringTree toString() const {
-    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
-  }
-#endif  // !CAPNP_LITE
+  inline bool isInt32List() const;
+  inline bool hasInt32List() const;
+  inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Reader getInt32List() const;
 
-  inline bool hasOwn() const;
-  inline  ::UnrealCore::Object::Reader getOwn() const;
+  inline bool isInt64List() const;
+  inline bool hasInt64List() const;
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader getInt64List() const;
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
+  inline bool isDataValue() const;
+  inline bool hasDataValue() const;
+  inline  ::capnp::Data::Reader getDataValue() const;
 
-  inline bool hasObjName() const;
-  inline  ::capnp::Text::Reader getObjName() const;
+  inline bool isVector2DValue() const;
+  inline bool hasVector2DValue() const;
+  inline  ::UnrealCore::Vector2D::Reader getVector2DValue() const;
 
-  inline  ::uint64_t getFlags() const;
+  inline bool isVectorValue() const;
+  inline bool hasVectorValue() const;
+  inline  ::UnrealCore::Vector::Reader getVectorValue() const;
 
-  inline bool hasConstructArgs() const;
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getConstructArgs() const;
+  inline bool isRotatorValue() const;
+  inline bool hasRotatorValue() const;
+  inline  ::UnrealCore::Rotator::Reader getRotatorValue() const;
+
+  inline bool isQuatValue() const;
+  inline bool hasQuatValue() const;
+  inline  ::UnrealCore::Quat::Reader getQuatValue() const;
+
+  inline bool isTransformValue() const;
+  inline bool hasTransformValue() const;
+  inline  ::UnrealCore::Transform::Reader getTransformValue() const;
+
+  inline bool isStrUtf16Value() const;
+  inline bool hasStrUtf16Value() const;
+  inline  ::capnp::Data::Reader getStrUtf16Value() const;
+
+  inline bool isStructValue() const;
+  inline bool hasStructValue() const;
+  inline  ::UnrealCore::StructValue::Reader getStructValue() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1862,9 +2022,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::NewObjectParams::Builder {
+class UnrealCore::Argument::Builder {
 public:
-  typedef NewObjectParams Builds;
+  typedef Argument Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1878,13 +2038,7 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn();
-  inline  ::UnrealCore::Object::Builder getOwn();
-  inline void setOwn( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwn();
-  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
-
+  inline Which which();
   inline bool hasUeClass();
   inline  ::UnrealCore::Class::Builder getUeClass();
   inline void setUeClass( ::UnrealCore::Class::Reader value);
@@ -1892,22 +2046,148 @@ public:
   inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
   inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
-  inline bool hasObjName();
-  inline  ::capnp::Text::Builder getObjName();
-  inline void setObjName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initObjName(unsigned int size);
-  inline void adoptObjName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownObjName();
+  inline bool hasName();
+  inline  ::capnp::Text::Builder getName();
+  inline void setName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initName(unsigned int size);
+  inline void adoptName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownName();
 
-  inline  ::uint64_t getFlags();
-  inline void setFlags( ::uint64_t value);
+  inline bool isBoolValue();
+  inline bool getBoolValue();
+  inline void setBoolValue(bool value);
 
-  inline bool hasConstructArgs();
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getConstructArgs();
-  inline void setConstructArgs( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initConstructArgs(unsigned int size);
-  inline void adoptConstructArgs(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownConstructArgs();
+  inline bool isUintValue();
+  inline  ::uint64_t getUintValue();
+  inline void setUintValue( ::uint64_t value);
+
+  inline bool isIntValue();
+  inline  ::int64_t getIntValue();
+  inline void setIntValue( ::int64_t value);
+
+  inline bool isStrValue();
+  inline bool hasStrValue();
+  inline  ::capnp::Text::Builder getStrValue();
+  inline void setStrValue( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initStrValue(unsigned int size);
+  inline void adoptStrValue(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownStrValue();
+
+  inline bool isFloatValue();
+  inline double getFloatValue();
+  inline void setFloatValue(double value);
+
+  inline bool isObject();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+
+  inline bool isEnumValue();
+  inline  ::int64_t getEnumValue();
+  inline void setEnumValue( ::int64_t value);
+
+  inline bool isFloat32List();
+  inline bool hasFloat32List();
+  inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Builder getFloat32List();
+  inline void setFloat32List( ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setFloat32List(::kj::ArrayPtr<const float> value);
+  inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Builder initFloat32List(unsigned int size);
+  inline void adoptFloat32List(::capnp::Orphan< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>> disownFloat32List();
+
+  inline bool isFloat64List();
+  inline bool hasFloat64List();
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder getFloat64List();
+  inline void setFloat64List( ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setFloat64List(::kj::ArrayPtr<const double> value);
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder initFloat64List(unsigned int size);
+  inline void adoptFloat64List(::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>> disownFloat64List();
+
+  inline bool isInt32List();
+  inline bool hasInt32List();
+  inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Builder getInt32List();
+  inline void setInt32List( ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setInt32List(::kj::ArrayPtr<const  ::int32_t> value);
+  inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Builder initInt32List(unsigned int size);
+  inline void adoptInt32List(::capnp::Orphan< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>> disownInt32List();
+
+  inline bool isInt64List();
+  inline bool hasInt64List();
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder getInt64List();
+  inline void setInt64List( ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setInt64List(::kj::ArrayPtr<const  ::int64_t> value);
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder initInt64List(unsigned int size);
+  inline void adoptInt64List(::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>> disownInt64List();
+
+  inline bool isDataValue();
+  inline bool hasDataValue();
+  inline  ::capnp::Data::Builder getDataValue();
+  inline void setDataValue( ::capnp::Data::Reader value);
+  inline  ::capnp::Data::Builder initDataValue(unsigned int size);
+  inline void adoptDataValue(::capnp::Orphan< ::capnp::Data>&& value);
+  inline ::capnp::Orphan< ::capnp::Data> disownDataValue();
+
+  inline bool isVector2DValue();
+  inline bool hasVector2DValue();
+  inline  ::UnrealCore::Vector2D::Builder getVector2DValue();
+  inline void setVector2DValue( ::UnrealCore::Vector2D::Reader value);
+  inline  ::UnrealCore::Vector2D::Builder initVector2DValue();
+  inline void adoptVector2DValue(::capnp::Orphan< ::UnrealCore::Vector2D>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Vector2D> disownVector2DValue();
+
+  inline bool isVectorValue();
+  inline bool hasVectorValue();
+  inline  ::UnrealCore::Vector::Builder getVectorValue();
+  inline void setVectorValue( ::UnrealCore::Vector::Reader value);
+  inline  ::UnrealCore::Vector::Builder initVectorValue();
+  inline void adoptVectorValue(::capnp::Orphan< ::UnrealCore::Vector>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Vector> disownVectorValue();
+
+  inline bool isRotatorValue();
+  inline bool hasRotatorValue();
+  inline  ::UnrealCore::Rotator::Builder getRotatorValue();
+  inline void setRotatorValue( ::UnrealCore::Rotator::Reader value);
+  inline  ::UnrealCore::Rotator::Builder initRotatorValue();
+  inline void adoptRotatorValue(::capnp::Orphan< ::UnrealCore::Rotator>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Rotator> disownRotatorValue();
+
+  inline bool isQuatValue();
+  inline bool hasQuatValue();
+  inline  ::UnrealCore::Quat::Builder getQuatValue();
+  inline void setQuatValue( ::UnrealCore::Quat::Reader value);
+  inline  ::UnrealCore::Quat::Builder initQuatValue();
+  inline void adoptQuatValue(::capnp::Orphan< ::UnrealCore::Quat>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Quat> disownQuatValue();
+
+  inline bool isTransformValue();
+  inline bool hasTransformValue();
+  inline  ::UnrealCore::Transform::Builder getTransformValue();
+  inline void setTransformValue( ::UnrealCore::Transform::Reader value);
+  inline  ::UnrealCore::Transform::Builder initTransformValue();
+  inline void adoptTransformValue(::capnp::Orphan< ::UnrealCore::Transform>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Transform> disownTransformValue();
+
+  inline bool isStrUtf16Value();
+  inline bool hasStrUtf16Value();
+  inline  ::capnp::Data::Builder getStrUtf16Value();
+  inline void setStrUtf16Value( ::capnp::Data::Reader value);
+  inline  ::capnp::Data::Builder initStrUtf16Value(unsigned int size);
+  inline void adoptStrUtf16Value(::capnp::Orphan< ::capnp::Data>&& value);
+  inline ::capnp::Orphan< ::capnp::Data> disownStrUtf16Value();
+
+  inline bool isStructValue();
+  inline bool hasStructValue();
+  inline  ::UnrealCore::StructValue::Builder getStructValue();
+  inline void setStructValue( ::UnrealCore::StructValue::Reader value);
+  inline  ::UnrealCore::StructValue::Builder initStructValue();
+  inline void adoptStructValue(::capnp::Orphan< ::UnrealCore::StructValue>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::StructValue> disownStructValue();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1919,15 +2199,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::NewObjectParams::Pipeline {
+class UnrealCore::Argument::Pipeline {
 public:
-  typedef NewObjectParams Pipelines;
+  typedef Argument Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getOwn();
   inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
@@ -1937,9 +2216,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::NewObjectResults::Reader {
+class UnrealCore::StructValue::Reader {
 public:
-  typedef NewObjectResults Reads;
+  typedef StructValue Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1954,8 +2233,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool hasTypeName() const;
+  inline  ::capnp::Text::Reader getTypeName() const;
+
+  inline bool hasFields() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getFields() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1969,9 +2251,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::NewObjectResults::Builder {
+class UnrealCore::StructValue::Builder {
 public:
-  typedef NewObjectResults Builds;
+  typedef StructValue Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1985,12 +2267,19 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+  inline bool hasTypeName();
+  inline  ::capnp::Text::Builder getTypeName();
+  inline void setTypeName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initTypeName(unsigned int size);
+  inline void adoptTypeName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownTypeName();
+
+  inline bool hasFields();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getFields();
+  inline void setFields( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initFields(unsigned int size);
+  inline void adoptFields(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownFields();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2002,15 +2291,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::NewObjectResults::Pipeline {
+class UnrealCore::StructValue::Pipeline {
 public:
-  typedef NewObjectResults Pipelines;
+  typedef StructValue Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2019,9 +2307,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::DestroyObjectParams::Reader {
+class UnrealCore::PackedParams::Reader {
 public:
-  typedef DestroyObjectParams Reads;
+  typedef PackedParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2036,8 +2324,26 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn() const;
-  inline  ::UnrealCore::Object::Reader getOwn() const;
+  inline bool hasTags() const;
+  inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Reader getTags() const;
+
+  inline bool hasNames() const;
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader getNames() const;
+
+  inline bool hasClasses() const;
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader getClasses() const;
+
+  inline bool hasInts() const;
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader getInts() const;
+
+  inline bool hasFloats() const;
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader getFloats() const;
+
+  inline bool hasStrs() const;
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader getStrs() const;
+
+  inline bool hasObjects() const;
+  inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Reader getObjects() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2051,9 +2357,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::DestroyObjectParams::Builder {
+class UnrealCore::PackedParams::Builder {
 public:
-  typedef DestroyObjectParams Builds;
+  typedef PackedParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2067,12 +2373,61 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn();
-  inline  ::UnrealCore::Object::Builder getOwn();
-  inline void setOwn( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwn();
-  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+  inline bool hasTags();
+  inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Builder getTags();
+  inline void setTags( ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Reader value);
+  inline void setTags(::kj::ArrayPtr<const  ::UnrealCore::PackedTag> value);
+  inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Builder initTags(unsigned int size);
+  inline void adoptTags(::capnp::Orphan< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>> disownTags();
+
+  inline bool hasNames();
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder getNames();
+  inline void setNames( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value);
+  inline void setNames(::kj::ArrayPtr<const  ::capnp::Text::Reader> value);
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder initNames(unsigned int size);
+  inline void adoptNames(::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> disownNames();
+
+  inline bool hasClasses();
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder getClasses();
+  inline void setClasses( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value);
+  inline void setClasses(::kj::ArrayPtr<const  ::capnp::Text::Reader> value);
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder initClasses(unsigned int size);
+  inline void adoptClasses(::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> disownClasses();
+
+  inline bool hasInts();
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder getInts();
+  inline void setInts( ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setInts(::kj::ArrayPtr<const  ::int64_t> value);
+  inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder initInts(unsigned int size);
+  inline void adoptInts(::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>> disownInts();
+
+  inline bool hasFloats();
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder getFloats();
+  inline void setFloats( ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setFloats(::kj::ArrayPtr<const double> value);
+  inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder initFloats(unsigned int size);
+  inline void adoptFloats(::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>> disownFloats();
+
+  inline bool hasStrs();
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder getStrs();
+  inline void setStrs( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value);
+  inline void setStrs(::kj::ArrayPtr<const  ::capnp::Text::Reader> value);
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder initStrs(unsigned int size);
+  inline void adoptStrs(::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> disownStrs();
+
+  inline bool hasObjects();
+  inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Builder getObjects();
+  inline void setObjects( ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Reader value);
+  inline void setObjects(::kj::ArrayPtr<const  ::uint64_t> value);
+  inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Builder initObjects(unsigned int size);
+  inline void adoptObjects(::capnp::Orphan< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>> disownObjects();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2084,15 +2439,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::DestroyObjectParams::Pipeline {
+class UnrealCore::PackedParams::Pipeline {
 public:
-  typedef DestroyObjectParams Pipelines;
+  typedef PackedParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getOwn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2101,9 +2455,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::DestroyObjectResults::Reader {
+class UnrealCore::Method::Reader {
 public:
-  typedef DestroyObjectResults Reads;
+  typedef Method Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2118,7 +2472,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool getResult() const;
+  inline bool hasName() const;
+  inline  ::capnp::Text::Reader getName() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2132,9 +2487,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::DestroyObjectResults::Builder {
+class UnrealCore::Method::Builder {
 public:
-  typedef DestroyObjectResults Builds;
+  typedef Method Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2148,8 +2503,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool getResult();
-  inline void setResult(bool value);
+  inline bool hasName();
+  inline  ::capnp::Text::Builder getName();
+  inline void setName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initName(unsigned int size);
+  inline void adoptName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownName();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2161,9 +2520,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::DestroyObjectResults::Pipeline {
+class UnrealCore::Method::Pipeline {
 public:
-  typedef DestroyObjectResults Pipelines;
+  typedef Method Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -2177,37 +2536,78 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::CallFunctionParams::Reader {
+#if !CAPNP_LITE
+class UnrealCore::MethodCallable::Client
+    : public virtual ::capnp::Capability::Client {
 public:
-  typedef CallFunctionParams Reads;
+  typedef MethodCallable Calls;
+  typedef MethodCallable Reads;
 
-  Reader() = default;
-  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+  Client(decltype(nullptr));
+  explicit Client(::kj::Own< ::capnp::ClientHook>&& hook);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Server*>()>>
+  Client(::kj::Own<_t>&& server);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Client*>()>>
+  Client(::kj::Promise<_t>&& promise);
+  Client(::kj::Exception&& exception);
+  Client(Client&) = default;
+  Client(Client&&) = default;
+  Client& operator=(Client& other);
+  Client& operator=(Client&& other);
 
-  inline ::capnp::MessageSize totalSize() const {
-    return _reader.totalSize().asPublic();
-  }
+  ::capnp::Request< ::UnrealCore::MethodCallable::InvokeParams,  ::UnrealCore::MethodCallable::InvokeResults> invokeRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
 
-#if !CAPNP_LITE
-  inline ::kj::StringTree toString() const {
-    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
-  }
-#endif  // !CAPNP_LITE
+protected:
+  Client() = default;
+};
 
-  inline bool hasOwn() const;
-  inline  ::UnrealCore::Object::Reader getOwn() const;
+class UnrealCore::MethodCallable::Server
+    : public virtual ::capnp::Capability::Server {
+public:
+  typedef MethodCallable Serves;
 
-  inline bool hasCallObject() const;
-  inline  ::UnrealCore::Object::Reader getCallObject() const;
+  ::capnp::Capability::Server::DispatchCallResult dispatchCall(
+      uint64_t interfaceId, uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context)
+      override;
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
+protected:
+  typedef  ::UnrealCore::MethodCallable::InvokeParams InvokeParams;
+  typedef  ::UnrealCore::MethodCallable::InvokeResults InvokeResults;
+  typedef ::capnp::CallContext<InvokeParams, InvokeResults> InvokeContext;
+  virtual ::kj::Promise<void> invoke(InvokeContext context);
 
-  inline bool hasFuncName() const;
-  inline  ::capnp::Text::Reader getFuncName() const;
+  inline  ::UnrealCore::MethodCallable::Client thisCap() {
+    return ::capnp::Capability::Server::thisCap()
+        .template castAs< ::UnrealCore::MethodCallable>();
+  }
 
-  inline bool hasParams() const;
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getParams() const;
+  ::capnp::Capability::Server::DispatchCallResult dispatchCallInternal(
+      uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context);
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::MethodCallable::InvokeParams::Reader {
+public:
+  typedef InvokeParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasMethod() const;
+  inline  ::UnrealCore::Method::Reader getMethod() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2221,9 +2621,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::CallFunctionParams::Builder {
+class UnrealCore::MethodCallable::InvokeParams::Builder {
 public:
-  typedef CallFunctionParams Builds;
+  typedef InvokeParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2237,40 +2637,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn();
-  inline  ::UnrealCore::Object::Builder getOwn();
-  inline void setOwn( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwn();
-  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
-
-  inline bool hasCallObject();
-  inline  ::UnrealCore::Object::Builder getCallObject();
-  inline void setCallObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initCallObject();
-  inline void adoptCallObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownCallObject();
-
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasFuncName();
-  inline  ::capnp::Text::Builder getFuncName();
-  inline void setFuncName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initFuncName(unsigned int size);
-  inline void adoptFuncName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownFuncName();
-
-  inline bool hasParams();
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getParams();
-  inline void setParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initParams(unsigned int size);
-  inline void adoptParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownParams();
+  inline bool hasMethod();
+  inline  ::UnrealCore::Method::Builder getMethod();
+  inline void setMethod( ::UnrealCore::Method::Reader value);
+  inline  ::UnrealCore::Method::Builder initMethod();
+  inline void adoptMethod(::capnp::Orphan< ::UnrealCore::Method>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Method> disownMethod();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2282,17 +2654,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::CallFunctionParams::Pipeline {
+class UnrealCore::MethodCallable::InvokeParams::Pipeline {
 public:
-  typedef CallFunctionParams Pipelines;
+  typedef InvokeParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getOwn();
-  inline  ::UnrealCore::Object::Pipeline getCallObject();
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Method::Pipeline getMethod();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2301,9 +2671,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::CallFunctionResults::Reader {
+class UnrealCore::MethodCallable::InvokeResults::Reader {
 public:
-  typedef CallFunctionResults Reads;
+  typedef InvokeResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2318,12 +2688,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasReturn() const;
-  inline  ::UnrealCore::Argument::Reader getReturn() const;
-
-  inline bool hasOutParams() const;
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getOutParams() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -2336,9 +2700,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::CallFunctionResults::Builder {
+class UnrealCore::MethodCallable::InvokeResults::Builder {
 public:
-  typedef CallFunctionResults Builds;
+  typedef InvokeResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2352,20 +2716,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasReturn();
-  inline  ::UnrealCore::Argument::Builder getReturn();
-  inline void setReturn( ::UnrealCore::Argument::Reader value);
-  inline  ::UnrealCore::Argument::Builder initReturn();
-  inline void adoptReturn(::capnp::Orphan< ::UnrealCore::Argument>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Argument> disownReturn();
-
-  inline bool hasOutParams();
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getOutParams();
-  inline void setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initOutParams(unsigned int size);
-  inline void adoptOutParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownOutParams();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -2376,15 +2726,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::CallFunctionResults::Pipeline {
+class UnrealCore::MethodCallable::InvokeResults::Pipeline {
 public:
-  typedef CallFunctionResults Pipelines;
+  typedef InvokeResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Argument::Pipeline getReturn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2393,9 +2742,62 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::CallStaticFunctionParams::Reader {
+#if !CAPNP_LITE
+class UnrealCore::DelegateCallback::Client
+    : public virtual ::capnp::Capability::Client {
 public:
-  typedef CallStaticFunctionParams Reads;
+  typedef DelegateCallback Calls;
+  typedef DelegateCallback Reads;
+
+  Client(decltype(nullptr));
+  explicit Client(::kj::Own< ::capnp::ClientHook>&& hook);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Server*>()>>
+  Client(::kj::Own<_t>&& server);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Client*>()>>
+  Client(::kj::Promise<_t>&& promise);
+  Client(::kj::Exception&& exception);
+  Client(Client&) = default;
+  Client(Client&&) = default;
+  Client& operator=(Client& other);
+  Client& operator=(Client&& other);
+
+  ::capnp::Request< ::UnrealCore::DelegateCallback::OnCallParams,  ::UnrealCore::DelegateCallback::OnCallResults> onCallRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+
+protected:
+  Client() = default;
+};
+
+class UnrealCore::DelegateCallback::Server
+    : public virtual ::capnp::Capability::Server {
+public:
+  typedef DelegateCallback Serves;
+
+  ::capnp::Capability::Server::DispatchCallResult dispatchCall(
+      uint64_t interfaceId, uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context)
+      override;
+
+protected:
+  typedef  ::UnrealCore::DelegateCallback::OnCallParams OnCallParams;
+  typedef  ::UnrealCore::DelegateCallback::OnCallResults OnCallResults;
+  typedef ::capnp::CallContext<OnCallParams, OnCallResults> OnCallContext;
+  virtual ::kj::Promise<void> onCall(OnCallContext context);
+
+  inline  ::UnrealCore::DelegateCallback::Client thisCap() {
+    return ::capnp::Capability::Server::thisCap()
+        .template castAs< ::UnrealCore::DelegateCallback>();
+  }
+
+  ::capnp::Capability::Server::DispatchCallResult dispatchCallInternal(
+      uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context);
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::DelegateCallback::OnCallParams::Reader {
+public:
+  typedef OnCallParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2410,11 +2812,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasFuncName() const;
-  inline  ::capnp::Text::Reader getFuncName() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
   inline bool hasParams() const;
   inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getParams() const;
@@ -2431,9 +2830,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::CallStaticFunctionParams::Builder {
+class UnrealCore::DelegateCallback::OnCallParams::Builder {
 public:
-  typedef CallStaticFunctionParams Builds;
+  typedef OnCallParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2447,19 +2846,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasFuncName();
-  inline  ::capnp::Text::Builder getFuncName();
-  inline void setFuncName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initFuncName(unsigned int size);
-  inline void adoptFuncName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownFuncName();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
   inline bool hasParams();
   inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getParams();
@@ -2478,15 +2870,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::CallStaticFunctionParams::Pipeline {
+class UnrealCore::DelegateCallback::OnCallParams::Pipeline {
 public:
-  typedef CallStaticFunctionParams Pipelines;
+  typedef OnCallParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2495,9 +2887,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::CallStaticFunctionResults::Reader {
+class UnrealCore::DelegateCallback::OnCallResults::Reader {
 public:
-  typedef CallStaticFunctionResults Reads;
+  typedef OnCallResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2512,12 +2904,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasReturn() const;
-  inline  ::UnrealCore::Argument::Reader getReturn() const;
-
-  inline bool hasOutParams() const;
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getOutParams() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -2530,9 +2916,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::CallStaticFunctionResults::Builder {
+class UnrealCore::DelegateCallback::OnCallResults::Builder {
 public:
-  typedef CallStaticFunctionResults Builds;
+  typedef OnCallResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2546,20 +2932,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasReturn();
-  inline  ::UnrealCore::Argument::Builder getReturn();
-  inline void setReturn( ::UnrealCore::Argument::Reader value);
-  inline  ::UnrealCore::Argument::Builder initReturn();
-  inline void adoptReturn(::capnp::Orphan< ::UnrealCore::Argument>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Argument> disownReturn();
-
-  inline bool hasOutParams();
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getOutParams();
-  inline void setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initOutParams(unsigned int size);
-  inline void adoptOutParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownOutParams();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -2570,15 +2942,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::CallStaticFunctionResults::Pipeline {
+class UnrealCore::DelegateCallback::OnCallResults::Pipeline {
 public:
-  typedef CallStaticFunctionResults Pipelines;
+  typedef OnCallResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Argument::Pipeline getReturn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2587,9 +2958,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::FindClassParams::Reader {
+class UnrealCore::NewObjectParams::Reader {
 public:
-  typedef FindClassParams Reads;
+  typedef NewObjectParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2604,24 +2975,35 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
+
   inline bool hasUeClass() const;
   inline  ::UnrealCore::Class::Reader getUeClass() const;
 
-private:
-  ::capnp::_::StructReader _reader;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::ToDynamic_;
-  template <typename, ::capnp::Kind>
-  friend struct ::capnp::_::PointerHelpers;
+  inline bool hasObjName() const;
+  inline  ::capnp::Text::Reader getObjName() const;
+
+  inline  ::uint64_t getFlags() const;
+
+  inline bool hasConstructArgs() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getConstructArgs() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
   template <typename, ::capnp::Kind>
   friend struct ::capnp::List;
   friend class ::capnp::MessageBuilder;
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::FindClassParams::Builder {
+class UnrealCore::NewObjectParams::Builder {
 public:
-  typedef FindClassParams Builds;
+  typedef NewObjectParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2635,6 +3017,13 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+
   inline bool hasUeClass();
   inline  ::UnrealCore::Class::Builder getUeClass();
   inline void setUeClass( ::UnrealCore::Class::Reader value);
@@ -2642,6 +3031,23 @@ public:
   inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
   inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
+  inline bool hasObjName();
+  inline  ::capnp::Text::Builder getObjName();
+  inline void setObjName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initObjName(unsigned int size);
+  inline void adoptObjName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownObjName();
+
+  inline  ::uint64_t getFlags();
+  inline void setFlags( ::uint64_t value);
+
+  inline bool hasConstructArgs();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getConstructArgs();
+  inline void setConstructArgs( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initConstructArgs(unsigned int size);
+  inline void adoptConstructArgs(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownConstructArgs();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -2652,14 +3058,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::FindClassParams::Pipeline {
+class UnrealCore::NewObjectParams::Pipeline {
 public:
-  typedef FindClassParams Pipelines;
+  typedef NewObjectParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::UnrealCore::Object::Pipeline getOwn();
   inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
@@ -2669,9 +3076,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::FindClassResults::Reader {
+class UnrealCore::NewObjectResults::Reader {
 public:
-  typedef FindClassResults Reads;
+  typedef NewObjectResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2701,9 +3108,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::FindClassResults::Builder {
+class UnrealCore::NewObjectResults::Builder {
 public:
-  typedef FindClassResults Builds;
+  typedef NewObjectResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2734,9 +3141,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::FindClassResults::Pipeline {
+class UnrealCore::NewObjectResults::Pipeline {
 public:
-  typedef FindClassResults Pipelines;
+  typedef NewObjectResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -2751,9 +3158,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::LoadClassParams::Reader {
+class UnrealCore::DestroyObjectParams::Reader {
 public:
-  typedef LoadClassParams Reads;
+  typedef DestroyObjectParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2768,8 +3175,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2783,9 +3190,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::LoadClassParams::Builder {
+class UnrealCore::DestroyObjectParams::Builder {
 public:
-  typedef LoadClassParams Builds;
+  typedef DestroyObjectParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2799,12 +3206,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2816,15 +3223,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::LoadClassParams::Pipeline {
+class UnrealCore::DestroyObjectParams::Pipeline {
 public:
-  typedef LoadClassParams Pipelines;
+  typedef DestroyObjectParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Object::Pipeline getOwn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2833,9 +3240,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::LoadClassResults::Reader {
+class UnrealCore::DestroyObjectResults::Reader {
 public:
-  typedef LoadClassResults Reads;
+  typedef DestroyObjectResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2850,8 +3257,7 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool getResult() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2865,9 +3271,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::LoadClassResults::Builder {
+class UnrealCore::DestroyObjectResults::Builder {
 public:
-  typedef LoadClassResults Builds;
+  typedef DestroyObjectResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2881,12 +3287,8 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+  inline bool getResult();
+  inline void setResult(bool value);
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2898,15 +3300,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::LoadClassResults::Pipeline {
+class UnrealCore::DestroyObjectResults::Pipeline {
 public:
-  typedef LoadClassResults Pipelines;
+  typedef DestroyObjectResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2915,9 +3316,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::StaticClassParams::Reader {
+class UnrealCore::CallFunctionParams::Reader {
 public:
-  typedef StaticClassParams Reads;
+  typedef CallFunctionParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -2932,8 +3333,20 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
+
+  inline bool hasCallObject() const;
+  inline  ::UnrealCore::Object::Reader getCallObject() const;
+
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+  inline bool hasFuncName() const;
+  inline  ::capnp::Text::Reader getFuncName() const;
+
+  inline bool hasParams() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getParams() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -2947,9 +3360,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::StaticClassParams::Builder {
+class UnrealCore::CallFunctionParams::Builder {
 public:
-  typedef StaticClassParams Builds;
+  typedef CallFunctionParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -2963,12 +3376,40 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+
+  inline bool hasCallObject();
+  inline  ::UnrealCore::Object::Builder getCallObject();
+  inline void setCallObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initCallObject();
+  inline void adoptCallObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownCallObject();
+
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+  inline bool hasFuncName();
+  inline  ::capnp::Text::Builder getFuncName();
+  inline void setFuncName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initFuncName(unsigned int size);
+  inline void adoptFuncName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownFuncName();
+
+  inline bool hasParams();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getParams();
+  inline void setParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initParams(unsigned int size);
+  inline void adoptParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownParams();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -2980,15 +3421,17 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::StaticClassParams::Pipeline {
+class UnrealCore::CallFunctionParams::Pipeline {
 public:
-  typedef StaticClassParams Pipelines;
+  typedef CallFunctionParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::Object::Pipeline getOwn();
+  inline  ::UnrealCore::Object::Pipeline getCallObject();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -2997,9 +3440,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::StaticClassResults::Reader {
+class UnrealCore::CallFunctionResults::Reader {
 public:
-  typedef StaticClassResults Reads;
+  typedef CallFunctionResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3014,8 +3457,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
+  inline bool hasReturn() const;
+  inline  ::UnrealCore::Argument::Reader getReturn() const;
+
+  inline bool hasOutParams() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getOutParams() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3029,9 +3475,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::StaticClassResults::Builder {
+class UnrealCore::CallFunctionResults::Builder {
 public:
-  typedef StaticClassResults Builds;
+  typedef CallFunctionResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3045,12 +3491,19 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+  inline bool hasReturn();
+  inline  ::UnrealCore::Argument::Builder getReturn();
+  inline void setReturn( ::UnrealCore::Argument::Reader value);
+  inline  ::UnrealCore::Argument::Builder initReturn();
+  inline void adoptReturn(::capnp::Orphan< ::UnrealCore::Argument>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Argument> disownReturn();
+
+  inline bool hasOutParams();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getOutParams();
+  inline void setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initOutParams(unsigned int size);
+  inline void adoptOutParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownOutParams();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3062,15 +3515,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::StaticClassResults::Pipeline {
+class UnrealCore::CallFunctionResults::Pipeline {
 public:
-  typedef StaticClassResults Pipelines;
+  typedef CallFunctionResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Argument::Pipeline getReturn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3079,9 +3532,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::BindDelegateParams::Reader {
+class UnrealCore::CallStaticFunctionParams::Reader {
 public:
-  typedef BindDelegateParams Reads;
+  typedef CallStaticFunctionParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3096,13 +3549,14 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
 
-  inline bool hasCallback() const;
-#if !CAPNP_LITE
-  inline  ::UnrealCore::DelegateCallback::Client getCallback() const;
-#endif  // !CAPNP_LITE
+  inline bool hasFuncName() const;
+  inline  ::capnp::Text::Reader getFuncName() const;
+
+  inline bool hasParams() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getParams() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3116,9 +3570,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::BindDelegateParams::Builder {
+class UnrealCore::CallStaticFunctionParams::Builder {
 public:
-  typedef BindDelegateParams Builds;
+  typedef CallStaticFunctionParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3132,21 +3586,26 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
-
-  inline bool hasCallback();
-#if !CAPNP_LITE
-  inline  ::UnrealCore::DelegateCallback::Client getCallback();
-  inline void setCallback( ::UnrealCore::DelegateCallback::Client&& value);
-  inline void setCallback( ::UnrealCore::DelegateCallback::Client& value);
-  inline void adoptCallback(::capnp::Orphan< ::UnrealCore::DelegateCallback>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::DelegateCallback> disownCallback();
-#endif  // !CAPNP_LITE
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+  inline bool hasFuncName();
+  inline  ::capnp::Text::Builder getFuncName();
+  inline void setFuncName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initFuncName(unsigned int size);
+  inline void adoptFuncName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownFuncName();
+
+  inline bool hasParams();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getParams();
+  inline void setParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initParams(unsigned int size);
+  inline void adoptParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownParams();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3158,16 +3617,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::BindDelegateParams::Pipeline {
+class UnrealCore::CallStaticFunctionParams::Pipeline {
 public:
-  typedef BindDelegateParams Pipelines;
+  typedef CallStaticFunctionParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
-  inline  ::UnrealCore::DelegateCallback::Client getCallback();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3176,9 +3634,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::BindDelegateResults::Reader {
+class UnrealCore::CallStaticFunctionResults::Reader {
 public:
-  typedef BindDelegateResults Reads;
+  typedef CallStaticFunctionResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3193,6 +3651,12 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline bool hasReturn() const;
+  inline  ::UnrealCore::Argument::Reader getReturn() const;
+
+  inline bool hasOutParams() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getOutParams() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -3205,9 +3669,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::BindDelegateResults::Builder {
+class UnrealCore::CallStaticFunctionResults::Builder {
 public:
-  typedef BindDelegateResults Builds;
+  typedef CallStaticFunctionResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3221,6 +3685,20 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline bool hasReturn();
+  inline  ::UnrealCore::Argument::Builder getReturn();
+  inline void setReturn( ::UnrealCore::Argument::Reader value);
+  inline  ::UnrealCore::Argument::Builder initReturn();
+  inline void adoptReturn(::capnp::Orphan< ::UnrealCore::Argument>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Argument> disownReturn();
+
+  inline bool hasOutParams();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getOutParams();
+  inline void setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initOutParams(unsigned int size);
+  inline void adoptOutParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownOutParams();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -3231,14 +3709,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::BindDelegateResults::Pipeline {
+class UnrealCore::CallStaticFunctionResults::Pipeline {
 public:
-  typedef BindDelegateResults Pipelines;
+  typedef CallStaticFunctionResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::UnrealCore::Argument::Pipeline getReturn();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3247,9 +3726,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::UnbindDelegateParams::Reader {
+class UnrealCore::FindClassParams::Reader {
 public:
-  typedef UnbindDelegateParams Reads;
+  typedef FindClassParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3264,8 +3743,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3279,9 +3758,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::UnbindDelegateParams::Builder {
+class UnrealCore::FindClassParams::Builder {
 public:
-  typedef UnbindDelegateParams Builds;
+  typedef FindClassParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3295,12 +3774,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3312,15 +3791,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::UnbindDelegateParams::Pipeline {
+class UnrealCore::FindClassParams::Pipeline {
 public:
-  typedef UnbindDelegateParams Pipelines;
+  typedef FindClassParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3329,9 +3808,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::UnbindDelegateResults::Reader {
+class UnrealCore::FindClassResults::Reader {
 public:
-  typedef UnbindDelegateResults Reads;
+  typedef FindClassResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3346,6 +3825,9 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -3358,9 +3840,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::UnbindDelegateResults::Builder {
+class UnrealCore::FindClassResults::Builder {
 public:
-  typedef UnbindDelegateResults Builds;
+  typedef FindClassResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3374,6 +3856,13 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -3384,14 +3873,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::UnbindDelegateResults::Pipeline {
+class UnrealCore::FindClassResults::Pipeline {
 public:
-  typedef UnbindDelegateResults Pipelines;
+  typedef FindClassResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3400,9 +3890,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::AddMultiDelegateParams::Reader {
+class UnrealCore::LoadClassParams::Reader {
 public:
-  typedef AddMultiDelegateParams Reads;
+  typedef LoadClassParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3417,13 +3907,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject() const;
-  inline  ::UnrealCore::Object::Reader getObject() const;
-
-  inline bool hasCallback() const;
-#if !CAPNP_LITE
-  inline  ::UnrealCore::DelegateCallback::Client getCallback() const;
-#endif  // !CAPNP_LITE
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3437,9 +3922,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::AddMultiDelegateParams::Builder {
+class UnrealCore::LoadClassParams::Builder {
 public:
-  typedef AddMultiDelegateParams Builds;
+  typedef LoadClassParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3453,21 +3938,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasObject();
-  inline  ::UnrealCore::Object::Builder getObject();
-  inline void setObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initObject();
-  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
-
-  inline bool hasCallback();
-#if !CAPNP_LITE
-  inline  ::UnrealCore::DelegateCallback::Client getCallback();
-  inline void setCallback( ::UnrealCore::DelegateCallback::Client&& value);
-  inline void setCallback( ::UnrealCore::DelegateCallback::Client& value);
-  inline void adoptCallback(::capnp::Orphan< ::UnrealCore::DelegateCallback>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::DelegateCallback> disownCallback();
-#endif  // !CAPNP_LITE
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3479,16 +3955,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::AddMultiDelegateParams::Pipeline {
+class UnrealCore::LoadClassParams::Pipeline {
 public:
-  typedef AddMultiDelegateParams Pipelines;
+  typedef LoadClassParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getObject();
-  inline  ::UnrealCore::DelegateCallback::Client getCallback();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3497,9 +3972,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::AddMultiDelegateResults::Reader {
+class UnrealCore::LoadClassResults::Reader {
 public:
-  typedef AddMultiDelegateResults Reads;
+  typedef LoadClassResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3514,8 +3989,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasDelegateObject() const;
-  inline  ::UnrealCore::Object::Reader getDelegateObject() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3529,9 +4004,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::AddMultiDelegateResults::Builder {
+class UnrealCore::LoadClassResults::Builder {
 public:
-  typedef AddMultiDelegateResults Builds;
+  typedef LoadClassResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3545,12 +4020,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasDelegateObject();
-  inline  ::UnrealCore::Object::Builder getDelegateObject();
-  inline void setDelegateObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initDelegateObject();
-  inline void adoptDelegateObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownDelegateObject();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3562,15 +4037,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::AddMultiDelegateResults::Pipeline {
+class UnrealCore::LoadClassResults::Pipeline {
 public:
-  typedef AddMultiDelegateResults Pipelines;
+  typedef LoadClassResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getDelegateObject();
+  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3579,9 +4054,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RemoveMultiDelegateParams::Reader {
+class UnrealCore::StaticClassParams::Reader {
 public:
-  typedef RemoveMultiDelegateParams Reads;
+  typedef StaticClassParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3599,9 +4074,6 @@ public:
   inline bool hasObject() const;
   inline  ::UnrealCore::Object::Reader getObject() const;
 
-  inline bool hasDelegateObject() const;
-  inline  ::UnrealCore::Object::Reader getDelegateObject() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -3614,9 +4086,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RemoveMultiDelegateParams::Builder {
+class UnrealCore::StaticClassParams::Builder {
 public:
-  typedef RemoveMultiDelegateParams Builds;
+  typedef StaticClassParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3637,13 +4109,6 @@ public:
   inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
   inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
-  inline bool hasDelegateObject();
-  inline  ::UnrealCore::Object::Builder getDelegateObject();
-  inline void setDelegateObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initDelegateObject();
-  inline void adoptDelegateObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownDelegateObject();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -3654,16 +4119,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RemoveMultiDelegateParams::Pipeline {
+class UnrealCore::StaticClassParams::Pipeline {
 public:
-  typedef RemoveMultiDelegateParams Pipelines;
+  typedef StaticClassParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
   inline  ::UnrealCore::Object::Pipeline getObject();
-  inline  ::UnrealCore::Object::Pipeline getDelegateObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3672,9 +4136,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RemoveMultiDelegateResults::Reader {
+class UnrealCore::StaticClassResults::Reader {
 public:
-  typedef RemoveMultiDelegateResults Reads;
+  typedef StaticClassResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3689,6 +4153,9 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -3701,9 +4168,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RemoveMultiDelegateResults::Builder {
+class UnrealCore::StaticClassResults::Builder {
 public:
-  typedef RemoveMultiDelegateResults Builds;
+  typedef StaticClassResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3717,6 +4184,13 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -3727,14 +4201,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RemoveMultiDelegateResults::Pipeline {
+class UnrealCore::StaticClassResults::Pipeline {
 public:
-  typedef RemoveMultiDelegateResults Pipelines;
+  typedef StaticClassResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3743,9 +4218,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RegisterOverrideClassParams::Reader {
+class UnrealCore::BindDelegateParams::Reader {
 public:
-  typedef RegisterOverrideClassParams Reads;
+  typedef BindDelegateParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3760,14 +4235,13 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasParent() const;
-  inline  ::UnrealCore::Class::Reader getParent() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
-  inline bool hasMethods() const;
-  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Reader getMethods() const;
+  inline bool hasCallback() const;
+#if !CAPNP_LITE
+  inline  ::UnrealCore::DelegateCallback::Client getCallback() const;
+#endif  // !CAPNP_LITE
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3781,9 +4255,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RegisterOverrideClassParams::Builder {
+class UnrealCore::BindDelegateParams::Builder {
 public:
-  typedef RegisterOverrideClassParams Builds;
+  typedef BindDelegateParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3797,26 +4271,21 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasParent();
-  inline  ::UnrealCore::Class::Builder getParent();
-  inline void setParent( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initParent();
-  inline void adoptParent(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownParent();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
-  inline bool hasMethods();
-  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Builder getMethods();
-  inline void setMethods( ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Reader value);
-  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Builder initMethods(unsigned int size);
-  inline void adoptMethods(::capnp::Orphan< ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>>&& value);
-  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>> disownMethods();
+  inline bool hasCallback();
+#if !CAPNP_LITE
+  inline  ::UnrealCore::DelegateCallback::Client getCallback();
+  inline void setCallback( ::UnrealCore::DelegateCallback::Client&& value);
+  inline void setCallback( ::UnrealCore::DelegateCallback::Client& value);
+  inline void adoptCallback(::capnp::Orphan< ::UnrealCore::DelegateCallback>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::DelegateCallback> disownCallback();
+#endif  // !CAPNP_LITE
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3828,16 +4297,16 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RegisterOverrideClassParams::Pipeline {
+class UnrealCore::BindDelegateParams::Pipeline {
 public:
-  typedef RegisterOverrideClassParams Pipelines;
+  typedef BindDelegateParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
-  inline  ::UnrealCore::Class::Pipeline getParent();
+  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::DelegateCallback::Client getCallback();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -3846,9 +4315,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RegisterOverrideClassResults::Reader {
+class UnrealCore::BindDelegateResults::Reader {
 public:
-  typedef RegisterOverrideClassResults Reads;
+  typedef BindDelegateResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3875,9 +4344,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RegisterOverrideClassResults::Builder {
+class UnrealCore::BindDelegateResults::Builder {
 public:
-  typedef RegisterOverrideClassResults Builds;
+  typedef BindDelegateResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3901,9 +4370,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RegisterOverrideClassResults::Pipeline {
+class UnrealCore::BindDelegateResults::Pipeline {
 public:
-  typedef RegisterOverrideClassResults Pipelines;
+  typedef BindDelegateResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -3917,9 +4386,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::UnregisterOverrideClassParams::Reader {
+class UnrealCore::UnbindDelegateParams::Reader {
 public:
-  typedef UnregisterOverrideClassParams Reads;
+  typedef UnbindDelegateParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -3934,11 +4403,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasParent() const;
-  inline  ::UnrealCore::Class::Reader getParent() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -3952,9 +4418,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::UnregisterOverrideClassParams::Builder {
+class UnrealCore::UnbindDelegateParams::Builder {
 public:
-  typedef UnregisterOverrideClassParams Builds;
+  typedef UnbindDelegateParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -3968,19 +4434,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasParent();
-  inline  ::UnrealCore::Class::Builder getParent();
-  inline void setParent( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initParent();
-  inline void adoptParent(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownParent();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -3992,16 +4451,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::UnregisterOverrideClassParams::Pipeline {
+class UnrealCore::UnbindDelegateParams::Pipeline {
 public:
-  typedef UnregisterOverrideClassParams Pipelines;
+  typedef UnbindDelegateParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
-  inline  ::UnrealCore::Class::Pipeline getParent();
+  inline  ::UnrealCore::Object::Pipeline getObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4010,9 +4468,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::UnregisterOverrideClassResults::Reader {
+class UnrealCore::UnbindDelegateResults::Reader {
 public:
-  typedef UnregisterOverrideClassResults Reads;
+  typedef UnbindDelegateResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4039,9 +4497,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::UnregisterOverrideClassResults::Builder {
+class UnrealCore::UnbindDelegateResults::Builder {
 public:
-  typedef UnregisterOverrideClassResults Builds;
+  typedef UnbindDelegateResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4065,9 +4523,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::UnregisterOverrideClassResults::Pipeline {
+class UnrealCore::UnbindDelegateResults::Pipeline {
 public:
-  typedef UnregisterOverrideClassResults Pipelines;
+  typedef UnbindDelegateResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -4081,9 +4539,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::SetPropertyParams::Reader {
+class UnrealCore::AddMultiDelegateParams::Reader {
 public:
-  typedef SetPropertyParams Reads;
+  typedef AddMultiDelegateParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4098,14 +4556,13 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasOwner() const;
-  inline  ::UnrealCore::Object::Reader getOwner() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
-  inline bool hasProperty() const;
-  inline  ::UnrealCore::Argument::Reader getProperty() const;
+  inline bool hasCallback() const;
+#if !CAPNP_LITE
+  inline  ::UnrealCore::DelegateCallback::Client getCallback() const;
+#endif  // !CAPNP_LITE
 
 private:
   ::capnp::_::StructReader _reader;
@@ -4119,9 +4576,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::SetPropertyParams::Builder {
+class UnrealCore::AddMultiDelegateParams::Builder {
 public:
-  typedef SetPropertyParams Builds;
+  typedef AddMultiDelegateParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4135,26 +4592,21 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasOwner();
-  inline  ::UnrealCore::Object::Builder getOwner();
-  inline void setOwner( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwner();
-  inline void adoptOwner(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwner();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
-  inline bool hasProperty();
-  inline  ::UnrealCore::Argument::Builder getProperty();
-  inline void setProperty( ::UnrealCore::Argument::Reader value);
-  inline  ::UnrealCore::Argument::Builder initProperty();
-  inline void adoptProperty(::capnp::Orphan< ::UnrealCore::Argument>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Argument> disownProperty();
+  inline bool hasCallback();
+#if !CAPNP_LITE
+  inline  ::UnrealCore::DelegateCallback::Client getCallback();
+  inline void setCallback( ::UnrealCore::DelegateCallback::Client&& value);
+  inline void setCallback( ::UnrealCore::DelegateCallback::Client& value);
+  inline void adoptCallback(::capnp::Orphan< ::UnrealCore::DelegateCallback>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::DelegateCallback> disownCallback();
+#endif  // !CAPNP_LITE
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -4166,17 +4618,16 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::SetPropertyParams::Pipeline {
+class UnrealCore::AddMultiDelegateParams::Pipeline {
 public:
-  typedef SetPropertyParams Pipelines;
+  typedef AddMultiDelegateParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
-  inline  ::UnrealCore::Object::Pipeline getOwner();
-  inline  ::UnrealCore::Argument::Pipeline getProperty();
+  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::DelegateCallback::Client getCallback();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4185,9 +4636,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::SetPropertyResults::Reader {
+class UnrealCore::AddMultiDelegateResults::Reader {
 public:
-  typedef SetPropertyResults Reads;
+  typedef AddMultiDelegateResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4202,6 +4653,9 @@ public:
   }
 #endif  // !CAPNP_LITE
 
+  inline bool hasDelegateObject() const;
+  inline  ::UnrealCore::Object::Reader getDelegateObject() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -4214,9 +4668,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::SetPropertyResults::Builder {
+class UnrealCore::AddMultiDelegateResults::Builder {
 public:
-  typedef SetPropertyResults Builds;
+  typedef AddMultiDelegateResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4230,6 +4684,13 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
+  inline bool hasDelegateObject();
+  inline  ::UnrealCore::Object::Builder getDelegateObject();
+  inline void setDelegateObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initDelegateObject();
+  inline void adoptDelegateObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownDelegateObject();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -4240,14 +4701,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::SetPropertyResults::Pipeline {
+class UnrealCore::AddMultiDelegateResults::Pipeline {
 public:
-  typedef SetPropertyResults Pipelines;
+  typedef AddMultiDelegateResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::UnrealCore::Object::Pipeline getDelegateObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4256,9 +4718,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::GetPropertyParams::Reader {
+class UnrealCore::RemoveMultiDelegateParams::Reader {
 public:
-  typedef GetPropertyParams Reads;
+  typedef RemoveMultiDelegateParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4273,14 +4735,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass() const;
-  inline  ::UnrealCore::Class::Reader getUeClass() const;
-
-  inline bool hasOwner() const;
-  inline  ::UnrealCore::Object::Reader getOwner() const;
+  inline bool hasObject() const;
+  inline  ::UnrealCore::Object::Reader getObject() const;
 
-  inline bool hasPropertyName() const;
-  inline  ::capnp::Text::Reader getPropertyName() const;
+  inline bool hasDelegateObject() const;
+  inline  ::UnrealCore::Object::Reader getDelegateObject() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -4294,9 +4753,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::GetPropertyParams::Builder {
+class UnrealCore::RemoveMultiDelegateParams::Builder {
 public:
-  typedef GetPropertyParams Builds;
+  typedef RemoveMultiDelegateParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4310,26 +4769,19 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUeClass();
-  inline  ::UnrealCore::Class::Builder getUeClass();
-  inline void setUeClass( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initUeClass();
-  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
-
-  inline bool hasOwner();
-  inline  ::UnrealCore::Object::Builder getOwner();
-  inline void setOwner( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwner();
-  inline void adoptOwner(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwner();
+  inline bool hasObject();
+  inline  ::UnrealCore::Object::Builder getObject();
+  inline void setObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initObject();
+  inline void adoptObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownObject();
 
-  inline bool hasPropertyName();
-  inline  ::capnp::Text::Builder getPropertyName();
-  inline void setPropertyName( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initPropertyName(unsigned int size);
-  inline void adoptPropertyName(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownPropertyName();
+  inline bool hasDelegateObject();
+  inline  ::UnrealCore::Object::Builder getDelegateObject();
+  inline void setDelegateObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initDelegateObject();
+  inline void adoptDelegateObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownDelegateObject();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -4341,16 +4793,16 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::GetPropertyParams::Pipeline {
+class UnrealCore::RemoveMultiDelegateParams::Pipeline {
 public:
-  typedef GetPropertyParams Pipelines;
+  typedef RemoveMultiDelegateParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Class::Pipeline getUeClass();
-  inline  ::UnrealCore::Object::Pipeline getOwner();
+  inline  ::UnrealCore::Object::Pipeline getObject();
+  inline  ::UnrealCore::Object::Pipeline getDelegateObject();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4359,9 +4811,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::GetPropertyResults::Reader {
+class UnrealCore::RemoveMultiDelegateResults::Reader {
 public:
-  typedef GetPropertyResults Reads;
+  typedef RemoveMultiDelegateResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4376,9 +4828,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasProperty() const;
-  inline  ::UnrealCore::Argument::Reader getProperty() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -4391,9 +4840,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::GetPropertyResults::Builder {
+class UnrealCore::RemoveMultiDelegateResults::Builder {
 public:
-  typedef GetPropertyResults Builds;
+  typedef RemoveMultiDelegateResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4407,13 +4856,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasProperty();
-  inline  ::UnrealCore::Argument::Builder getProperty();
-  inline void setProperty( ::UnrealCore::Argument::Reader value);
-  inline  ::UnrealCore::Argument::Builder initProperty();
-  inline void adoptProperty(::capnp::Orphan< ::UnrealCore::Argument>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Argument> disownProperty();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -4424,15 +4866,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::GetPropertyResults::Pipeline {
+class UnrealCore::RemoveMultiDelegateResults::Pipeline {
 public:
-  typedef GetPropertyResults Pipelines;
+  typedef RemoveMultiDelegateResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Argument::Pipeline getProperty();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4441,9 +4882,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RegisterCreatedPyObjectParams::Reader {
+class UnrealCore::RegisterOverrideClassParams::Reader {
 public:
-  typedef RegisterCreatedPyObjectParams Reads;
+  typedef RegisterOverrideClassParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4458,15 +4899,15 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasPyObject() const;
-  inline  ::UnrealCore::Object::Reader getPyObject() const;
-
-  inline bool hasUnrealObject() const;
-  inline  ::UnrealCore::Object::Reader getUnrealObject() const;
-
   inline bool hasUeClass() const;
   inline  ::UnrealCore::Class::Reader getUeClass() const;
 
+  inline bool hasParent() const;
+  inline  ::UnrealCore::Class::Reader getParent() const;
+
+  inline bool hasMethods() const;
+  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Reader getMethods() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -4479,9 +4920,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RegisterCreatedPyObjectParams::Builder {
+class UnrealCore::RegisterOverrideClassParams::Builder {
 public:
-  typedef RegisterCreatedPyObjectParams Builds;
+  typedef RegisterOverrideClassParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4495,20 +4936,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasPyObject();
-  inline  ::UnrealCore::Object::Builder getPyObject();
-  inline void setPyObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initPyObject();
-  inline void adoptPyObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownPyObject();
-
-  inline bool hasUnrealObject();
-  inline  ::UnrealCore::Object::Builder getUnrealObject();
-  inline void setUnrealObject( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initUnrealObject();
-  inline void adoptUnrealObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownUnrealObject();
-
   inline bool hasUeClass();
   inline  ::UnrealCore::Class::Builder getUeClass();
   inline void setUeClass( ::UnrealCore::Class::Reader value);
@@ -4516,6 +4943,20 @@ public:
   inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
   inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
+  inline bool hasParent();
+  inline  ::UnrealCore::Class::Builder getParent();
+  inline void setParent( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initParent();
+  inline void adoptParent(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownParent();
+
+  inline bool hasMethods();
+  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Builder getMethods();
+  inline void setMethods( ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>::Builder initMethods(unsigned int size);
+  inline void adoptMethods(::capnp::Orphan< ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Method,  ::capnp::Kind::STRUCT>> disownMethods();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -4526,17 +4967,16 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RegisterCreatedPyObjectParams::Pipeline {
+class UnrealCore::RegisterOverrideClassParams::Pipeline {
 public:
-  typedef RegisterCreatedPyObjectParams Pipelines;
+  typedef RegisterOverrideClassParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getPyObject();
-  inline  ::UnrealCore::Object::Pipeline getUnrealObject();
   inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Class::Pipeline getParent();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4545,9 +4985,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::RegisterCreatedPyObjectResults::Reader {
+class UnrealCore::RegisterOverrideClassResults::Reader {
 public:
-  typedef RegisterCreatedPyObjectResults Reads;
+  typedef RegisterOverrideClassResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4574,9 +5014,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::RegisterCreatedPyObjectResults::Builder {
+class UnrealCore::RegisterOverrideClassResults::Builder {
 public:
-  typedef RegisterCreatedPyObjectResults Builds;
+  typedef RegisterOverrideClassResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4600,9 +5040,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::RegisterCreatedPyObjectResults::Pipeline {
+class UnrealCore::RegisterOverrideClassResults::Pipeline {
 public:
-  typedef RegisterCreatedPyObjectResults Pipelines;
+  typedef RegisterOverrideClassResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -4616,9 +5056,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::NewContainerParams::Reader {
+class UnrealCore::UnregisterOverrideClassParams::Reader {
 public:
-  typedef NewContainerParams Reads;
+  typedef UnregisterOverrideClassParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4633,17 +5073,11 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn() const;
-  inline  ::UnrealCore::Object::Reader getOwn() const;
-
-  inline bool hasContainerType() const;
-  inline  ::UnrealCore::Class::Reader getContainerType() const;
-
-  inline bool hasValueType() const;
-  inline  ::UnrealCore::Class::Reader getValueType() const;
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
 
-  inline bool hasKeyType() const;
-  inline  ::UnrealCore::Class::Reader getKeyType() const;
+  inline bool hasParent() const;
+  inline  ::UnrealCore::Class::Reader getParent() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -4657,9 +5091,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::NewContainerParams::Builder {
+class UnrealCore::UnregisterOverrideClassParams::Builder {
 public:
-  typedef NewContainerParams Builds;
+  typedef UnregisterOverrideClassParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4673,33 +5107,19 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn();
-  inline  ::UnrealCore::Object::Builder getOwn();
-  inline void setOwn( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwn();
-  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
-
-  inline bool hasContainerType();
-  inline  ::UnrealCore::Class::Builder getContainerType();
-  inline void setContainerType( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initContainerType();
-  inline void adoptContainerType(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownContainerType();
-
-  inline bool hasValueType();
-  inline  ::UnrealCore::Class::Builder getValueType();
-  inline void setValueType( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initValueType();
-  inline void adoptValueType(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownValueType();
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
 
-  inline bool hasKeyType();
-  inline  ::UnrealCore::Class::Builder getKeyType();
-  inline void setKeyType( ::UnrealCore::Class::Reader value);
-  inline  ::UnrealCore::Class::Builder initKeyType();
-  inline void adoptKeyType(::capnp::Orphan< ::UnrealCore::Class>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Class> disownKeyType();
+  inline bool hasParent();
+  inline  ::UnrealCore::Class::Builder getParent();
+  inline void setParent( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initParent();
+  inline void adoptParent(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownParent();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -4711,18 +5131,16 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::NewContainerParams::Pipeline {
+class UnrealCore::UnregisterOverrideClassParams::Pipeline {
 public:
-  typedef NewContainerParams Pipelines;
+  typedef UnregisterOverrideClassParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getOwn();
-  inline  ::UnrealCore::Class::Pipeline getContainerType();
-  inline  ::UnrealCore::Class::Pipeline getValueType();
-  inline  ::UnrealCore::Class::Pipeline getKeyType();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Class::Pipeline getParent();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4731,9 +5149,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::NewContainerResults::Reader {
+class UnrealCore::UnregisterOverrideClassResults::Reader {
 public:
-  typedef NewContainerResults Reads;
+  typedef UnregisterOverrideClassResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4748,9 +5166,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasContainer() const;
-  inline  ::UnrealCore::Object::Reader getContainer() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -4763,9 +5178,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::NewContainerResults::Builder {
+class UnrealCore::UnregisterOverrideClassResults::Builder {
 public:
-  typedef NewContainerResults Builds;
+  typedef UnregisterOverrideClassResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4779,13 +5194,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasContainer();
-  inline  ::UnrealCore::Object::Builder getContainer();
-  inline void setContainer( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initContainer();
-  inline void adoptContainer(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownContainer();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -4796,15 +5204,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::NewContainerResults::Pipeline {
+class UnrealCore::UnregisterOverrideClassResults::Pipeline {
 public:
-  typedef NewContainerResults Pipelines;
+  typedef UnregisterOverrideClassResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getContainer();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4813,9 +5220,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::DestroyContainerParams::Reader {
+class UnrealCore::SetPropertyParams::Reader {
 public:
-  typedef DestroyContainerParams Reads;
+  typedef SetPropertyParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4830,8 +5237,14 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn() const;
-  inline  ::UnrealCore::Object::Reader getOwn() const;
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+  inline bool hasOwner() const;
+  inline  ::UnrealCore::Object::Reader getOwner() const;
+
+  inline bool hasProperty() const;
+  inline  ::UnrealCore::Argument::Reader getProperty() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -4845,9 +5258,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::DestroyContainerParams::Builder {
+class UnrealCore::SetPropertyParams::Builder {
 public:
-  typedef DestroyContainerParams Builds;
+  typedef SetPropertyParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4861,12 +5274,26 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasOwn();
-  inline  ::UnrealCore::Object::Builder getOwn();
-  inline void setOwn( ::UnrealCore::Object::Reader value);
-  inline  ::UnrealCore::Object::Builder initOwn();
-  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
-  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+  inline bool hasOwner();
+  inline  ::UnrealCore::Object::Builder getOwner();
+  inline void setOwner( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwner();
+  inline void adoptOwner(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwner();
+
+  inline bool hasProperty();
+  inline  ::UnrealCore::Argument::Builder getProperty();
+  inline void setProperty( ::UnrealCore::Argument::Reader value);
+  inline  ::UnrealCore::Argument::Builder initProperty();
+  inline void adoptProperty(::capnp::Orphan< ::UnrealCore::Argument>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Argument> disownProperty();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -4878,15 +5305,17 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::DestroyContainerParams::Pipeline {
+class UnrealCore::SetPropertyParams::Pipeline {
 public:
-  typedef DestroyContainerParams Pipelines;
+  typedef SetPropertyParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline  ::UnrealCore::Object::Pipeline getOwn();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Object::Pipeline getOwner();
+  inline  ::UnrealCore::Argument::Pipeline getProperty();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -4895,9 +5324,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class UnrealCore::DestroyContainerResults::Reader {
+class UnrealCore::SetPropertyResults::Reader {
 public:
-  typedef DestroyContainerResults Reads;
+  typedef SetPropertyResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -4912,8 +5341,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool getResult() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -4926,9 +5353,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class UnrealCore::DestroyContainerResults::Builder {
+class UnrealCore::SetPropertyResults::Builder {
 public:
-  typedef DestroyContainerResults Builds;
+  typedef SetPropertyResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -4942,9 +5369,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool getResult();
-  inline void setResult(bool value);
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -4955,9 +5379,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class UnrealCore::DestroyContainerResults::Pipeline {
+class UnrealCore::SetPropertyResults::Pipeline {
 public:
-  typedef DestroyContainerResults Pipelines;
+  typedef SetPropertyResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -4971,10 +5395,1416 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-// =======================================================================================
+class UnrealCore::GetPropertyParams::Reader {
+public:
+  typedef GetPropertyParams Reads;
 
-#if !CAPNP_LITE
-inline UnrealCore::Client::Client(decltype(nullptr))
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+  inline bool hasOwner() const;
+  inline  ::UnrealCore::Object::Reader getOwner() const;
+
+  inline bool hasPropertyName() const;
+  inline  ::capnp::Text::Reader getPropertyName() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetPropertyParams::Builder {
+public:
+  typedef GetPropertyParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+  inline bool hasOwner();
+  inline  ::UnrealCore::Object::Builder getOwner();
+  inline void setOwner( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwner();
+  inline void adoptOwner(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwner();
+
+  inline bool hasPropertyName();
+  inline  ::capnp::Text::Builder getPropertyName();
+  inline void setPropertyName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initPropertyName(unsigned int size);
+  inline void adoptPropertyName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownPropertyName();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetPropertyParams::Pipeline {
+public:
+  typedef GetPropertyParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::Object::Pipeline getOwner();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::GetPropertyResults::Reader {
+public:
+  typedef GetPropertyResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasProperty() const;
+  inline  ::UnrealCore::Argument::Reader getProperty() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetPropertyResults::Builder {
+public:
+  typedef GetPropertyResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasProperty();
+  inline  ::UnrealCore::Argument::Builder getProperty();
+  inline void setProperty( ::UnrealCore::Argument::Reader value);
+  inline  ::UnrealCore::Argument::Builder initProperty();
+  inline void adoptProperty(::capnp::Orphan< ::UnrealCore::Argument>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Argument> disownProperty();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetPropertyResults::Pipeline {
+public:
+  typedef GetPropertyResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Argument::Pipeline getProperty();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::RegisterCreatedPyObjectParams::Reader {
+public:
+  typedef RegisterCreatedPyObjectParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasPyObject() const;
+  inline  ::UnrealCore::Object::Reader getPyObject() const;
+
+  inline bool hasUnrealObject() const;
+  inline  ::UnrealCore::Object::Reader getUnrealObject() const;
+
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::RegisterCreatedPyObjectParams::Builder {
+public:
+  typedef RegisterCreatedPyObjectParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasPyObject();
+  inline  ::UnrealCore::Object::Builder getPyObject();
+  inline void setPyObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initPyObject();
+  inline void adoptPyObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownPyObject();
+
+  inline bool hasUnrealObject();
+  inline  ::UnrealCore::Object::Builder getUnrealObject();
+  inline void setUnrealObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initUnrealObject();
+  inline void adoptUnrealObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownUnrealObject();
+
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::RegisterCreatedPyObjectParams::Pipeline {
+public:
+  typedef RegisterCreatedPyObjectParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Object::Pipeline getPyObject();
+  inline  ::UnrealCore::Object::Pipeline getUnrealObject();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::RegisterCreatedPyObjectResults::Reader {
+public:
+  typedef RegisterCreatedPyObjectResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::RegisterCreatedPyObjectResults::Builder {
+public:
+  typedef RegisterCreatedPyObjectResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::RegisterCreatedPyObjectResults::Pipeline {
+public:
+  typedef RegisterCreatedPyObjectResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::NewContainerParams::Reader {
+public:
+  typedef NewContainerParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
+
+  inline bool hasContainerType() const;
+  inline  ::UnrealCore::Class::Reader getContainerType() const;
+
+  inline bool hasValueType() const;
+  inline  ::UnrealCore::Class::Reader getValueType() const;
+
+  inline bool hasKeyType() const;
+  inline  ::UnrealCore::Class::Reader getKeyType() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::NewContainerParams::Builder {
+public:
+  typedef NewContainerParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+
+  inline bool hasContainerType();
+  inline  ::UnrealCore::Class::Builder getContainerType();
+  inline void setContainerType( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initContainerType();
+  inline void adoptContainerType(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownContainerType();
+
+  inline bool hasValueType();
+  inline  ::UnrealCore::Class::Builder getValueType();
+  inline void setValueType( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initValueType();
+  inline void adoptValueType(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownValueType();
+
+  inline bool hasKeyType();
+  inline  ::UnrealCore::Class::Builder getKeyType();
+  inline void setKeyType( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initKeyType();
+  inline void adoptKeyType(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownKeyType();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::NewContainerParams::Pipeline {
+public:
+  typedef NewContainerParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Object::Pipeline getOwn();
+  inline  ::UnrealCore::Class::Pipeline getContainerType();
+  inline  ::UnrealCore::Class::Pipeline getValueType();
+  inline  ::UnrealCore::Class::Pipeline getKeyType();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::NewContainerResults::Reader {
+public:
+  typedef NewContainerResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasContainer() const;
+  inline  ::UnrealCore::Object::Reader getContainer() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::NewContainerResults::Builder {
+public:
+  typedef NewContainerResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasContainer();
+  inline  ::UnrealCore::Object::Builder getContainer();
+  inline void setContainer( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initContainer();
+  inline void adoptContainer(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownContainer();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::NewContainerResults::Pipeline {
+public:
+  typedef NewContainerResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Object::Pipeline getContainer();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::DestroyContainerParams::Reader {
+public:
+  typedef DestroyContainerParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::DestroyContainerParams::Builder {
+public:
+  typedef DestroyContainerParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::DestroyContainerParams::Pipeline {
+public:
+  typedef DestroyContainerParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Object::Pipeline getOwn();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::DestroyContainerResults::Reader {
+public:
+  typedef DestroyContainerResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool getResult() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::DestroyContainerResults::Builder {
+public:
+  typedef DestroyContainerResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool getResult();
+  inline void setResult(bool value);
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::DestroyContainerResults::Pipeline {
+public:
+  typedef DestroyContainerResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::CallFunctionPackedParams::Reader {
+public:
+  typedef CallFunctionPackedParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn() const;
+  inline  ::UnrealCore::Object::Reader getOwn() const;
+
+  inline bool hasCallObject() const;
+  inline  ::UnrealCore::Object::Reader getCallObject() const;
+
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+  inline bool hasFuncName() const;
+  inline  ::capnp::Text::Reader getFuncName() const;
+
+  inline bool hasParams() const;
+  inline  ::UnrealCore::PackedParams::Reader getParams() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::CallFunctionPackedParams::Builder {
+public:
+  typedef CallFunctionPackedParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasOwn();
+  inline  ::UnrealCore::Object::Builder getOwn();
+  inline void setOwn( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initOwn();
+  inline void adoptOwn(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownOwn();
+
+  inline bool hasCallObject();
+  inline  ::UnrealCore::Object::Builder getCallObject();
+  inline void setCallObject( ::UnrealCore::Object::Reader value);
+  inline  ::UnrealCore::Object::Builder initCallObject();
+  inline void adoptCallObject(::capnp::Orphan< ::UnrealCore::Object>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Object> disownCallObject();
+
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+  inline bool hasFuncName();
+  inline  ::capnp::Text::Builder getFuncName();
+  inline void setFuncName( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initFuncName(unsigned int size);
+  inline void adoptFuncName(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownFuncName();
+
+  inline bool hasParams();
+  inline  ::UnrealCore::PackedParams::Builder getParams();
+  inline void setParams( ::UnrealCore::PackedParams::Reader value);
+  inline  ::UnrealCore::PackedParams::Builder initParams();
+  inline void adoptParams(::capnp::Orphan< ::UnrealCore::PackedParams>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::PackedParams> disownParams();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::CallFunctionPackedParams::Pipeline {
+public:
+  typedef CallFunctionPackedParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Object::Pipeline getOwn();
+  inline  ::UnrealCore::Object::Pipeline getCallObject();
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+  inline  ::UnrealCore::PackedParams::Pipeline getParams();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::CallFunctionPackedResults::Reader {
+public:
+  typedef CallFunctionPackedResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasReturn() const;
+  inline  ::UnrealCore::Argument::Reader getReturn() const;
+
+  inline bool hasOutParams() const;
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader getOutParams() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::CallFunctionPackedResults::Builder {
+public:
+  typedef CallFunctionPackedResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasReturn();
+  inline  ::UnrealCore::Argument::Builder getReturn();
+  inline void setReturn( ::UnrealCore::Argument::Reader value);
+  inline  ::UnrealCore::Argument::Builder initReturn();
+  inline void adoptReturn(::capnp::Orphan< ::UnrealCore::Argument>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Argument> disownReturn();
+
+  inline bool hasOutParams();
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder getOutParams();
+  inline void setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder initOutParams(unsigned int size);
+  inline void adoptOutParams(::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> disownOutParams();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::CallFunctionPackedResults::Pipeline {
+public:
+  typedef CallFunctionPackedResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Argument::Pipeline getReturn();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::GetFeaturesParams::Reader {
+public:
+  typedef GetFeaturesParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetFeaturesParams::Builder {
+public:
+  typedef GetFeaturesParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetFeaturesParams::Pipeline {
+public:
+  typedef GetFeaturesParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::GetFeaturesResults::Reader {
+public:
+  typedef GetFeaturesResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline  ::uint64_t getFeatures() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetFeaturesResults::Builder {
+public:
+  typedef GetFeaturesResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline  ::uint64_t getFeatures();
+  inline void setFeatures( ::uint64_t value);
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetFeaturesResults::Pipeline {
+public:
+  typedef GetFeaturesResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::DumpReflectionParams::Reader {
+public:
+  typedef DumpReflectionParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::DumpReflectionParams::Builder {
+public:
+  typedef DumpReflectionParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::DumpReflectionParams::Pipeline {
+public:
+  typedef DumpReflectionParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::DumpReflectionResults::Reader {
+public:
+  typedef DumpReflectionResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasDump() const;
+  inline  ::capnp::Text::Reader getDump() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::DumpReflectionResults::Builder {
+public:
+  typedef DumpReflectionResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasDump();
+  inline  ::capnp::Text::Builder getDump();
+  inline void setDump( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initDump(unsigned int size);
+  inline void adoptDump(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownDump();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::DumpReflectionResults::Pipeline {
+public:
+  typedef DumpReflectionResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::GetClassHierarchyParams::Reader {
+public:
+  typedef GetClassHierarchyParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUeClass() const;
+  inline  ::UnrealCore::Class::Reader getUeClass() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetClassHierarchyParams::Builder {
+public:
+  typedef GetClassHierarchyParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUeClass();
+  inline  ::UnrealCore::Class::Builder getUeClass();
+  inline void setUeClass( ::UnrealCore::Class::Reader value);
+  inline  ::UnrealCore::Class::Builder initUeClass();
+  inline void adoptUeClass(::capnp::Orphan< ::UnrealCore::Class>&& value);
+  inline ::capnp::Orphan< ::UnrealCore::Class> disownUeClass();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetClassHierarchyParams::Pipeline {
+public:
+  typedef GetClassHierarchyParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::UnrealCore::Class::Pipeline getUeClass();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class UnrealCore::GetClassHierarchyResults::Reader {
+public:
+  typedef GetClassHierarchyResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasParents() const;
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader getParents() const;
+
+  inline bool hasInterfaces() const;
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader getInterfaces() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class UnrealCore::GetClassHierarchyResults::Builder {
+public:
+  typedef GetClassHierarchyResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasParents();
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder getParents();
+  inline void setParents( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value);
+  inline void setParents(::kj::ArrayPtr<const  ::capnp::Text::Reader> value);
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder initParents(unsigned int size);
+  inline void adoptParents(::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> disownParents();
+
+  inline bool hasInterfaces();
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder getInterfaces();
+  inline void setInterfaces( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value);
+  inline void setInterfaces(::kj::ArrayPtr<const  ::capnp::Text::Reader> value);
+  inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder initInterfaces(unsigned int size);
+  inline void adoptInterfaces(::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> disownInterfaces();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class UnrealCore::GetClassHierarchyResults::Pipeline {
+public:
+  typedef GetClassHierarchyResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+// =======================================================================================
+
+#if !CAPNP_LITE
+inline UnrealCore::Client::Client(decltype(nullptr))
     : ::capnp::Capability::Client(nullptr) {}
 inline UnrealCore::Client::Client(
     ::kj::Own< ::capnp::ClientHook>&& hook)
@@ -4991,412 +6821,1703 @@ inline  ::UnrealCore::Client& UnrealCore::Client::operator=(Client& other) {
   ::capnp::Capability::Client::operator=(other);
   return *this;
 }
-inline  ::UnrealCore::Client& UnrealCore::Client::operator=(Client&& other) {
-  ::capnp::Capability::Client::operator=(kj::mv(other));
-  return *this;
+inline  ::UnrealCore::Client& UnrealCore::Client::operator=(Client&& other) {
+  ::capnp::Capability::Client::operator=(kj::mv(other));
+  return *this;
+}
+
+#endif  // !CAPNP_LITE
+inline bool UnrealCore::Object::Reader::hasName() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Object::Builder::hasName() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader UnrealCore::Object::Reader::getName() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder UnrealCore::Object::Builder::getName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Object::Builder::setName( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder UnrealCore::Object::Builder::initName(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Object::Builder::adoptName(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Object::Builder::disownName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline  ::uint64_t UnrealCore::Object::Reader::getAddress() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t UnrealCore::Object::Builder::getAddress() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Object::Builder::setAddress( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Class::Reader::hasTypeName() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Class::Builder::hasTypeName() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader UnrealCore::Class::Reader::getTypeName() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder UnrealCore::Class::Builder::getTypeName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Class::Builder::setTypeName( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder UnrealCore::Class::Builder::initTypeName(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Class::Builder::adoptTypeName(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Class::Builder::disownTypeName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline double UnrealCore::Vector2D::Reader::getX() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Vector2D::Builder::getX() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Vector2D::Builder::setX(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Vector2D::Reader::getY() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Vector2D::Builder::getY() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Vector2D::Builder::setY(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Vector::Reader::getX() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Vector::Builder::getX() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Vector::Builder::setX(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Vector::Reader::getY() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Vector::Builder::getY() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Vector::Builder::setY(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Vector::Reader::getZ() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Vector::Builder::getZ() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Vector::Builder::setZ(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Rotator::Reader::getPitch() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Rotator::Builder::getPitch() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Rotator::Builder::setPitch(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Rotator::Reader::getYaw() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Rotator::Builder::getYaw() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Rotator::Builder::setYaw(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Rotator::Reader::getRoll() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Rotator::Builder::getRoll() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Rotator::Builder::setRoll(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Quat::Reader::getX() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Quat::Builder::getX() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Quat::Builder::setX(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Quat::Reader::getY() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Quat::Builder::getY() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Quat::Builder::setY(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Quat::Reader::getZ() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Quat::Builder::getZ() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Quat::Builder::setZ(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS, value);
+}
+
+inline double UnrealCore::Quat::Reader::getW() const {
+  return _reader.getDataField<double>(
+      ::capnp::bounded<3>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Quat::Builder::getW() {
+  return _builder.getDataField<double>(
+      ::capnp::bounded<3>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Quat::Builder::setW(double value) {
+  _builder.setDataField<double>(
+      ::capnp::bounded<3>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Transform::Reader::hasRotation() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Transform::Builder::hasRotation() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Quat::Reader UnrealCore::Transform::Reader::getRotation() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Quat::Builder UnrealCore::Transform::Builder::getRotation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Quat::Pipeline UnrealCore::Transform::Pipeline::getRotation() {
+  return  ::UnrealCore::Quat::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::Transform::Builder::setRotation( ::UnrealCore::Quat::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Quat::Builder UnrealCore::Transform::Builder::initRotation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Transform::Builder::adoptRotation(
+    ::capnp::Orphan< ::UnrealCore::Quat>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Quat> UnrealCore::Transform::Builder::disownRotation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Transform::Reader::hasTranslation() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Transform::Builder::hasTranslation() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Vector::Reader UnrealCore::Transform::Reader::getTranslation() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Transform::Builder::getTranslation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Vector::Pipeline UnrealCore::Transform::Pipeline::getTranslation() {
+  return  ::UnrealCore::Vector::Pipeline(_typeless.getPointerField(1));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::Transform::Builder::setTranslation( ::UnrealCore::Vector::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Transform::Builder::initTranslation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Transform::Builder::adoptTranslation(
+    ::capnp::Orphan< ::UnrealCore::Vector>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Vector> UnrealCore::Transform::Builder::disownTranslation() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Transform::Reader::hasScale3D() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Transform::Builder::hasScale3D() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Vector::Reader UnrealCore::Transform::Reader::getScale3D() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Transform::Builder::getScale3D() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Vector::Pipeline UnrealCore::Transform::Pipeline::getScale3D() {
+  return  ::UnrealCore::Vector::Pipeline(_typeless.getPointerField(2));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::Transform::Builder::setScale3D( ::UnrealCore::Vector::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Transform::Builder::initScale3D() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Transform::Builder::adoptScale3D(
+    ::capnp::Orphan< ::UnrealCore::Vector>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Vector> UnrealCore::Transform::Builder::disownScale3D() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline  ::UnrealCore::Argument::Which UnrealCore::Argument::Reader::which() const {
+  return _reader.getDataField<Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline  ::UnrealCore::Argument::Which UnrealCore::Argument::Builder::which() {
+  return _builder.getDataField<Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline bool UnrealCore::Argument::Reader::hasUeClass() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasUeClass() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Class::Reader UnrealCore::Argument::Reader::getUeClass() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::Argument::Builder::getUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Class::Pipeline UnrealCore::Argument::Pipeline::getUeClass() {
+  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::Argument::Builder::setUeClass( ::UnrealCore::Class::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::Argument::Builder::initUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptUeClass(
+    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::Argument::Builder::disownUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::hasName() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasName() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader UnrealCore::Argument::Reader::getName() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::getName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setName( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::initName(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptName(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Argument::Builder::disownName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isBoolValue() const {
+  return which() == UnrealCore::Argument::BOOL_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isBoolValue() {
+  return which() == UnrealCore::Argument::BOOL_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::getBoolValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::BOOL_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _reader.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline bool UnrealCore::Argument::Builder::getBoolValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::BOOL_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _builder.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Argument::Builder::setBoolValue(bool value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::BOOL_VALUE);
+  _builder.setDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Argument::Reader::isUintValue() const {
+  return which() == UnrealCore::Argument::UINT_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isUintValue() {
+  return which() == UnrealCore::Argument::UINT_VALUE;
+}
+inline  ::uint64_t UnrealCore::Argument::Reader::getUintValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::UINT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t UnrealCore::Argument::Builder::getUintValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::UINT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Argument::Builder::setUintValue( ::uint64_t value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::UINT_VALUE);
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Argument::Reader::isIntValue() const {
+  return which() == UnrealCore::Argument::INT_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isIntValue() {
+  return which() == UnrealCore::Argument::INT_VALUE;
+}
+inline  ::int64_t UnrealCore::Argument::Reader::getIntValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _reader.getDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::int64_t UnrealCore::Argument::Builder::getIntValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _builder.getDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Argument::Builder::setIntValue( ::int64_t value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT_VALUE);
+  _builder.setDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Argument::Reader::isStrValue() const {
+  return which() == UnrealCore::Argument::STR_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isStrValue() {
+  return which() == UnrealCore::Argument::STR_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasStrValue() const {
+  if (which() != UnrealCore::Argument::STR_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasStrValue() {
+  if (which() != UnrealCore::Argument::STR_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader UnrealCore::Argument::Reader::getStrValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::getStrValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setStrValue( ::capnp::Text::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::initStrValue(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptStrValue(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Argument::Builder::disownStrValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isFloatValue() const {
+  return which() == UnrealCore::Argument::FLOAT_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isFloatValue() {
+  return which() == UnrealCore::Argument::FLOAT_VALUE;
+}
+inline double UnrealCore::Argument::Reader::getFloatValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _reader.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline double UnrealCore::Argument::Builder::getFloatValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _builder.getDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Argument::Builder::setFloatValue(double value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT_VALUE);
+  _builder.setDataField<double>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Argument::Reader::isObject() const {
+  return which() == UnrealCore::Argument::OBJECT;
+}
+inline bool UnrealCore::Argument::Builder::isObject() {
+  return which() == UnrealCore::Argument::OBJECT;
+}
+inline bool UnrealCore::Argument::Reader::hasObject() const {
+  if (which() != UnrealCore::Argument::OBJECT) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasObject() {
+  if (which() != UnrealCore::Argument::OBJECT) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Object::Reader UnrealCore::Argument::Reader::getObject() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::Argument::Builder::getObject() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setObject( ::UnrealCore::Object::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::Argument::Builder::initObject() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptObject(
+    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::Argument::Builder::disownObject() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isEnumValue() const {
+  return which() == UnrealCore::Argument::ENUM_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isEnumValue() {
+  return which() == UnrealCore::Argument::ENUM_VALUE;
+}
+inline  ::int64_t UnrealCore::Argument::Reader::getEnumValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::ENUM_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _reader.getDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::int64_t UnrealCore::Argument::Builder::getEnumValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::ENUM_VALUE),
+              "Must check which() before get()ing a union member.");
+  return _builder.getDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::Argument::Builder::setEnumValue( ::int64_t value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::ENUM_VALUE);
+  _builder.setDataField< ::int64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::Argument::Reader::isFloat32List() const {
+  return which() == UnrealCore::Argument::FLOAT32_LIST;
+}
+inline bool UnrealCore::Argument::Builder::isFloat32List() {
+  return which() == UnrealCore::Argument::FLOAT32_LIST;
+}
+inline bool UnrealCore::Argument::Reader::hasFloat32List() const {
+  if (which() != UnrealCore::Argument::FLOAT32_LIST) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasFloat32List() {
+  if (which() != UnrealCore::Argument::FLOAT32_LIST) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::Argument::Reader::getFloat32List() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::getFloat32List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setFloat32List( ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::Argument::Builder::setFloat32List(::kj::ArrayPtr<const float> value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::initFloat32List(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT32_LIST);
+  return ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptFloat32List(
+    ::capnp::Orphan< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>> UnrealCore::Argument::Builder::disownFloat32List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<float,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isFloat64List() const {
+  return which() == UnrealCore::Argument::FLOAT64_LIST;
+}
+inline bool UnrealCore::Argument::Builder::isFloat64List() {
+  return which() == UnrealCore::Argument::FLOAT64_LIST;
+}
+inline bool UnrealCore::Argument::Reader::hasFloat64List() const {
+  if (which() != UnrealCore::Argument::FLOAT64_LIST) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasFloat64List() {
+  if (which() != UnrealCore::Argument::FLOAT64_LIST) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::Argument::Reader::getFloat64List() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::getFloat64List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setFloat64List( ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::Argument::Builder::setFloat64List(::kj::ArrayPtr<const double> value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::initFloat64List(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT64_LIST);
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptFloat64List(
+    ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>> UnrealCore::Argument::Builder::disownFloat64List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isInt32List() const {
+  return which() == UnrealCore::Argument::INT32_LIST;
+}
+inline bool UnrealCore::Argument::Builder::isInt32List() {
+  return which() == UnrealCore::Argument::INT32_LIST;
+}
+inline bool UnrealCore::Argument::Reader::hasInt32List() const {
+  if (which() != UnrealCore::Argument::INT32_LIST) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasInt32List() {
+  if (which() != UnrealCore::Argument::INT32_LIST) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::Argument::Reader::getInt32List() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::getInt32List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setInt32List( ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::Argument::Builder::setInt32List(::kj::ArrayPtr<const  ::int32_t> value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::initInt32List(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT32_LIST);
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptInt32List(
+    ::capnp::Orphan< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT32_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>> UnrealCore::Argument::Builder::disownInt32List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT32_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int32_t,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isInt64List() const {
+  return which() == UnrealCore::Argument::INT64_LIST;
+}
+inline bool UnrealCore::Argument::Builder::isInt64List() {
+  return which() == UnrealCore::Argument::INT64_LIST;
+}
+inline bool UnrealCore::Argument::Reader::hasInt64List() const {
+  if (which() != UnrealCore::Argument::INT64_LIST) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasInt64List() {
+  if (which() != UnrealCore::Argument::INT64_LIST) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::Argument::Reader::getInt64List() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::getInt64List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setInt64List( ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::Argument::Builder::setInt64List(::kj::ArrayPtr<const  ::int64_t> value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::Argument::Builder::initInt64List(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT64_LIST);
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptInt64List(
+    ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT64_LIST);
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>> UnrealCore::Argument::Builder::disownInt64List() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::INT64_LIST),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isDataValue() const {
+  return which() == UnrealCore::Argument::DATA_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isDataValue() {
+  return which() == UnrealCore::Argument::DATA_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasDataValue() const {
+  if (which() != UnrealCore::Argument::DATA_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasDataValue() {
+  if (which() != UnrealCore::Argument::DATA_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Data::Reader UnrealCore::Argument::Reader::getDataValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::DATA_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Data::Builder UnrealCore::Argument::Builder::getDataValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::DATA_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setDataValue( ::capnp::Data::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::DATA_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Data>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Data::Builder UnrealCore::Argument::Builder::initDataValue(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::DATA_VALUE);
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptDataValue(
+    ::capnp::Orphan< ::capnp::Data>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::DATA_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Data>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Data> UnrealCore::Argument::Builder::disownDataValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::DATA_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-#endif  // !CAPNP_LITE
-inline bool UnrealCore::Object::Reader::hasName() const {
+inline bool UnrealCore::Argument::Reader::isVector2DValue() const {
+  return which() == UnrealCore::Argument::VECTOR2_D_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isVector2DValue() {
+  return which() == UnrealCore::Argument::VECTOR2_D_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasVector2DValue() const {
+  if (which() != UnrealCore::Argument::VECTOR2_D_VALUE) return false;
   return !_reader.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Object::Builder::hasName() {
+inline bool UnrealCore::Argument::Builder::hasVector2DValue() {
+  if (which() != UnrealCore::Argument::VECTOR2_D_VALUE) return false;
   return !_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline  ::capnp::Text::Reader UnrealCore::Object::Reader::getName() const {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS));
+inline  ::UnrealCore::Vector2D::Reader UnrealCore::Argument::Reader::getVector2DValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR2_D_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline  ::capnp::Text::Builder UnrealCore::Object::Builder::getName() {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS));
+inline  ::UnrealCore::Vector2D::Builder UnrealCore::Argument::Builder::getVector2DValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR2_D_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Object::Builder::setName( ::capnp::Text::Reader value) {
-  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+inline void UnrealCore::Argument::Builder::setVector2DValue( ::UnrealCore::Vector2D::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR2_D_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
 }
-inline  ::capnp::Text::Builder UnrealCore::Object::Builder::initName(unsigned int size) {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+inline  ::UnrealCore::Vector2D::Builder UnrealCore::Argument::Builder::initVector2DValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR2_D_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Object::Builder::adoptName(
-    ::capnp::Orphan< ::capnp::Text>&& value) {
-  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+inline void UnrealCore::Argument::Builder::adoptVector2DValue(
+    ::capnp::Orphan< ::UnrealCore::Vector2D>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR2_D_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Object::Builder::disownName() {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS));
+inline ::capnp::Orphan< ::UnrealCore::Vector2D> UnrealCore::Argument::Builder::disownVector2DValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR2_D_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector2D>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline  ::uint64_t UnrealCore::Object::Reader::getAddress() const {
-  return _reader.getDataField< ::uint64_t>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::Argument::Reader::isVectorValue() const {
+  return which() == UnrealCore::Argument::VECTOR_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isVectorValue() {
+  return which() == UnrealCore::Argument::VECTOR_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasVectorValue() const {
+  if (which() != UnrealCore::Argument::VECTOR_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasVectorValue() {
+  if (which() != UnrealCore::Argument::VECTOR_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Vector::Reader UnrealCore::Argument::Reader::getVectorValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Argument::Builder::getVectorValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setVectorValue( ::UnrealCore::Vector::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Vector::Builder UnrealCore::Argument::Builder::initVectorValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptVectorValue(
+    ::capnp::Orphan< ::UnrealCore::Vector>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::VECTOR_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Vector> UnrealCore::Argument::Builder::disownVectorValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::VECTOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Vector>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline  ::uint64_t UnrealCore::Object::Builder::getAddress() {
-  return _builder.getDataField< ::uint64_t>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::Argument::Reader::isRotatorValue() const {
+  return which() == UnrealCore::Argument::ROTATOR_VALUE;
 }
-inline void UnrealCore::Object::Builder::setAddress( ::uint64_t value) {
-  _builder.setDataField< ::uint64_t>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+inline bool UnrealCore::Argument::Builder::isRotatorValue() {
+  return which() == UnrealCore::Argument::ROTATOR_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasRotatorValue() const {
+  if (which() != UnrealCore::Argument::ROTATOR_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasRotatorValue() {
+  if (which() != UnrealCore::Argument::ROTATOR_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Rotator::Reader UnrealCore::Argument::Reader::getRotatorValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::ROTATOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Rotator::Builder UnrealCore::Argument::Builder::getRotatorValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::ROTATOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setRotatorValue( ::UnrealCore::Rotator::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::ROTATOR_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Rotator::Builder UnrealCore::Argument::Builder::initRotatorValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::ROTATOR_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptRotatorValue(
+    ::capnp::Orphan< ::UnrealCore::Rotator>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::ROTATOR_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Rotator> UnrealCore::Argument::Builder::disownRotatorValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::ROTATOR_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Rotator>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::Class::Reader::hasTypeName() const {
+inline bool UnrealCore::Argument::Reader::isQuatValue() const {
+  return which() == UnrealCore::Argument::QUAT_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isQuatValue() {
+  return which() == UnrealCore::Argument::QUAT_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasQuatValue() const {
+  if (which() != UnrealCore::Argument::QUAT_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasQuatValue() {
+  if (which() != UnrealCore::Argument::QUAT_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Quat::Reader UnrealCore::Argument::Reader::getQuatValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::QUAT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Quat::Builder UnrealCore::Argument::Builder::getQuatValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::QUAT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setQuatValue( ::UnrealCore::Quat::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::QUAT_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Quat::Builder UnrealCore::Argument::Builder::initQuatValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::QUAT_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptQuatValue(
+    ::capnp::Orphan< ::UnrealCore::Quat>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::QUAT_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Quat> UnrealCore::Argument::Builder::disownQuatValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::QUAT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Quat>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isTransformValue() const {
+  return which() == UnrealCore::Argument::TRANSFORM_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isTransformValue() {
+  return which() == UnrealCore::Argument::TRANSFORM_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasTransformValue() const {
+  if (which() != UnrealCore::Argument::TRANSFORM_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasTransformValue() {
+  if (which() != UnrealCore::Argument::TRANSFORM_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Transform::Reader UnrealCore::Argument::Reader::getTransformValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::TRANSFORM_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Transform::Builder UnrealCore::Argument::Builder::getTransformValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::TRANSFORM_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setTransformValue( ::UnrealCore::Transform::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::TRANSFORM_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Transform::Builder UnrealCore::Argument::Builder::initTransformValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::TRANSFORM_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptTransformValue(
+    ::capnp::Orphan< ::UnrealCore::Transform>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::TRANSFORM_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Transform> UnrealCore::Argument::Builder::disownTransformValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::TRANSFORM_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Transform>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isStrUtf16Value() const {
+  return which() == UnrealCore::Argument::STR_UTF16_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isStrUtf16Value() {
+  return which() == UnrealCore::Argument::STR_UTF16_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasStrUtf16Value() const {
+  if (which() != UnrealCore::Argument::STR_UTF16_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasStrUtf16Value() {
+  if (which() != UnrealCore::Argument::STR_UTF16_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Data::Reader UnrealCore::Argument::Reader::getStrUtf16Value() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_UTF16_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Data::Builder UnrealCore::Argument::Builder::getStrUtf16Value() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_UTF16_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setStrUtf16Value( ::capnp::Data::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_UTF16_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Data>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Data::Builder UnrealCore::Argument::Builder::initStrUtf16Value(unsigned int size) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_UTF16_VALUE);
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::Argument::Builder::adoptStrUtf16Value(
+    ::capnp::Orphan< ::capnp::Data>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_UTF16_VALUE);
+  ::capnp::_::PointerHelpers< ::capnp::Data>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Data> UnrealCore::Argument::Builder::disownStrUtf16Value() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_UTF16_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::Argument::Reader::isStructValue() const {
+  return which() == UnrealCore::Argument::STRUCT_VALUE;
+}
+inline bool UnrealCore::Argument::Builder::isStructValue() {
+  return which() == UnrealCore::Argument::STRUCT_VALUE;
+}
+inline bool UnrealCore::Argument::Reader::hasStructValue() const {
+  if (which() != UnrealCore::Argument::STRUCT_VALUE) return false;
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::Argument::Builder::hasStructValue() {
+  if (which() != UnrealCore::Argument::STRUCT_VALUE) return false;
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::StructValue::Reader UnrealCore::Argument::Reader::getStructValue() const {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STRUCT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::StructValue::Builder UnrealCore::Argument::Builder::getStructValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STRUCT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::setStructValue( ::UnrealCore::StructValue::Reader value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STRUCT_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::StructValue::Builder UnrealCore::Argument::Builder::initStructValue() {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STRUCT_VALUE);
+  return ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::Argument::Builder::adoptStructValue(
+    ::capnp::Orphan< ::UnrealCore::StructValue>&& value) {
+  _builder.setDataField<UnrealCore::Argument::Which>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STRUCT_VALUE);
+  ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::StructValue> UnrealCore::Argument::Builder::disownStructValue() {
+  KJ_IREQUIRE((which() == UnrealCore::Argument::STRUCT_VALUE),
+              "Must check which() before get()ing a union member.");
+  return ::capnp::_::PointerHelpers< ::UnrealCore::StructValue>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::StructValue::Reader::hasTypeName() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Class::Builder::hasTypeName() {
+inline bool UnrealCore::StructValue::Builder::hasTypeName() {
   return !_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline  ::capnp::Text::Reader UnrealCore::Class::Reader::getTypeName() const {
+inline  ::capnp::Text::Reader UnrealCore::StructValue::Reader::getTypeName() const {
   return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline  ::capnp::Text::Builder UnrealCore::Class::Builder::getTypeName() {
+inline  ::capnp::Text::Builder UnrealCore::StructValue::Builder::getTypeName() {
   return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Class::Builder::setTypeName( ::capnp::Text::Reader value) {
+inline void UnrealCore::StructValue::Builder::setTypeName( ::capnp::Text::Reader value) {
   ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-inline  ::capnp::Text::Builder UnrealCore::Class::Builder::initTypeName(unsigned int size) {
+inline  ::capnp::Text::Builder UnrealCore::StructValue::Builder::initTypeName(unsigned int size) {
   return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), size);
 }
-inline void UnrealCore::Class::Builder::adoptTypeName(
+inline void UnrealCore::StructValue::Builder::adoptTypeName(
     ::capnp::Orphan< ::capnp::Text>&& value) {
   ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Class::Builder::disownTypeName() {
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::StructValue::Builder::disownTypeName() {
   return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline  ::UnrealCore::Argument::Which UnrealCore::Argument::Reader::which() const {
-  return _reader.getDataField<Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::StructValue::Reader::hasFields() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Argument::Which UnrealCore::Argument::Builder::which() {
-  return _builder.getDataField<Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::StructValue::Builder::hasFields() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader UnrealCore::StructValue::Reader::getFields() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder UnrealCore::StructValue::Builder::getFields() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::StructValue::Builder::setFields( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder UnrealCore::StructValue::Builder::initFields(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::StructValue::Builder::adoptFields(
+    ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> UnrealCore::StructValue::Builder::disownFields() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::Argument::Reader::hasUeClass() const {
+inline bool UnrealCore::PackedParams::Reader::hasTags() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Argument::Builder::hasUeClass() {
+inline bool UnrealCore::PackedParams::Builder::hasTags() {
   return !_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Class::Reader UnrealCore::Argument::Reader::getUeClass() const {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Reader UnrealCore::PackedParams::Reader::getTags() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::get(_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::Argument::Builder::getUeClass() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Builder UnrealCore::PackedParams::Builder::getTags() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::get(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-#if !CAPNP_LITE
-inline  ::UnrealCore::Class::Pipeline UnrealCore::Argument::Pipeline::getUeClass() {
-  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(0));
+inline void UnrealCore::PackedParams::Builder::setTags( ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-#endif  // !CAPNP_LITE
-inline void UnrealCore::Argument::Builder::setUeClass( ::UnrealCore::Class::Reader value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+inline void UnrealCore::PackedParams::Builder::setTags(::kj::ArrayPtr<const  ::UnrealCore::PackedTag> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::set(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::Argument::Builder::initUeClass() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
-      ::capnp::bounded<0>() * ::capnp::POINTERS));
+inline  ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>::Builder UnrealCore::PackedParams::Builder::initTags(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
 }
-inline void UnrealCore::Argument::Builder::adoptUeClass(
-    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+inline void UnrealCore::PackedParams::Builder::adoptTags(
+    ::capnp::Orphan< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::adopt(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::Argument::Builder::disownUeClass() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>> UnrealCore::PackedParams::Builder::disownTags() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::PackedTag,  ::capnp::Kind::ENUM>>::disown(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::Argument::Reader::hasName() const {
+inline bool UnrealCore::PackedParams::Reader::hasNames() const {
   return !_reader.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Argument::Builder::hasName() {
+inline bool UnrealCore::PackedParams::Builder::hasNames() {
   return !_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline  ::capnp::Text::Reader UnrealCore::Argument::Reader::getName() const {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader UnrealCore::PackedParams::Reader::getNames() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_reader.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
-inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::getName() {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::getNames() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Argument::Builder::setName( ::capnp::Text::Reader value) {
-  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+inline void UnrealCore::PackedParams::Builder::setNames( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS), value);
 }
-inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::initName(unsigned int size) {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+inline void UnrealCore::PackedParams::Builder::setNames(::kj::ArrayPtr<const  ::capnp::Text::Reader> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::initNames(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::init(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS), size);
 }
-inline void UnrealCore::Argument::Builder::adoptName(
-    ::capnp::Orphan< ::capnp::Text>&& value) {
-  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+inline void UnrealCore::PackedParams::Builder::adoptNames(
+    ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::adopt(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Argument::Builder::disownName() {
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> UnrealCore::PackedParams::Builder::disownNames() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::disown(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::Argument::Reader::isBoolValue() const {
-  return which() == UnrealCore::Argument::BOOL_VALUE;
+inline bool UnrealCore::PackedParams::Reader::hasClasses() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Argument::Builder::isBoolValue() {
-  return which() == UnrealCore::Argument::BOOL_VALUE;
+inline bool UnrealCore::PackedParams::Builder::hasClasses() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Argument::Reader::getBoolValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::BOOL_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _reader.getDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader UnrealCore::PackedParams::Reader::getClasses() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-
-inline bool UnrealCore::Argument::Builder::getBoolValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::BOOL_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _builder.getDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::getClasses() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Argument::Builder::setBoolValue(bool value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::BOOL_VALUE);
-  _builder.setDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+inline void UnrealCore::PackedParams::Builder::setClasses( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
 }
-
-inline bool UnrealCore::Argument::Reader::isUintValue() const {
-  return which() == UnrealCore::Argument::UINT_VALUE;
+inline void UnrealCore::PackedParams::Builder::setClasses(::kj::ArrayPtr<const  ::capnp::Text::Reader> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
 }
-inline bool UnrealCore::Argument::Builder::isUintValue() {
-  return which() == UnrealCore::Argument::UINT_VALUE;
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::initClasses(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
 }
-inline  ::uint64_t UnrealCore::Argument::Reader::getUintValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::UINT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _reader.getDataField< ::uint64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline void UnrealCore::PackedParams::Builder::adoptClasses(
+    ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> UnrealCore::PackedParams::Builder::disownClasses() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline  ::uint64_t UnrealCore::Argument::Builder::getUintValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::UINT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _builder.getDataField< ::uint64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::PackedParams::Reader::hasInts() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
 }
-inline void UnrealCore::Argument::Builder::setUintValue( ::uint64_t value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::UINT_VALUE);
-  _builder.setDataField< ::uint64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+inline bool UnrealCore::PackedParams::Builder::hasInts() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
 }
-
-inline bool UnrealCore::Argument::Reader::isIntValue() const {
-  return which() == UnrealCore::Argument::INT_VALUE;
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::PackedParams::Reader::getInts() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
-inline bool UnrealCore::Argument::Builder::isIntValue() {
-  return which() == UnrealCore::Argument::INT_VALUE;
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::getInts() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
-inline  ::int64_t UnrealCore::Argument::Reader::getIntValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::INT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _reader.getDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline void UnrealCore::PackedParams::Builder::setInts( ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), value);
 }
-
-inline  ::int64_t UnrealCore::Argument::Builder::getIntValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::INT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _builder.getDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline void UnrealCore::PackedParams::Builder::setInts(::kj::ArrayPtr<const  ::int64_t> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), value);
 }
-inline void UnrealCore::Argument::Builder::setIntValue( ::int64_t value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::INT_VALUE);
-  _builder.setDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+inline  ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::initInts(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), size);
 }
-
-inline bool UnrealCore::Argument::Reader::isStrValue() const {
-  return which() == UnrealCore::Argument::STR_VALUE;
+inline void UnrealCore::PackedParams::Builder::adoptInts(
+    ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline bool UnrealCore::Argument::Builder::isStrValue() {
-  return which() == UnrealCore::Argument::STR_VALUE;
+inline ::capnp::Orphan< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>> UnrealCore::PackedParams::Builder::disownInts() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::int64_t,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
-inline bool UnrealCore::Argument::Reader::hasStrValue() const {
-  if (which() != UnrealCore::Argument::STR_VALUE) return false;
+
+inline bool UnrealCore::PackedParams::Reader::hasFloats() const {
   return !_reader.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+      ::capnp::bounded<4>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::Argument::Builder::hasStrValue() {
-  if (which() != UnrealCore::Argument::STR_VALUE) return false;
+inline bool UnrealCore::PackedParams::Builder::hasFloats() {
   return !_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
-}
-inline  ::capnp::Text::Reader UnrealCore::Argument::Reader::getStrValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
-}
-inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::getStrValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+      ::capnp::bounded<4>() * ::capnp::POINTERS).isNull();
 }
-inline void UnrealCore::Argument::Builder::setStrValue( ::capnp::Text::Reader value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
-  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::PackedParams::Reader::getFloats() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
 }
-inline  ::capnp::Text::Builder UnrealCore::Argument::Builder::initStrValue(unsigned int size) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::getFloats() {
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::Argument::Builder::adoptStrValue(
-    ::capnp::Orphan< ::capnp::Text>&& value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::STR_VALUE);
-  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+inline void UnrealCore::PackedParams::Builder::setFloats( ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), value);
 }
-inline ::capnp::Orphan< ::capnp::Text> UnrealCore::Argument::Builder::disownStrValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::STR_VALUE),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+inline void UnrealCore::PackedParams::Builder::setFloats(::kj::ArrayPtr<const double> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), value);
 }
-
-inline bool UnrealCore::Argument::Reader::isFloatValue() const {
-  return which() == UnrealCore::Argument::FLOAT_VALUE;
+inline  ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::initFloats(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), size);
 }
-inline bool UnrealCore::Argument::Builder::isFloatValue() {
-  return which() == UnrealCore::Argument::FLOAT_VALUE;
+inline void UnrealCore::PackedParams::Builder::adoptFloats(
+    ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline double UnrealCore::Argument::Reader::getFloatValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _reader.getDataField<double>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline ::capnp::Orphan< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>> UnrealCore::PackedParams::Builder::disownFloats() {
+  return ::capnp::_::PointerHelpers< ::capnp::List<double,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
 }
 
-inline double UnrealCore::Argument::Builder::getFloatValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::FLOAT_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _builder.getDataField<double>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::PackedParams::Reader::hasStrs() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS).isNull();
 }
-inline void UnrealCore::Argument::Builder::setFloatValue(double value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::FLOAT_VALUE);
-  _builder.setDataField<double>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+inline bool UnrealCore::PackedParams::Builder::hasStrs() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS).isNull();
 }
-
-inline bool UnrealCore::Argument::Reader::isObject() const {
-  return which() == UnrealCore::Argument::OBJECT;
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader UnrealCore::PackedParams::Reader::getStrs() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_reader.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS));
 }
-inline bool UnrealCore::Argument::Builder::isObject() {
-  return which() == UnrealCore::Argument::OBJECT;
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::getStrs() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS));
 }
-inline bool UnrealCore::Argument::Reader::hasObject() const {
-  if (which() != UnrealCore::Argument::OBJECT) return false;
-  return !_reader.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+inline void UnrealCore::PackedParams::Builder::setStrs( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS), value);
 }
-inline bool UnrealCore::Argument::Builder::hasObject() {
-  if (which() != UnrealCore::Argument::OBJECT) return false;
-  return !_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+inline void UnrealCore::PackedParams::Builder::setStrs(::kj::ArrayPtr<const  ::capnp::Text::Reader> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Object::Reader UnrealCore::Argument::Reader::getObject() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::PackedParams::Builder::initStrs(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::init(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS), size);
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::Argument::Builder::getObject() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+inline void UnrealCore::PackedParams::Builder::adoptStrs(
+    ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline void UnrealCore::Argument::Builder::setObject( ::UnrealCore::Object::Reader value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> UnrealCore::PackedParams::Builder::disownStrs() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::disown(_builder.getPointerField(
+      ::capnp::bounded<5>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::Argument::Builder::initObject() {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+
+inline bool UnrealCore::PackedParams::Reader::hasObjects() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS).isNull();
 }
-inline void UnrealCore::Argument::Builder::adoptObject(
-    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::OBJECT);
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+inline bool UnrealCore::PackedParams::Builder::hasObjects() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS).isNull();
 }
-inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::Argument::Builder::disownObject() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::OBJECT),
-              "Must check which() before get()ing a union member.");
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
-      ::capnp::bounded<2>() * ::capnp::POINTERS));
+inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Reader UnrealCore::PackedParams::Reader::getObjects() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::get(_reader.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS));
 }
-
-inline bool UnrealCore::Argument::Reader::isEnumValue() const {
-  return which() == UnrealCore::Argument::ENUM_VALUE;
+inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::getObjects() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::get(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS));
 }
-inline bool UnrealCore::Argument::Builder::isEnumValue() {
-  return which() == UnrealCore::Argument::ENUM_VALUE;
+inline void UnrealCore::PackedParams::Builder::setObjects( ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS), value);
 }
-inline  ::int64_t UnrealCore::Argument::Reader::getEnumValue() const {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::ENUM_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _reader.getDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline void UnrealCore::PackedParams::Builder::setObjects(::kj::ArrayPtr<const  ::uint64_t> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::set(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>::Builder UnrealCore::PackedParams::Builder::initObjects(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::init(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS), size);
 }
-
-inline  ::int64_t UnrealCore::Argument::Builder::getEnumValue() {
-  KJ_IREQUIRE((which() == UnrealCore::Argument::ENUM_VALUE),
-              "Must check which() before get()ing a union member.");
-  return _builder.getDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+inline void UnrealCore::PackedParams::Builder::adoptObjects(
+    ::capnp::Orphan< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline void UnrealCore::Argument::Builder::setEnumValue( ::int64_t value) {
-  _builder.setDataField<UnrealCore::Argument::Which>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, UnrealCore::Argument::ENUM_VALUE);
-  _builder.setDataField< ::int64_t>(
-      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+inline ::capnp::Orphan< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>> UnrealCore::PackedParams::Builder::disownObjects() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::uint64_t,  ::capnp::Kind::PRIMITIVE>>::disown(_builder.getPointerField(
+      ::capnp::bounded<6>() * ::capnp::POINTERS));
 }
 
 inline bool UnrealCore::Method::Reader::hasName() const {
@@ -7404,252 +10525,678 @@ inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::RegisterCreatedPyObject
       ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::NewContainerParams::Reader::hasOwn() const {
+inline bool UnrealCore::NewContainerParams::Reader::hasOwn() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::NewContainerParams::Builder::hasOwn() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Object::Reader UnrealCore::NewContainerParams::Reader::getOwn() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerParams::Builder::getOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Object::Pipeline UnrealCore::NewContainerParams::Pipeline::getOwn() {
+  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::NewContainerParams::Builder::setOwn( ::UnrealCore::Object::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerParams::Builder::initOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::NewContainerParams::Builder::adoptOwn(
+    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::NewContainerParams::Builder::disownOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::NewContainerParams::Reader::hasContainerType() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::NewContainerParams::Builder::hasContainerType() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getContainerType() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getContainerType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getContainerType() {
+  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(1));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::NewContainerParams::Builder::setContainerType( ::UnrealCore::Class::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initContainerType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::NewContainerParams::Builder::adoptContainerType(
+    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownContainerType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::NewContainerParams::Reader::hasValueType() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::NewContainerParams::Builder::hasValueType() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getValueType() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getValueType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getValueType() {
+  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(2));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::NewContainerParams::Builder::setValueType( ::UnrealCore::Class::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initValueType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::NewContainerParams::Builder::adoptValueType(
+    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownValueType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::NewContainerParams::Reader::hasKeyType() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::NewContainerParams::Builder::hasKeyType() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getKeyType() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getKeyType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getKeyType() {
+  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(3));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::NewContainerParams::Builder::setKeyType( ::UnrealCore::Class::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initKeyType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::NewContainerParams::Builder::adoptKeyType(
+    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownKeyType() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::NewContainerResults::Reader::hasContainer() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::NewContainerResults::Builder::hasContainer() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Object::Reader UnrealCore::NewContainerResults::Reader::getContainer() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerResults::Builder::getContainer() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Object::Pipeline UnrealCore::NewContainerResults::Pipeline::getContainer() {
+  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::NewContainerResults::Builder::setContainer( ::UnrealCore::Object::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerResults::Builder::initContainer() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::NewContainerResults::Builder::adoptContainer(
+    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::NewContainerResults::Builder::disownContainer() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::DestroyContainerParams::Reader::hasOwn() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::DestroyContainerParams::Builder::hasOwn() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Object::Reader UnrealCore::DestroyContainerParams::Reader::getOwn() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::DestroyContainerParams::Builder::getOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::Object::Pipeline UnrealCore::DestroyContainerParams::Pipeline::getOwn() {
+  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::DestroyContainerParams::Builder::setOwn( ::UnrealCore::Object::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::Object::Builder UnrealCore::DestroyContainerParams::Builder::initOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::DestroyContainerParams::Builder::adoptOwn(
+    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::DestroyContainerParams::Builder::disownOwn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::DestroyContainerResults::Reader::getResult() const {
+  return _reader.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline bool UnrealCore::DestroyContainerResults::Builder::getResult() {
+  return _builder.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::DestroyContainerResults::Builder::setResult(bool value) {
+  _builder.setDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::CallFunctionPackedParams::Reader::hasOwn() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::NewContainerParams::Builder::hasOwn() {
+inline bool UnrealCore::CallFunctionPackedParams::Builder::hasOwn() {
   return !_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Object::Reader UnrealCore::NewContainerParams::Reader::getOwn() const {
+inline  ::UnrealCore::Object::Reader UnrealCore::CallFunctionPackedParams::Reader::getOwn() const {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerParams::Builder::getOwn() {
+inline  ::UnrealCore::Object::Builder UnrealCore::CallFunctionPackedParams::Builder::getOwn() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 #if !CAPNP_LITE
-inline  ::UnrealCore::Object::Pipeline UnrealCore::NewContainerParams::Pipeline::getOwn() {
+inline  ::UnrealCore::Object::Pipeline UnrealCore::CallFunctionPackedParams::Pipeline::getOwn() {
   return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
 }
 #endif  // !CAPNP_LITE
-inline void UnrealCore::NewContainerParams::Builder::setOwn( ::UnrealCore::Object::Reader value) {
+inline void UnrealCore::CallFunctionPackedParams::Builder::setOwn( ::UnrealCore::Object::Reader value) {
   ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerParams::Builder::initOwn() {
+inline  ::UnrealCore::Object::Builder UnrealCore::CallFunctionPackedParams::Builder::initOwn() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::NewContainerParams::Builder::adoptOwn(
+inline void UnrealCore::CallFunctionPackedParams::Builder::adoptOwn(
     ::capnp::Orphan< ::UnrealCore::Object>&& value) {
   ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::NewContainerParams::Builder::disownOwn() {
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::CallFunctionPackedParams::Builder::disownOwn() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::NewContainerParams::Reader::hasContainerType() const {
+inline bool UnrealCore::CallFunctionPackedParams::Reader::hasCallObject() const {
   return !_reader.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::NewContainerParams::Builder::hasContainerType() {
+inline bool UnrealCore::CallFunctionPackedParams::Builder::hasCallObject() {
   return !_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getContainerType() const {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+inline  ::UnrealCore::Object::Reader UnrealCore::CallFunctionPackedParams::Reader::getCallObject() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getContainerType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+inline  ::UnrealCore::Object::Builder UnrealCore::CallFunctionPackedParams::Builder::getCallObject() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 #if !CAPNP_LITE
-inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getContainerType() {
-  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(1));
+inline  ::UnrealCore::Object::Pipeline UnrealCore::CallFunctionPackedParams::Pipeline::getCallObject() {
+  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(1));
 }
 #endif  // !CAPNP_LITE
-inline void UnrealCore::NewContainerParams::Builder::setContainerType( ::UnrealCore::Class::Reader value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedParams::Builder::setCallObject( ::UnrealCore::Object::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initContainerType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
+inline  ::UnrealCore::Object::Builder UnrealCore::CallFunctionPackedParams::Builder::initCallObject() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::NewContainerParams::Builder::adoptContainerType(
-    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedParams::Builder::adoptCallObject(
+    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownContainerType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::CallFunctionPackedParams::Builder::disownCallObject() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::NewContainerParams::Reader::hasValueType() const {
+inline bool UnrealCore::CallFunctionPackedParams::Reader::hasUeClass() const {
   return !_reader.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::NewContainerParams::Builder::hasValueType() {
+inline bool UnrealCore::CallFunctionPackedParams::Builder::hasUeClass() {
   return !_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getValueType() const {
+inline  ::UnrealCore::Class::Reader UnrealCore::CallFunctionPackedParams::Reader::getUeClass() const {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getValueType() {
+inline  ::UnrealCore::Class::Builder UnrealCore::CallFunctionPackedParams::Builder::getUeClass() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 #if !CAPNP_LITE
-inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getValueType() {
+inline  ::UnrealCore::Class::Pipeline UnrealCore::CallFunctionPackedParams::Pipeline::getUeClass() {
   return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(2));
 }
 #endif  // !CAPNP_LITE
-inline void UnrealCore::NewContainerParams::Builder::setValueType( ::UnrealCore::Class::Reader value) {
+inline void UnrealCore::CallFunctionPackedParams::Builder::setUeClass( ::UnrealCore::Class::Reader value) {
   ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initValueType() {
+inline  ::UnrealCore::Class::Builder UnrealCore::CallFunctionPackedParams::Builder::initUeClass() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::NewContainerParams::Builder::adoptValueType(
+inline void UnrealCore::CallFunctionPackedParams::Builder::adoptUeClass(
     ::capnp::Orphan< ::UnrealCore::Class>&& value) {
   ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownValueType() {
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::CallFunctionPackedParams::Builder::disownUeClass() {
   return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
       ::capnp::bounded<2>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::NewContainerParams::Reader::hasKeyType() const {
+inline bool UnrealCore::CallFunctionPackedParams::Reader::hasFuncName() const {
   return !_reader.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::NewContainerParams::Builder::hasKeyType() {
+inline bool UnrealCore::CallFunctionPackedParams::Builder::hasFuncName() {
   return !_builder.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Class::Reader UnrealCore::NewContainerParams::Reader::getKeyType() const {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+inline  ::capnp::Text::Reader UnrealCore::CallFunctionPackedParams::Reader::getFuncName() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::getKeyType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
+inline  ::capnp::Text::Builder UnrealCore::CallFunctionPackedParams::Builder::getFuncName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
-#if !CAPNP_LITE
-inline  ::UnrealCore::Class::Pipeline UnrealCore::NewContainerParams::Pipeline::getKeyType() {
-  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(3));
-}
-#endif  // !CAPNP_LITE
-inline void UnrealCore::NewContainerParams::Builder::setKeyType( ::UnrealCore::Class::Reader value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedParams::Builder::setFuncName( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Class::Builder UnrealCore::NewContainerParams::Builder::initKeyType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
-      ::capnp::bounded<3>() * ::capnp::POINTERS));
+inline  ::capnp::Text::Builder UnrealCore::CallFunctionPackedParams::Builder::initFuncName(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<3>() * ::capnp::POINTERS), size);
 }
-inline void UnrealCore::NewContainerParams::Builder::adoptKeyType(
-    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedParams::Builder::adoptFuncName(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::NewContainerParams::Builder::disownKeyType() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::CallFunctionPackedParams::Builder::disownFuncName() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
       ::capnp::bounded<3>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::NewContainerResults::Reader::hasContainer() const {
+inline bool UnrealCore::CallFunctionPackedParams::Reader::hasParams() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::CallFunctionPackedParams::Builder::hasParams() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::PackedParams::Reader UnrealCore::CallFunctionPackedParams::Reader::getParams() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::get(_reader.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::PackedParams::Builder UnrealCore::CallFunctionPackedParams::Builder::getParams() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::get(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::UnrealCore::PackedParams::Pipeline UnrealCore::CallFunctionPackedParams::Pipeline::getParams() {
+  return  ::UnrealCore::PackedParams::Pipeline(_typeless.getPointerField(4));
+}
+#endif  // !CAPNP_LITE
+inline void UnrealCore::CallFunctionPackedParams::Builder::setParams( ::UnrealCore::PackedParams::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::set(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), value);
+}
+inline  ::UnrealCore::PackedParams::Builder UnrealCore::CallFunctionPackedParams::Builder::initParams() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::init(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::CallFunctionPackedParams::Builder::adoptParams(
+    ::capnp::Orphan< ::UnrealCore::PackedParams>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::adopt(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::UnrealCore::PackedParams> UnrealCore::CallFunctionPackedParams::Builder::disownParams() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::PackedParams>::disown(_builder.getPointerField(
+      ::capnp::bounded<4>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::CallFunctionPackedResults::Reader::hasReturn() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::NewContainerResults::Builder::hasContainer() {
+inline bool UnrealCore::CallFunctionPackedResults::Builder::hasReturn() {
   return !_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Object::Reader UnrealCore::NewContainerResults::Reader::getContainer() const {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+inline  ::UnrealCore::Argument::Reader UnrealCore::CallFunctionPackedResults::Reader::getReturn() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::get(_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerResults::Builder::getContainer() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+inline  ::UnrealCore::Argument::Builder UnrealCore::CallFunctionPackedResults::Builder::getReturn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::get(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 #if !CAPNP_LITE
-inline  ::UnrealCore::Object::Pipeline UnrealCore::NewContainerResults::Pipeline::getContainer() {
-  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
+inline  ::UnrealCore::Argument::Pipeline UnrealCore::CallFunctionPackedResults::Pipeline::getReturn() {
+  return  ::UnrealCore::Argument::Pipeline(_typeless.getPointerField(0));
 }
 #endif  // !CAPNP_LITE
-inline void UnrealCore::NewContainerResults::Builder::setContainer( ::UnrealCore::Object::Reader value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedResults::Builder::setReturn( ::UnrealCore::Argument::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::set(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::NewContainerResults::Builder::initContainer() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+inline  ::UnrealCore::Argument::Builder UnrealCore::CallFunctionPackedResults::Builder::initReturn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::init(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::NewContainerResults::Builder::adoptContainer(
-    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+inline void UnrealCore::CallFunctionPackedResults::Builder::adoptReturn(
+    ::capnp::Orphan< ::UnrealCore::Argument>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::adopt(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::NewContainerResults::Builder::disownContainer() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::UnrealCore::Argument> UnrealCore::CallFunctionPackedResults::Builder::disownReturn() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Argument>::disown(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::DestroyContainerParams::Reader::hasOwn() const {
+inline bool UnrealCore::CallFunctionPackedResults::Reader::hasOutParams() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::CallFunctionPackedResults::Builder::hasOutParams() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader UnrealCore::CallFunctionPackedResults::Reader::getOutParams() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder UnrealCore::CallFunctionPackedResults::Builder::getOutParams() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::CallFunctionPackedResults::Builder::setOutParams( ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>::Builder UnrealCore::CallFunctionPackedResults::Builder::initOutParams(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::CallFunctionPackedResults::Builder::adoptOutParams(
+    ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>> UnrealCore::CallFunctionPackedResults::Builder::disownOutParams() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::UnrealCore::Argument,  ::capnp::Kind::STRUCT>>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline  ::uint64_t UnrealCore::GetFeaturesResults::Reader::getFeatures() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t UnrealCore::GetFeaturesResults::Builder::getFeatures() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void UnrealCore::GetFeaturesResults::Builder::setFeatures( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool UnrealCore::DumpReflectionResults::Reader::hasDump() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline bool UnrealCore::DestroyContainerParams::Builder::hasOwn() {
+inline bool UnrealCore::DumpReflectionResults::Builder::hasDump() {
   return !_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
 }
-inline  ::UnrealCore::Object::Reader UnrealCore::DestroyContainerParams::Reader::getOwn() const {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_reader.getPointerField(
+inline  ::capnp::Text::Reader UnrealCore::DumpReflectionResults::Reader::getDump() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::DestroyContainerParams::Builder::getOwn() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::get(_builder.getPointerField(
+inline  ::capnp::Text::Builder UnrealCore::DumpReflectionResults::Builder::getDump() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::DumpReflectionResults::Builder::setDump( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder UnrealCore::DumpReflectionResults::Builder::initDump(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::DumpReflectionResults::Builder::adoptDump(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> UnrealCore::DumpReflectionResults::Builder::disownDump() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool UnrealCore::GetClassHierarchyParams::Reader::hasUeClass() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::GetClassHierarchyParams::Builder::hasUeClass() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::UnrealCore::Class::Reader UnrealCore::GetClassHierarchyParams::Reader::getUeClass() const {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::UnrealCore::Class::Builder UnrealCore::GetClassHierarchyParams::Builder::getUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::get(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 #if !CAPNP_LITE
-inline  ::UnrealCore::Object::Pipeline UnrealCore::DestroyContainerParams::Pipeline::getOwn() {
-  return  ::UnrealCore::Object::Pipeline(_typeless.getPointerField(0));
+inline  ::UnrealCore::Class::Pipeline UnrealCore::GetClassHierarchyParams::Pipeline::getUeClass() {
+  return  ::UnrealCore::Class::Pipeline(_typeless.getPointerField(0));
 }
 #endif  // !CAPNP_LITE
-inline void UnrealCore::DestroyContainerParams::Builder::setOwn( ::UnrealCore::Object::Reader value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::set(_builder.getPointerField(
+inline void UnrealCore::GetClassHierarchyParams::Builder::setUeClass( ::UnrealCore::Class::Reader value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::set(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), value);
 }
-inline  ::UnrealCore::Object::Builder UnrealCore::DestroyContainerParams::Builder::initOwn() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::init(_builder.getPointerField(
+inline  ::UnrealCore::Class::Builder UnrealCore::GetClassHierarchyParams::Builder::initUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::init(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
-inline void UnrealCore::DestroyContainerParams::Builder::adoptOwn(
-    ::capnp::Orphan< ::UnrealCore::Object>&& value) {
-  ::capnp::_::PointerHelpers< ::UnrealCore::Object>::adopt(_builder.getPointerField(
+inline void UnrealCore::GetClassHierarchyParams::Builder::adoptUeClass(
+    ::capnp::Orphan< ::UnrealCore::Class>&& value) {
+  ::capnp::_::PointerHelpers< ::UnrealCore::Class>::adopt(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
 }
-inline ::capnp::Orphan< ::UnrealCore::Object> UnrealCore::DestroyContainerParams::Builder::disownOwn() {
-  return ::capnp::_::PointerHelpers< ::UnrealCore::Object>::disown(_builder.getPointerField(
+inline ::capnp::Orphan< ::UnrealCore::Class> UnrealCore::GetClassHierarchyParams::Builder::disownUeClass() {
+  return ::capnp::_::PointerHelpers< ::UnrealCore::Class>::disown(_builder.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::DestroyContainerResults::Reader::getResult() const {
-  return _reader.getDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::GetClassHierarchyResults::Reader::hasParents() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool UnrealCore::GetClassHierarchyResults::Builder::hasParents() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader UnrealCore::GetClassHierarchyResults::Reader::getParents() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::GetClassHierarchyResults::Builder::getParents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::setParents( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::setParents(::kj::ArrayPtr<const  ::capnp::Text::Reader> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::GetClassHierarchyResults::Builder::initParents(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::adoptParents(
+    ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> UnrealCore::GetClassHierarchyResults::Builder::disownParents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline bool UnrealCore::DestroyContainerResults::Builder::getResult() {
-  return _builder.getDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+inline bool UnrealCore::GetClassHierarchyResults::Reader::hasInterfaces() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
 }
-inline void UnrealCore::DestroyContainerResults::Builder::setResult(bool value) {
-  _builder.setDataField<bool>(
-      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+inline bool UnrealCore::GetClassHierarchyResults::Builder::hasInterfaces() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader UnrealCore::GetClassHierarchyResults::Reader::getInterfaces() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::GetClassHierarchyResults::Builder::getInterfaces() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::setInterfaces( ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::setInterfaces(::kj::ArrayPtr<const  ::capnp::Text::Reader> value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>::Builder UnrealCore::GetClassHierarchyResults::Builder::initInterfaces(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void UnrealCore::GetClassHierarchyResults::Builder::adoptInterfaces(
+    ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>> UnrealCore::GetClassHierarchyResults::Builder::disownInterfaces() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::capnp::Text,  ::capnp::Kind::BLOB>>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 
 
@@ -0,0 +1,462 @@
+#pragma once
+
+/**
+ * value layouts of the unreal engine math structs, double precision as FVector2D, FVector,
+ * FRotator, FQuat and FTransform are since UE5
+ */
+typedef struct {
+    double X;
+    double Y;
+} Vector2DValue;
+
+typedef struct {
+    double X;
+    double Y;
+    double Z;
+} VectorValue;
+
+typedef struct {
+    double Pitch;
+    double Yaw;
+    double Roll;
+} RotatorValue;
+
+typedef struct {
+    double X;
+    double Y;
+    double Z;
+    double W;
+} QuatValue;
+
+typedef struct {
+    QuatValue Rotation;
+    VectorValue Translation;
+    VectorValue Scale3D;
+} TransformValue;
+
+/**
+ * SIMD kernels over the packed layouts above, on four double lanes.
+ * SSE2 is the baseline of every x64 target, the AVX path is taken when the extension is
+ * built with AVX enabled (/arch:AVX, -mavx). other targets use the scalar fallback.
+ * 2 and 3 component loads leave the unused lanes zero, so horizontal sums cover all four lanes
+ */
+#include <cmath>
+
+#if defined(__AVX__)
+#define UE_MATH_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define UE_MATH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// squared length under which a vector can not be normalized, UE_SMALL_NUMBER
+#define UE_MATH_SMALL_NUMBER 1.e-8
+
+#if defined(UE_MATH_AVX)
+typedef __m256d DoubleLanes;
+
+template <int N>
+static inline DoubleLanes load_lanes(const double* p)
+{
+    if (N == 4) {
+        return _mm256_loadu_pd(p);
+    }
+    const __m256i mask = _mm256_setr_epi64x(-1, N > 1 ? -1 : 0, N > 2 ? -1 : 0, 0);
+    return _mm256_maskload_pd(p, mask);
+}
+
+template <int N>
+static inline void store_lanes(double* p, DoubleLanes v)
+{
+    if (N == 4) {
+        _mm256_storeu_pd(p, v);
+        return;
+    }
+    const __m256i mask = _mm256_setr_epi64x(-1, N > 1 ? -1 : 0, N > 2 ? -1 : 0, 0);
+    _mm256_maskstore_pd(p, mask, v);
+}
+
+static inline DoubleLanes lanes_add(DoubleLanes a, DoubleLanes b) { return _mm256_add_pd(a, b); }
+static inline DoubleLanes lanes_sub(DoubleLanes a, DoubleLanes b) { return _mm256_sub_pd(a, b); }
+static inline DoubleLanes lanes_mul(DoubleLanes a, DoubleLanes b) { return _mm256_mul_pd(a, b); }
+static inline DoubleLanes lanes_div(DoubleLanes a, DoubleLanes b) { return _mm256_div_pd(a, b); }
+static inline DoubleLanes lanes_splat(double s) { return _mm256_set1_pd(s); }
+
+static inline double lanes_sum(DoubleLanes v)
+{
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+#elif defined(UE_MATH_SSE2)
+typedef struct {
+    __m128d xy;
+    __m128d zw;
+} DoubleLanes;
+
+template <int N>
+static inline DoubleLanes load_lanes(const double* p)
+{
+    DoubleLanes v;
+    v.xy = N > 1 ? _mm_loadu_pd(p) : _mm_load_sd(p);
+    v.zw = N == 4 ? _mm_loadu_pd(p + 2) : (N == 3 ? _mm_load_sd(p + 2) : _mm_setzero_pd());
+    return v;
+}
+
+template <int N>
+static inline void store_lanes(double* p, DoubleLanes v)
+{
+    if (N > 1) {
+        _mm_storeu_pd(p, v.xy);
+    }
+    else {
+        _mm_store_sd(p, v.xy);
+    }
+    if (N == 4) {
+        _mm_storeu_pd(p + 2, v.zw);
+    }
+    else if (N == 3) {
+        _mm_store_sd(p + 2, v.zw);
+    }
+}
+
+static inline DoubleLanes lanes_add(DoubleLanes a, DoubleLanes b) { return DoubleLanes{_mm_add_pd(a.xy, b.xy), _mm_add_pd(a.zw, b.zw)}; }
+static inline DoubleLanes lanes_sub(DoubleLanes a, DoubleLanes b) { return DoubleLanes{_mm_sub_pd(a.xy, b.xy), _mm_sub_pd(a.zw, b.zw)}; }
+static inline DoubleLanes lanes_mul(DoubleLanes a, DoubleLanes b) { return DoubleLanes{_mm_mul_pd(a.xy, b.xy), _mm_mul_pd(a.zw, b.zw)}; }
+static inline DoubleLanes lanes_div(DoubleLanes a, DoubleLanes b) { return DoubleLanes{_mm_div_pd(a.xy, b.xy), _mm_div_pd(a.zw, b.zw)}; }
+static inline DoubleLanes lanes_splat(double s) { return DoubleLanes{_mm_set1_pd(s), _mm_set1_pd(s)}; }
+
+static inline double lanes_sum(DoubleLanes v)
+{
+    __m128d sum = _mm_add_pd(v.xy, v.zw);
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+#else
+typedef struct {
+    double v[4];
+} DoubleLanes;
+
+template <int N>
+static inline DoubleLanes load_lanes(const double* p)
+{
+    DoubleLanes lanes = {{0.0, 0.0, 0.0, 0.0}};
+    for (int i = 0; i < N; i++) {
+        lanes.v[i] = p[i];
+    }
+    return lanes;
+}
+
+template <int N>
+static inline void store_lanes(double* p, DoubleLanes lanes)
+{
+    for (int i = 0; i < N; i++) {
+        p[i] = lanes.v[i];
+    }
+}
+
+#define UE_MATH_SCALAR_LANES_OP(name, op) \
+    static inline DoubleLanes name(DoubleLanes a, DoubleLanes b) \
+    { \
+        return DoubleLanes{{a.v[0] op b.v[0], a.v[1] op b.v[1], a.v[2] op b.v[2], a.v[3] op b.v[3]}}; \
+    }
+UE_MATH_SCALAR_LANES_OP(lanes_add, +)
+UE_MATH_SCALAR_LANES_OP(lanes_sub, -)
+UE_MATH_SCALAR_LANES_OP(lanes_mul, *)
+UE_MATH_SCALAR_LANES_OP(lanes_div, /)
+#undef UE_MATH_SCALAR_LANES_OP
+
+static inline DoubleLanes lanes_splat(double s) { return DoubleLanes{{s, s, s, s}}; }
+static inline double lanes_sum(DoubleLanes v) { return v.v[0] + v.v[1] + v.v[2] + v.v[3]; }
+#endif
+
+/**
+ * component wise kernels on N packed doubles, out may alias the inputs
+ */
+template <int N>
+static inline void math_add(double* out, const double* a, const double* b)
+{
+    store_lanes<N>(out, lanes_add(load_lanes<N>(a), load_lanes<N>(b)));
+}
+
+template <int N>
+static inline void math_sub(double* out, const double* a, const double* b)
+{
+    store_lanes<N>(out, lanes_sub(load_lanes<N>(a), load_lanes<N>(b)));
+}
+
+template <int N>
+static inline void math_mul(double* out, const double* a, const double* b)
+{
+    store_lanes<N>(out, lanes_mul(load_lanes<N>(a), load_lanes<N>(b)));
+}
+
+template <int N>
+static inline void math_div(double* out, const double* a, const double* b)
+{
+    // the unused lanes divide 0 by 0 and are never stored
+    store_lanes<N>(out, lanes_div(load_lanes<N>(a), load_lanes<N>(b)));
+}
+
+template <int N>
+static inline void math_scale(double* out, const double* a, double s)
+{
+    store_lanes<N>(out, lanes_mul(load_lanes<N>(a), lanes_splat(s)));
+}
+
+template <int N>
+static inline double math_dot(const double* a, const double* b)
+{
+    return lanes_sum(lanes_mul(load_lanes<N>(a), load_lanes<N>(b)));
+}
+
+// a + (b - a) * alpha, as FMath::Lerp
+template <int N>
+static inline void math_lerp(double* out, const double* a, const double* b, double alpha)
+{
+    DoubleLanes from = load_lanes<N>(a);
+    store_lanes<N>(out, lanes_add(from, lanes_mul(lanes_sub(load_lanes<N>(b), from), lanes_splat(alpha))));
+}
+
+// GetSafeNormal: false and out untouched when the squared size is below UE_MATH_SMALL_NUMBER
+template <int N>
+static inline bool math_normalize(double* out, const double* a)
+{
+    DoubleLanes v = load_lanes<N>(a);
+    double square_sum = lanes_sum(lanes_mul(v, v));
+    if (square_sum < UE_MATH_SMALL_NUMBER) {
+        return false;
+    }
+    store_lanes<N>(out, lanes_mul(v, lanes_splat(1.0 / std::sqrt(square_sum))));
+    return true;
+}
+
+/**
+ * shuffle heavy operations, written on scalars which the compiler schedules well enough for
+ * a single value
+ */
+static inline VectorValue vector_cross(const VectorValue& a, const VectorValue& b)
+{
+    return VectorValue{
+        a.Y * b.Z - a.Z * b.Y,
+        a.Z * b.X - a.X * b.Z,
+        a.X * b.Y - a.Y * b.X};
+}
+
+// a * b applies b first, as FQuat::operator*
+static inline QuatValue quat_multiply(const QuatValue& a, const QuatValue& b)
+{
+    return QuatValue{
+        a.W * b.X + a.X * b.W + a.Y * b.Z - a.Z * b.Y,
+        a.W * b.Y - a.X * b.Z + a.Y * b.W + a.Z * b.X,
+        a.W * b.Z + a.X * b.Y - a.Y * b.X + a.Z * b.W,
+        a.W * b.W - a.X * b.X - a.Y * b.Y - a.Z * b.Z};
+}
+
+// FQuat::RotateVector: v + 2w(q x v) + q x (2(q x v)), for a normalized q
+static inline VectorValue quat_rotate_vector(const QuatValue& q, const VectorValue& v)
+{
+    VectorValue axis = {q.X, q.Y, q.Z};
+    VectorValue t = vector_cross(axis, v);
+    t = VectorValue{t.X * 2.0, t.Y * 2.0, t.Z * 2.0};
+    VectorValue u = vector_cross(axis, t);
+    return VectorValue{v.X + q.W * t.X + u.X, v.Y + q.W * t.Y + u.Y, v.Z + q.W * t.Z + u.Z};
+}
+
+// FQuat::Inverse, for a normalized q
+static inline QuatValue quat_inverse(const QuatValue& q)
+{
+    return QuatValue{-q.X, -q.Y, -q.Z, q.W};
+}
+
+// FQuat::FastLerp followed by a normalize, blending along the shortest arc
+static inline QuatValue quat_lerp(const QuatValue& a, const QuatValue& b, double alpha)
+{
+    double bias = math_dot<4>(&a.X, &b.X) >= 0.0 ? 1.0 : -1.0;
+    QuatValue from;
+    QuatValue result;
+    math_scale<4>(&from.X, &a.X, bias * (1.0 - alpha));
+    math_scale<4>(&result.X, &b.X, alpha);
+    math_add<4>(&result.X, &result.X, &from.X);
+    if (!math_normalize<4>(&result.X, &result.X)) {
+        result = QuatValue{0.0, 0.0, 0.0, 1.0};
+    }
+    return result;
+}
+
+// FTransform::TransformPosition: scale, then rotate, then translate
+static inline VectorValue transform_position(const TransformValue& t, const VectorValue& v)
+{
+    VectorValue scaled;
+    math_mul<3>(&scaled.X, &t.Scale3D.X, &v.X);
+    VectorValue result = quat_rotate_vector(t.Rotation, scaled);
+    math_add<3>(&result.X, &result.X, &t.Translation.X);
+    return result;
+}
+
+// FTransform::TransformVector: as transform_position without the translation
+static inline VectorValue transform_vector(const TransformValue& t, const VectorValue& v)
+{
+    VectorValue scaled;
+    math_mul<3>(&scaled.X, &t.Scale3D.X, &v.X);
+    return quat_rotate_vector(t.Rotation, scaled);
+}
+
+// a * b applies a first, as FTransform::operator*
+static inline TransformValue transform_multiply(const TransformValue& a, const TransformValue& b)
+{
+    TransformValue result;
+    result.Rotation = quat_multiply(b.Rotation, a.Rotation);
+    VectorValue scaled;
+    math_mul<3>(&scaled.X, &a.Translation.X, &b.Scale3D.X);
+    result.Translation = quat_rotate_vector(b.Rotation, scaled);
+    math_add<3>(&result.Translation.X, &result.Translation.X, &b.Translation.X);
+    math_mul<3>(&result.Scale3D.X, &a.Scale3D.X, &b.Scale3D.X);
+    return result;
+}
+
+// FTransform::BlendWith style blend: translation and scale linearly, rotation as quat_lerp
+static inline TransformValue transform_lerp(const TransformValue& a, const TransformValue& b, double alpha)
+{
+    TransformValue result;
+    result.Rotation = quat_lerp(a.Rotation, b.Rotation, alpha);
+    math_lerp<3>(&result.Translation.X, &a.Translation.X, &b.Translation.X, alpha);
+    math_lerp<3>(&result.Scale3D.X, &a.Scale3D.X, &b.Scale3D.X, alpha);
+    return result;
+}
+
+// FQuat::Slerp: spherical blend along the shortest arc, normalized
+static inline QuatValue quat_slerp(const QuatValue& a, const QuatValue& b, double alpha)
+{
+    double raw_cosom = math_dot<4>(&a.X, &b.X);
+    double cosom = raw_cosom >= 0.0 ? raw_cosom : -raw_cosom;
+    double scale0;
+    double scale1;
+    if (cosom < 0.9999) {
+        double omega = std::acos(cosom);
+        double inv_sin = 1.0 / std::sin(omega);
+        scale0 = std::sin((1.0 - alpha) * omega) * inv_sin;
+        scale1 = std::sin(alpha * omega) * inv_sin;
+    }
+    else {
+        // nearly parallel, the linear blend is as accurate and avoids the division
+        scale0 = 1.0 - alpha;
+        scale1 = alpha;
+    }
+    scale1 = raw_cosom >= 0.0 ? scale1 : -scale1;
+
+    QuatValue result;
+    DoubleLanes blend = lanes_add(lanes_mul(load_lanes<4>(&a.X), lanes_splat(scale0)), lanes_mul(load_lanes<4>(&b.X), lanes_splat(scale1)));
+    store_lanes<4>(&result.X, blend);
+    if (!math_normalize<4>(&result.X, &result.X)) {
+        result = QuatValue{0.0, 0.0, 0.0, 1.0};
+    }
+    return result;
+}
+
+/**
+ * quat of the rotation matrix whose rows are the x, y and z axes, as FQuat(const FMatrix&)
+ */
+static inline QuatValue quat_from_axes(const VectorValue& x, const VectorValue& y, const VectorValue& z)
+{
+    const double m[3][3] = {{x.X, x.Y, x.Z}, {y.X, y.Y, y.Z}, {z.X, z.Y, z.Z}};
+    double trace = m[0][0] + m[1][1] + m[2][2];
+    QuatValue q;
+    if (trace > 0.0) {
+        double inv_s = 1.0 / std::sqrt(trace + 1.0);
+        double s = 0.5 * inv_s;
+        q.W = 0.5 / inv_s;
+        q.X = (m[1][2] - m[2][1]) * s;
+        q.Y = (m[2][0] - m[0][2]) * s;
+        q.Z = (m[0][1] - m[1][0]) * s;
+        return q;
+    }
+
+    static const int next[3] = {1, 2, 0};
+    int i = 0;
+    if (m[1][1] > m[0][0]) {
+        i = 1;
+    }
+    if (m[2][2] > m[i][i]) {
+        i = 2;
+    }
+    int j = next[i];
+    int k = next[j];
+    double inv_s = 1.0 / std::sqrt(m[i][i] - m[j][j] - m[k][k] + 1.0);
+    double s = 0.5 * inv_s;
+    double* components = &q.X;
+    components[i] = 0.5 / inv_s;
+    q.W = (m[j][k] - m[k][j]) * s;
+    components[j] = (m[i][j] + m[j][i]) * s;
+    components[k] = (m[i][k] + m[k][i]) * s;
+    return q;
+}
+
+/**
+ * rotation turning the x axis from origin towards target with z kept towards up, as
+ * FRotationMatrix::MakeFromXZ. the identity when target is origin, and up falls back to the
+ * x axis as FRotationMatrix::MakeFromX does when it is parallel to the direction
+ */
+static inline QuatValue quat_look_at(const VectorValue& origin, const VectorValue& target, const VectorValue& up)
+{
+    VectorValue x;
+    math_sub<3>(&x.X, &target.X, &origin.X);
+    if (!math_normalize<3>(&x.X, &x.X)) {
+        return QuatValue{0.0, 0.0, 0.0, 1.0};
+    }
+
+    VectorValue y = vector_cross(up, x);
+    if (!math_normalize<3>(&y.X, &y.X)) {
+        VectorValue fallback = std::fabs(x.Z) < 1.0 - 1.e-4 ? VectorValue{0.0, 0.0, 1.0} : VectorValue{1.0, 0.0, 0.0};
+        y = vector_cross(fallback, x);
+        math_normalize<3>(&y.X, &y.X);
+    }
+    VectorValue z = vector_cross(x, y);
+    return quat_from_axes(x, y, z);
+}
+
+/**
+ * transform_position over packed points. the transform is folded into a scaled rotation matrix
+ * once, so each point is three lane multiplies and adds against the matrix columns
+ */
+static inline void transform_points(const TransformValue& t, const double* points, double* out, size_t begin, size_t end)
+{
+    const QuatValue& q = t.Rotation;
+    double x2 = q.X + q.X, y2 = q.Y + q.Y, z2 = q.Z + q.Z;
+    double xx = q.X * x2, xy = q.X * y2, xz = q.X * z2;
+    double yy = q.Y * y2, yz = q.Y * z2, zz = q.Z * z2;
+    double wx = q.W * x2, wy = q.W * y2, wz = q.W * z2;
+    const double columns[3][3] = {
+        {(1.0 - (yy + zz)) * t.Scale3D.X, (xy + wz) * t.Scale3D.X, (xz - wy) * t.Scale3D.X},
+        {(xy - wz) * t.Scale3D.Y, (1.0 - (xx + zz)) * t.Scale3D.Y, (yz + wx) * t.Scale3D.Y},
+        {(xz + wy) * t.Scale3D.Z, (yz - wx) * t.Scale3D.Z, (1.0 - (xx + yy)) * t.Scale3D.Z},
+    };
+    DoubleLanes column_x = load_lanes<3>(columns[0]);
+    DoubleLanes column_y = load_lanes<3>(columns[1]);
+    DoubleLanes column_z = load_lanes<3>(columns[2]);
+    DoubleLanes translation = load_lanes<3>(&t.Translation.X);
+
+    for (size_t i = begin; i < end; i++) {
+        const double* p = points + i * 3;
+        DoubleLanes result = lanes_add(translation, lanes_mul(column_x, lanes_splat(p[0])));
+        result = lanes_add(result, lanes_mul(column_y, lanes_splat(p[1])));
+        result = lanes_add(result, lanes_mul(column_z, lanes_splat(p[2])));
+        store_lanes<3>(out + i * 3, result);
+    }
+}
+
+// FRotator::Quaternion, angles in degrees
+static inline QuatValue rotator_to_quat(const RotatorValue& r)
+{
+    const double half_degrees_to_radians = 3.14159265358979323846 / 360.0;
+    double pitch = std::fmod(r.Pitch, 360.0) * half_degrees_to_radians;
+    double yaw = std::fmod(r.Yaw, 360.0) * half_degrees_to_radians;
+    double roll = std::fmod(r.Roll, 360.0) * half_degrees_to_radians;
+    double sp = std::sin(pitch), cp = std::cos(pitch);
+    double sy = std::sin(yaw), cy = std::cos(yaw);
+    double sr = std::sin(roll), cr = std::cos(roll);
+    return QuatValue{
+        cr * sp * sy - sr * cp * cy,
+        -cr * sp * cy - sr * cp * sy,
+        cr * cp * sy - sr * sp * cy,
+        cr * cp * cy + sr * sp * sy};
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * UTF-16 transcoding between the PEP 393 str layouts (latin1, UCS2, UCS4) and the UTF-16LE code
+ * units of FString. latin1 widens and narrows on 16 byte SSE2 lanes (the baseline of every x64
+ * target), UCS2 is UTF-16 already and copies as is. other targets use the scalar loops, which
+ * also finish the tails shorter than a lane
+ */
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define UE_UTF16_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// latin1 -> UTF-16, n code units
+static inline void utf16_from_latin1(const uint8_t* src, size_t n, uint16_t* dst)
+{
+    size_t i = 0;
+#if defined(UE_UTF16_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = src[i];
+    }
+}
+
+// UTF-16 -> latin1, every unit must be below 0x100
+static inline void utf16_to_latin1(const uint16_t* src, size_t n, uint8_t* dst)
+{
+    size_t i = 0;
+#if defined(UE_UTF16_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i low = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i high = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(low, high));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = (uint8_t)src[i];
+    }
+}
+
+/**
+ * largest code unit and whether any unit is a surrogate, in one pass.
+ * SSE2 has no unsigned 16 bit max, the sign bit is flipped around a signed max instead
+ */
+static inline uint16_t utf16_scan(const uint16_t* src, size_t n, bool* has_surrogates)
+{
+    size_t i = 0;
+    uint16_t max_unit = 0;
+    bool surrogates = false;
+#if defined(UE_UTF16_SSE2)
+    const __m128i sign = _mm_set1_epi16((short)0x8000);
+    const __m128i surrogate_mask = _mm_set1_epi16((short)0xF800);
+    const __m128i surrogate_bits = _mm_set1_epi16((short)0xD800);
+    __m128i max_lanes = _mm_set1_epi16((short)0x8000);    // 0 with the sign bit flipped
+    __m128i surrogate_lanes = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i units = _mm_loadu_si128((const __m128i*)(src + i));
+        max_lanes = _mm_max_epi16(max_lanes, _mm_xor_si128(units, sign));
+        surrogate_lanes = _mm_or_si128(surrogate_lanes, _mm_cmpeq_epi16(_mm_and_si128(units, surrogate_mask), surrogate_bits));
+    }
+    uint16_t lanes[8];
+    _mm_storeu_si128((__m128i*)lanes, _mm_xor_si128(max_lanes, sign));
+    for (int lane = 0; lane < 8; lane++) {
+        max_unit = lanes[lane] > max_unit ? lanes[lane] : max_unit;
+    }
+    surrogates = _mm_movemask_epi8(surrogate_lanes) != 0;
+#endif
+    for (; i < n; i++) {
+        max_unit = src[i] > max_unit ? src[i] : max_unit;
+        surrogates = surrogates || (src[i] & 0xF800) == 0xD800;
+    }
+    *has_surrogates = surrogates;
+    return max_unit;
+}
+
+// UTF-16 units needed for n UCS4 code points
+static inline size_t utf16_length_of_ucs4(const uint32_t* src, size_t n)
+{
+    size_t length = n;
+    for (size_t i = 0; i < n; i++) {
+        length += src[i] > 0xFFFF;
+    }
+    return length;
+}
+
+// UCS4 -> UTF-16 with surrogate pairs above the BMP, dst holds utf16_length_of_ucs4 units
+static inline void utf16_from_ucs4(const uint32_t* src, size_t n, uint16_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint32_t code_point = src[i];
+        if (code_point > 0xFFFF) {
+            code_point -= 0x10000;
+            *dst++ = (uint16_t)(0xD800 + (code_point >> 10));
+            *dst++ = (uint16_t)(0xDC00 + (code_point & 0x3FF));
+        }
+        else {
+            *dst++ = (uint16_t)code_point;
+        }
+    }
+}
+
+// UTF-8 bytes of n UTF-16 units, an unpaired surrogate counts as U+FFFD
+static inline size_t utf8_length_of_utf16(const uint16_t* src, size_t n)
+{
+    size_t length = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint16_t unit = src[i];
+        if (unit < 0x80) {
+            length += 1;
+        }
+        else if (unit < 0x800) {
+            length += 2;
+        }
+        else if (unit >= 0xD800 && unit < 0xDC00 && i + 1 < n && (src[i + 1] & 0xFC00) == 0xDC00) {
+            length += 4;
+            i++;
+        }
+        else {
+            length += 3;
+        }
+    }
+    return length;
+}
+
+// UTF-16 -> UTF-8, dst holds utf8_length_of_utf16 bytes
+static inline void utf8_from_utf16(const uint16_t* src, size_t n, char* dst)
+{
+    uint8_t* out = (uint8_t*)dst;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t code_point = src[i];
+        if (code_point >= 0xD800 && code_point < 0xDC00 && i + 1 < n && (src[i + 1] & 0xFC00) == 0xDC00) {
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (src[++i] - 0xDC00);
+        }
+        else if ((code_point & 0xF800) == 0xD800) {
+            code_point = 0xFFFD;
+        }
+
+        if (code_point < 0x80) {
+            *out++ = (uint8_t)code_point;
+        }
+        else if (code_point < 0x800) {
+            *out++ = (uint8_t)(0xC0 | (code_point >> 6));
+            *out++ = (uint8_t)(0x80 | (code_point & 0x3F));
+        }
+        else if (code_point < 0x10000) {
+            *out++ = (uint8_t)(0xE0 | (code_point >> 12));
+            *out++ = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+            *out++ = (uint8_t)(0x80 | (code_point & 0x3F));
+        }
+        else {
+            *out++ = (uint8_t)(0xF0 | (code_point >> 18));
+            *out++ = (uint8_t)(0x80 | ((code_point >> 12) & 0x3F));
+            *out++ = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+            *out++ = (uint8_t)(0x80 | (code_point & 0x3F));
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * C function table of unreal_core, for compiled code (C, C++, Cython, numba) driving unreal engine
+ * without python objects. the module exports it as the capsule UNREAL_CORE_CAPI_NAME:
+ *
+ *     const UnrealCoreCAPI* api = unreal_core_import_capi();
+ *     int32_t actor = api->resolve_class("Actor");
+ *     int32_t add = api->resolve_function(actor, "Add", 0);
+ *     UnrealCoreCall* call = api->begin_call(add, owner, address, NULL, 2);
+ *     api->encode_param(call, 0, "a", &a);
+ *     api->encode_param(call, 1, "b", &b);
+ *     api->send_call(call);
+ *     api->wait_call(call);
+ *     api->read_result(call, -1, &result, NULL, 0);
+ *     api->end_call(call);
+ *
+ * the table shares the rpc connection and event loop of the python api, call it with the GIL held.
+ * functions return 0 (or a valid id / handle) on success and -1 (or NULL) on failure, last_error
+ * then tells why. no python exception is set
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#define UNREAL_CORE_CAPI_VERSION 1
+#define UNREAL_CORE_CAPI_NAME "unreal_core._C_API"
+
+// resolve_function flags
+#define UE_FUNCTION_STATIC 0x1
+
+typedef enum {
+    UE_VALUE_NONE = 0,      // void return or a property never set
+    UE_VALUE_BOOL,          // i
+    UE_VALUE_INT,           // i, int, uint (bit cast) and enum values
+    UE_VALUE_FLOAT,         // f
+    UE_VALUE_STR,           // str, UTF-8
+    UE_VALUE_OBJECT,        // object address
+    UE_VALUE_VECTOR,        // xyzw[0..2] as X, Y, Z
+    UE_VALUE_ROTATOR,       // xyzw[0..2] as Pitch, Yaw, Roll
+    UE_VALUE_QUAT,          // xyzw as X, Y, Z, W
+} UEValueKind;
+
+typedef struct {
+    int32_t kind;           // UEValueKind
+    union {
+        int64_t i;
+        double f;
+        uint64_t object;
+        double xyzw[4];
+        struct {
+            const char* data;   // read values point into the caller's buffer, NUL terminated
+            size_t size;        // bytes without the NUL, the needed size when the buffer was too small
+        } str;
+    } as;
+} UEValue;
+
+typedef struct UnrealCoreCall UnrealCoreCall;
+
+typedef struct {
+    uint32_t version;       // UNREAL_CORE_CAPI_VERSION of the module
+    uint32_t size;          // sizeof the table, later versions only append members
+
+    // why the last failing call failed
+    const char* (*last_error)(void);
+
+    // interned id of a ue class, stable for the life of the process
+    int32_t (*resolve_class)(const char* class_name);
+    // id of a function of a resolved class, flags UE_FUNCTION_*
+    int32_t (*resolve_function)(int32_t class_id, const char* function_name, uint32_t flags);
+
+    // new call of function_id on the ue object at object_address bound to owner, object_name may be NULL.
+    // owner and object_address are ignored for static functions
+    UnrealCoreCall* (*begin_call)(int32_t function_id, uint64_t owner, uint64_t object_address, const char* object_name, uint32_t param_count);
+    // write param index, name may be NULL for an unnamed param
+    int (*encode_param)(UnrealCoreCall* call, uint32_t index, const char* name, const UEValue* value);
+    // send the call without waiting, several calls can be in flight
+    int (*send_call)(UnrealCoreCall* call);
+    // wait for the response of a sent call
+    int (*wait_call)(UnrealCoreCall* call);
+    // read the return value (index -1) or out param index of a finished call. strings are copied
+    // into buffer, a call without strings may pass NULL
+    int (*read_result)(UnrealCoreCall* call, int32_t index, UEValue* value, char* buffer, size_t capacity);
+    // number of out params of a finished call, -1 when it has not finished
+    int32_t (*out_param_count)(UnrealCoreCall* call);
+    // release a call in any state
+    void (*end_call)(UnrealCoreCall* call);
+
+    // read count properties of owner in one round trip, strings are packed into buffer
+    int (*get_properties)(uint64_t owner, int32_t class_id, const char* const* names, uint32_t count, UEValue* values, char* buffer, size_t capacity);
+    // write count properties of owner in one round trip
+    int (*set_properties)(uint64_t owner, int32_t class_id, const char* const* names, const UEValue* values, uint32_t count);
+} UnrealCoreCAPI;
+
+#ifdef Py_PYTHON_H
+/**
+ * the table of the imported unreal_core module, NULL with a python error when it is missing or older
+ * than this header
+ */
+static inline const UnrealCoreCAPI* unreal_core_import_capi(void)
+{
+    const UnrealCoreCAPI* api = (const UnrealCoreCAPI*)PyCapsule_Import(UNREAL_CORE_CAPI_NAME, 0);
+    if (api != NULL && (api->version < UNREAL_CORE_CAPI_VERSION || api->size < sizeof(UnrealCoreCAPI))) {
+        PyErr_Format(PyExc_ImportError, "unreal_core C API version %u is older than %d", api->version, UNREAL_CORE_CAPI_VERSION);
+        return NULL;
+    }
+    return api;
+}
+#endif
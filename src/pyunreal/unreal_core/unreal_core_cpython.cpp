@@ -1,11 +1,27 @@
 #include <Python.h>
+#include <structmember.h>
 #include "ue_core.capnp.h"
+#include "ue_math.h"
+#include "ue_utf16.h"
+#include "unreal_core_capi.h"
 #include <kj/async-io.h>
 #include <capnp/rpc-twoparty.h>
+#include <capnp/any.h>
+#include <capnp/schema.h>
 #include <windows.h>
 #include <exception>
 #include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #define CHECK_CLIENT_AND_RECREATE_IT() \
     if (ue_core_client == NULL) { \
@@ -28,34 +44,226 @@
 #define PYTHON_MODULE_NAME "py_unreal"
 #define UNREAD_OBJECT_PROPERTY_NAME "unreal_object"
 
+#ifdef UNREAL_CORE_TESTING
+// test builds only: set this environment variable to answer rpc calls from an in-process stand-in server instead of unreal engine
+#define LOOPBACK_ENV_NAME "UNREAL_CORE_LOOPBACK"
+#endif
+
 
 /**
  * Utils functions
  */
-static inline char* deep_copy_str(const char* src)
+static inline char* deep_copy_str(const char* src, size_t length)
 {
-    char* dest = (char*)malloc(strlen(src));
-    strcpy(dest, src);
+    char* dest = (char*)malloc(length + 1);
+    if (dest != NULL) {
+        memcpy(dest, src, length);
+        dest[length] = '\0';
+    }
     return dest;
 }
 
-int is_enum_type(PyObject* obj) {
-    PyObject* enum_module = PyImport_ImportModule("enum");
-    if (!enum_module) return 0;
+static inline char* deep_copy_str(const char* src)
+{
+    return deep_copy_str(src, strlen(src));
+}
+
+static inline char* deep_copy_str(const capnp::Text::Reader& src)
+{
+    return deep_copy_str(src.begin(), src.size());
+}
+
+/**
+ * METH_FASTCALL argument unpacking
+ */
+static inline bool check_positional_args(const char* func_name, Py_ssize_t nargs, Py_ssize_t min_args, Py_ssize_t max_args)
+{
+    if (nargs < min_args || nargs > max_args) {
+        if (min_args == max_args) {
+            PyErr_Format(PyExc_TypeError, "%s() takes exactly %zd arguments (%zd given)", func_name, min_args, nargs);
+        }
+        else {
+            PyErr_Format(PyExc_TypeError, "%s() takes from %zd to %zd arguments (%zd given)", func_name, min_args, max_args, nargs);
+        }
+        return false;
+    }
+    return true;
+}
+
+static inline bool check_arg_type(const char* func_name, PyObject* const* args, Py_ssize_t index, PyTypeObject* type)
+{
+    if (!PyObject_TypeCheck(args[index], type)) {
+        PyErr_Format(PyExc_TypeError, "%s() argument %zd must be %s, not %.200s",
+            func_name, index + 1, type->tp_name, Py_TYPE(args[index])->tp_name);
+        return false;
+    }
+    return true;
+}
+
+static inline const char* unpack_str_arg(const char* func_name, PyObject* const* args, Py_ssize_t index)
+{
+    if (!PyUnicode_Check(args[index])) {
+        PyErr_Format(PyExc_TypeError, "%s() argument %zd must be str, not %.200s",
+            func_name, index + 1, Py_TYPE(args[index])->tp_name);
+        return NULL;
+    }
+    return PyUnicode_AsUTF8(args[index]);
+}
+
+/**
+ * borrowed view of the items of any sequence, lists and tuples are used in place without copying
+ */
+class SequenceItems {
+public:
+    ~SequenceItems()
+    {
+        Py_XDECREF(sequence);
+    }
+
+    bool open(PyObject* object, const char* error_message)
+    {
+        sequence = PySequence_Fast(object, error_message);
+        if (sequence == NULL) {
+            return false;
+        }
+        items = PySequence_Fast_ITEMS(sequence);
+        size = PySequence_Fast_GET_SIZE(sequence);
+        return true;
+    }
+
+    PyObject** items = NULL;
+    Py_ssize_t size = 0;
+
+private:
+    PyObject* sequence = NULL;
+};
+
+/**
+ * Cached module and class lookups, resolved once on first use
+ */
+static PyObject* enum_class = NULL;
+static PyObject* py_unreal_module = NULL;
+/**
+ * python class wrapping a ue class, with how its instances receive their unreal object.
+ * classes that declare the handle in __slots__ get it stored at the slot offset, in the same step
+ * as the allocation, the others through setattr
+ */
+typedef struct {
+    PyTypeObject* py_class;
+    Py_ssize_t handle_offset;   // member offset of the UNREAD_OBJECT_PROPERTY_NAME slot, -1 when not a slot
+} PythonClass;
 
-    PyObject* enum_class = PyObject_GetAttrString(enum_module, "Enum");
-    if (!enum_class) {
+static std::unordered_map<std::string, PythonClass> py_unreal_classes;
+static std::string py_unreal_class_key;     // reused to look up a class without allocating
+// handle slot offsets of the classes seen, including ones find_python_class did not load. the map holds
+// a reference to the types, so their address can not be reused by another type
+static std::unordered_map<PyTypeObject*, Py_ssize_t> handle_offsets;
+
+static PyObject* get_enum_class()
+{
+    if (enum_class == NULL) {
+        PyObject* enum_module = PyImport_ImportModule("enum");
+        if (!enum_module) return NULL;
+
+        enum_class = PyObject_GetAttrString(enum_module, "Enum");
         Py_DECREF(enum_module);
-        return 0;
     }
+    return enum_class;
+}
 
-    int result = PyObject_IsInstance(obj, enum_class);
+int is_enum_type(PyObject* obj) {
+    PyObject* enum_type = get_enum_class();
+    if (!enum_type) {
+        PyErr_Clear();
+        return 0;
+    }
 
-    Py_DECREF(enum_class);
-    Py_DECREF(enum_module);
+    int result = PyObject_IsInstance(obj, enum_type);
+    if (result < 0) {
+        PyErr_Clear();
+        return 0;
+    }
     return result;
 }
 
+static Py_ssize_t find_handle_offset(PyTypeObject* py_class)
+{
+    PyObject* descr = PyObject_GetAttrString((PyObject*)py_class, UNREAD_OBJECT_PROPERTY_NAME);
+    Py_ssize_t offset = -1;
+    if (descr != NULL && Py_TYPE(descr) == &PyMemberDescr_Type
+        && ((PyMemberDescrObject*)descr)->d_member->type == T_OBJECT_EX) {
+        offset = ((PyMemberDescrObject*)descr)->d_member->offset;
+    }
+    Py_XDECREF(descr);
+    PyErr_Clear();
+    return offset;
+}
+
+static Py_ssize_t handle_offset_of(PyTypeObject* py_class)
+{
+    auto it = handle_offsets.find(py_class);
+    if (it != handle_offsets.end()) {
+        return it->second;
+    }
+    Py_ssize_t offset = find_handle_offset(py_class);
+    Py_INCREF(py_class);
+    handle_offsets.emplace(py_class, offset);
+    return offset;
+}
+
+/**
+ * find the python class which wraps the unreal class `class_type_name` in PYTHON_MODULE_NAME,
+ * return a borrowed entry. generated lazy packages materialize the class in their module
+ * __getattr__ on the first lookup, later ones are answered from the cache
+ */
+static const PythonClass* find_python_class(const char* class_type_name)
+{
+    py_unreal_class_key.assign(class_type_name);
+    auto it = py_unreal_classes.find(py_unreal_class_key);
+    if (it != py_unreal_classes.end()) {
+        return &it->second;
+    }
+
+    if (py_unreal_module == NULL) {
+        py_unreal_module = PyImport_ImportModule(PYTHON_MODULE_NAME); // todo: Compatible with other Python versions
+        if (py_unreal_module == NULL) {
+            PyErr_SetString(PyExc_ImportError, "Failed to import unreal module");
+            return NULL;
+        }
+    }
+
+    PyObject* py_class = PyObject_GetAttrString(py_unreal_module, class_type_name);
+    if (py_class == NULL || !PyType_Check(py_class)) {
+        Py_XDECREF(py_class);
+        char error_msg[128];
+        snprintf(error_msg, sizeof(error_msg), "Failed to find unreal class: %s", class_type_name);
+        PyErr_SetString(PyExc_ImportError, error_msg);
+        return NULL;
+    }
+
+    // the cache keeps the reference
+    PythonClass entry = {(PyTypeObject*)py_class, handle_offset_of((PyTypeObject*)py_class)};
+    return &py_unreal_classes.emplace(py_unreal_class_key, entry).first->second;
+}
+
+/**
+ * unreal_core.clear_class_cache
+ * forget the module and classes found by find_python_class, e.g. after regenerating the bindings
+ */
+static PyObject* unreal_core_clear_class_cache(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    for (auto& entry : py_unreal_classes) {
+        Py_DECREF(entry.second.py_class);
+    }
+    py_unreal_classes.clear();
+    for (auto& entry : handle_offsets) {
+        Py_DECREF(entry.first);
+    }
+    handle_offsets.clear();
+    Py_CLEAR(py_unreal_module);
+    Py_RETURN_NONE;
+}
+
 /**
  * capnp client
  */
@@ -63,14 +271,157 @@ typedef struct {
     const char* name;
     kj::Own<kj::AsyncIoStream> connection;
     kj::Own<capnp::TwoPartyClient> client;
+    // bootstrap capability, resolved once per connection
+    UnrealCore::Client ue_core = nullptr;
+    // SERVER_FEATURE_* bits advertised by the server, asked once per connection
+    uint64_t features = 0;
+    bool features_known = false;
 } CapnpClient;
 
+// the server answers callFunctionPacked
+#define SERVER_FEATURE_PACKED_PARAMS (1ull << 0)
+// the server reads and writes strUtf16Value
+#define SERVER_FEATURE_UTF16_STRINGS (1ull << 1)
+
 static PyTypeObject CapnpClient_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
 };
 
 static CapnpClient* ue_core_client = NULL;
 static kj::AsyncIoContext io_context = kj::setupAsyncIo();
+
+static bool server_supports(uint64_t feature)
+{
+    if (ue_core_client == NULL) {
+        return false;
+    }
+    if (!ue_core_client->features_known) {
+        ue_core_client->features_known = true;
+        // servers without getFeatures answer unimplemented
+        try {
+            auto features_request = ue_core_client->ue_core.getFeaturesRequest();
+            ue_core_client->features = features_request.send().wait(io_context.waitScope).getFeatures();
+        } catch (kj::Exception& e) {
+            ue_core_client->features = 0;
+        }
+    }
+    return (ue_core_client->features & feature) != 0;
+}
+
+/**
+ * Request sizing
+ * capnp allocates the first segment of a request message from the size hint (1024 words without one)
+ * and chains bigger segments when the message outgrows it. every rpc method keeps a histogram of its
+ * recent request sizes and hints the size covering nearly all of them, so a steady state request is
+ * built in one right-sized segment instead of a zeroed 8KB one or a chain of them
+ */
+typedef enum {
+    REQUEST_NEW_OBJECT = 0,
+    REQUEST_DESTROY_OBJECT,
+    REQUEST_REGISTER_CREATED_PY_OBJECT,
+    REQUEST_CALL_FUNCTION,
+    REQUEST_CALL_STATIC_FUNCTION,
+    REQUEST_GET_PROPERTY,
+    REQUEST_SET_PROPERTY,
+    REQUEST_NEW_CONTAINER,
+    REQUEST_DESTROY_CONTAINER,
+    REQUEST_CALL_FUNCTION_PACKED,
+    REQUEST_STATIC_CLASS,
+    REQUEST_GET_CLASS_HIERARCHY,
+    REQUEST_METHOD_COUNT,
+} RequestMethod;
+
+static const char* request_method_names[REQUEST_METHOD_COUNT] = {
+    "newObject",
+    "destroyObject",
+    "registerCreatedPyObject",
+    "callFunction",
+    "callStaticFunction",
+    "getProperty",
+    "setProperty",
+    "newContainer",
+    "destroyContainer",
+    "callFunctionPacked",
+    "staticClass",
+    "getClassHierarchy",
+};
+
+#define REQUEST_SIZE_BUCKETS 20         // bucket b counts requests of up to 2^b words
+#define REQUEST_SIZE_WINDOW 256         // the histogram is halved after this many samples to follow recent calls
+#define REQUEST_SIZE_COVERAGE 0.95      // share of recent requests the hint must fit
+#define REQUEST_DEFAULT_FIRST_SEGMENT_WORDS 1024
+
+typedef struct {
+    uint32_t buckets[REQUEST_SIZE_BUCKETS];
+    uint32_t samples;
+    uint64_t hint_words;
+    uint64_t requests;
+    uint64_t message_words;
+    uint64_t modeled_segments;
+    uint64_t modeled_words;
+} RequestSizeStats;
+
+static RequestSizeStats request_size_stats[REQUEST_METHOD_COUNT];
+static bool adaptive_request_sizing = true;
+
+static kj::Maybe<capnp::MessageSize> request_size_hint(RequestMethod method)
+{
+    uint64_t hint_words = request_size_stats[method].hint_words;
+    if (!adaptive_request_sizing || hint_words == 0) {
+        return nullptr;
+    }
+    return capnp::MessageSize{hint_words, 0};
+}
+
+static uint32_t request_size_bucket(uint64_t words)
+{
+    uint32_t bucket = 0;
+    while (bucket < REQUEST_SIZE_BUCKETS - 1 && (1ull << bucket) < words) {
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * record the size of a built request. the rpc system allocates the request segments out of reach of
+ * the module, so the segment counters are modeled on the capnp growth policy, where every new segment
+ * is at least as big as the message so far
+ */
+static void record_request_size(RequestMethod method, capnp::MessageSize size)
+{
+    RequestSizeStats& stats = request_size_stats[method];
+    uint64_t words = size.wordCount + 1;    // + root pointer
+
+    uint64_t segment_words = adaptive_request_sizing && stats.hint_words != 0 ? stats.hint_words : REQUEST_DEFAULT_FIRST_SEGMENT_WORDS;
+    uint64_t total_words = segment_words;
+    stats.modeled_segments++;
+    while (total_words < words) {
+        segment_words = total_words > words - total_words ? total_words : words - total_words;
+        total_words += segment_words;
+        stats.modeled_segments++;
+    }
+    stats.modeled_words += total_words;
+    stats.message_words += words;
+    stats.requests++;
+
+    stats.buckets[request_size_bucket(words)]++;
+    if (++stats.samples >= REQUEST_SIZE_WINDOW) {
+        stats.samples = 0;
+        for (uint32_t b = 0; b < REQUEST_SIZE_BUCKETS; b++) {
+            stats.buckets[b] /= 2;
+            stats.samples += stats.buckets[b];
+        }
+    }
+
+    uint32_t covered = 0;
+    for (uint32_t b = 0; b < REQUEST_SIZE_BUCKETS; b++) {
+        covered += stats.buckets[b];
+        if (covered >= stats.samples * REQUEST_SIZE_COVERAGE) {
+            stats.hint_words = 1ull << b;
+            break;
+        }
+    }
+}
 static uint16_t server_port = 0;
 
 static const char* format_win_characters(const char* message)
@@ -91,14 +442,235 @@ static const char* format_win_characters(const char* message)
     return message;
 }
 
-static CapnpClient* create_ue_core_client()
-{
-    CapnpClient* rpc_client = (CapnpClient*)malloc(sizeof(CapnpClient));
-    if (rpc_client == NULL) {
-        return NULL;
+#ifdef UNREAL_CORE_TESTING
+static void echo_packed_param(UnrealCore::CallFunctionPackedParams::Reader request, UnrealCore::Argument::Builder result);
+
+// python callable answering callStaticFunction on the stand-in server, see set_loopback_static_function_handler
+static PyObject* loopback_static_function_handler = NULL;
+static bool answer_loopback_static_function(UnrealCore::CallStaticFunctionParams::Reader params, UnrealCore::CallStaticFunctionResults::Builder results);
+
+// class hierarchies answered by getClassHierarchy on the stand-in server, see set_loopback_class_hierarchy.
+// classes missing from it derive straight from Object
+typedef struct {
+    std::vector<std::string> parents;
+    std::vector<std::string> interfaces;
+} LoopbackClassHierarchy;
+
+static std::unordered_map<std::string, LoopbackClassHierarchy> loopback_class_hierarchies;
+
+/**
+ * in-process stand-in for the unreal engine rpc server, answers every call with an empty result,
+ * except callFunction / callFunctionPacked which echo their first param back as the return value, callStaticFunction
+ * which asks the python handler when one is set, getProperty which reads back what setProperty stored,
+ * staticClass which answers the class an object was created with, getClassHierarchy which reads
+ * loopback_class_hierarchies, and dumpReflection which describes the UE.py test classes.
+ * used to measure the client side overhead without running unreal engine
+ */
+// reflection of the UE.py test classes, answered by the stand-in server for generate_bindings.py
+static const char* LOOPBACK_REFLECTION_DUMP = R"json({
+    "classes": [
+        {"name": "Object", "parent": null, "interfaces": [], "properties": [], "functions": []},
+        {"name": "MyObject", "parent": "Object", "interfaces": [],
+         "properties": [
+            {"name": "Health", "type": "float"},
+            {"name": "DisplayName", "type": "str"}
+         ],
+         "functions": [
+            {"name": "Add", "params": [{"name": "a", "type": "int"}, {"name": "b", "type": "int"}], "return": "int"},
+            {"name": "TestVector", "params": [{"name": "Vector", "type": "Vector"}], "return": "Vector"},
+            {"name": "TestEnum", "params": [{"name": "Enum", "type": "MyEnum"}], "return": "MyEnum"},
+            {"name": "MakeDefault", "params": [], "return": "MyObject", "static": true}
+         ]}
+    ],
+    "enums": [
+        {"name": "MyEnum", "values": {"TEST": 0, "TEST2": 1, "TEST3": 2}}
+    ],
+    "structs": [
+        {"name": "HitResult", "fields": [
+            {"name": "Actor", "type": "Object"},
+            {"name": "Distance", "type": "float"},
+            {"name": "Location", "type": "Vector"}
+        ]}
+    ]
+})json";
+
+class LoopbackUnrealCore final : public UnrealCore::Server {
+protected:
+    kj::Promise<void> newObject(NewObjectContext context) override
+    {
+        auto params = context.getParams();
+        auto object = context.getResults().initObject();
+        object.setName(params.getObjName());
+        object.setAddress(params.getOwn().getAddress());
+        object_classes[params.getOwn().getAddress()] = params.getUeClass().getTypeName().cStr();
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> staticClass(StaticClassContext context) override
+    {
+        auto it = object_classes.find(context.getParams().getObject().getAddress());
+        context.getResults().initUeClass().setTypeName(it == object_classes.end() ? "Object" : it->second);
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> getClassHierarchy(GetClassHierarchyContext context) override
+    {
+        capnp::Text::Reader class_name = context.getParams().getUeClass().getTypeName();
+        auto results = context.getResults();
+        auto it = loopback_class_hierarchies.find(std::string(class_name.cStr(), class_name.size()));
+        if (it == loopback_class_hierarchies.end()) {
+            if (class_name != "Object") {
+                results.initParents(1).set(0, "Object");
+            }
+            return kj::READY_NOW;
+        }
+
+        const LoopbackClassHierarchy& hierarchy = it->second;
+        auto parents = results.initParents(hierarchy.parents.size());
+        for (size_t i = 0; i < hierarchy.parents.size(); i++) {
+            parents.set(i, hierarchy.parents[i]);
+        }
+        auto interfaces = results.initInterfaces(hierarchy.interfaces.size());
+        for (size_t i = 0; i < hierarchy.interfaces.size(); i++) {
+            interfaces.set(i, hierarchy.interfaces[i]);
+        }
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> destroyObject(DestroyObjectContext context) override
+    {
+        context.getResults().setResult(true);
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> callFunction(CallFunctionContext context) override
+    {
+        auto params = context.getParams().getParams();
+        if (params.size() > 0 && params[0].isObject()) {
+            echo_object(params[0].getObject().getAddress(), context.getResults().initReturn());
+        }
+        else if (params.size() > 0) {
+            context.getResults().setReturn(params[0]);
+        }
+        else {
+            context.getResults().initReturn().initUeClass().setTypeName("void");
+        }
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> callFunctionPacked(CallFunctionPackedContext context) override
+    {
+        UnrealCore::PackedParams::Reader params = context.getParams().getParams();
+        if (params.getTags().size() > 0 && params.getTags()[0] == UnrealCore::PackedTag::OBJECT) {
+            echo_object(params.getObjects()[0], context.getResults().initReturn());
+        }
+        else {
+            echo_packed_param(context.getParams(), context.getResults().initReturn());
+        }
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> getFeatures(GetFeaturesContext context) override
+    {
+        context.getResults().setFeatures(SERVER_FEATURE_PACKED_PARAMS | SERVER_FEATURE_UTF16_STRINGS);
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> dumpReflection(DumpReflectionContext context) override
+    {
+        context.getResults().setDump(LOOPBACK_REFLECTION_DUMP);
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> callStaticFunction(CallStaticFunctionContext context) override
+    {
+        if (loopback_static_function_handler != NULL) {
+            if (!answer_loopback_static_function(context.getParams(), context.getResults())) {
+                return KJ_EXCEPTION(FAILED, "loopback static function handler failed");
+            }
+            return kj::READY_NOW;
+        }
+        context.getResults().initReturn().initUeClass().setTypeName("void");
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> setProperty(SetPropertyContext context) override
+    {
+        auto params = context.getParams();
+        auto property = params.getProperty();
+        kj::Own<capnp::MallocMessageBuilder>& stored = properties[property_key(params.getOwner().getAddress(), property.getName())];
+        stored = kj::heap<capnp::MallocMessageBuilder>();
+        stored->setRoot(property);
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> getProperty(GetPropertyContext context) override
+    {
+        auto params = context.getParams();
+        auto it = properties.find(property_key(params.getOwner().getAddress(), params.getPropertyName()));
+        if (it == properties.end()) {
+            context.getResults().initProperty().initUeClass().setTypeName("void");
+        }
+        else {
+            context.getResults().setProperty(it->second->getRoot<UnrealCore::Argument>().asReader());
+        }
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> registerCreatedPyObject(RegisterCreatedPyObjectContext context) override
+    {
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> newContainer(NewContainerContext context) override
+    {
+        context.getResults().initContainer().setAddress(context.getParams().getOwn().getAddress());
+        return kj::READY_NOW;
+    }
+
+    kj::Promise<void> destroyContainer(DestroyContainerContext context) override
+    {
+        context.getResults().setResult(true);
+        return kj::READY_NOW;
     }
 
-    std::memset(rpc_client, 0, sizeof(CapnpClient));
+private:
+    // objects created with newObject come back with their class, others as a void return
+    void echo_object(uint64_t address, UnrealCore::Argument::Builder result)
+    {
+        auto it = object_classes.find(address);
+        if (it == object_classes.end()) {
+            result.initUeClass().setTypeName("void");
+            return;
+        }
+        result.initUeClass().setTypeName(it->second);
+        result.initObject().setAddress(address);
+    }
+
+    static std::string property_key(uint64_t owner, capnp::Text::Reader name)
+    {
+        std::string key = std::to_string(owner);
+        key.push_back('.');
+        key.append(name.cStr(), name.size());
+        return key;
+    }
+
+    std::unordered_map<std::string, kj::Own<capnp::MallocMessageBuilder>> properties;
+    std::unordered_map<uint64_t, std::string> object_classes;
+};
+
+static CapnpClient* create_loopback_ue_core_client()
+{
+    CapnpClient* rpc_client = new CapnpClient();
+    rpc_client->name = "unreal_core_loopback_client";
+    rpc_client->ue_core = UnrealCore::Client(kj::heap<LoopbackUnrealCore>());
+    return rpc_client;
+}
+#endif  // UNREAL_CORE_TESTING
+
+static CapnpClient* create_ue_core_client()
+{
+    CapnpClient* rpc_client = new CapnpClient();
 
     rpc_client->name = "unreal_core_client";
     kj::Network& network = io_context.provider->getNetwork();
@@ -123,6 +695,7 @@ static CapnpClient* create_ue_core_client()
 
             // create and save rpc client
             rpc_client->client = kj::heap<capnp::TwoPartyClient>(*rpc_client->connection);
+            rpc_client->ue_core = rpc_client->client->bootstrap().castAs<UnrealCore>();
 
             server_port = port;
 
@@ -150,7 +723,7 @@ static CapnpClient* create_ue_core_client()
 
     if (server_port == 0) {
         printf("connect to unreal engine rpc server failed\n");
-        free(rpc_client);
+        delete rpc_client;
         rpc_client = NULL;
         return NULL;
     }
@@ -158,6 +731,80 @@ static CapnpClient* create_ue_core_client()
     return rpc_client;
 }
 
+/**
+ * Class hierarchy
+ * ue class names are interned to dense ids. the first is_a on an object of a class fetches the parent
+ * chain and interfaces of that class once (getClassHierarchy) and keeps them as a bit set over the
+ * class ids, every later check is a single bit test, without an rpc
+ */
+#define CLASS_ID_UNKNOWN -1
+
+typedef struct {
+    bool fetched;
+    std::vector<uint64_t> ancestors;    // bit i is set when the class is, derives from or implements class i
+} ClassHierarchy;
+
+static std::unordered_map<std::string, int32_t> class_ids;
+static std::vector<std::string> class_names;            // indexed by class id
+static std::vector<ClassHierarchy> class_hierarchies;   // indexed by class id
+static std::string class_id_key;    // reused to look up a class name without allocating
+
+static int32_t intern_class_id(const char* name, size_t length)
+{
+    class_id_key.assign(name, length);
+    auto it = class_ids.find(class_id_key);
+    if (it != class_ids.end()) {
+        return it->second;
+    }
+
+    int32_t class_id = (int32_t)class_names.size();
+    class_ids.emplace(class_id_key, class_id);
+    class_names.push_back(class_id_key);
+    class_hierarchies.push_back(ClassHierarchy{false, {}});
+    return class_id;
+}
+
+static void set_ancestor_bit(std::vector<uint64_t>& ancestors, int32_t class_id)
+{
+    size_t word = (size_t)class_id >> 6;
+    if (ancestors.size() <= word) {
+        ancestors.resize(word + 1, 0);
+    }
+    ancestors[word] |= 1ull << (class_id & 63);
+}
+
+/**
+ * ancestor bit set of class_id, asked from the server the first time. NULL with a python error when the rpc fails
+ */
+static const ClassHierarchy* fetch_class_hierarchy(int32_t class_id)
+{
+    if (class_hierarchies[class_id].fetched) {
+        return &class_hierarchies[class_id];
+    }
+
+    auto hierarchy_request = ue_core_client->ue_core.getClassHierarchyRequest(request_size_hint(REQUEST_GET_CLASS_HIERARCHY));
+    hierarchy_request.initUeClass().setTypeName(class_names[class_id]);
+    record_request_size(REQUEST_GET_CLASS_HIERARCHY, hierarchy_request.totalSize());
+
+    std::vector<uint64_t> ancestors;
+    set_ancestor_bit(ancestors, class_id);
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        auto response = hierarchy_request.send().wait(io_context.waitScope);
+        for (capnp::Text::Reader parent : response.getParents()) {
+            set_ancestor_bit(ancestors, intern_class_id(parent.cStr(), parent.size()));
+        }
+        for (capnp::Text::Reader interface_name : response.getInterfaces()) {
+            set_ancestor_bit(ancestors, intern_class_id(interface_name.cStr(), interface_name.size()));
+        }
+    })
+
+    // interning the parents may have grown the table, index it again
+    ClassHierarchy& hierarchy = class_hierarchies[class_id];
+    hierarchy.fetched = true;
+    hierarchy.ancestors = std::move(ancestors);
+    return &hierarchy;
+}
+
 /**
  * Unreal Object
  */
@@ -165,6 +812,7 @@ typedef struct {
     PyObject_HEAD
     char* name;
     uint64_t address;
+    int32_t class_id;   // interned ue class of the object, CLASS_ID_UNKNOWN until returned with one or asked by is_a
 } UnrealObject;
 
 static PyObject* UnrealObject_repr(UnrealObject* self)
@@ -175,15 +823,8 @@ static PyObject* UnrealObject_repr(UnrealObject* self)
     return PyUnicode_FromFormat("UnrealObject(name=%s, address=0x%016llx)", self->name, self->address);
 }
 
-static int UnrealObject_init(UnrealObject* self, PyObject* args)
+static int UnrealObject_setup(UnrealObject* self, uint64_t address, const char* name)
 {
-    const char* name = NULL;
-    uint64_t address = 0;
-
-    if (!PyArg_ParseTuple(args, "K|s", &address, &name)) {
-        return -1;
-    }
-    
     if (name != NULL) {
         self->name = deep_copy_str(name);
     }
@@ -192,15 +833,66 @@ static int UnrealObject_init(UnrealObject* self, PyObject* args)
     return 0;
 }
 
-static PyObject* UnrealObject_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+static int UnrealObject_init(UnrealObject* self, PyObject* args)
 {
-    UnrealObject* self = (UnrealObject*)type->tp_alloc(type, 0);
-    if (self != NULL) {
-        self->name = "";
-        self->address = 0;
+    const char* name = NULL;
+    uint64_t address = 0;
+
+    if (!PyArg_ParseTuple(args, "K|s", &address, &name)) {
+        return -1;
+    }
+
+    return UnrealObject_setup(self, address, name);
+}
+
+static PyObject* UnrealObject_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    UnrealObject* self = (UnrealObject*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->name = NULL;
+        self->address = 0;
+        self->class_id = CLASS_ID_UNKNOWN;
+    }
+    return (PyObject*)self;
+}
+
+#if PY_VERSION_HEX >= 0x03090000
+/**
+ * UnrealObject(address, name=None) without building an args tuple
+ */
+static PyObject* UnrealObject_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        PyErr_SetString(PyExc_TypeError, "UnrealObject() takes no keyword arguments");
+        return NULL;
+    }
+    if (!check_positional_args("UnrealObject", nargs, 1, 2)) {
+        return NULL;
+    }
+    if (!PyLong_Check(args[0])) {
+        PyErr_Format(PyExc_TypeError, "UnrealObject() argument 1 must be int, not %.200s", Py_TYPE(args[0])->tp_name);
+        return NULL;
+    }
+
+    uint64_t address = PyLong_AsUnsignedLongLongMask(args[0]);
+    if (address == (uint64_t)-1 && PyErr_Occurred()) {
+        return NULL;
+    }
+
+    const char* name = NULL;
+    if (nargs > 1 && (name = unpack_str_arg("UnrealObject", args, 1)) == NULL) {
+        return NULL;
+    }
+
+    UnrealObject* self = (UnrealObject*)UnrealObject_new((PyTypeObject*)type, NULL, NULL);
+    if (self == NULL) {
+        return NULL;
     }
+    UnrealObject_setup(self, address, name);
     return (PyObject*)self;
 }
+#endif
 
 static void UnrealObject_dealloc(UnrealObject* self)
 {
@@ -252,6 +944,48 @@ static PyTypeObject UnrealObject_Type = {
     UnrealObject_new,                  /* tp_new */
 };
 
+/**
+ * class id of unreal_object, asked once with staticClass when the object did not come with its class.
+ * CLASS_ID_UNKNOWN with a python error when the rpc fails
+ */
+static int32_t unreal_object_class_id(UnrealObject* unreal_object)
+{
+    if (unreal_object->class_id != CLASS_ID_UNKNOWN) {
+        return unreal_object->class_id;
+    }
+
+    auto static_class_request = ue_core_client->ue_core.staticClassRequest(request_size_hint(REQUEST_STATIC_CLASS));
+    static_class_request.initObject().setAddress(unreal_object->address);
+    record_request_size(REQUEST_STATIC_CLASS, static_class_request.totalSize());
+    try {
+        auto response = static_class_request.send().wait(io_context.waitScope);
+        capnp::Text::Reader class_name = response.getUeClass().getTypeName();
+        unreal_object->class_id = intern_class_id(class_name.cStr(), class_name.size());
+    } catch (kj::Exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.getDescription().cStr());
+        return CLASS_ID_UNKNOWN;
+    }
+    return unreal_object->class_id;
+}
+
+/**
+ * 1 when unreal_object is, derives from or implements class_id, 0 when not, -1 with a python error
+ */
+static int unreal_object_is_a(UnrealObject* unreal_object, int32_t class_id)
+{
+    int32_t object_class_id = unreal_object_class_id(unreal_object);
+    if (object_class_id == CLASS_ID_UNKNOWN) {
+        return -1;
+    }
+    const ClassHierarchy* hierarchy = fetch_class_hierarchy(object_class_id);
+    if (hierarchy == NULL) {
+        return -1;
+    }
+
+    size_t word = (size_t)class_id >> 6;
+    return word < hierarchy->ancestors.size() && (hierarchy->ancestors[word] >> (class_id & 63)) & 1;
+}
+
 /*
  * Class
  */
@@ -284,6 +1018,9 @@ static int ClassProp_init(ClassProp* self, PyObject* args, PyObject* kwargs)
 static PyObject* ClassProp_new(PyTypeObject* type, PyObject* args, PyObject* kwds) 
 {
     ClassProp* self = (ClassProp*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        new (&self->type_name) std::string();
+    }
     return (PyObject*)self;
 }
 
@@ -335,922 +1072,7116 @@ static PyTypeObject ClassProp_Type = {
 };
 
 /*
- * Property
+ * Value structs
+ * USTRUCT values that live on the client and travel by value inside the call message,
+ * instead of as remote objects behind an address
  */
-typedef enum {
-    ARGUMENT_TYPE_BOOL = 0,
-    ARGUMENT_TYPE_UINT = 1,
-    ARGUMENT_TYPE_INT = 2,
-    ARGUMENT_TYPE_FLOAT = 3,
-    ARGUMENT_TYPE_STRING = 4,
-    ARGUMENT_TYPE_ENUM = 5,
-    ARGUMENT_TYPE_OBJECT = 6,
-} ArgumentType;
+typedef struct {
+    PyObject_HEAD
+    Vector2DValue value;
+} Vector2D;
 
 typedef struct {
     PyObject_HEAD
-    ClassProp* ue_class;
-    std::string name;
-    ArgumentType value_type;
-    union {
-        bool bool_value;
-        uint64_t uint_value;
-        int64_t int_value;
-        double float_value;
-        const char* str_value;
-        int64_t enum_value;
-        PyObject* object;
-    };
-} Argument;
+    VectorValue value;
+} Vector;
 
-static PyObject* Argument_repr(Argument* self)
+typedef struct {
+    PyObject_HEAD
+    RotatorValue value;
+} Rotator;
+
+typedef struct {
+    PyObject_HEAD
+    QuatValue value;
+} Quat;
+
+typedef struct {
+    PyObject_HEAD
+    TransformValue value;
+} Transform;
+
+static const char* vector2d_field_names[] = {"X", "Y"};
+static const char* vector_field_names[] = {"X", "Y", "Z"};
+static const char* rotator_field_names[] = {"Pitch", "Yaw", "Roll"};
+static const char* quat_field_names[] = {"X", "Y", "Z", "W"};
+
+template <typename T, typename V>
+static PyObject* new_value_object(PyTypeObject* type, const V& value)
 {
-    switch (self->value_type) {
-        case ARGUMENT_TYPE_BOOL:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, bool_value=%d)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->bool_value);
-        case ARGUMENT_TYPE_UINT:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, uint_value=%lld)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->uint_value);
-        case ARGUMENT_TYPE_INT:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, int_value=%lld)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->int_value);
-        case ARGUMENT_TYPE_FLOAT:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, float_value=%f)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->float_value);
-        case ARGUMENT_TYPE_STRING:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, str_value=%s)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->str_value);
-        case ARGUMENT_TYPE_ENUM:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, enum_value=%lld)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->enum_value);
-        case ARGUMENT_TYPE_OBJECT:
-            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, object=0x%llx)", 
-                self->name, self->ue_class->type_name.c_str(), self->value_type, self->object); 
+    T* self = PyObject_New(T, type);
+    if (self != NULL) {
+        self->value = value;
     }
+    return (PyObject*)self;
 }
 
-static int Argument_init(Argument* self, PyObject* args)
+static bool check_value_type(PyObject* value, PyTypeObject* type)
 {
-    char* name = NULL;    
-    ClassProp* ue_class = NULL;
-    PyObject* value = NULL;
-    char* value_type = NULL;
-    if (!PyArg_ParseTuple(args, "sO!O|s", &name, &ClassProp_Type, &ue_class, &value, &value_type)) {
-        return -1;
-    }
-    if (ue_class == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, "ue_class is required");
-        return -1;
+    if (!PyObject_TypeCheck(value, type)) {
+        PyErr_Format(PyExc_TypeError, "expected %.200s, not %.200s", type->tp_name, Py_TYPE(value)->tp_name);
+        return false;
     }
+    return true;
+}
 
-    if (ue_class->type_name.empty()) {
-        PyErr_SetString(PyExc_RuntimeError, "ue_class is not initialized");
-        return -1;
+// "X=1, Y=2" into buffer, returns the written length
+static int format_value_fields(char* buffer, size_t buffer_size, const char** names, const double* values, size_t count)
+{
+    int written = 0;
+    for (size_t i = 0; i < count && (size_t)written < buffer_size; i++) {
+        written += snprintf(buffer + written, buffer_size - written, "%s%s=%.17g", i > 0 ? ", " : "", names[i], values[i]);
     }
+    return written;
+}
 
-    self->name = std::move(std::string(name));
-    self->ue_class = ue_class;
+template <typename T>
+static PyObject* ValueStruct_repr(PyObject* self, const char* type_name, const char** names)
+{
+    char fields[256];
+    format_value_fields(fields, sizeof(fields), names, (const double*)&((T*)self)->value, sizeof(((T*)self)->value) / sizeof(double));
+    return PyUnicode_FromFormat("%s(%s)", type_name, fields);
+}
 
-    if (value == NULL) {
-        return 0;
+// values compare field by field, so 0.0 == -0.0 and nan != nan as for float
+template <typename T>
+static PyObject* ValueStruct_richcompare(PyObject* self, PyObject* other, int op)
+{
+    if ((op != Py_EQ && op != Py_NE) || !PyObject_TypeCheck(other, Py_TYPE(self))) {
+        Py_RETURN_NOTIMPLEMENTED;
     }
 
-    if (PyBool_Check(value))
-    {
-        self->value_type = ARGUMENT_TYPE_BOOL;
-        self->bool_value = PyObject_IsTrue(value);
+    const double* a = (const double*)&((T*)self)->value;
+    const double* b = (const double*)&((T*)other)->value;
+    bool equal = true;
+    for (size_t i = 0; i < sizeof(((T*)self)->value) / sizeof(double) && equal; i++) {
+        equal = a[i] == b[i];
     }
-    else if (PyLong_Check(value)) {
+    if (equal == (op == Py_EQ)) {
+        Py_RETURN_TRUE;
+    }
+    Py_RETURN_FALSE;
+}
 
-        // special case: enum
-        if (value_type != NULL && strcmp(value_type, "enum") == 0) {
-            self->value_type = ARGUMENT_TYPE_ENUM;     
-            self->enum_value = PyLong_AsLongLong(value); 
-        }
-        else {
-            self->value_type = ARGUMENT_TYPE_INT;
-            self->int_value = PyLong_AsLongLong(value);    
-        }
+static PyObject* Vector2D_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"X", "Y", NULL};
+    Vector2DValue value = {0.0, 0.0};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|dd:Vector2D", (char**)kwlist, &value.X, &value.Y)) {
+        return NULL;
     }
-    else if (PyFloat_Check(value)) {
 
-        // special case: int
-        if (value_type != NULL && strcmp(value_type, "int") == 0) {
-            self->value_type = ARGUMENT_TYPE_INT;
-            self->int_value = PyLong_AsLong(PyNumber_Long(value)); // convert float to int
-        }
-        else {
-            self->value_type = ARGUMENT_TYPE_FLOAT;
-            self->float_value = PyFloat_AsDouble(value);
-        }
+    Vector2D* self = (Vector2D*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->value = value;
     }
-    else if (PyUnicode_Check(value)) {
-        self->value_type = ARGUMENT_TYPE_STRING;
-        self->str_value = PyUnicode_AsUTF8(value);
+    return (PyObject*)self;
+}
+
+static PyObject* Vector_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"X", "Y", "Z", NULL};
+    VectorValue value = {0.0, 0.0, 0.0};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|ddd:Vector", (char**)kwlist, &value.X, &value.Y, &value.Z)) {
+        return NULL;
     }
-    else if (is_enum_type(value)) {
-        printf("enum type\n");
-        PyObject* enum_value = PyObject_GetAttrString(value, "value");
-        if (!value) {
-            PyErr_SetString(PyExc_RuntimeError, "Can not read the value of enum object");
-            return -1;
-        }
-        self->value_type = ARGUMENT_TYPE_ENUM;
-        self->enum_value = PyLong_AsLongLong(enum_value);
-        printf("enum value: %lld\n", self->enum_value);
+
+    Vector* self = (Vector*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->value = value;
     }
-    else {
-        // todo@Caleb196x: implement special type such as list, set or map
-        self->value_type = ARGUMENT_TYPE_OBJECT;
-        self->object = value;
-        Py_INCREF(self->object);
+    return (PyObject*)self;
+}
+
+static PyObject* Rotator_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"Pitch", "Yaw", "Roll", NULL};
+    RotatorValue value = {0.0, 0.0, 0.0};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|ddd:Rotator", (char**)kwlist, &value.Pitch, &value.Yaw, &value.Roll)) {
+        return NULL;
     }
 
-    return 0;
+    Rotator* self = (Rotator*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->value = value;
+    }
+    return (PyObject*)self;
 }
 
-static PyObject* Argument_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+static PyObject* Quat_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
 {
-    Argument* self;
-    self = (Argument*)type->tp_alloc(type, 0);
+    // identity by default, as FQuat::Identity
+    static const char* kwlist[] = {"X", "Y", "Z", "W", NULL};
+    QuatValue value = {0.0, 0.0, 0.0, 1.0};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|dddd:Quat", (char**)kwlist, &value.X, &value.Y, &value.Z, &value.W)) {
+        return NULL;
+    }
+
+    Quat* self = (Quat*)type->tp_alloc(type, 0);
     if (self != NULL) {
-        self->name = "";
-        self->ue_class = NULL;
-        self->value_type = ARGUMENT_TYPE_BOOL;
-        self->bool_value = false;
-        self->uint_value = 0;
-        self->float_value = 0.0;
-        self->str_value = NULL;
-        self->enum_value = 0;
-        self->object = NULL;
+        self->value = value;
     }
     return (PyObject*)self;
 }
 
-static void Argument_dealloc(Argument* self)
+static PyObject* Vector2D_repr(PyObject* self)
 {
-    if (self->value_type == ARGUMENT_TYPE_OBJECT)
-    {
-        Py_DECREF(self->object);
-    }
+    return ValueStruct_repr<Vector2D>(self, "Vector2D", vector2d_field_names);
+}
 
-    Py_TYPE(self)->tp_free((PyObject*)self);
+static PyObject* Vector_repr(PyObject* self)
+{
+    return ValueStruct_repr<Vector>(self, "Vector", vector_field_names);
+}
+
+static PyObject* Rotator_repr(PyObject* self)
+{
+    return ValueStruct_repr<Rotator>(self, "Rotator", rotator_field_names);
+}
+
+static PyObject* Quat_repr(PyObject* self)
+{
+    return ValueStruct_repr<Quat>(self, "Quat", quat_field_names);
 }
 
+static PyMemberDef Vector2D_members[] = {
+    {"X", T_DOUBLE, offsetof(Vector2D, value.X), 0, NULL},
+    {"Y", T_DOUBLE, offsetof(Vector2D, value.Y), 0, NULL},
+    {NULL}
+};
 
-static PyTypeObject Argument_Type = {
+static PyMemberDef Vector_members[] = {
+    {"X", T_DOUBLE, offsetof(Vector, value.X), 0, NULL},
+    {"Y", T_DOUBLE, offsetof(Vector, value.Y), 0, NULL},
+    {"Z", T_DOUBLE, offsetof(Vector, value.Z), 0, NULL},
+    {NULL}
+};
+
+static PyMemberDef Rotator_members[] = {
+    {"Pitch", T_DOUBLE, offsetof(Rotator, value.Pitch), 0, NULL},
+    {"Yaw", T_DOUBLE, offsetof(Rotator, value.Yaw), 0, NULL},
+    {"Roll", T_DOUBLE, offsetof(Rotator, value.Roll), 0, NULL},
+    {NULL}
+};
+
+static PyMemberDef Quat_members[] = {
+    {"X", T_DOUBLE, offsetof(Quat, value.X), 0, NULL},
+    {"Y", T_DOUBLE, offsetof(Quat, value.Y), 0, NULL},
+    {"Z", T_DOUBLE, offsetof(Quat, value.Z), 0, NULL},
+    {"W", T_DOUBLE, offsetof(Quat, value.W), 0, NULL},
+    {NULL}
+};
+
+static PyTypeObject Vector2D_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
-    "unreal_core.Argument",           /* tp_name */
-    sizeof(Argument),                 /* tp_basicsize */
+    "unreal_core.Vector2D",        /* tp_name */
+    sizeof(Vector2D),              /* tp_basicsize */
     0,                             /* tp_itemsize */
-    (destructor)Argument_dealloc,  /* tp_dealloc */
+    0,                             /* tp_dealloc */
     0,                             /* tp_print */
     0,                             /* tp_getattr */
     0,                             /* tp_setattr */
     0,                             /* tp_reserved */
-    (reprfunc)Argument_repr,         /* tp_repr */
+    (reprfunc)Vector2D_repr,       /* tp_repr */
     0,                             /* tp_as_number */
     0,                             /* tp_as_sequence */
     0,                             /* tp_as_mapping */
     0,                             /* tp_hash */
     0,                             /* tp_call */
-    (reprfunc)Argument_repr,       /* tp_str */
+    0,                             /* tp_str */
     0,                             /* tp_getattro */
     0,                             /* tp_setattro */
     0,                             /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,           /* tp_flags */
-    "Unreal Engine Argument",        /* tp_doc */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  /* tp_flags */
+    "FVector2D value",             /* tp_doc */
     0,                             /* tp_traverse */
     0,                             /* tp_clear */
-    0,                             /* tp_richcompare */
+    ValueStruct_richcompare<Vector2D>,  /* tp_richcompare */
     0,                             /* tp_weaklistoffset */
     0,                             /* tp_iter */
     0,                             /* tp_iternext */
     0,                             /* tp_methods */
-    0,                             /* tp_members */
+    Vector2D_members,              /* tp_members */
     0,                             /* tp_getset */
     0,                             /* tp_base */
     0,                             /* tp_dict */
     0,                             /* tp_descr_get */
     0,                             /* tp_descr_set */
     0,                             /* tp_dictoffset */
-    (initproc)Argument_init,         /* tp_init */
-    0,
-    Argument_new
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    Vector2D_new,                  /* tp_new */
 };
 
-typedef struct {
-    PyObject_HEAD
-    const char* name;
-} Method;
-
-static PyObject* Method_repr(Method* self)
-{
-    if (self->name == NULL) {
-        return PyUnicode_FromFormat("Method(name=NULL)");
-    }
-    return PyUnicode_FromFormat("Method(name=%s)", self->name);
-}
-
-static int Method_init(Method* self, PyObject* args, PyObject* kwargs)
-{
-    char* name = NULL;
-    if (!PyArg_ParseTuple(args, "s", &name)) {
-        return -1;
-    }
-    self->name = name;
-    return 0;
-}
-
-static PyTypeObject Method_Type = {
+static PyTypeObject Vector_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
-    "unreal_core.Method",           /* tp_name */
-    sizeof(Method),                 /* tp_basicsize */
+    "unreal_core.Vector",          /* tp_name */
+    sizeof(Vector),                /* tp_basicsize */
     0,                             /* tp_itemsize */
     0,                             /* tp_dealloc */
     0,                             /* tp_print */
     0,                             /* tp_getattr */
     0,                             /* tp_setattr */
     0,                             /* tp_reserved */
-    (reprfunc)Method_repr,         /* tp_repr */
+    (reprfunc)Vector_repr,         /* tp_repr */
     0,                             /* tp_as_number */
     0,                             /* tp_as_sequence */
     0,                             /* tp_as_mapping */
     0,                             /* tp_hash */
     0,                             /* tp_call */
-    (reprfunc)Method_repr,         /* tp_str */
+    0,                             /* tp_str */
     0,                             /* tp_getattro */
     0,                             /* tp_setattro */
     0,                             /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT,           /* tp_flags */
-    "Unreal Engine Method",        /* tp_doc */ 
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  /* tp_flags */
+    "FVector value",               /* tp_doc */
     0,                             /* tp_traverse */
     0,                             /* tp_clear */
-    0,                             /* tp_richcompare */
+    ValueStruct_richcompare<Vector>,  /* tp_richcompare */
     0,                             /* tp_weaklistoffset */
     0,                             /* tp_iter */
     0,                             /* tp_iternext */
     0,                             /* tp_methods */
-    0,                             /* tp_members */
+    Vector_members,                /* tp_members */
     0,                             /* tp_getset */
     0,                             /* tp_base */
     0,                             /* tp_dict */
     0,                             /* tp_descr_get */
     0,                             /* tp_descr_set */
     0,                             /* tp_dictoffset */
-    (initproc)Method_init,         /* tp_init */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    Vector_new,                    /* tp_new */
 };
 
-static bool create_unreal_rpc_argument(PyObject* py_argument, UnrealCore::Argument::Builder& unreal_core_argument)
-{
-    if (!PyObject_TypeCheck(py_argument, &Argument_Type)) {
-        return false;
-    }
-
-    Argument* argument = (Argument*)py_argument;
-    unreal_core_argument.setName(argument->name);
-    unreal_core_argument.initUeClass().setTypeName(argument->ue_class->type_name);
+static PyTypeObject Rotator_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.Rotator",         /* tp_name */
+    sizeof(Rotator),               /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    0,                             /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)Rotator_repr,        /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  /* tp_flags */
+    "FRotator value, in degrees",  /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    ValueStruct_richcompare<Rotator>,  /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    Rotator_members,               /* tp_members */
+    0,                             /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    0,                             /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    Rotator_new,                   /* tp_new */
+};
+
+static PyTypeObject Quat_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.Quat",            /* tp_name */
+    sizeof(Quat),                  /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    0,                             /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)Quat_repr,           /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  /* tp_flags */
+    "FQuat value",                 /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    ValueStruct_richcompare<Quat>, /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    Quat_members,                  /* tp_members */
+    0,                             /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    0,                             /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    Quat_new,                      /* tp_new */
+};
+
+static PyObject* Transform_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    // identity by default, as FTransform::Identity
+    static const char* kwlist[] = {"Rotation", "Translation", "Scale3D", NULL};
+    PyObject* rotation = NULL;
+    PyObject* translation = NULL;
+    PyObject* scale = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|O!O!O!:Transform", (char**)kwlist,
+            &Quat_Type, &rotation, &Vector_Type, &translation, &Vector_Type, &scale)) {
+        return NULL;
+    }
+
+    Transform* self = (Transform*)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->value.Rotation = rotation != NULL ? ((Quat*)rotation)->value : QuatValue{0.0, 0.0, 0.0, 1.0};
+    self->value.Translation = translation != NULL ? ((Vector*)translation)->value : VectorValue{0.0, 0.0, 0.0};
+    self->value.Scale3D = scale != NULL ? ((Vector*)scale)->value : VectorValue{1.0, 1.0, 1.0};
+    return (PyObject*)self;
+}
+
+static PyObject* Transform_repr(Transform* self)
+{
+    char rotation[256];
+    char translation[256];
+    char scale[256];
+    format_value_fields(rotation, sizeof(rotation), quat_field_names, (const double*)&self->value.Rotation, 4);
+    format_value_fields(translation, sizeof(translation), vector_field_names, (const double*)&self->value.Translation, 3);
+    format_value_fields(scale, sizeof(scale), vector_field_names, (const double*)&self->value.Scale3D, 3);
+    return PyUnicode_FromFormat("Transform(Rotation=Quat(%s), Translation=Vector(%s), Scale3D=Vector(%s))",
+        rotation, translation, scale);
+}
+
+static PyObject* Transform_get_rotation(Transform* self, void* closure)
+{
+    return new_value_object<Quat>(&Quat_Type, self->value.Rotation);
+}
+
+static int Transform_set_rotation(Transform* self, PyObject* value, void* closure)
+{
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "can not delete Rotation");
+        return -1;
+    }
+    if (!check_value_type(value, &Quat_Type)) {
+        return -1;
+    }
+    self->value.Rotation = ((Quat*)value)->value;
+    return 0;
+}
+
+// closure is the offset of the vector in the transform value
+static PyObject* Transform_get_vector(Transform* self, void* closure)
+{
+    const VectorValue* vector = (const VectorValue*)((const char*)&self->value + (size_t)closure);
+    return new_value_object<Vector>(&Vector_Type, *vector);
+}
+
+static int Transform_set_vector(Transform* self, PyObject* value, void* closure)
+{
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "can not delete a transform vector");
+        return -1;
+    }
+    if (!check_value_type(value, &Vector_Type)) {
+        return -1;
+    }
+    *(VectorValue*)((char*)&self->value + (size_t)closure) = ((Vector*)value)->value;
+    return 0;
+}
+
+static PyGetSetDef Transform_getset[] = {
+    {"Rotation", (getter)Transform_get_rotation, (setter)Transform_set_rotation, NULL, NULL},
+    {"Translation", (getter)Transform_get_vector, (setter)Transform_set_vector, NULL, (void*)offsetof(TransformValue, Translation)},
+    {"Scale3D", (getter)Transform_get_vector, (setter)Transform_set_vector, NULL, (void*)offsetof(TransformValue, Scale3D)},
+    {NULL}
+};
+
+static PyTypeObject Transform_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.Transform",       /* tp_name */
+    sizeof(Transform),             /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    0,                             /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)Transform_repr,      /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  /* tp_flags */
+    "FTransform value, the members are copies",  /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    ValueStruct_richcompare<Transform>,  /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    0,                             /* tp_members */
+    Transform_getset,              /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    0,                             /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    Transform_new,                 /* tp_new */
+};
+
+/**
+ * value struct math, number protocol and methods over the ue_math.h kernels.
+ * results are always the base value type, as float arithmetic returns float for subclasses
+ */
+#define VALUE_LANES(T) ((int)(sizeof(((T*)NULL)->value) / sizeof(double)))
+
+// 1 and the value for int and float, 0 for other types, -1 on error
+static inline int unpack_scalar(PyObject* value, double* scalar)
+{
+    if (PyFloat_CheckExact(value)) {
+        *scalar = PyFloat_AS_DOUBLE(value);
+        return 1;
+    }
+    if (!PyFloat_Check(value) && !PyLong_Check(value)) {
+        return 0;
+    }
+    *scalar = PyFloat_AsDouble(value);
+    return (*scalar == -1.0 && PyErr_Occurred()) ? -1 : 1;
+}
+
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_add(PyObject* a, PyObject* b)
+{
+    if (!PyObject_TypeCheck(a, Type) || !PyObject_TypeCheck(b, Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_add<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, (const double*)&((T*)b)->value);
+    }
+    return (PyObject*)result;
+}
+
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_subtract(PyObject* a, PyObject* b)
+{
+    if (!PyObject_TypeCheck(a, Type) || !PyObject_TypeCheck(b, Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_sub<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, (const double*)&((T*)b)->value);
+    }
+    return (PyObject*)result;
+}
+
+// value * value component wise, value * scalar and scalar * value
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_multiply(PyObject* a, PyObject* b)
+{
+    bool a_is_value = PyObject_TypeCheck(a, Type);
+    bool b_is_value = PyObject_TypeCheck(b, Type);
+    if (a_is_value && b_is_value) {
+        T* result = PyObject_New(T, Type);
+        if (result != NULL) {
+            math_mul<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, (const double*)&((T*)b)->value);
+        }
+        return (PyObject*)result;
+    }
+
+    double scalar = 0.0;
+    int is_scalar = unpack_scalar(a_is_value ? b : a, &scalar);
+    if (is_scalar <= 0) {
+        if (is_scalar < 0) {
+            return NULL;
+        }
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_scale<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)(a_is_value ? a : b))->value, scalar);
+    }
+    return (PyObject*)result;
+}
+
+// value / value component wise and value / scalar
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_true_divide(PyObject* a, PyObject* b)
+{
+    if (!PyObject_TypeCheck(a, Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    if (PyObject_TypeCheck(b, Type)) {
+        T* result = PyObject_New(T, Type);
+        if (result != NULL) {
+            math_div<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, (const double*)&((T*)b)->value);
+        }
+        return (PyObject*)result;
+    }
+
+    double scalar = 0.0;
+    int is_scalar = unpack_scalar(b, &scalar);
+    if (is_scalar <= 0) {
+        if (is_scalar < 0) {
+            return NULL;
+        }
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    if (scalar == 0.0) {
+        PyErr_SetString(PyExc_ZeroDivisionError, "division by zero");
+        return NULL;
+    }
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_scale<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, 1.0 / scalar);
+    }
+    return (PyObject*)result;
+}
+
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_negative(PyObject* a)
+{
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_scale<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)a)->value, -1.0);
+    }
+    return (PyObject*)result;
+}
+
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_dot(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("dot", nargs, 1, 1) || !check_arg_type("dot", args, 0, Type)) {
+        return NULL;
+    }
+    return PyFloat_FromDouble(math_dot<VALUE_LANES(T)>((const double*)&((T*)self)->value, (const double*)&((T*)args[0])->value));
+}
+
+template <typename T>
+static PyObject* ValueStruct_size(PyObject* self, PyObject* unused)
+{
+    const double* value = (const double*)&((T*)self)->value;
+    return PyFloat_FromDouble(std::sqrt(math_dot<VALUE_LANES(T)>(value, value)));
+}
+
+template <typename T>
+static PyObject* ValueStruct_size_squared(PyObject* self, PyObject* unused)
+{
+    const double* value = (const double*)&((T*)self)->value;
+    return PyFloat_FromDouble(math_dot<VALUE_LANES(T)>(value, value));
+}
+
+// in place, False and unchanged when the value is too small, as FVector::Normalize
+template <typename T>
+static PyObject* ValueStruct_normalize(PyObject* self, PyObject* unused)
+{
+    double* value = (double*)&((T*)self)->value;
+    return PyBool_FromLong(math_normalize<VALUE_LANES(T)>(value, value));
+}
+
+// normalized copy, the zero vector when the value is too small as GetSafeNormal
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_normalized(PyObject* self, PyObject* unused)
+{
+    T* result = PyObject_New(T, Type);
+    if (result == NULL) {
+        return NULL;
+    }
+    if (!math_normalize<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)self)->value)) {
+        memset(&result->value, 0, sizeof(result->value));
+    }
+    return (PyObject*)result;
+}
+
+template <typename T, PyTypeObject* Type>
+static PyObject* ValueStruct_lerp(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("lerp", nargs, 2, 2) || !check_arg_type("lerp", args, 0, Type)) {
+        return NULL;
+    }
+    double alpha = PyFloat_AsDouble(args[1]);
+    if (alpha == -1.0 && PyErr_Occurred()) {
+        return NULL;
+    }
+    T* result = PyObject_New(T, Type);
+    if (result != NULL) {
+        math_lerp<VALUE_LANES(T)>((double*)&result->value, (const double*)&((T*)self)->value, (const double*)&((T*)args[0])->value, alpha);
+    }
+    return (PyObject*)result;
+}
+
+static PyObject* Vector2D_cross(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("cross", nargs, 1, 1) || !check_arg_type("cross", args, 0, &Vector2D_Type)) {
+        return NULL;
+    }
+    // FVector2D::CrossProduct, the z of the 3d cross product
+    const Vector2DValue& a = ((Vector2D*)self)->value;
+    const Vector2DValue& b = ((Vector2D*)args[0])->value;
+    return PyFloat_FromDouble(a.X * b.Y - a.Y * b.X);
+}
+
+static PyObject* Vector_cross(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("cross", nargs, 1, 1) || !check_arg_type("cross", args, 0, &Vector_Type)) {
+        return NULL;
+    }
+    return new_value_object<Vector>(&Vector_Type, vector_cross(((Vector*)self)->value, ((Vector*)args[0])->value));
+}
+
+// quat * quat applies the right hand side first, quat * vector rotates the vector
+static PyObject* Quat_multiply(PyObject* a, PyObject* b)
+{
+    if (PyObject_TypeCheck(a, &Quat_Type) && PyObject_TypeCheck(b, &Quat_Type)) {
+        return new_value_object<Quat>(&Quat_Type, quat_multiply(((Quat*)a)->value, ((Quat*)b)->value));
+    }
+    if (PyObject_TypeCheck(a, &Quat_Type) && PyObject_TypeCheck(b, &Vector_Type)) {
+        return new_value_object<Vector>(&Vector_Type, quat_rotate_vector(((Quat*)a)->value, ((Vector*)b)->value));
+    }
+    return ValueStruct_multiply<Quat, &Quat_Type>(a, b);
+}
+
+// normalized copy, the identity when the value is too small as FQuat::GetNormalized
+static PyObject* Quat_normalized(PyObject* self, PyObject* unused)
+{
+    QuatValue result;
+    if (!math_normalize<4>(&result.X, &((Quat*)self)->value.X)) {
+        result = QuatValue{0.0, 0.0, 0.0, 1.0};
+    }
+    return new_value_object<Quat>(&Quat_Type, result);
+}
+
+static PyObject* Quat_lerp(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("lerp", nargs, 2, 2) || !check_arg_type("lerp", args, 0, &Quat_Type)) {
+        return NULL;
+    }
+    double alpha = PyFloat_AsDouble(args[1]);
+    if (alpha == -1.0 && PyErr_Occurred()) {
+        return NULL;
+    }
+    return new_value_object<Quat>(&Quat_Type, quat_lerp(((Quat*)self)->value, ((Quat*)args[0])->value, alpha));
+}
+
+static PyObject* Quat_rotate_vector(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("rotate_vector", nargs, 1, 1) || !check_arg_type("rotate_vector", args, 0, &Vector_Type)) {
+        return NULL;
+    }
+    return new_value_object<Vector>(&Vector_Type, quat_rotate_vector(((Quat*)self)->value, ((Vector*)args[0])->value));
+}
+
+static PyObject* Quat_inverse(PyObject* self, PyObject* unused)
+{
+    return new_value_object<Quat>(&Quat_Type, quat_inverse(((Quat*)self)->value));
+}
+
+// transform * transform applies the left hand side first
+static PyObject* Transform_multiply(PyObject* a, PyObject* b)
+{
+    if (!PyObject_TypeCheck(a, &Transform_Type) || !PyObject_TypeCheck(b, &Transform_Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    return new_value_object<Transform>(&Transform_Type, transform_multiply(((Transform*)a)->value, ((Transform*)b)->value));
+}
+
+static PyObject* Transform_transform_position(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("transform_position", nargs, 1, 1) || !check_arg_type("transform_position", args, 0, &Vector_Type)) {
+        return NULL;
+    }
+    return new_value_object<Vector>(&Vector_Type, transform_position(((Transform*)self)->value, ((Vector*)args[0])->value));
+}
+
+static PyObject* Transform_transform_vector(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("transform_vector", nargs, 1, 1) || !check_arg_type("transform_vector", args, 0, &Vector_Type)) {
+        return NULL;
+    }
+    return new_value_object<Vector>(&Vector_Type, transform_vector(((Transform*)self)->value, ((Vector*)args[0])->value));
+}
+
+static PyObject* Transform_lerp(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("lerp", nargs, 2, 2) || !check_arg_type("lerp", args, 0, &Transform_Type)) {
+        return NULL;
+    }
+    double alpha = PyFloat_AsDouble(args[1]);
+    if (alpha == -1.0 && PyErr_Occurred()) {
+        return NULL;
+    }
+    return new_value_object<Transform>(&Transform_Type, transform_lerp(((Transform*)self)->value, ((Transform*)args[0])->value, alpha));
+}
+
+static PyNumberMethods Vector2D_as_number = {
+    ValueStruct_add<Vector2D, &Vector2D_Type>,          /* nb_add */
+    ValueStruct_subtract<Vector2D, &Vector2D_Type>,     /* nb_subtract */
+    ValueStruct_multiply<Vector2D, &Vector2D_Type>,     /* nb_multiply */
+    0,                                                  /* nb_remainder */
+    0,                                                  /* nb_divmod */
+    0,                                                  /* nb_power */
+    ValueStruct_negative<Vector2D, &Vector2D_Type>,     /* nb_negative */
+    0,                                                  /* nb_positive */
+    0,                                                  /* nb_absolute */
+    0,                                                  /* nb_bool */
+    0,                                                  /* nb_invert */
+    0,                                                  /* nb_lshift */
+    0,                                                  /* nb_rshift */
+    0,                                                  /* nb_and */
+    0,                                                  /* nb_xor */
+    0,                                                  /* nb_or */
+    0,                                                  /* nb_int */
+    0,                                                  /* nb_reserved */
+    0,                                                  /* nb_float */
+    0,                                                  /* nb_inplace_add */
+    0,                                                  /* nb_inplace_subtract */
+    0,                                                  /* nb_inplace_multiply */
+    0,                                                  /* nb_inplace_remainder */
+    0,                                                  /* nb_inplace_power */
+    0,                                                  /* nb_inplace_lshift */
+    0,                                                  /* nb_inplace_rshift */
+    0,                                                  /* nb_inplace_and */
+    0,                                                  /* nb_inplace_xor */
+    0,                                                  /* nb_inplace_or */
+    0,                                                  /* nb_floor_divide */
+    ValueStruct_true_divide<Vector2D, &Vector2D_Type>,  /* nb_true_divide */
+};
+
+static PyNumberMethods Vector_as_number = {
+    ValueStruct_add<Vector, &Vector_Type>,              /* nb_add */
+    ValueStruct_subtract<Vector, &Vector_Type>,         /* nb_subtract */
+    ValueStruct_multiply<Vector, &Vector_Type>,         /* nb_multiply */
+    0,                                                  /* nb_remainder */
+    0,                                                  /* nb_divmod */
+    0,                                                  /* nb_power */
+    ValueStruct_negative<Vector, &Vector_Type>,         /* nb_negative */
+    0,                                                  /* nb_positive */
+    0,                                                  /* nb_absolute */
+    0,                                                  /* nb_bool */
+    0,                                                  /* nb_invert */
+    0,                                                  /* nb_lshift */
+    0,                                                  /* nb_rshift */
+    0,                                                  /* nb_and */
+    0,                                                  /* nb_xor */
+    0,                                                  /* nb_or */
+    0,                                                  /* nb_int */
+    0,                                                  /* nb_reserved */
+    0,                                                  /* nb_float */
+    0,                                                  /* nb_inplace_add */
+    0,                                                  /* nb_inplace_subtract */
+    0,                                                  /* nb_inplace_multiply */
+    0,                                                  /* nb_inplace_remainder */
+    0,                                                  /* nb_inplace_power */
+    0,                                                  /* nb_inplace_lshift */
+    0,                                                  /* nb_inplace_rshift */
+    0,                                                  /* nb_inplace_and */
+    0,                                                  /* nb_inplace_xor */
+    0,                                                  /* nb_inplace_or */
+    0,                                                  /* nb_floor_divide */
+    ValueStruct_true_divide<Vector, &Vector_Type>,      /* nb_true_divide */
+};
+
+static PyNumberMethods Quat_as_number = {
+    ValueStruct_add<Quat, &Quat_Type>,                  /* nb_add */
+    ValueStruct_subtract<Quat, &Quat_Type>,             /* nb_subtract */
+    Quat_multiply,                                      /* nb_multiply */
+    0,                                                  /* nb_remainder */
+    0,                                                  /* nb_divmod */
+    0,                                                  /* nb_power */
+    ValueStruct_negative<Quat, &Quat_Type>,             /* nb_negative */
+    0,                                                  /* nb_positive */
+    0,                                                  /* nb_absolute */
+    0,                                                  /* nb_bool */
+    0,                                                  /* nb_invert */
+    0,                                                  /* nb_lshift */
+    0,                                                  /* nb_rshift */
+    0,                                                  /* nb_and */
+    0,                                                  /* nb_xor */
+    0,                                                  /* nb_or */
+    0,                                                  /* nb_int */
+    0,                                                  /* nb_reserved */
+    0,                                                  /* nb_float */
+    0,                                                  /* nb_inplace_add */
+    0,                                                  /* nb_inplace_subtract */
+    0,                                                  /* nb_inplace_multiply */
+    0,                                                  /* nb_inplace_remainder */
+    0,                                                  /* nb_inplace_power */
+    0,                                                  /* nb_inplace_lshift */
+    0,                                                  /* nb_inplace_rshift */
+    0,                                                  /* nb_inplace_and */
+    0,                                                  /* nb_inplace_xor */
+    0,                                                  /* nb_inplace_or */
+    0,                                                  /* nb_floor_divide */
+    ValueStruct_true_divide<Quat, &Quat_Type>,          /* nb_true_divide */
+};
+
+static PyNumberMethods Transform_as_number = {
+    0,                                                  /* nb_add */
+    0,                                                  /* nb_subtract */
+    Transform_multiply,                                 /* nb_multiply */
+};
+
+static PyMethodDef Vector2D_methods[] = {
+    {"dot", (PyCFunction)(void(*)(void))ValueStruct_dot<Vector2D, &Vector2D_Type>, METH_FASTCALL, "dot product"},
+    {"cross", (PyCFunction)(void(*)(void))Vector2D_cross, METH_FASTCALL, "z of the cross product, as FVector2D::CrossProduct"},
+    {"size", (PyCFunction)ValueStruct_size<Vector2D>, METH_NOARGS, "length"},
+    {"size_squared", (PyCFunction)ValueStruct_size_squared<Vector2D>, METH_NOARGS, "squared length"},
+    {"normalize", (PyCFunction)ValueStruct_normalize<Vector2D>, METH_NOARGS, "normalize in place, False when too small"},
+    {"normalized", (PyCFunction)ValueStruct_normalized<Vector2D, &Vector2D_Type>, METH_NOARGS, "normalized copy, zero when too small"},
+    {"lerp", (PyCFunction)(void(*)(void))ValueStruct_lerp<Vector2D, &Vector2D_Type>, METH_FASTCALL, "lerp(other, alpha)"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyMethodDef Vector_methods[] = {
+    {"dot", (PyCFunction)(void(*)(void))ValueStruct_dot<Vector, &Vector_Type>, METH_FASTCALL, "dot product"},
+    {"cross", (PyCFunction)(void(*)(void))Vector_cross, METH_FASTCALL, "cross product"},
+    {"size", (PyCFunction)ValueStruct_size<Vector>, METH_NOARGS, "length"},
+    {"size_squared", (PyCFunction)ValueStruct_size_squared<Vector>, METH_NOARGS, "squared length"},
+    {"normalize", (PyCFunction)ValueStruct_normalize<Vector>, METH_NOARGS, "normalize in place, False when too small"},
+    {"normalized", (PyCFunction)ValueStruct_normalized<Vector, &Vector_Type>, METH_NOARGS, "normalized copy, zero when too small"},
+    {"lerp", (PyCFunction)(void(*)(void))ValueStruct_lerp<Vector, &Vector_Type>, METH_FASTCALL, "lerp(other, alpha)"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyMethodDef Quat_methods[] = {
+    {"dot", (PyCFunction)(void(*)(void))ValueStruct_dot<Quat, &Quat_Type>, METH_FASTCALL, "dot product"},
+    {"size", (PyCFunction)ValueStruct_size<Quat>, METH_NOARGS, "length"},
+    {"normalize", (PyCFunction)ValueStruct_normalize<Quat>, METH_NOARGS, "normalize in place, False when too small"},
+    {"normalized", (PyCFunction)Quat_normalized, METH_NOARGS, "normalized copy, identity when too small"},
+    {"lerp", (PyCFunction)(void(*)(void))Quat_lerp, METH_FASTCALL, "lerp(other, alpha), normalized and along the shortest arc"},
+    {"rotate_vector", (PyCFunction)(void(*)(void))Quat_rotate_vector, METH_FASTCALL, "rotate a Vector"},
+    {"inverse", (PyCFunction)Quat_inverse, METH_NOARGS, "inverse of a normalized quat"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyMethodDef Transform_methods[] = {
+    {"transform_position", (PyCFunction)(void(*)(void))Transform_transform_position, METH_FASTCALL, "scale, rotate and translate a Vector"},
+    {"transform_vector", (PyCFunction)(void(*)(void))Transform_transform_vector, METH_FASTCALL, "scale and rotate a Vector"},
+    {"lerp", (PyCFunction)(void(*)(void))Transform_lerp, METH_FASTCALL, "lerp(other, alpha)"},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Batch math
+ * kernels over C contiguous float64 buffers of packed values: 3 doubles per point, 4 per quat
+ * and 10 per transform (rotation, translation, scale3D). results are (count, width) float64
+ * memoryviews, which call() and Argument send as a float64 list
+ */
+// worker threads used by batches of at least batch_thread_threshold values, 1 runs on the caller only
+static Py_ssize_t batch_threads = 1;
+static Py_ssize_t batch_thread_threshold = 65536;
+
+/**
+ * persistent workers of run_batch, started by the first large batch and kept for the next ones
+ * rather than a thread created and joined per worker per call. a batch is cut into chunks that
+ * the workers and the calling thread take from a shared counter
+ */
+class BatchPool {
+public:
+    // run kernel over [0, count) in chunks pieces, false when another thread's batch holds the workers
+    bool run(size_t count, size_t chunks, const std::function<void(size_t, size_t)>& kernel)
+    {
+        std::unique_lock<std::mutex> batch_lock(batch_mutex, std::try_to_lock);
+        if (!batch_lock.owns_lock()) {
+            return false;
+        }
+        grow(chunks - 1);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &kernel;
+            job_count = count;
+            job_chunk = (count + chunks - 1) / chunks;
+            chunk_total = chunks;
+            pending.store(chunks);
+            next_chunk.store(0);
+            generation++;
+        }
+        wake.notify_all();
+
+        work();
+        // the workers that joined this batch leave before the chunk counter is reset for the next one
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return pending.load() == 0 && active == 0; });
+        job = NULL;
+        return true;
+    }
+
+private:
+    void grow(size_t size)
+    {
+        try {
+            while (workers < size) {
+                // detached, the workers live as long as the process like the pool itself
+                std::thread([this]() { worker_loop(); }).detach();
+                workers++;
+            }
+        }
+        catch (const std::system_error&) {
+            // out of threads, the started workers and the caller take every chunk
+        }
+    }
+
+    void work()
+    {
+        for (;;) {
+            size_t index = next_chunk.fetch_add(1);
+            if (index >= chunk_total) {
+                return;
+            }
+            size_t begin = index * job_chunk;
+            size_t end = std::min(begin + job_chunk, job_count);
+            if (begin < end) {
+                (*job)(begin, end);
+            }
+            if (pending.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_one();
+            }
+        }
+    }
+
+    void worker_loop()
+    {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [&]() { return generation != seen; });
+            seen = generation;
+            if (job == NULL) {
+                // the batch finished before this worker woke up
+                continue;
+            }
+            active++;
+            lock.unlock();
+            work();
+            lock.lock();
+            if (--active == 0) {
+                finished.notify_one();
+            }
+        }
+    }
+
+    std::mutex batch_mutex;     // one batch at a time
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    size_t workers = 0;
+    size_t active = 0;          // workers inside work() for the current batch
+    uint64_t generation = 0;
+    const std::function<void(size_t, size_t)>* job = NULL;
+    size_t job_count = 0;
+    size_t job_chunk = 0;
+    size_t chunk_total = 0;
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<size_t> pending{0};
+};
+
+// never destroyed, its detached workers may still be waiting when the process exits
+static BatchPool* batch_pool = NULL;
+
+/**
+ * run kernel(begin, end) over [0, count), split across batch_threads when the batch is large.
+ * called without the GIL
+ */
+template <typename Kernel>
+static void run_batch(size_t count, Kernel kernel)
+{
+    size_t threads = (size_t)batch_threads;
+    if (threads <= 1 || count < (size_t)batch_thread_threshold) {
+        kernel((size_t)0, count);
+        return;
+    }
+
+    static std::once_flag pool_created;
+    std::call_once(pool_created, []() { batch_pool = new BatchPool(); });
+    std::function<void(size_t, size_t)> job(kernel);
+    if (!batch_pool->run(count, threads, job)) {
+        // another thread's batch holds the workers, run this one on the caller
+        kernel((size_t)0, count);
+    }
+}
+
+class BatchBuffer {
+public:
+    BatchBuffer() { view.obj = NULL; }
+    ~BatchBuffer()
+    {
+        if (view.obj != NULL) {
+            PyBuffer_Release(&view);
+        }
+    }
+
+    /**
+     * export obj as packed values of width doubles, count is taken from the buffer
+     */
+    bool open(const char* func_name, PyObject* obj, Py_ssize_t width, bool writable)
+    {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(obj, &view, flags) < 0) {
+            view.obj = NULL;
+            return false;
+        }
+
+        const char* format = view.format != NULL ? view.format : "B";
+        if (*format == '@' || *format == '=' || *format == '<') {
+            format++;
+        }
+        if (strcmp(format, "d") != 0 || view.itemsize != sizeof(double)) {
+            PyErr_Format(PyExc_TypeError, "%s() expects float64 buffers, not format '%s'", func_name, view.format);
+            return false;
+        }
+        if (view.len % (width * (Py_ssize_t)sizeof(double)) != 0) {
+            PyErr_Format(PyExc_ValueError, "%s() expects buffers of %zd float64 per value", func_name, width);
+            return false;
+        }
+        if (view.len > 0 && (uintptr_t)view.buf % alignof(double) != 0) {
+            PyErr_Format(PyExc_ValueError, "%s() expects float64 aligned buffers", func_name);
+            return false;
+        }
+        count = view.len / (width * (Py_ssize_t)sizeof(double));
+        return true;
+    }
+
+    double* data() const { return (double*)view.buf; }
+
+    Py_buffer view;
+    Py_ssize_t count = 0;
+};
+
+/**
+ * the out argument when given, or a new (count, width) float64 memoryview over a bytearray
+ */
+static PyObject* open_batch_output(const char* func_name, PyObject* out, Py_ssize_t count, Py_ssize_t width, BatchBuffer& buffer)
+{
+    if (out != NULL && out != Py_None) {
+        if (!buffer.open(func_name, out, width, true)) {
+            return NULL;
+        }
+        if (buffer.count != count) {
+            PyErr_Format(PyExc_ValueError, "%s() out holds %zd values, expected %zd", func_name, buffer.count, count);
+            return NULL;
+        }
+        Py_INCREF(out);
+        return out;
+    }
+
+    PyObject* bytes = PyByteArray_FromStringAndSize(NULL, count * width * (Py_ssize_t)sizeof(double));
+    if (bytes == NULL) {
+        return NULL;
+    }
+    PyObject* view = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if (view == NULL) {
+        return NULL;
+    }
+    PyObject* result = count > 0 ? PyObject_CallMethod(view, "cast", "s(nn)", "d", count, width) : PyObject_CallMethod(view, "cast", "s", "d");
+    Py_DECREF(view);
+    if (result == NULL || !buffer.open(func_name, result, width, true)) {
+        Py_XDECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
+/**
+ * transform_points(transform, points, out=None)
+ * 
+ * args:
+ *   transform: Transform applied to every point, or buffer of one transform per point
+ *   points: float64 buffer of points
+ *   out: optional float64 buffer receiving the result, may be points
+ * 
+ * return:
+ *   (count, 3) float64 memoryview, or out
+ */
+static PyObject* unreal_core_transform_points(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("transform_points", nargs, 2, 3)) {
+        return NULL;
+    }
+
+    BatchBuffer points;
+    if (!points.open("transform_points", args[1], 3, false)) {
+        return NULL;
+    }
+
+    BatchBuffer transforms;
+    bool single = PyObject_TypeCheck(args[0], &Transform_Type);
+    if (!single) {
+        if (!transforms.open("transform_points", args[0], 10, false)) {
+            return NULL;
+        }
+        if (transforms.count != points.count) {
+            PyErr_Format(PyExc_ValueError, "transform_points() got %zd transforms for %zd points", transforms.count, points.count);
+            return NULL;
+        }
+    }
+
+    BatchBuffer out;
+    PyObject* result = open_batch_output("transform_points", nargs > 2 ? args[2] : NULL, points.count, 3, out);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    const double* src = points.data();
+    double* dest = out.data();
+    if (single) {
+        TransformValue transform = ((Transform*)args[0])->value;
+        Py_BEGIN_ALLOW_THREADS
+        run_batch((size_t)points.count, [&](size_t begin, size_t end) {
+            transform_points(transform, src, dest, begin, end);
+        });
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        const TransformValue* transform = (const TransformValue*)transforms.data();
+        Py_BEGIN_ALLOW_THREADS
+        run_batch((size_t)points.count, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                VectorValue point = transform_position(transform[i], *(const VectorValue*)(src + i * 3));
+                memcpy(dest + i * 3, &point, sizeof(point));
+            }
+        });
+        Py_END_ALLOW_THREADS
+    }
+    return result;
+}
+
+/**
+ * compose_transforms(a, b, out=None)
+ * 
+ * args:
+ *   a, b: buffers of transforms, or a single Transform applied to every value of the other
+ *   out: optional float64 buffer receiving the result
+ * 
+ * return:
+ *   (count, 10) float64 memoryview of a[i] * b[i] (a applied first), or out
+ */
+static PyObject* unreal_core_compose_transforms(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("compose_transforms", nargs, 2, 3)) {
+        return NULL;
+    }
+
+    BatchBuffer buffers[2];
+    const TransformValue* values[2] = {NULL, NULL};
+    size_t strides[2] = {0, 0};
+    Py_ssize_t count = -1;
+    for (int i = 0; i < 2; i++) {
+        if (PyObject_TypeCheck(args[i], &Transform_Type)) {
+            values[i] = &((Transform*)args[i])->value;
+            continue;
+        }
+        if (!buffers[i].open("compose_transforms", args[i], 10, false)) {
+            return NULL;
+        }
+        if (count >= 0 && buffers[i].count != count) {
+            PyErr_Format(PyExc_ValueError, "compose_transforms() got %zd and %zd transforms", count, buffers[i].count);
+            return NULL;
+        }
+        values[i] = (const TransformValue*)buffers[i].data();
+        strides[i] = 1;
+        count = buffers[i].count;
+    }
+    if (count < 0) {
+        PyErr_SetString(PyExc_TypeError, "compose_transforms() expects at least one buffer of transforms");
+        return NULL;
+    }
+
+    BatchBuffer out;
+    PyObject* result = open_batch_output("compose_transforms", nargs > 2 ? args[2] : NULL, count, 10, out);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    TransformValue* dest = (TransformValue*)out.data();
+    Py_BEGIN_ALLOW_THREADS
+    run_batch((size_t)count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dest[i] = transform_multiply(values[0][i * strides[0]], values[1][i * strides[1]]);
+        }
+    });
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+/**
+ * quat_slerp_many(a, b, alpha, out=None)
+ * 
+ * args:
+ *   a, b: buffers of quats
+ *   alpha: float, or float64 buffer of one alpha per quat
+ *   out: optional float64 buffer receiving the result
+ * 
+ * return:
+ *   (count, 4) float64 memoryview of normalized slerps, or out
+ */
+static PyObject* unreal_core_quat_slerp_many(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("quat_slerp_many", nargs, 3, 4)) {
+        return NULL;
+    }
+
+    BatchBuffer a;
+    BatchBuffer b;
+    if (!a.open("quat_slerp_many", args[0], 4, false) || !b.open("quat_slerp_many", args[1], 4, false)) {
+        return NULL;
+    }
+    if (a.count != b.count) {
+        PyErr_Format(PyExc_ValueError, "quat_slerp_many() got %zd and %zd quats", a.count, b.count);
+        return NULL;
+    }
+
+    BatchBuffer alphas;
+    double alpha = 0.0;
+    bool single_alpha = PyFloat_Check(args[2]) || PyLong_Check(args[2]);
+    if (single_alpha) {
+        alpha = PyFloat_AsDouble(args[2]);
+        if (alpha == -1.0 && PyErr_Occurred()) {
+            return NULL;
+        }
+    }
+    else {
+        if (!alphas.open("quat_slerp_many", args[2], 1, false)) {
+            return NULL;
+        }
+        if (alphas.count != a.count) {
+            PyErr_Format(PyExc_ValueError, "quat_slerp_many() got %zd alphas for %zd quats", alphas.count, a.count);
+            return NULL;
+        }
+    }
+
+    BatchBuffer out;
+    PyObject* result = open_batch_output("quat_slerp_many", nargs > 3 ? args[3] : NULL, a.count, 4, out);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    const QuatValue* from = (const QuatValue*)a.data();
+    const QuatValue* to = (const QuatValue*)b.data();
+    const double* alpha_values = single_alpha ? NULL : alphas.data();
+    QuatValue* dest = (QuatValue*)out.data();
+    Py_BEGIN_ALLOW_THREADS
+    run_batch((size_t)a.count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dest[i] = quat_slerp(from[i], to[i], alpha_values != NULL ? alpha_values[i] : alpha);
+        }
+    });
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+/**
+ * look_at_many(origins, targets, up=None, out=None)
+ * 
+ * args:
+ *   origins: buffer of points, or a single Vector shared by every target
+ *   targets: buffer of points
+ *   up: optional Vector kept as the z axis, Vector(0, 0, 1) by default
+ *   out: optional float64 buffer receiving the result
+ * 
+ * return:
+ *   (count, 4) float64 memoryview of quats turning the x axis towards each target, or out
+ */
+static PyObject* unreal_core_look_at_many(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("look_at_many", nargs, 2, 4)) {
+        return NULL;
+    }
+
+    BatchBuffer targets;
+    if (!targets.open("look_at_many", args[1], 3, false)) {
+        return NULL;
+    }
+
+    BatchBuffer origins;
+    const VectorValue* origin_values = NULL;
+    size_t origin_stride = 0;
+    if (PyObject_TypeCheck(args[0], &Vector_Type)) {
+        origin_values = &((Vector*)args[0])->value;
+    }
+    else {
+        if (!origins.open("look_at_many", args[0], 3, false)) {
+            return NULL;
+        }
+        if (origins.count != targets.count) {
+            PyErr_Format(PyExc_ValueError, "look_at_many() got %zd origins for %zd targets", origins.count, targets.count);
+            return NULL;
+        }
+        origin_values = (const VectorValue*)origins.data();
+        origin_stride = 1;
+    }
+
+    VectorValue up = {0.0, 0.0, 1.0};
+    if (nargs > 2 && args[2] != Py_None) {
+        if (!check_arg_type("look_at_many", args, 2, &Vector_Type)) {
+            return NULL;
+        }
+        up = ((Vector*)args[2])->value;
+    }
+
+    BatchBuffer out;
+    PyObject* result = open_batch_output("look_at_many", nargs > 3 ? args[3] : NULL, targets.count, 4, out);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    const VectorValue* target_values = (const VectorValue*)targets.data();
+    QuatValue* dest = (QuatValue*)out.data();
+    Py_BEGIN_ALLOW_THREADS
+    run_batch((size_t)targets.count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dest[i] = quat_look_at(origin_values[i * origin_stride], target_values[i], up);
+        }
+    });
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+/**
+ * set_batch_threads(threads, threshold=65536)
+ * 
+ * args:
+ *   threads: threads a large batch is split across, 1 keeps batches on the calling thread
+ *   threshold: batches of fewer values always run on the calling thread
+ */
+static PyObject* unreal_core_set_batch_threads(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_batch_threads", nargs, 1, 2)) {
+        return NULL;
+    }
+
+    Py_ssize_t threads = PyLong_AsSsize_t(args[0]);
+    if (threads == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_ssize_t threshold = batch_thread_threshold;
+    if (nargs > 1 && (threshold = PyLong_AsSsize_t(args[1])) == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (threads < 1 || threshold < 1) {
+        PyErr_SetString(PyExc_ValueError, "set_batch_threads() expects positive values");
+        return NULL;
+    }
+
+    batch_threads = threads;
+    batch_thread_threshold = threshold;
+    Py_RETURN_NONE;
+}
+
+/*
+ * Property
+ */
+typedef enum {
+    ARGUMENT_TYPE_BOOL = 0,
+    ARGUMENT_TYPE_UINT = 1,
+    ARGUMENT_TYPE_INT = 2,
+    ARGUMENT_TYPE_FLOAT = 3,
+    ARGUMENT_TYPE_STRING = 4,
+    ARGUMENT_TYPE_ENUM = 5,
+    ARGUMENT_TYPE_OBJECT = 6,
+    ARGUMENT_TYPE_FLOAT32_LIST = 7,
+    ARGUMENT_TYPE_FLOAT64_LIST = 8,
+    ARGUMENT_TYPE_INT32_LIST = 9,
+    ARGUMENT_TYPE_INT64_LIST = 10,
+    ARGUMENT_TYPE_DATA = 11,
+    ARGUMENT_TYPE_VECTOR2D = 12,
+    ARGUMENT_TYPE_VECTOR = 13,
+    ARGUMENT_TYPE_ROTATOR = 14,
+    ARGUMENT_TYPE_QUAT = 15,
+    ARGUMENT_TYPE_TRANSFORM = 16,
+    ARGUMENT_TYPE_STRUCT = 17,      // registered dataclass / NamedTuple, written field by field
+    ARGUMENT_TYPE_ENCODED = 18,     // value returned by a registered encoder, written as its wire kind
+} ArgumentType;
+
+static inline bool is_buffer_argument_type(ArgumentType type)
+{
+    return type >= ARGUMENT_TYPE_FLOAT32_LIST && type <= ARGUMENT_TYPE_DATA;
+}
+
+struct RegisteredType;
+
+// converted value of an argument, shared by Argument objects and the positional call path
+typedef struct {
+    ArgumentType value_type;
+    union {
+        bool bool_value;
+        uint64_t uint_value;
+        int64_t int_value;
+        double float_value;
+        const char* str_value;
+        int64_t enum_value;
+        PyObject* object;
+        Vector2DValue vector2d_value;
+        VectorValue vector_value;
+        RotatorValue rotator_value;
+        QuatValue quat_value;
+        TransformValue transform_value;
+    };
+    // ARGUMENT_TYPE_STRING: the str owning the utf8 buffer of str_value, and the buffer length.
+    // str_value is NULL for a str with lone surrogates, which is only sent as UTF-16
+    PyObject* str_object;
+    Py_ssize_t str_length;
+    // list and data types: the exported buffer of the value, see release_argument_value
+    Py_buffer buffer;
+    // struct and encoded types: the converter registration of object, which the value owns
+    const RegisteredType* registered;
+} ArgumentValue;
+
+static inline void release_argument_value(ArgumentValue& value)
+{
+    if (is_buffer_argument_type(value.value_type)) {
+        PyBuffer_Release(&value.buffer);
+    }
+    else if (value.value_type == ARGUMENT_TYPE_STRUCT || value.value_type == ARGUMENT_TYPE_ENCODED) {
+        Py_CLEAR(value.object);
+    }
+}
+
+typedef struct {
+    PyObject_HEAD
+    ClassProp* ue_class;
+    std::string name;
+    ArgumentValue data;
+} Argument;
+
+static PyObject* Argument_repr(Argument* self)
+{
+    switch (self->data.value_type) {
+        case ARGUMENT_TYPE_BOOL:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, bool_value=%d)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.bool_value);
+        case ARGUMENT_TYPE_UINT:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, uint_value=%lld)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.uint_value);
+        case ARGUMENT_TYPE_INT:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, int_value=%lld)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.int_value);
+        case ARGUMENT_TYPE_FLOAT:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, float_value=%f)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.float_value);
+        case ARGUMENT_TYPE_STRING:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, str_value=%R)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.str_object);
+        case ARGUMENT_TYPE_ENUM:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, enum_value=%lld)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.enum_value);
+        case ARGUMENT_TYPE_OBJECT:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, object=0x%llx)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.object); 
+        case ARGUMENT_TYPE_FLOAT32_LIST:
+        case ARGUMENT_TYPE_FLOAT64_LIST:
+        case ARGUMENT_TYPE_INT32_LIST:
+        case ARGUMENT_TYPE_INT64_LIST:
+        case ARGUMENT_TYPE_DATA:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d, buffer_size=%zd)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type, self->data.buffer.len);
+        default:
+            return PyUnicode_FromFormat("Argument(name=%s, ue_class=%s, value_type=%d)", 
+                self->name.c_str(), self->ue_class->type_name.c_str(), self->data.value_type);
+    }
+}
+
+/**
+ * Argument value conversion, dispatched on the exact type of the value
+ */
+typedef int (*ArgumentConverter)(ArgumentValue* dest, PyObject* value, const char* value_type);
+
+static int convert_bool_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    // prepared calls reach this with any value of a "bool" param, e.g. 1 or numpy.bool_
+    int truth = PyObject_IsTrue(value);
+    if (truth < 0) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_BOOL;
+    dest->bool_value = truth != 0;
+    return 0;
+}
+
+static int convert_int_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    // special case: enum
+    if (value_type != NULL && strcmp(value_type, "enum") == 0) {
+        dest->value_type = ARGUMENT_TYPE_ENUM;
+        dest->enum_value = PyLong_AsLongLong(value);
+        return (dest->enum_value == -1 && PyErr_Occurred()) ? -1 : 0;
+    }
+
+    dest->value_type = ARGUMENT_TYPE_INT;
+    dest->int_value = PyLong_AsLongLong(value);
+    return (dest->int_value == -1 && PyErr_Occurred()) ? -1 : 0;
+}
+
+static int convert_float_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    // special case: int
+    if (value_type != NULL && strcmp(value_type, "int") == 0) {
+        // truncates like int(), nan, inf and values outside int64 raise instead of casting
+        PyObject* int_value = PyNumber_Long(value);
+        if (int_value == NULL) {
+            return -1;
+        }
+        dest->value_type = ARGUMENT_TYPE_INT;
+        dest->int_value = PyLong_AsLongLong(int_value);
+        Py_DECREF(int_value);
+        return (dest->int_value == -1 && PyErr_Occurred()) ? -1 : 0;
+    }
+
+    dest->value_type = ARGUMENT_TYPE_FLOAT;
+    dest->float_value = PyFloat_AsDouble(value);
+    return (dest->float_value == -1.0 && PyErr_Occurred()) ? -1 : 0;
+}
+
+static inline bool use_utf16_strings();
+
+static int convert_str_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    // utf8 buffer cached in the str itself, no copy
+    Py_ssize_t str_length = 0;
+    const char* str_value = PyUnicode_AsUTF8AndSize(value, &str_length);
+    if (str_value == NULL) {
+        // lone surrogates have no utf8 form, sent as UTF-16 they reach the FString as they are
+        if (!use_utf16_strings() || !PyErr_ExceptionMatches(PyExc_UnicodeEncodeError)) {
+            return -1;
+        }
+        PyErr_Clear();
+        str_length = 0;
+    }
+
+    dest->value_type = ARGUMENT_TYPE_STRING;
+    dest->str_value = str_value;
+    dest->str_object = value;
+    dest->str_length = str_length;
+    return 0;
+}
+
+static int convert_enum_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    PyObject* enum_value = PyObject_GetAttrString(value, "value");
+    if (!enum_value) {
+        PyErr_SetString(PyExc_RuntimeError, "Can not read the value of enum object");
+        return -1;
+    }
+
+    dest->value_type = ARGUMENT_TYPE_ENUM;
+    dest->enum_value = PyLong_AsLongLong(enum_value);
+    Py_DECREF(enum_value);
+    return (dest->enum_value == -1 && PyErr_Occurred()) ? -1 : 0;
+}
+
+static int convert_object_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    // todo@Caleb196x: implement special type such as list, set or map
+    // borrowed here, Argument_setup takes the reference for Argument objects
+    dest->value_type = ARGUMENT_TYPE_OBJECT;
+    dest->object = value;
+    return 0;
+}
+
+/**
+ * objects exporting the buffer protocol become numeric lists when their format is a single
+ * float32/float64/int32/int64 code, and raw data otherwise or with the "data" hint.
+ * the buffer stays exported until the value is released
+ */
+static int convert_buffer_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (PyObject_GetBuffer(value, &dest->buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return -1;
+    }
+
+    const char* format = dest->buffer.format != NULL ? dest->buffer.format : "B";
+    Py_ssize_t itemsize = dest->buffer.itemsize;
+    if (*format == '@' || *format == '=' || *format == '<') {
+        format++;
+    }
+
+    // numpy scalars (numpy.int32, numpy.float32, numpy.bool_) export 0-d buffers, they are sent as
+    // the scalar they hold. arrays and other sequences stay lists
+    if (dest->buffer.ndim == 0 && (value_type == NULL || strcmp(value_type, "data") != 0)) {
+        char code = format[0] != '\0' && format[1] == '\0' ? format[0] : '\0';
+        ArgumentConverter scalar_converter = NULL;
+        switch (code) {
+            case '?':
+                scalar_converter = convert_bool_argument;
+                break;
+            case 'e':
+            case 'f':
+            case 'd':
+                scalar_converter = convert_float_argument;
+                break;
+            case 'b':
+            case 'B':
+            case 'h':
+            case 'H':
+            case 'i':
+            case 'I':
+            case 'l':
+            case 'L':
+            case 'q':
+            case 'Q':
+                scalar_converter = convert_int_argument;
+                break;
+            default:
+                break;
+        }
+        if (scalar_converter != NULL) {
+            PyBuffer_Release(&dest->buffer);
+            return scalar_converter(dest, value, value_type);
+        }
+    }
+
+    ArgumentType type = ARGUMENT_TYPE_DATA;
+    if ((value_type == NULL || strcmp(value_type, "data") != 0) && format[0] != '\0' && format[1] == '\0') {
+        switch (format[0]) {
+            case 'f':
+                type = itemsize == 4 ? ARGUMENT_TYPE_FLOAT32_LIST : ARGUMENT_TYPE_DATA;
+                break;
+            case 'd':
+                type = itemsize == 8 ? ARGUMENT_TYPE_FLOAT64_LIST : ARGUMENT_TYPE_DATA;
+                break;
+            case 'i':
+            case 'l':
+            case 'q':
+                type = itemsize == 4 ? ARGUMENT_TYPE_INT32_LIST : (itemsize == 8 ? ARGUMENT_TYPE_INT64_LIST : ARGUMENT_TYPE_DATA);
+                break;
+            default:
+                break;
+        }
+    }
+
+    dest->value_type = type;
+    return 0;
+}
+
+/**
+ * value structs are copied into the argument, the type is checked as prepared calls
+ * reach these converters without the type dispatch
+ */
+static int convert_vector2d_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (!check_value_type(value, &Vector2D_Type)) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_VECTOR2D;
+    dest->vector2d_value = ((Vector2D*)value)->value;
+    return 0;
+}
+
+static int convert_vector_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (!check_value_type(value, &Vector_Type)) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_VECTOR;
+    dest->vector_value = ((Vector*)value)->value;
+    return 0;
+}
+
+static int convert_rotator_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (!check_value_type(value, &Rotator_Type)) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_ROTATOR;
+    dest->rotator_value = ((Rotator*)value)->value;
+    return 0;
+}
+
+static int convert_quat_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (!check_value_type(value, &Quat_Type)) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_QUAT;
+    dest->quat_value = ((Quat*)value)->value;
+    return 0;
+}
+
+static int convert_transform_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    if (!check_value_type(value, &Transform_Type)) {
+        return -1;
+    }
+    dest->value_type = ARGUMENT_TYPE_TRANSFORM;
+    dest->transform_value = ((Transform*)value)->value;
+    return 0;
+}
+
+/**
+ * Converters for user types, see unreal_core.register_converter
+ * a registered type either has an encoder returning a value of one of the param kinds, or is a
+ * dataclass / NamedTuple / attrs class sent as a StructValue. the field layout of those is resolved
+ * once at registration: NamedTuple fields are tuple items, __slots__ fields are read at their member
+ * offset and the others from the instance dict with interned keys, so no attribute lookup is left
+ * per field
+ */
+struct RegisteredType {
+    PyTypeObject* type;
+    std::string type_name;              // StructValue.typeName and the ue class matched by the decoder
+    PyObject* encoder;                  // NULL for field layouts
+    PyObject* decoder;                  // NULL decodes field layouts by calling type
+    ArgumentConverter wire_converter;   // converts what encoder returns
+    const char* wire_value_type;
+    bool is_tuple;
+    bool has_dict_fields;
+    std::vector<std::string> field_names;
+    std::vector<PyObject*> field_keys;        // interned
+    std::vector<Py_ssize_t> field_offsets;    // member offset of slots, -1 for fields in the instance dict
+};
+
+static std::unordered_map<PyTypeObject*, RegisteredType*> registered_types;
+static std::unordered_map<std::string, RegisteredType*> registered_type_names;
+
+// registration of type or of its nearest registered base
+static const RegisteredType* find_registered_type(PyTypeObject* type)
+{
+    if (registered_types.empty()) {
+        return NULL;
+    }
+    auto it = registered_types.find(type);
+    if (it != registered_types.end()) {
+        return it->second;
+    }
+    PyObject* mro = type->tp_mro;
+    if (mro == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 1; i < PyTuple_GET_SIZE(mro); i++) {
+        it = registered_types.find((PyTypeObject*)PyTuple_GET_ITEM(mro, i));
+        if (it != registered_types.end()) {
+            return it->second;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * encoded values own what the encoder returned, it is converted as the wire kind when the argument is
+ * written, as converted strings and objects only borrow from it
+ */
+static int convert_registered_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    const RegisteredType* registered = find_registered_type(Py_TYPE(value));
+    if (registered == NULL) {
+        return convert_object_argument(dest, value, value_type);
+    }
+
+    if (registered->encoder == NULL) {
+        Py_INCREF(value);
+        dest->object = value;
+        dest->value_type = ARGUMENT_TYPE_STRUCT;
+    }
+    else {
+        PyObject* encoded = PyObject_CallFunctionObjArgs(registered->encoder, value, NULL);
+        if (encoded == NULL) {
+            return -1;
+        }
+        dest->object = encoded;
+        dest->value_type = ARGUMENT_TYPE_ENCODED;
+    }
+    dest->registered = registered;
+    return 0;
+}
+
+// field names of a NamedTuple, dataclass or attrs class, in declaration order
+static PyObject* struct_field_names(PyTypeObject* type, bool* is_tuple)
+{
+    *is_tuple = PyType_IsSubtype(type, &PyTuple_Type);
+    PyObject* fields = NULL;
+    if (*is_tuple) {
+        fields = PyObject_GetAttrString((PyObject*)type, "_fields");
+    }
+    else if (PyObject_HasAttrString((PyObject*)type, "__dataclass_fields__")) {
+        // dataclasses.fields leaves out ClassVar and InitVar pseudo fields
+        PyObject* dataclasses = PyImport_ImportModule("dataclasses");
+        if (dataclasses == NULL) {
+            return NULL;
+        }
+        fields = PyObject_CallMethod(dataclasses, "fields", "O", (PyObject*)type);
+        Py_DECREF(dataclasses);
+    }
+    else {
+        fields = PyObject_GetAttrString((PyObject*)type, "__attrs_attrs__");
+    }
+    if (fields == NULL) {
+        if (PyErr_ExceptionMatches(PyExc_AttributeError)) {
+            PyErr_Format(PyExc_TypeError, "%s is not a dataclass, NamedTuple or attrs class", type->tp_name);
+        }
+        return NULL;
+    }
+
+    if (*is_tuple) {
+        PyObject* names = PySequence_Tuple(fields);
+        Py_DECREF(fields);
+        return names;
+    }
+
+    SequenceItems items;
+    if (!items.open(fields, "field list must be a sequence")) {
+        Py_DECREF(fields);
+        return NULL;
+    }
+    PyObject* names = PyTuple_New(items.size);
+    for (Py_ssize_t i = 0; names != NULL && i < items.size; i++) {
+        PyObject* name = PyObject_GetAttrString(items.items[i], "name");
+        if (name == NULL) {
+            Py_CLEAR(names);
+            break;
+        }
+        PyTuple_SET_ITEM(names, i, name);
+    }
+    Py_DECREF(fields);
+    return names;
+}
+
+static bool resolve_struct_layout(RegisteredType* registered)
+{
+    PyObject* names = struct_field_names(registered->type, &registered->is_tuple);
+    if (names == NULL) {
+        return false;
+    }
+
+    registered->has_dict_fields = false;
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(names); i++) {
+        PyObject* key = PyTuple_GET_ITEM(names, i);
+        const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : NULL;
+        if (name == NULL) {
+            PyErr_SetString(PyExc_TypeError, "field names must be str");
+            Py_DECREF(names);
+            return false;
+        }
+        Py_INCREF(key);
+        PyUnicode_InternInPlace(&key);
+
+        Py_ssize_t offset = -1;
+        if (!registered->is_tuple) {
+            PyObject* descr = PyObject_GetAttr((PyObject*)registered->type, key);
+            if (descr != NULL && Py_TYPE(descr) == &PyMemberDescr_Type
+                && ((PyMemberDescrObject*)descr)->d_member->type == T_OBJECT_EX) {
+                offset = ((PyMemberDescrObject*)descr)->d_member->offset;
+            }
+            Py_XDECREF(descr);
+            PyErr_Clear();
+            registered->has_dict_fields = registered->has_dict_fields || offset < 0;
+        }
+
+        registered->field_names.emplace_back(name);
+        registered->field_keys.push_back(key);
+        registered->field_offsets.push_back(offset);
+    }
+    Py_DECREF(names);
+    return true;
+}
+
+// new reference to field i of a registered struct value, dict is its instance dict or NULL
+static PyObject* read_struct_field(PyObject* object, PyObject* dict, const RegisteredType& registered, size_t i)
+{
+    PyObject* field = NULL;
+    if (registered.is_tuple) {
+        if ((Py_ssize_t)i < PyTuple_GET_SIZE(object)) {
+            field = PyTuple_GET_ITEM(object, i);
+        }
+    }
+    else if (registered.field_offsets[i] >= 0) {
+        field = *(PyObject**)((char*)object + registered.field_offsets[i]);
+    }
+    else if (dict != NULL) {
+        field = PyDict_GetItemWithError(dict, registered.field_keys[i]);
+        if (field == NULL && PyErr_Occurred()) {
+            return NULL;
+        }
+    }
+    else {
+        // no instance dict, e.g. a property of a slots class
+        return PyObject_GetAttr(object, registered.field_keys[i]);
+    }
+
+    if (field == NULL) {
+        PyErr_Format(PyExc_AttributeError, "'%s' object has no field '%s'", Py_TYPE(object)->tp_name, registered.field_names[i].c_str());
+        return NULL;
+    }
+    Py_INCREF(field);
+    return field;
+}
+
+// upper bound of the types remembered by the slow path, keeps dynamically created classes from growing the table forever
+#define MAX_CACHED_ARGUMENT_TYPES 256
+
+static std::unordered_map<PyTypeObject*, ArgumentConverter> argument_converters = {
+    {&PyBool_Type, convert_bool_argument},
+    {&PyLong_Type, convert_int_argument},
+    {&PyFloat_Type, convert_float_argument},
+    {&PyUnicode_Type, convert_str_argument},
+    {&Vector2D_Type, convert_vector2d_argument},
+    {&Vector_Type, convert_vector_argument},
+    {&Rotator_Type, convert_rotator_argument},
+    {&Quat_Type, convert_quat_argument},
+    {&Transform_Type, convert_transform_argument},
+};
+
+static ArgumentConverter find_argument_converter(PyObject* value)
+{
+    PyTypeObject* type = Py_TYPE(value);
+    auto it = argument_converters.find(type);
+    if (it != argument_converters.end()) {
+        return it->second;
+    }
+
+    // slow path: subclasses of the builtin types, enums and other objects.
+    // the result only depends on the type, so remember it for the next call
+    ArgumentConverter converter;
+    if (find_registered_type(type) != NULL) {
+        converter = convert_registered_argument;
+    }
+    else if (PyLong_Check(value)) {
+        converter = convert_int_argument;
+    }
+    else if (PyFloat_Check(value)) {
+        converter = convert_float_argument;
+    }
+    else if (PyUnicode_Check(value)) {
+        converter = convert_str_argument;
+    }
+    else if (is_enum_type(value)) {
+        converter = convert_enum_argument;
+    }
+    else if (PyObject_TypeCheck(value, &Vector2D_Type)) {
+        converter = convert_vector2d_argument;
+    }
+    else if (PyObject_TypeCheck(value, &Vector_Type)) {
+        converter = convert_vector_argument;
+    }
+    else if (PyObject_TypeCheck(value, &Rotator_Type)) {
+        converter = convert_rotator_argument;
+    }
+    else if (PyObject_TypeCheck(value, &Quat_Type)) {
+        converter = convert_quat_argument;
+    }
+    else if (PyObject_TypeCheck(value, &Transform_Type)) {
+        converter = convert_transform_argument;
+    }
+    else if (PyObject_CheckBuffer(value)) {
+        converter = convert_buffer_argument;
+    }
+    else {
+        converter = convert_object_argument;
+    }
+
+    if (argument_converters.size() < MAX_CACHED_ARGUMENT_TYPES) {
+        // the table holds a reference, so the type pointer can not be reused by another type
+        Py_INCREF(type);
+        argument_converters.emplace(type, converter);
+    }
+    return converter;
+}
+
+/**
+ * kind of a declared param, shared by prepared call signatures and Argument value types
+ */
+typedef struct {
+    const char* name;
+    ArgumentConverter converter;
+    bool scalar;              // fixed size value, can be patched in a request template
+    ArgumentType slot_type;   // value type written by the converter of a scalar kind
+} ParamKind;
+
+static const ParamKind* find_param_kind(const char* kind_name);
+
+static int Argument_setup(Argument* self, const char* name, ClassProp* ue_class, PyObject* value, const char* value_type)
+{
+    if (ue_class == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "ue_class is required");
+        return -1;
+    }
+
+    if (ue_class->type_name.empty()) {
+        PyErr_SetString(PyExc_RuntimeError, "ue_class is not initialized");
+        return -1;
+    }
+
+    self->name = std::move(std::string(name));
+    self->ue_class = ue_class;
+
+    if (value == NULL) {
+        return 0;
+    }
+
+    // a param kind as value type converts like a prepared param of that kind, e.g. an int for a "float"
+    // param. "int" keeps its hint meaning of truncating floats
+    const ParamKind* kind = value_type != NULL && strcmp(value_type, "int") != 0 ? find_param_kind(value_type) : NULL;
+    ArgumentConverter converter = kind != NULL ? kind->converter : find_argument_converter(value);
+    if (converter(&self->data, value, value_type) < 0) {
+        return -1;
+    }
+    // keep the values the argument points to alive, struct and encoded values own theirs already
+    if (self->data.value_type == ARGUMENT_TYPE_OBJECT) {
+        Py_INCREF(self->data.object);
+    }
+    else if (self->data.value_type == ARGUMENT_TYPE_STRING) {
+        Py_INCREF(self->data.str_object);
+    }
+    return 0;
+}
+
+static int Argument_init(Argument* self, PyObject* args)
+{
+    char* name = NULL;    
+    ClassProp* ue_class = NULL;
+    PyObject* value = NULL;
+    char* value_type = NULL;
+    if (!PyArg_ParseTuple(args, "sO!O|s", &name, &ClassProp_Type, &ue_class, &value, &value_type)) {
+        return -1;
+    }
+
+    return Argument_setup(self, name, ue_class, value, value_type);
+}
+
+static PyObject* Argument_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    Argument* self;
+    self = (Argument*)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        new (&self->name) std::string();
+        self->ue_class = NULL;
+        self->data.value_type = ARGUMENT_TYPE_BOOL;
+        self->data.uint_value = 0;
+    }
+    return (PyObject*)self;
+}
+
+static void Argument_dealloc(Argument* self)
+{
+    if (self->data.value_type == ARGUMENT_TYPE_OBJECT)
+    {
+        Py_DECREF(self->data.object);
+    }
+    else if (self->data.value_type == ARGUMENT_TYPE_STRING)
+    {
+        Py_DECREF(self->data.str_object);
+    }
+    release_argument_value(self->data);
+
+    self->name.~basic_string();
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+#if PY_VERSION_HEX >= 0x03090000
+/**
+ * Argument(name, ue_class, value, value_type=None) without building an args tuple
+ */
+static PyObject* Argument_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        PyErr_SetString(PyExc_TypeError, "Argument() takes no keyword arguments");
+        return NULL;
+    }
+    if (!check_positional_args("Argument", nargs, 3, 4)) {
+        return NULL;
+    }
+
+    const char* name = unpack_str_arg("Argument", args, 0);
+    if (name == NULL || !check_arg_type("Argument", args, 1, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    const char* value_type = NULL;
+    if (nargs > 3 && (value_type = unpack_str_arg("Argument", args, 3)) == NULL) {
+        return NULL;
+    }
+
+    Argument* self = (Argument*)Argument_new((PyTypeObject*)type, NULL, NULL);
+    if (self == NULL) {
+        return NULL;
+    }
+    if (Argument_setup(self, name, (ClassProp*)args[1], args[2], value_type) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject*)self;
+}
+#endif
+
+
+static PyTypeObject Argument_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.Argument",           /* tp_name */
+    sizeof(Argument),                 /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)Argument_dealloc,  /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)Argument_repr,         /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    (reprfunc)Argument_repr,       /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,           /* tp_flags */
+    "Unreal Engine Argument",        /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    0,                             /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    0,                             /* tp_members */
+    0,                             /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    0,                             /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    (initproc)Argument_init,         /* tp_init */
+    0,
+    Argument_new
+};
+
+typedef struct {
+    PyObject_HEAD
+    const char* name;
+} Method;
+
+static PyObject* Method_repr(Method* self)
+{
+    if (self->name == NULL) {
+        return PyUnicode_FromFormat("Method(name=NULL)");
+    }
+    return PyUnicode_FromFormat("Method(name=%s)", self->name);
+}
+
+static int Method_init(Method* self, PyObject* args, PyObject* kwargs)
+{
+    char* name = NULL;
+    if (!PyArg_ParseTuple(args, "s", &name)) {
+        return -1;
+    }
+    self->name = name;
+    return 0;
+}
+
+static PyTypeObject Method_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.Method",           /* tp_name */
+    sizeof(Method),                 /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    0,                             /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)Method_repr,         /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    (reprfunc)Method_repr,         /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,           /* tp_flags */
+    "Unreal Engine Method",        /* tp_doc */ 
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    0,                             /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    0,                             /* tp_members */
+    0,                             /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    0,                             /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    (initproc)Method_init,         /* tp_init */
+};
+
+/**
+ * primitive list elements are contiguous little endian values in the segment, as on every platform
+ * unreal engine runs on, so the buffer is copied into the list in one go
+ */
+template <typename T>
+static void copy_buffer_to_list(typename capnp::List<T>::Builder list, const Py_buffer& buffer)
+{
+    kj::ArrayPtr<const kj::byte> bytes = capnp::AnyList::Reader(list.asReader()).getRawBytes();
+    memcpy(const_cast<kj::byte*>(bytes.begin()), buffer.buf, bytes.size());
+}
+
+static void set_vector_fields(UnrealCore::Vector::Builder builder, const VectorValue& value)
+{
+    builder.setX(value.X);
+    builder.setY(value.Y);
+    builder.setZ(value.Z);
+}
+
+static void set_quat_fields(UnrealCore::Quat::Builder builder, const QuatValue& value)
+{
+    builder.setX(value.X);
+    builder.setY(value.Y);
+    builder.setZ(value.Z);
+    builder.setW(value.W);
+}
+
+static VectorValue read_vector_fields(UnrealCore::Vector::Reader reader)
+{
+    return VectorValue{reader.getX(), reader.getY(), reader.getZ()};
+}
+
+static QuatValue read_quat_fields(UnrealCore::Quat::Reader reader)
+{
+    return QuatValue{reader.getX(), reader.getY(), reader.getZ(), reader.getW()};
+}
+
+/**
+ * Marshalling traits
+ * Marshal<T> converts one C++ value type between python, ArgumentValue and the Argument union:
+ *   type                   the ArgumentType of the value
+ *   get / set              the value in an ArgumentValue
+ *   from_python            false with an exception set when the object does not convert
+ *   to_python              new reference
+ *   write / read           the union member of an Argument
+ * the runtime switches below dispatch to the traits, and encode<Ts...> chains them over a
+ * fixed signature so every param is converted without a switch
+ */
+template <typename T>
+struct Marshal;
+
+// utf8 bytes of a str, owned by the str or the message
+typedef struct {
+    const char* data;
+    Py_ssize_t length;
+} Utf8Value;
+
+// enum values go in their own union member
+typedef struct {
+    int64_t value;
+} EnumValue;
+
+template <>
+struct Marshal<bool> {
+    static const ArgumentType type = ARGUMENT_TYPE_BOOL;
+    static bool get(const ArgumentValue& value) { return value.bool_value; }
+    static void set(ArgumentValue& dest, bool value) { dest.value_type = type; dest.bool_value = value; }
+    static bool from_python(PyObject* value, bool& out)
+    {
+        int truth = PyObject_IsTrue(value);
+        out = truth > 0;
+        return truth >= 0;
+    }
+    static PyObject* to_python(bool value) { return PyBool_FromLong(value); }
+    static void write(UnrealCore::Argument::Builder& dest, bool value) { dest.setBoolValue(value); }
+    static bool read(const UnrealCore::Argument::Reader& src) { return src.getBoolValue(); }
+};
+
+template <>
+struct Marshal<int64_t> {
+    static const ArgumentType type = ARGUMENT_TYPE_INT;
+    static int64_t get(const ArgumentValue& value) { return value.int_value; }
+    static void set(ArgumentValue& dest, int64_t value) { dest.value_type = type; dest.int_value = value; }
+    static bool from_python(PyObject* value, int64_t& out)
+    {
+        out = PyLong_AsLongLong(value);
+        return !(out == -1 && PyErr_Occurred());
+    }
+    static PyObject* to_python(int64_t value) { return PyLong_FromLongLong(value); }
+    static void write(UnrealCore::Argument::Builder& dest, int64_t value) { dest.setIntValue(value); }
+    static int64_t read(const UnrealCore::Argument::Reader& src) { return src.getIntValue(); }
+};
+
+template <>
+struct Marshal<uint64_t> {
+    static const ArgumentType type = ARGUMENT_TYPE_UINT;
+    static uint64_t get(const ArgumentValue& value) { return value.uint_value; }
+    static void set(ArgumentValue& dest, uint64_t value) { dest.value_type = type; dest.uint_value = value; }
+    static bool from_python(PyObject* value, uint64_t& out)
+    {
+        out = PyLong_AsUnsignedLongLong(value);
+        return !(out == (uint64_t)-1 && PyErr_Occurred());
+    }
+    static PyObject* to_python(uint64_t value) { return PyLong_FromUnsignedLongLong(value); }
+    static void write(UnrealCore::Argument::Builder& dest, uint64_t value) { dest.setUintValue(value); }
+    static uint64_t read(const UnrealCore::Argument::Reader& src) { return src.getUintValue(); }
+};
+
+template <>
+struct Marshal<double> {
+    static const ArgumentType type = ARGUMENT_TYPE_FLOAT;
+    static double get(const ArgumentValue& value) { return value.float_value; }
+    static void set(ArgumentValue& dest, double value) { dest.value_type = type; dest.float_value = value; }
+    static bool from_python(PyObject* value, double& out)
+    {
+        out = PyFloat_AsDouble(value);
+        return !(out == -1.0 && PyErr_Occurred());
+    }
+    static PyObject* to_python(double value) { return PyFloat_FromDouble(value); }
+    static void write(UnrealCore::Argument::Builder& dest, double value) { dest.setFloatValue(value); }
+    static double read(const UnrealCore::Argument::Reader& src) { return src.getFloatValue(); }
+};
+
+template <>
+struct Marshal<Utf8Value> {
+    static const ArgumentType type = ARGUMENT_TYPE_STRING;
+    static Utf8Value get(const ArgumentValue& value) { return Utf8Value{value.str_value, value.str_length}; }
+    // the caller keeps the owner of the bytes in str_object
+    static void set(ArgumentValue& dest, Utf8Value value)
+    {
+        dest.value_type = type;
+        dest.str_value = value.data;
+        dest.str_object = NULL;
+        dest.str_length = value.length;
+    }
+    static bool from_python(PyObject* value, Utf8Value& out)
+    {
+        out.data = PyUnicode_AsUTF8AndSize(value, &out.length);
+        return out.data != NULL;
+    }
+    static PyObject* to_python(Utf8Value value) { return PyUnicode_DecodeUTF8(value.data, value.length, NULL); }
+    // single copy of the utf8 bytes into the message segment, length known up front
+    static void write(UnrealCore::Argument::Builder& dest, Utf8Value value)
+    {
+        dest.setStrValue(capnp::Text::Reader(value.data, (size_t)value.length));
+    }
+    static Utf8Value read(const UnrealCore::Argument::Reader& src)
+    {
+        capnp::Text::Reader text = src.getStrValue();
+        return Utf8Value{text.begin(), (Py_ssize_t)text.size()};
+    }
+};
+
+template <>
+struct Marshal<EnumValue> {
+    static const ArgumentType type = ARGUMENT_TYPE_ENUM;
+    static EnumValue get(const ArgumentValue& value) { return EnumValue{value.enum_value}; }
+    static void set(ArgumentValue& dest, EnumValue value) { dest.value_type = type; dest.enum_value = value.value; }
+    // a plain int or an enum member
+    static bool from_python(PyObject* value, EnumValue& out)
+    {
+        if (PyLong_Check(value)) {
+            out.value = PyLong_AsLongLong(value);
+            return !(out.value == -1 && PyErr_Occurred());
+        }
+        ArgumentValue converted;
+        if (convert_enum_argument(&converted, value, NULL) < 0) {
+            return false;
+        }
+        out.value = converted.enum_value;
+        return true;
+    }
+    static PyObject* to_python(EnumValue value) { return PyLong_FromLongLong(value.value); }
+    static void write(UnrealCore::Argument::Builder& dest, EnumValue value) { dest.setEnumValue(value.value); }
+    static EnumValue read(const UnrealCore::Argument::Reader& src) { return EnumValue{src.getEnumValue()}; }
+};
+
+/**
+ * value structs share the python side: a type checked copy out of the object and a new object back
+ */
+template <typename V, typename T, PyTypeObject* Type, ArgumentType Kind, V ArgumentValue::*Member>
+struct MarshalValueStruct {
+    static const ArgumentType type = Kind;
+    static V get(const ArgumentValue& value) { return value.*Member; }
+    static void set(ArgumentValue& dest, const V& value) { dest.value_type = type; dest.*Member = value; }
+    static bool from_python(PyObject* value, V& out)
+    {
+        if (!check_value_type(value, Type)) {
+            return false;
+        }
+        out = ((T*)value)->value;
+        return true;
+    }
+    static PyObject* to_python(const V& value) { return new_value_object<T>(Type, value); }
+};
+
+template <>
+struct Marshal<Vector2DValue> : MarshalValueStruct<Vector2DValue, Vector2D, &Vector2D_Type, ARGUMENT_TYPE_VECTOR2D, &ArgumentValue::vector2d_value> {
+    static void write(UnrealCore::Argument::Builder& dest, const Vector2DValue& value)
+    {
+        UnrealCore::Vector2D::Builder vector2d = dest.initVector2DValue();
+        vector2d.setX(value.X);
+        vector2d.setY(value.Y);
+    }
+    static Vector2DValue read(const UnrealCore::Argument::Reader& src)
+    {
+        UnrealCore::Vector2D::Reader vector2d = src.getVector2DValue();
+        return Vector2DValue{vector2d.getX(), vector2d.getY()};
+    }
+};
+
+template <>
+struct Marshal<VectorValue> : MarshalValueStruct<VectorValue, Vector, &Vector_Type, ARGUMENT_TYPE_VECTOR, &ArgumentValue::vector_value> {
+    static void write(UnrealCore::Argument::Builder& dest, const VectorValue& value) { set_vector_fields(dest.initVectorValue(), value); }
+    static VectorValue read(const UnrealCore::Argument::Reader& src) { return read_vector_fields(src.getVectorValue()); }
+};
+
+template <>
+struct Marshal<RotatorValue> : MarshalValueStruct<RotatorValue, Rotator, &Rotator_Type, ARGUMENT_TYPE_ROTATOR, &ArgumentValue::rotator_value> {
+    static void write(UnrealCore::Argument::Builder& dest, const RotatorValue& value)
+    {
+        UnrealCore::Rotator::Builder rotator = dest.initRotatorValue();
+        rotator.setPitch(value.Pitch);
+        rotator.setYaw(value.Yaw);
+        rotator.setRoll(value.Roll);
+    }
+    static RotatorValue read(const UnrealCore::Argument::Reader& src)
+    {
+        UnrealCore::Rotator::Reader rotator = src.getRotatorValue();
+        return RotatorValue{rotator.getPitch(), rotator.getYaw(), rotator.getRoll()};
+    }
+};
+
+template <>
+struct Marshal<QuatValue> : MarshalValueStruct<QuatValue, Quat, &Quat_Type, ARGUMENT_TYPE_QUAT, &ArgumentValue::quat_value> {
+    static void write(UnrealCore::Argument::Builder& dest, const QuatValue& value) { set_quat_fields(dest.initQuatValue(), value); }
+    static QuatValue read(const UnrealCore::Argument::Reader& src) { return read_quat_fields(src.getQuatValue()); }
+};
+
+template <>
+struct Marshal<TransformValue> : MarshalValueStruct<TransformValue, Transform, &Transform_Type, ARGUMENT_TYPE_TRANSFORM, &ArgumentValue::transform_value> {
+    static void write(UnrealCore::Argument::Builder& dest, const TransformValue& value)
+    {
+        UnrealCore::Transform::Builder transform = dest.initTransformValue();
+        set_quat_fields(transform.initRotation(), value.Rotation);
+        set_vector_fields(transform.initTranslation(), value.Translation);
+        set_vector_fields(transform.initScale3D(), value.Scale3D);
+    }
+    static TransformValue read(const UnrealCore::Argument::Reader& src)
+    {
+        UnrealCore::Transform::Reader transform = src.getTransformValue();
+        return TransformValue{
+            read_quat_fields(transform.getRotation()),
+            read_vector_fields(transform.getTranslation()),
+            read_vector_fields(transform.getScale3D())};
+    }
+};
+
+// runtime entry points of the traits, used by the switches over ArgumentType and Argument::Which
+template <typename T>
+static inline void write_marshalled(const ArgumentValue& value, UnrealCore::Argument::Builder& dest)
+{
+    Marshal<T>::write(dest, Marshal<T>::get(value));
+}
+
+template <typename T>
+static inline PyObject* read_marshalled(const UnrealCore::Argument::Reader& src)
+{
+    return Marshal<T>::to_python(Marshal<T>::read(src));
+}
+
+template <typename T>
+static inline int convert_marshalled(ArgumentValue* dest, PyObject* value)
+{
+    T converted;
+    if (!Marshal<T>::from_python(value, converted)) {
+        return -1;
+    }
+    Marshal<T>::set(*dest, converted);
+    return 0;
+}
+
+/**
+ * encode<Ts...>: write python values into the value slots of a params list, one trait per param
+ * resolved at compile time. names and classes are left to the caller (skeleton or request builder)
+ */
+typedef capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder ArgumentListBuilder;
+typedef bool (*SpecializedEncoder)(PyObject* const* values, ArgumentListBuilder& dest);
+
+template <typename T>
+static inline bool encode_value(PyObject* value, UnrealCore::Argument::Builder dest)
+{
+    T converted;
+    if (!Marshal<T>::from_python(value, converted)) {
+        return false;
+    }
+    Marshal<T>::write(dest, converted);
+    return true;
+}
+
+template <typename... Ts, size_t... Is>
+static inline bool encode_pack(PyObject* const* values, ArgumentListBuilder& dest, std::index_sequence<Is...>)
+{
+    return (encode_value<Ts>(values[Is], dest[(uint32_t)Is]) && ...);
+}
+
+template <typename... Ts>
+static bool encode(PyObject* const* values, ArgumentListBuilder& dest)
+{
+    return encode_pack<Ts...>(values, dest, std::index_sequence_for<Ts...>{});
+}
+
+/**
+ * UTF-16 strings
+ * FString is UTF-16, so with a server that supports it strings travel as strUtf16Value and the
+ * server skips its UTF-8 conversions. the client transcodes straight between the str storage and the
+ * message: latin1 strs widen on SIMD lanes, UCS2 strs are copied as is, and results are narrowed back
+ * into the smallest str kind that holds them.
+ * every path writing Arguments follows the encoding, prepared calls included whatever their signature.
+ * packed params carry UTF-8 Text, a str without a UTF-8 form falls back to Arguments
+ */
+typedef enum {
+    STRING_ENCODING_AUTO = 0,   // UTF-16 when the server supports it
+    STRING_ENCODING_UTF8 = 1,
+    STRING_ENCODING_UTF16 = 2,
+} StringEncoding;
+
+static const char* string_encoding_names[] = {"auto", "utf8", "utf16"};
+static StringEncoding string_encoding = STRING_ENCODING_AUTO;
+
+static inline bool use_utf16_strings()
+{
+    return string_encoding == STRING_ENCODING_UTF16 ||
+        (string_encoding == STRING_ENCODING_AUTO && server_supports(SERVER_FEATURE_UTF16_STRINGS));
+}
+
+static void write_utf16_string(UnrealCore::Argument::Builder& dest, PyObject* str)
+{
+    size_t length = (size_t)PyUnicode_GET_LENGTH(str);
+    switch (PyUnicode_KIND(str)) {
+        case PyUnicode_1BYTE_KIND:
+        {
+            capnp::Data::Builder data = dest.initStrUtf16Value((uint32_t)(length * sizeof(uint16_t)));
+            utf16_from_latin1(PyUnicode_1BYTE_DATA(str), length, (uint16_t*)data.begin());
+            break;
+        }
+        case PyUnicode_2BYTE_KIND:
+            dest.setStrUtf16Value(capnp::Data::Reader((const kj::byte*)PyUnicode_2BYTE_DATA(str), length * sizeof(uint16_t)));
+            break;
+        default:
+        {
+            const uint32_t* code_points = (const uint32_t*)PyUnicode_4BYTE_DATA(str);
+            size_t units = utf16_length_of_ucs4(code_points, length);
+            capnp::Data::Builder data = dest.initStrUtf16Value((uint32_t)(units * sizeof(uint16_t)));
+            utf16_from_ucs4(code_points, length, (uint16_t*)data.begin());
+            break;
+        }
+    }
+}
+
+static PyObject* read_utf16_string(capnp::Data::Reader data)
+{
+    // Data starts on a word boundary, the units are aligned
+    const uint16_t* units = (const uint16_t*)data.begin();
+    size_t length = data.size() / sizeof(uint16_t);
+    bool has_surrogates;
+    uint16_t max_unit = utf16_scan(units, length, &has_surrogates);
+
+    if (has_surrogates) {
+        int byte_order = -1;    // little endian
+        return PyUnicode_DecodeUTF16((const char*)data.begin(), (Py_ssize_t)(length * sizeof(uint16_t)), "surrogatepass", &byte_order);
+    }
+
+    PyObject* str = PyUnicode_New((Py_ssize_t)length, max_unit);
+    if (str == NULL) {
+        return NULL;
+    }
+    if (max_unit < 0x100) {
+        utf16_to_latin1(units, length, PyUnicode_1BYTE_DATA(str));
+    }
+    else {
+        memcpy(PyUnicode_2BYTE_DATA(str), units, length * sizeof(uint16_t));
+    }
+    return str;
+}
+
+// str params of specialized encoders follow the string encoding like every other prepared param
+template <>
+inline bool encode_value<Utf8Value>(PyObject* value, UnrealCore::Argument::Builder dest)
+{
+    if (!use_utf16_strings()) {
+        Utf8Value converted;
+        if (!Marshal<Utf8Value>::from_python(value, converted)) {
+            return false;
+        }
+        Marshal<Utf8Value>::write(dest, converted);
+        return true;
+    }
+    if (!PyUnicode_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "expected str, not %.200s", Py_TYPE(value)->tp_name);
+        return false;
+    }
+    write_utf16_string(dest, value);
+    return true;
+}
+
+/**
+ * specialized encoders of common signatures, keyed by the prepare() kinds joined with ','.
+ * signatures of bool, int, float and enum params only are patched into the skeleton in place and
+ * take no encoder. generated bindings instantiate encode<Ts...> for their own signatures the same way
+ */
+static const std::unordered_map<std::string, SpecializedEncoder> specialized_encoders = {
+    {"str", encode<Utf8Value>},
+    {"str,int", encode<Utf8Value, int64_t>},
+    {"str,float", encode<Utf8Value, double>},
+    {"str,int,float,bool", encode<Utf8Value, int64_t, double, bool>},
+    {"Vector", encode<VectorValue>},
+    {"Vector,Vector", encode<VectorValue, VectorValue>},
+    {"Vector,float", encode<VectorValue, double>},
+    {"Vector,Rotator", encode<VectorValue, RotatorValue>},
+    {"Vector,Rotator,Vector", encode<VectorValue, RotatorValue, VectorValue>},
+    {"Rotator", encode<RotatorValue>},
+    {"Quat", encode<QuatValue>},
+    {"Transform", encode<TransformValue>},
+    {"Vector2D", encode<Vector2DValue>},
+};
+
+static SpecializedEncoder find_specialized_encoder(const std::string& signature_key)
+{
+    auto it = specialized_encoders.find(signature_key);
+    return it != specialized_encoders.end() ? it->second : NULL;
+}
+
+/**
+ * unreal_core.set_string_encoding
+ * 
+ * args:
+ *   encoding: "auto" sends strings as UTF-16 when the server supports it, "utf8" or "utf16" force one
+ */
+static PyObject* unreal_core_set_string_encoding(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_string_encoding", nargs, 1, 1)) {
+        return NULL;
+    }
+    const char* encoding_name = unpack_str_arg("set_string_encoding", args, 0);
+    if (encoding_name == NULL) {
+        return NULL;
+    }
+
+    for (int encoding = STRING_ENCODING_AUTO; encoding <= STRING_ENCODING_UTF16; encoding++) {
+        if (strcmp(encoding_name, string_encoding_names[encoding]) == 0) {
+            string_encoding = (StringEncoding)encoding;
+            Py_RETURN_NONE;
+        }
+    }
+    PyErr_Format(PyExc_ValueError, "unknown string encoding '%s'", encoding_name);
+    return NULL;
+}
+
+static bool set_unreal_rpc_argument_value(const ArgumentValue& value, UnrealCore::Argument::Builder& unreal_core_argument);
+
+// fields of a registered struct value, each converted with the type dispatch of call params
+static bool write_struct_value(const ArgumentValue& value, UnrealCore::Argument::Builder& unreal_core_argument)
+{
+    const RegisteredType& registered = *value.registered;
+    UnrealCore::StructValue::Builder struct_value = unreal_core_argument.initStructValue();
+    struct_value.setTypeName(registered.type_name);
+    auto fields = struct_value.initFields((uint32_t)registered.field_names.size());
+
+    PyObject* dict = NULL;
+    if (registered.has_dict_fields && Py_TYPE(value.object)->tp_dictoffset != 0) {
+        dict = PyObject_GenericGetDict(value.object, NULL);
+        if (dict == NULL) {
+            return false;
+        }
+    }
+    if (Py_EnterRecursiveCall(" while writing a struct value")) {
+        Py_XDECREF(dict);
+        return false;
+    }
+
+    bool written = true;
+    for (size_t i = 0; written && i < registered.field_names.size(); i++) {
+        PyObject* field = read_struct_field(value.object, dict, registered, i);
+        if (field == NULL) {
+            written = false;
+            break;
+        }
+        UnrealCore::Argument::Builder dest_field = fields[(uint32_t)i];
+        dest_field.setName(registered.field_names[i]);
+        ArgumentValue converted;
+        written = find_argument_converter(field)(&converted, field, NULL) == 0;
+        if (written) {
+            written = set_unreal_rpc_argument_value(converted, dest_field);
+            release_argument_value(converted);
+        }
+        Py_DECREF(field);
+    }
+
+    Py_LeaveRecursiveCall();
+    Py_XDECREF(dict);
+    return written;
+}
+
+static bool set_unreal_rpc_argument_value(const ArgumentValue& value, UnrealCore::Argument::Builder& unreal_core_argument)
+{
+    switch (value.value_type) {
+        case ARGUMENT_TYPE_BOOL:
+            write_marshalled<bool>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_INT:
+            write_marshalled<int64_t>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_UINT:
+            write_marshalled<uint64_t>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_FLOAT:
+            write_marshalled<double>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_STRING:
+            if (value.str_object != NULL && use_utf16_strings()) {
+                write_utf16_string(unreal_core_argument, value.str_object);
+            }
+            else {
+                write_marshalled<Utf8Value>(value, unreal_core_argument);
+            }
+            break;
+        case ARGUMENT_TYPE_ENUM:
+            write_marshalled<EnumValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_OBJECT:
+        {
+            unreal_core_argument.initObject().setAddress(reinterpret_cast<uint64_t>(value.object));
+            break;
+        }
+        case ARGUMENT_TYPE_FLOAT32_LIST:
+            copy_buffer_to_list<float>(unreal_core_argument.initFloat32List((uint32_t)(value.buffer.len / sizeof(float))), value.buffer);
+            break;
+        case ARGUMENT_TYPE_FLOAT64_LIST:
+            copy_buffer_to_list<double>(unreal_core_argument.initFloat64List((uint32_t)(value.buffer.len / sizeof(double))), value.buffer);
+            break;
+        case ARGUMENT_TYPE_INT32_LIST:
+            copy_buffer_to_list<int32_t>(unreal_core_argument.initInt32List((uint32_t)(value.buffer.len / sizeof(int32_t))), value.buffer);
+            break;
+        case ARGUMENT_TYPE_INT64_LIST:
+            copy_buffer_to_list<int64_t>(unreal_core_argument.initInt64List((uint32_t)(value.buffer.len / sizeof(int64_t))), value.buffer);
+            break;
+        case ARGUMENT_TYPE_DATA:
+            unreal_core_argument.setDataValue(capnp::Data::Reader((const kj::byte*)value.buffer.buf, (size_t)value.buffer.len));
+            break;
+        case ARGUMENT_TYPE_VECTOR2D:
+            write_marshalled<Vector2DValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_VECTOR:
+            write_marshalled<VectorValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_ROTATOR:
+            write_marshalled<RotatorValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_QUAT:
+            write_marshalled<QuatValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_TRANSFORM:
+            write_marshalled<TransformValue>(value, unreal_core_argument);
+            break;
+        case ARGUMENT_TYPE_STRUCT:
+            return write_struct_value(value, unreal_core_argument);
+        case ARGUMENT_TYPE_ENCODED:
+        {
+            ArgumentValue wire;
+            if (value.registered->wire_converter(&wire, value.object, value.registered->wire_value_type) < 0) {
+                return false;
+            }
+            bool written = set_unreal_rpc_argument_value(wire, unreal_core_argument);
+            release_argument_value(wire);
+            return written;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool create_unreal_rpc_argument(PyObject* py_argument, UnrealCore::Argument::Builder& unreal_core_argument)
+{
+    if (!PyObject_TypeCheck(py_argument, &Argument_Type)) {
+        return false;
+    }
+
+    Argument* argument = (Argument*)py_argument;
+    unreal_core_argument.setName(argument->name);
+    unreal_core_argument.initUeClass().setTypeName(argument->ue_class->type_name);
+
+    return set_unreal_rpc_argument_value(argument->data, unreal_core_argument);
+}
+
+
+static bool setup_unreal_rpc_arguments_from_list(PyObject* const* src_args, capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder& dest_args, Py_ssize_t list_size)
+{
+    for (uint32_t i = 0; i < list_size; i++) {
+        PyObject* item = src_args[i];
+
+        if (PyObject_TypeCheck(item, &Argument_Type)) {
+            UnrealCore::Argument::Builder dest_arg = dest_args[i];
+            if (!create_unreal_rpc_argument(item, dest_arg)) {
+                PyErr_SetString(PyExc_RuntimeError, "Failure to create parameters needed for unreal rpc call.");
+                return false;
+            }
+        }
+        else {
+            PyErr_SetString(PyExc_RuntimeError, "The type of the argument passed into the function must be the 'Argument' type.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Inline caches for call_function and call
+ * every (class, function) call site remembers the python types of its last params and their converters.
+ * a call with the same types skips the type dispatch, a mismatch takes the generic path and re-specializes
+ * the site. sites that keep changing types are left on the generic path.
+ * a site is found from its ClassProp and function name objects, the "Class.Function" name is only built
+ * the first time a pair of objects is seen
+ */
+#define INLINE_CACHE_MAX_PARAMS 8
+#define INLINE_CACHE_MAX_SITES 1024
+#define INLINE_CACHE_MAX_RESPECIALIZATIONS 16
+
+typedef struct {
+    bool specialized;
+    bool generic;
+    uint32_t respecializations;
+    Py_ssize_t params_size;
+    PyTypeObject* types[INLINE_CACHE_MAX_PARAMS];
+    ArgumentConverter converters[INLINE_CACHE_MAX_PARAMS];   // NULL for Argument objects passed through
+    uint64_t hits;
+    uint64_t misses;
+} InlineCache;
+
+static std::unordered_map<std::string, InlineCache> inline_caches;
+static std::string inline_cache_key;    // reused to look up a site by name without allocating
+
+// a call site seen before is found from the ClassProp and function name objects it passes, without
+// building its "Class.Function" name. both are held, so their addresses are not reused by other objects
+struct InlineCacheSite {
+    ClassProp* ue_class;
+    PyObject* function_name;
+    bool operator==(const InlineCacheSite& other) const { return ue_class == other.ue_class && function_name == other.function_name; }
+};
+
+struct InlineCacheSiteHash {
+    size_t operator()(const InlineCacheSite& site) const
+    {
+        return std::hash<const void*>()(site.ue_class) * 31 + std::hash<const void*>()(site.function_name);
+    }
+};
+
+static std::unordered_map<InlineCacheSite, InlineCache*, InlineCacheSiteHash> inline_cache_sites;
+
+static void clear_inline_cache_sites()
+{
+    for (auto& site : inline_cache_sites) {
+        Py_DECREF(site.first.ue_class);
+        Py_DECREF(site.first.function_name);
+    }
+    inline_cache_sites.clear();
+}
+
+static InlineCache* find_inline_cache(ClassProp* ue_class, PyObject* function_name_object, const char* function_name)
+{
+    auto site = inline_cache_sites.find(InlineCacheSite{ue_class, function_name_object});
+    if (site != inline_cache_sites.end()) {
+        return site->second;
+    }
+
+    // other ClassProp or str objects of the same names share the cache of the site
+    inline_cache_key.assign(ue_class->type_name);
+    inline_cache_key.push_back('.');
+    inline_cache_key.append(function_name);
+
+    InlineCache* cache;
+    auto it = inline_caches.find(inline_cache_key);
+    if (it != inline_caches.end()) {
+        cache = &it->second;
+    }
+    else if (inline_caches.size() < INLINE_CACHE_MAX_SITES) {
+        cache = &inline_caches[inline_cache_key];
+    }
+    else {
+        return NULL;
+    }
+
+    // names built per call would each add an entry, those sites stay on the lookup by name
+    if (inline_cache_sites.size() < INLINE_CACHE_MAX_SITES * 4) {
+        Py_INCREF(ue_class);
+        Py_INCREF(function_name_object);
+        inline_cache_sites.emplace(InlineCacheSite{ue_class, function_name_object}, cache);
+    }
+    return cache;
+}
+
+static bool inline_cache_matches(const InlineCache* cache, PyObject* const* values, Py_ssize_t values_size)
+{
+    if (!cache->specialized || cache->params_size != values_size) {
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < values_size; i++) {
+        if (Py_TYPE(values[i]) != cache->types[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void release_inline_cache_types(InlineCache* cache)
+{
+    if (cache->specialized) {
+        for (Py_ssize_t i = 0; i < cache->params_size; i++) {
+            Py_DECREF(cache->types[i]);
+        }
+        cache->specialized = false;
+    }
+}
+
+static void specialize_inline_cache(InlineCache* cache, PyObject* const* values, Py_ssize_t values_size, const ArgumentConverter* converters)
+{
+    if (cache->generic) {
+        return;
+    }
+    if (cache->specialized) {
+        cache->respecializations++;
+    }
+    release_inline_cache_types(cache);
+
+    if (values_size > INLINE_CACHE_MAX_PARAMS || cache->respecializations >= INLINE_CACHE_MAX_RESPECIALIZATIONS) {
+        cache->generic = true;
+        return;
+    }
+
+    // the cache holds a reference to the types, so their address can not be reused by another type
+    for (Py_ssize_t i = 0; i < values_size; i++) {
+        cache->types[i] = Py_TYPE(values[i]);
+        Py_INCREF(cache->types[i]);
+        cache->converters[i] = converters[i];
+    }
+    cache->params_size = values_size;
+    cache->specialized = true;
+}
+
+#define CALL_PARAMS_INLINE 16
+
+/**
+ * params of call_function and call, converted once with the same rules as Argument but without
+ * creating an Argument object per value, then written with either param encoding.
+ * plain values go through the inline cache of the call site, Argument objects are passed through
+ */
+class CallParams {
+public:
+    CallParams() = default;
+    CallParams(const CallParams&) = delete;
+
+    ~CallParams()
+    {
+        for (Py_ssize_t i = 0; i < converted_size; i++) {
+            if (arguments[i] == NULL) {
+                release_argument_value(values[i]);
+            }
+        }
+    }
+
+    bool convert(PyObject* const* items, Py_ssize_t items_size, InlineCache* cache)
+    {
+        if (items_size > CALL_PARAMS_INLINE) {
+            heap_values.resize((size_t)items_size);
+            heap_arguments.resize((size_t)items_size);
+            values = heap_values.data();
+            arguments = heap_arguments.data();
+        }
+        size = items_size;
+
+        bool hit = cache != NULL && inline_cache_matches(cache, items, items_size);
+        if (cache != NULL) {
+            hit ? cache->hits++ : cache->misses++;
+        }
+        ArgumentConverter observed[INLINE_CACHE_MAX_PARAMS];
+
+        for (Py_ssize_t i = 0; i < items_size; i++) {
+            PyObject* item = items[i];
+
+            ArgumentConverter converter;
+            if (hit) {
+                converter = cache->converters[i];
+            }
+            else {
+                converter = PyObject_TypeCheck(item, &Argument_Type) ? NULL : find_argument_converter(item);
+                if (i < INLINE_CACHE_MAX_PARAMS) {
+                    observed[i] = converter;
+                }
+            }
+
+            // prebuilt arguments, e.g. to pass a name or a type hint
+            if (converter == NULL) {
+                arguments[i] = (Argument*)item;
+                values[i] = arguments[i]->data;
+                described = true;
+            }
+            else {
+                arguments[i] = NULL;
+                if (converter(&values[i], item, NULL) < 0) {
+                    return false;
+                }
+            }
+            converted_size++;
+        }
+
+        if (cache != NULL && !hit) {
+            specialize_inline_cache(cache, items, items_size, observed);
+        }
+        return true;
+    }
+
+    // the Argument encoding, plain values are tagged with the class of the called function
+    bool write_arguments(capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder& dest_args, ClassProp* ue_class) const
+    {
+        for (Py_ssize_t i = 0; i < size; i++) {
+            UnrealCore::Argument::Builder dest_arg = dest_args[(uint32_t)i];
+            bool written;
+            if (arguments[i] != NULL) {
+                written = create_unreal_rpc_argument((PyObject*)arguments[i], dest_arg);
+            }
+            else {
+                dest_arg.initUeClass().setTypeName(ue_class->type_name);
+                written = set_unreal_rpc_argument_value(values[i], dest_arg);
+            }
+            if (!written) {
+                if (!PyErr_Occurred()) {
+                    PyErr_SetString(PyExc_RuntimeError, "Failure to create parameters needed for unreal rpc call.");
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ArgumentValue* values = inline_values;
+    Argument** arguments = inline_arguments;    // NULL for plain values
+    Py_ssize_t size = 0;
+    bool described = false;                     // some param is an Argument with its own name and class
+
+private:
+    ArgumentValue inline_values[CALL_PARAMS_INLINE];
+    Argument* inline_arguments[CALL_PARAMS_INLINE];
+    std::vector<ArgumentValue> heap_values;
+    std::vector<Argument*> heap_arguments;
+    Py_ssize_t converted_size = 0;
+};
+
+/**
+ * unreal_core.inline_cache_stats
+ * hit and miss counts of the call_function / call inline caches
+ * 
+ * return:
+ *   dict of "Class.Function" -> (hits, misses, state), state is "specialized", "generic" or "empty"
+ */
+static PyObject* unreal_core_inline_cache_stats(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    PyObject* stats = PyDict_New();
+    if (stats == NULL) {
+        return NULL;
+    }
+
+    for (const auto& site : inline_caches) {
+        const InlineCache& cache = site.second;
+        const char* state = cache.generic ? "generic" : (cache.specialized ? "specialized" : "empty");
+        PyObject* entry = Py_BuildValue("(KKs)", (unsigned long long)cache.hits, (unsigned long long)cache.misses, state);
+        if (entry == NULL || PyDict_SetItemString(stats, site.first.c_str(), entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(stats);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+    return stats;
+}
+
+/**
+ * unreal_core.reset_inline_caches
+ * drop all call_function / call inline caches and their counters
+ */
+static PyObject* unreal_core_reset_inline_caches(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    for (auto& site : inline_caches) {
+        release_inline_cache_types(&site.second);
+    }
+    clear_inline_cache_sites();
+    inline_caches.clear();
+    Py_RETURN_NONE;
+}
+
+/**
+ * unreal_core.new_object
+ * call rpc function (newObject) to create a new ue object
+ * 
+ * args:
+ *   object: pyobject
+ *   ue_class: ue class name
+ *   flags: ue object flags
+ *   construct_args: sequence of struct Argument
+ * 
+ * return:
+ *   ue object address
+ */
+static PyObject* unreal_core_new_object(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    if (!check_positional_args("new_object", nargs, 5, 5) ||
+        !check_arg_type("new_object", args, 1, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    PyObject* object = args[0];
+    ClassProp* ue_class = (ClassProp*)args[1];
+    const char* object_name = unpack_str_arg("new_object", args, 2);
+    if (object_name == NULL) {
+        return NULL;
+    }
+    uint32_t flags = (uint32_t)PyLong_AsUnsignedLongMask(args[3]);
+    if (flags == (uint32_t)-1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    SequenceItems construct_args;
+    if (!construct_args.open(args[4], "new_object() argument 5 must be a sequence")) {
+        return NULL;
+    }
+
+    // if (object == Py_None)
+    // {
+    //     PyErr_SetString(PyExc_RuntimeError, "object can not be None.");
+    //     return NULL;
+    // }
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+
+    capnp::Request<UnrealCore::NewObjectParams, UnrealCore::NewObjectResults> new_object_request = client.newObjectRequest(request_size_hint(REQUEST_NEW_OBJECT));
+    new_object_request.getUeClass().setTypeName(ue_class->type_name);
+    new_object_request.setFlags(flags);
+    new_object_request.setObjName(object_name);
+    new_object_request.getOwn().setAddress(reinterpret_cast<uint64_t>(object));
+    new_object_request.getOwn().setName(object_name);
+
+    // handle construct_args
+    // get list size
+    Py_ssize_t list_size = construct_args.size;
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder new_object_args = new_object_request.initConstructArgs(list_size);
+
+    if (!setup_unreal_rpc_arguments_from_list(construct_args.items, new_object_args, list_size))
+    {
+        return NULL;
+    }
+
+    record_request_size(REQUEST_NEW_OBJECT, new_object_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::NewObjectResults> result = new_object_request.send().wait(wait_scope);
+        
+        UnrealObject* unreal_object = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type);
+        unreal_object->address = result.getObject().getAddress();
+        unreal_object->name = deep_copy_str(result.getObject().getName());
+        unreal_object->class_id = intern_class_id(ue_class->type_name.c_str(), ue_class->type_name.size());
+
+        return (PyObject*)unreal_object;
+
+    })
+}
+
+/**
+ * unreal_core.destory_object
+ * call rpc function (destoryObject) to destory a ue object
+ * 
+ * args:
+ *   object: pyobject
+ * 
+ * return:
+ *   bool
+ */
+static PyObject* unreal_core_destory_object(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    if (!check_positional_args("destory_object", nargs, 1, 1)) {
+        return NULL;
+    }
+    PyObject* object = args[0];
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto destory_object_request = client.destroyObjectRequest(request_size_hint(REQUEST_DESTROY_OBJECT));
+    destory_object_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
+
+    record_request_size(REQUEST_DESTROY_OBJECT, destory_object_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::DestroyObjectResults> result = destory_object_request.send().wait(wait_scope);
+        if (result.getResult()) {
+            Py_RETURN_TRUE;
+        }
+        else {
+            Py_RETURN_FALSE;
+        }
+    })
+}
+
+/**
+ * instance of the python class of class_type_name holding unreal_object, without running __init__.
+ * steals the reference to unreal_object
+ */
+static PyObject* create_object_from_specified_class(const char* class_type_name, UnrealObject* unreal_object)
+{
+    const PythonClass* python_class = find_python_class(class_type_name);
+    if (python_class == NULL) {
+        Py_DECREF(unreal_object);
+        return NULL;
+    }
+
+    PyTypeObject* py_class = python_class->py_class;
+    PyObject* py_object = py_class->tp_alloc(py_class, 0);
+    if (py_object == NULL) {
+        Py_DECREF(unreal_object);
+        return NULL;
+    }
+
+    if (python_class->handle_offset >= 0) {
+        *(PyObject**)((char*)py_object + python_class->handle_offset) = (PyObject*)unreal_object;
+        return py_object;
+    }
+
+    // set unreal object to the py object's property, property name is UNREAD_OBJECT_PROPERTY_NAME
+    int result = PyObject_SetAttrString(py_object, UNREAD_OBJECT_PROPERTY_NAME, (PyObject*)unreal_object);
+    Py_DECREF(unreal_object);
+    if (result != 0) {
+        Py_DECREF(py_object);
+        return NULL;
+    }
+    return py_object;
+}
+
+static PyObject* send_pyobject_to_unreal_engine(PyObject* py_object, UnrealObject* unreal_object, const char* class_type_name)
+{
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto create_py_object_request = client.registerCreatedPyObjectRequest(request_size_hint(REQUEST_REGISTER_CREATED_PY_OBJECT));
+    create_py_object_request.initPyObject().setAddress(reinterpret_cast<uint64_t>(py_object));
+    create_py_object_request.initUnrealObject().setAddress(unreal_object->address);
+    create_py_object_request.initUeClass().setTypeName(class_type_name);
+
+    record_request_size(REQUEST_REGISTER_CREATED_PY_OBJECT, create_py_object_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        create_py_object_request.send().wait(wait_scope);
+        return Py_True;
+    })
+}
+
+/**
+ * Response owner
+ * keeps a capnp response alive while python objects still point into its message
+ */
+class ResponseHolder {
+public:
+    virtual ~ResponseHolder() noexcept(false) {}
+};
+
+template <typename T>
+class TypedResponseHolder final : public ResponseHolder {
+public:
+    explicit TypedResponseHolder(capnp::Response<T>&& response) : response(kj::mv(response)) {}
+
+    capnp::Response<T> response;
+};
+
+typedef struct {
+    PyObject_HEAD
+    ResponseHolder* holder;
+} ResponseOwner;
+
+static void ResponseOwner_dealloc(ResponseOwner* self)
+{
+    delete self->holder;
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyTypeObject ResponseOwner_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.ResponseOwner",       /* tp_name */
+    sizeof(ResponseOwner),             /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)ResponseOwner_dealloc,  /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    0,                             /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Keeps an unreal engine rpc response alive",  /* tp_doc */
+};
+
+/**
+ * move a response into a new owner, readers taken from the response before stay valid
+ */
+template <typename T>
+static PyObject* new_response_owner(capnp::Response<T>& response)
+{
+    ResponseOwner* owner = PyObject_New(ResponseOwner, &ResponseOwner_Type);
+    if (owner == NULL) {
+        return NULL;
+    }
+    owner->holder = new TypedResponseHolder<T>(kj::mv(response));
+    return (PyObject*)owner;
+}
+
+/**
+ * Response view
+ * read-only one dimensional buffer over a Text, Data or primitive list of a response message,
+ * exported to python as a memoryview without creating a python object per element
+ */
+typedef struct {
+    PyObject_HEAD
+    PyObject* owner;
+    const void* data;
+    Py_ssize_t length;      // elements
+    Py_ssize_t itemsize;
+    const char* format;
+} ResponseView;
+
+static int ResponseView_getbuffer(ResponseView* self, Py_buffer* view, int flags)
+{
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "response views are read-only");
+        view->obj = NULL;
+        return -1;
+    }
+
+    Py_INCREF(self);
+    view->obj = (PyObject*)self;
+    view->buf = (void*)self->data;
+    view->len = self->length * self->itemsize;
+    view->readonly = 1;
+    view->itemsize = self->itemsize;
+    view->format = (flags & PyBUF_FORMAT) ? (char*)self->format : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? &self->length : NULL;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? &self->itemsize : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static void ResponseView_dealloc(ResponseView* self)
+{
+    Py_XDECREF(self->owner);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyBufferProcs ResponseView_as_buffer = {
+    (getbufferproc)ResponseView_getbuffer,
+    NULL,
+};
+
+static PyTypeObject ResponseView_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.ResponseView",    /* tp_name */
+    sizeof(ResponseView),          /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)ResponseView_dealloc,  /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    0,                             /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    &ResponseView_as_buffer,       /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Buffer over a value in an unreal engine rpc response",  /* tp_doc */
+};
+
+// Text results of at least this many bytes come back as memoryviews, 0 always builds str
+static size_t text_view_threshold = 0;
+
+/**
+ * owner of the response being parsed, created on the first view into the response
+ */
+class LazyResponseOwner {
+public:
+    template <typename T>
+    explicit LazyResponseOwner(capnp::Response<T>& response)
+        : response(&response), create(&create_owner<T>) {}
+
+    // the response already lives in an owner
+    explicit LazyResponseOwner(PyObject* owner)
+        : response(NULL), create(NULL), owner(owner)
+    {
+        Py_INCREF(owner);
+    }
+
+    ~LazyResponseOwner()
+    {
+        Py_XDECREF(owner);
+    }
+
+    // borrowed reference, NULL with an exception set on failure
+    PyObject* get()
+    {
+        if (owner == NULL) {
+            owner = create(response);
+        }
+        return owner;
+    }
+
+private:
+    template <typename T>
+    static PyObject* create_owner(void* response)
+    {
+        return new_response_owner(*(capnp::Response<T>*)response);
+    }
+
+    void* response;
+    PyObject* (*create)(void*);
+    PyObject* owner = NULL;
+};
+
+static PyObject* new_response_view(LazyResponseOwner& response_owner, kj::ArrayPtr<const kj::byte> bytes, Py_ssize_t itemsize, const char* format)
+{
+    PyObject* owner = response_owner.get();
+    if (owner == NULL) {
+        return NULL;
+    }
+
+    ResponseView* view = PyObject_New(ResponseView, &ResponseView_Type);
+    if (view == NULL) {
+        return NULL;
+    }
+    Py_INCREF(owner);
+    view->owner = owner;
+    view->data = bytes.begin();
+    view->length = (Py_ssize_t)bytes.size() / itemsize;
+    view->itemsize = itemsize;
+    view->format = format;
+
+    PyObject* memory_view = PyMemoryView_FromObject((PyObject*)view);
+    Py_DECREF(view);
+    return memory_view;
+}
+
+template <typename T>
+static PyObject* new_list_view(LazyResponseOwner& response_owner, typename capnp::List<T>::Reader list, const char* format)
+{
+    return new_response_view(response_owner, capnp::AnyList::Reader(kj::mv(list)).getRawBytes(), sizeof(T), format);
+}
+
+/**
+ * parse a response, the response is moved into an owner only when a view into it is returned
+ */
+template <typename T, typename Parser>
+static PyObject* parse_response(capnp::Response<T>& response, Parser parse)
+{
+    typename T::Reader reader = response;
+    LazyResponseOwner owner(response);
+    return parse(reader, owner);
+}
+
+/**
+ * unreal_core.set_text_view_threshold
+ * return Text results of at least this many bytes as read-only memoryviews of the response
+ * instead of str, 0 disables views
+ * 
+ * args:
+ *   threshold: int, bytes
+ */
+static PyObject* unreal_core_set_text_view_threshold(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_text_view_threshold", nargs, 1, 1)) {
+        return NULL;
+    }
+    Py_ssize_t threshold = PyLong_AsSsize_t(args[0]);
+    if (threshold == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (threshold < 0) {
+        PyErr_SetString(PyExc_ValueError, "threshold must not be negative");
+        return NULL;
+    }
+    text_view_threshold = (size_t)threshold;
+    Py_RETURN_NONE;
+}
+
+static PyObject* read_struct_value(const UnrealCore::StructValue::Reader& struct_value, LazyResponseOwner& response_owner);
+
+static PyObject* parse_wire_value(const  UnrealCore::Argument::Reader& return_value, bool is_retrun_value, LazyResponseOwner& response_owner)
+{
+    // Initialize the object's fields
+    capnp::Text::Reader class_type = return_value.getUeClass().getTypeName();
+    const char* class_type_name = class_type.cStr();
+
+    if (class_type == "void") {
+        Py_RETURN_NONE;
+    }
+
+    // Set the value based on the return type
+    switch (return_value.which()) {
+        case UnrealCore::Argument::BOOL_VALUE:
+            return read_marshalled<bool>(return_value);
+        case UnrealCore::Argument::UINT_VALUE:
+            return read_marshalled<uint64_t>(return_value);
+        case UnrealCore::Argument::INT_VALUE:
+            return read_marshalled<int64_t>(return_value);
+        case UnrealCore::Argument::FLOAT_VALUE:
+            return read_marshalled<double>(return_value);
+        case UnrealCore::Argument::STR_VALUE:
+        {
+            // lengths are known from the message, decode straight from the segment
+            capnp::Text::Reader text = return_value.getStrValue();
+            if (text_view_threshold != 0 && text.size() >= text_view_threshold) {
+                return new_response_view(response_owner, text.asBytes(), 1, "B");
+            }
+            return read_marshalled<Utf8Value>(return_value);
+        }
+        case UnrealCore::Argument::STR_UTF16_VALUE:
+            return read_utf16_string(return_value.getStrUtf16Value());
+        case UnrealCore::Argument::ENUM_VALUE:
+            return read_marshalled<EnumValue>(return_value);
+        case UnrealCore::Argument::FLOAT32_LIST:
+            return new_list_view<float>(response_owner, return_value.getFloat32List(), "f");
+        case UnrealCore::Argument::FLOAT64_LIST:
+            return new_list_view<double>(response_owner, return_value.getFloat64List(), "d");
+        case UnrealCore::Argument::INT32_LIST:
+            return new_list_view<int32_t>(response_owner, return_value.getInt32List(), "i");
+        case UnrealCore::Argument::INT64_LIST:
+            return new_list_view<int64_t>(response_owner, return_value.getInt64List(), "q");
+        case UnrealCore::Argument::DATA_VALUE:
+            return new_response_view(response_owner, return_value.getDataValue(), 1, "B");
+        case UnrealCore::Argument::VECTOR2_D_VALUE:
+            return read_marshalled<Vector2DValue>(return_value);
+        case UnrealCore::Argument::VECTOR_VALUE:
+            return read_marshalled<VectorValue>(return_value);
+        case UnrealCore::Argument::ROTATOR_VALUE:
+            return read_marshalled<RotatorValue>(return_value);
+        case UnrealCore::Argument::QUAT_VALUE:
+            return read_marshalled<QuatValue>(return_value);
+        case UnrealCore::Argument::TRANSFORM_VALUE:
+            return read_marshalled<TransformValue>(return_value);
+        case UnrealCore::Argument::STRUCT_VALUE:
+            return read_struct_value(return_value.getStructValue(), response_owner);
+        case UnrealCore::Argument::OBJECT:
+        {
+            if (!is_retrun_value) {
+                uint64_t address = return_value.getObject().getAddress();
+                void* object = (void*)address;
+                return (PyObject*)object;
+            }
+
+            // Handle the case where return value is an unreal object:
+            // 1. Create a corresponding pyobject based on the class name
+            // 2. Set the obtained unreal object to the corresponding property
+            // 3. Return the created pyobject
+            // Create a new UnrealObject for object returns
+            UnrealObject* obj = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type);
+            if (obj == NULL) {
+                return NULL;
+            }
+            obj->address = return_value.getObject().getAddress();
+            obj->name = deep_copy_str(return_value.getObject().getName());
+            obj->class_id = intern_class_id(class_type_name, class_type.size());
+            PyObject* py_object = create_object_from_specified_class(class_type_name, obj);
+            if (py_object == NULL) {
+                return NULL;
+            }
+
+            // register the py object to unreal engine
+            send_pyobject_to_unreal_engine(py_object, obj, class_type_name);
+
+            return py_object;
+        }
+        default:
+        {
+            PyErr_SetString(PyExc_ValueError, "Unsupported return value type");
+            return NULL;
+        }
+
+    }
+
+    return NULL;
+}
+
+// values of a ue class registered with a decoder are handed to it
+static PyObject* parse_value_from_function_return(const  UnrealCore::Argument::Reader& return_value, bool is_retrun_value, LazyResponseOwner& response_owner)
+{
+    PyObject* value = parse_wire_value(return_value, is_retrun_value, response_owner);
+    if (value == NULL || registered_type_names.empty() || return_value.isStructValue()) {
+        return value;
+    }
+
+    auto it = registered_type_names.find(return_value.getUeClass().getTypeName().cStr());
+    if (it != registered_type_names.end() && it->second->decoder != NULL) {
+        Py_SETREF(value, PyObject_CallFunctionObjArgs(it->second->decoder, value, NULL));
+    }
+    return value;
+}
+
+/**
+ * a struct of a registered type is rebuilt with its decoder, or by calling the type with the fields
+ * in order. unknown types decode to a dict of the fields
+ */
+static PyObject* read_struct_value(const UnrealCore::StructValue::Reader& struct_value, LazyResponseOwner& response_owner)
+{
+    auto fields = struct_value.getFields();
+    auto it = registered_type_names.find(struct_value.getTypeName().cStr());
+
+    if (it == registered_type_names.end()) {
+        PyObject* dict = PyDict_New();
+        for (uint32_t i = 0; dict != NULL && i < fields.size(); i++) {
+            PyObject* field = parse_value_from_function_return(fields[i], true, response_owner);
+            if (field == NULL || PyDict_SetItemString(dict, fields[i].getName().cStr(), field) < 0) {
+                Py_XDECREF(field);
+                Py_CLEAR(dict);
+                break;
+            }
+            Py_DECREF(field);
+        }
+        return dict;
+    }
+
+    PyObject* values = PyTuple_New(fields.size());
+    for (uint32_t i = 0; values != NULL && i < fields.size(); i++) {
+        PyObject* field = parse_value_from_function_return(fields[i], true, response_owner);
+        if (field == NULL) {
+            Py_CLEAR(values);
+            break;
+        }
+        PyTuple_SET_ITEM(values, i, field);
+    }
+    if (values == NULL) {
+        return NULL;
+    }
+
+    const RegisteredType* registered = it->second;
+    PyObject* callable = registered->decoder != NULL ? registered->decoder : (PyObject*)registered->type;
+    PyObject* result = PyObject_Call(callable, values, NULL);
+    Py_DECREF(values);
+    return result;
+}
+
+// results of callFunction and callFunctionPacked
+template <typename Results>
+static PyObject* parse_call_function_results(const Results& result, LazyResponseOwner& response_owner)
+{
+    PyObject* return_value = parse_value_from_function_return(result.getReturn(), true, response_owner);
+    if (return_value == NULL) {
+        return NULL; 
+    }
+
+    if (Py_None == return_value) {
+        Py_DECREF(return_value);
+        return PyTuple_New(0);
+    }
+
+    // handle out params
+    auto out_params = result.getOutParams();
+    auto out_params_size = out_params.size();
+
+    PyObject* tuple = PyTuple_New(out_params_size + 1); // +1 for return value
+    PyTuple_SetItem(tuple, 0, return_value);
+
+    for (Py_ssize_t i = 0; i < out_params_size; ++i) {
+        // fixme: do not create new py object when out params is unreal object, directly return the passed in py object
+        PyObject* out_param = parse_value_from_function_return(out_params[i], false, response_owner);
+        if (out_param == NULL) {
+            // the tuple owns return_value
+            Py_DECREF(tuple);
+            return NULL;
+        }
+
+        PyTuple_SetItem(tuple, i + 1, out_param);
+    }
+
+    return tuple; 
+}
+
+/**
+ * Result view
+ * callFunction results decoded on access: keeps the response alive and turns the return value or an
+ * out param into a python object only when it is indexed, so unused out params and unreal object
+ * returns cost nothing. indexes like the tuple returned by call_function, decoded items are cached
+ */
+typedef struct {
+    PyObject_HEAD
+    PyObject* owner;
+    UnrealCore::Argument::Reader return_value;
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Reader out_params;
+    Py_ssize_t size;        // 0 for a void return, otherwise 1 + out params
+    PyObject** items;       // decoded items, NULL until decoded
+} ResultView;
+
+// call_function, call and prepared calls return a ResultView instead of a tuple
+static bool lazy_results = false;
+
+static void ResultView_dealloc(ResultView* self)
+{
+    if (self->items != NULL) {
+        for (Py_ssize_t i = 0; i < self->size; i++) {
+            Py_XDECREF(self->items[i]);
+        }
+        PyMem_Free(self->items);
+    }
+    Py_XDECREF(self->owner);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static Py_ssize_t ResultView_length(ResultView* self)
+{
+    return self->size;
+}
+
+static PyObject* ResultView_item(ResultView* self, Py_ssize_t index)
+{
+    if (index < 0 || index >= self->size) {
+        PyErr_SetString(PyExc_IndexError, "result index out of range");
+        return NULL;
+    }
+
+    if (self->items == NULL) {
+        self->items = (PyObject**)PyMem_Calloc((size_t)self->size, sizeof(PyObject*));
+        if (self->items == NULL) {
+            return PyErr_NoMemory();
+        }
+    }
+    if (self->items[index] == NULL) {
+        LazyResponseOwner response_owner(self->owner);
+        self->items[index] = index == 0 ?
+            parse_value_from_function_return(self->return_value, true, response_owner) :
+            parse_value_from_function_return(self->out_params[(uint32_t)(index - 1)], false, response_owner);
+        if (self->items[index] == NULL) {
+            return NULL;
+        }
+    }
+    Py_INCREF(self->items[index]);
+    return self->items[index];
+}
+
+static PyObject* ResultView_get_return_value(ResultView* self, void* closure)
+{
+    if (self->size == 0) {
+        Py_RETURN_NONE;
+    }
+    return ResultView_item(self, 0);
+}
+
+static PyObject* ResultView_repr(ResultView* self)
+{
+    return PyUnicode_FromFormat("ResultView(size=%zd)", self->size);
+}
+
+static PySequenceMethods ResultView_as_sequence = {
+    (lenfunc)ResultView_length,    /* sq_length */
+    0,                             /* sq_concat */
+    0,                             /* sq_repeat */
+    (ssizeargfunc)ResultView_item, /* sq_item */
+};
+
+static PyGetSetDef ResultView_getset[] = {
+    {"return_value", (getter)ResultView_get_return_value, NULL, "Return value, None for a void function", NULL},
+    {NULL}  /* Sentinel */
+};
+
+static PyTypeObject ResultView_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.ResultView",      /* tp_name */
+    sizeof(ResultView),            /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)ResultView_dealloc,  /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)ResultView_repr,     /* tp_repr */
+    0,                             /* tp_as_number */
+    &ResultView_as_sequence,       /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    0,                             /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Function results decoded on access",  /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    0,                             /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    0,                             /* tp_members */
+    ResultView_getset,             /* tp_getset */
+};
+
+template <typename Results>
+static PyObject* new_result_view(const Results& result, LazyResponseOwner& response_owner)
+{
+    PyObject* owner = response_owner.get();
+    if (owner == NULL) {
+        return NULL;
+    }
+
+    ResultView* view = PyObject_New(ResultView, &ResultView_Type);
+    if (view == NULL) {
+        return NULL;
+    }
+    Py_INCREF(owner);
+    view->owner = owner;
+    new (&view->return_value) UnrealCore::Argument::Reader(result.getReturn());
+    new (&view->out_params) capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Reader(result.getOutParams());
+    view->size = view->return_value.getUeClass().getTypeName() == "void" ? 0 : (Py_ssize_t)view->out_params.size() + 1;
+    view->items = NULL;
+    return (PyObject*)view;
+}
+
+template <typename T>
+static PyObject* parse_call_function_response(capnp::Response<T>& response)
+{
+    return lazy_results ? parse_response(response, new_result_view<typename T::Reader>) :
+        parse_response(response, parse_call_function_results<typename T::Reader>);
+}
+
+/**
+ * unreal_core.set_lazy_results
+ * return a ResultView decoding the return value and out params on access from call_function,
+ * call and prepared calls instead of a tuple
+ * 
+ * args:
+ *   enabled: bool
+ */
+static PyObject* unreal_core_set_lazy_results(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_lazy_results", nargs, 1, 1)) {
+        return NULL;
+    }
+    int enabled = PyObject_IsTrue(args[0]);
+    if (enabled < 0) {
+        return NULL;
+    }
+    lazy_results = enabled != 0;
+    Py_RETURN_NONE;
+}
+
+/**
+ * Packed params
+ * v2 param encoding of callFunctionPacked: scalar params go into one typed list per kind behind a
+ * tag per param instead of an Argument struct each, so a call needs a handful of pointers whatever
+ * its arity. chosen automatically when the server advertises SERVER_FEATURE_PACKED_PARAMS, calls
+ * with params of other kinds (lists, data, value structs) keep the Argument encoding
+ */
+typedef enum {
+    PARAM_ENCODING_AUTO = 0,    // packed when the server supports it
+    PARAM_ENCODING_V1 = 1,      // always a list of Argument
+    PARAM_ENCODING_V2 = 2,      // always packed
+} ParamEncoding;
+
+static const char* param_encoding_names[] = {"auto", "v1", "v2"};
+static ParamEncoding param_encoding = PARAM_ENCODING_AUTO;
+
+#define PACKED_PARAMS_MAX 64
+
+typedef enum {
+    PACKED_LIST_INTS = 0,
+    PACKED_LIST_FLOATS,
+    PACKED_LIST_STRS,
+    PACKED_LIST_OBJECTS,
+    PACKED_LIST_COUNT,
+} PackedList;
+
+// the tag of a value kind on the wire, false when it needs the Argument encoding
+static inline bool packed_tag_of(ArgumentType value_type, UnrealCore::PackedTag& tag)
+{
+    switch (value_type) {
+        case ARGUMENT_TYPE_BOOL:
+            tag = UnrealCore::PackedTag::BOOL_VALUE;
+            return true;
+        case ARGUMENT_TYPE_UINT:
+            tag = UnrealCore::PackedTag::UINT_VALUE;
+            return true;
+        case ARGUMENT_TYPE_INT:
+            tag = UnrealCore::PackedTag::INT_VALUE;
+            return true;
+        case ARGUMENT_TYPE_ENUM:
+            tag = UnrealCore::PackedTag::ENUM_VALUE;
+            return true;
+        case ARGUMENT_TYPE_FLOAT:
+            tag = UnrealCore::PackedTag::FLOAT_VALUE;
+            return true;
+        case ARGUMENT_TYPE_STRING:
+            tag = UnrealCore::PackedTag::STR_VALUE;
+            return true;
+        case ARGUMENT_TYPE_OBJECT:
+            tag = UnrealCore::PackedTag::OBJECT;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// the list the values of a tag are packed into
+static inline PackedList packed_list_of(UnrealCore::PackedTag tag)
+{
+    switch (tag) {
+        case UnrealCore::PackedTag::FLOAT_VALUE:
+            return PACKED_LIST_FLOATS;
+        case UnrealCore::PackedTag::STR_VALUE:
+            return PACKED_LIST_STRS;
+        case UnrealCore::PackedTag::OBJECT:
+            return PACKED_LIST_OBJECTS;
+        default:
+            return PACKED_LIST_INTS;
+    }
+}
+
+static inline bool use_packed_params()
+{
+    return param_encoding == PARAM_ENCODING_V2 ||
+        (param_encoding == PARAM_ENCODING_AUTO && server_supports(SERVER_FEATURE_PACKED_PARAMS));
+}
+
+/**
+ * tags and list sizes of converted params, false when a param needs the Argument encoding
+ */
+static bool pack_call_params(const CallParams& params, UnrealCore::PackedTag* tags, uint32_t* list_sizes)
+{
+    if (params.size > PACKED_PARAMS_MAX) {
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < params.size; i++) {
+        const ArgumentValue& value = params.values[i];
+        // packed strs are utf8 Text
+        if (!packed_tag_of(value.value_type, tags[i]) || (value.value_type == ARGUMENT_TYPE_STRING && value.str_value == NULL)) {
+            return false;
+        }
+        list_sizes[packed_list_of(tags[i])]++;
+    }
+    return true;
+}
+
+/**
+ * call function with packed params, tags and list_sizes from pack_call_params.
+ * names and classes are only sent when a param is an Argument, plain values then get the class of the
+ * called function like in the Argument encoding
+ */
+static PyObject* call_function_packed(PyObject* object, UnrealObject* unreal_object, ClassProp* ue_class, const char* function_name,
+    const CallParams& params, const UnrealCore::PackedTag* tags, const uint32_t* list_sizes)
+{
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto call_function_request = client.callFunctionPackedRequest(request_size_hint(REQUEST_CALL_FUNCTION_PACKED));
+    call_function_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
+    call_function_request.initUeClass().setTypeName(ue_class->type_name);
+
+    auto call_object = call_function_request.initCallObject();
+    call_object.setName(unreal_object->name);
+    call_object.setAddress(unreal_object->address);
+
+    call_function_request.setFuncName(function_name);
+
+    UnrealCore::PackedParams::Builder packed = call_function_request.initParams();
+    packed.setTags(kj::arrayPtr(tags, (size_t)params.size));
+    auto ints = packed.initInts(list_sizes[PACKED_LIST_INTS]);
+    auto floats = packed.initFloats(list_sizes[PACKED_LIST_FLOATS]);
+    auto strs = packed.initStrs(list_sizes[PACKED_LIST_STRS]);
+    auto objects = packed.initObjects(list_sizes[PACKED_LIST_OBJECTS]);
+    capnp::List<capnp::Text>::Builder names = nullptr;
+    capnp::List<capnp::Text>::Builder classes = nullptr;
+    if (params.described) {
+        names = packed.initNames((uint32_t)params.size);
+        classes = packed.initClasses((uint32_t)params.size);
+    }
+
+    uint32_t next[PACKED_LIST_COUNT] = {0};
+    for (Py_ssize_t i = 0; i < params.size; i++) {
+        const ArgumentValue& value = params.values[i];
+        switch (value.value_type) {
+            case ARGUMENT_TYPE_BOOL:
+                ints.set(next[PACKED_LIST_INTS]++, value.bool_value);
+                break;
+            case ARGUMENT_TYPE_UINT:
+                ints.set(next[PACKED_LIST_INTS]++, (int64_t)value.uint_value);
+                break;
+            case ARGUMENT_TYPE_INT:
+                ints.set(next[PACKED_LIST_INTS]++, value.int_value);
+                break;
+            case ARGUMENT_TYPE_ENUM:
+                ints.set(next[PACKED_LIST_INTS]++, value.enum_value);
+                break;
+            case ARGUMENT_TYPE_FLOAT:
+                floats.set(next[PACKED_LIST_FLOATS]++, value.float_value);
+                break;
+            case ARGUMENT_TYPE_STRING:
+                strs.set(next[PACKED_LIST_STRS]++, capnp::Text::Reader(value.str_value, (size_t)value.str_length));
+                break;
+            case ARGUMENT_TYPE_OBJECT:
+                objects.set(next[PACKED_LIST_OBJECTS]++, reinterpret_cast<uint64_t>(value.object));
+                break;
+            default:
+                break;
+        }
+        if (params.described) {
+            Argument* argument = params.arguments[i];
+            if (argument != NULL) {
+                names.set((uint32_t)i, argument->name);
+                classes.set((uint32_t)i, argument->ue_class->type_name);
+            }
+            else {
+                classes.set((uint32_t)i, ue_class->type_name);
+            }
+        }
+    }
+
+    record_request_size(REQUEST_CALL_FUNCTION_PACKED, call_function_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::CallFunctionPackedResults> result = call_function_request.send().wait(wait_scope);
+        return parse_call_function_response(result);
+    })
+}
+
+/**
+ * call function with params converted once, packed when the server takes it and every param packs,
+ * in the Argument encoding otherwise
+ */
+static PyObject* call_function_with_values(PyObject* object, UnrealObject* unreal_object, ClassProp* ue_class, PyObject* function_name_object,
+    const char* function_name, PyObject* const* values, Py_ssize_t values_size)
+{
+    CallParams params;
+    if (!params.convert(values, values_size, find_inline_cache(ue_class, function_name_object, function_name))) {
+        return NULL;
+    }
+
+    UnrealCore::PackedTag tags[PACKED_PARAMS_MAX];
+    uint32_t list_sizes[PACKED_LIST_COUNT] = {0};
+    if (use_packed_params() && pack_call_params(params, tags, list_sizes)) {
+        return call_function_packed(object, unreal_object, ue_class, function_name, params, tags, list_sizes);
+    }
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto call_function_request = client.callFunctionRequest(request_size_hint(REQUEST_CALL_FUNCTION));
+    call_function_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
+    call_function_request.initUeClass().setTypeName(ue_class->type_name);
+
+    auto call_object = call_function_request.initCallObject();
+    call_object.setName(unreal_object->name);
+    call_object.setAddress(unreal_object->address);
+
+    call_function_request.setFuncName(function_name);
+
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder call_function_args = call_function_request.initParams((uint32_t)params.size);
+    if (!params.write_arguments(call_function_args, ue_class)) {
+        return NULL;
+    }
+
+    record_request_size(REQUEST_CALL_FUNCTION, call_function_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::CallFunctionResults> result = call_function_request.send().wait(wait_scope);
+        return parse_call_function_response(result);
+    })
+}
+
+#ifdef UNREAL_CORE_TESTING
+/**
+ * stand-in server: return the first packed param as an Argument, like the loopback callFunction.
+ * a param without a class has the class of the call
+ */
+static void echo_packed_param(UnrealCore::CallFunctionPackedParams::Reader request, UnrealCore::Argument::Builder result)
+{
+    UnrealCore::PackedParams::Reader params = request.getParams();
+    auto tags = params.getTags();
+    if (tags.size() == 0 || tags[0] == UnrealCore::PackedTag::OBJECT) {
+        result.initUeClass().setTypeName("void");
+        return;
+    }
+
+    capnp::Text::Reader ue_class = params.hasClasses() ? params.getClasses()[0] : capnp::Text::Reader();
+    result.initUeClass().setTypeName(ue_class.size() > 0 ? ue_class : request.getUeClass().getTypeName());
+    if (params.hasNames()) {
+        result.setName(params.getNames()[0]);
+    }
+    switch (tags[0]) {
+        case UnrealCore::PackedTag::BOOL_VALUE:
+            result.setBoolValue(params.getInts()[0] != 0);
+            break;
+        case UnrealCore::PackedTag::UINT_VALUE:
+            result.setUintValue((uint64_t)params.getInts()[0]);
+            break;
+        case UnrealCore::PackedTag::INT_VALUE:
+            result.setIntValue(params.getInts()[0]);
+            break;
+        case UnrealCore::PackedTag::ENUM_VALUE:
+            result.setEnumValue(params.getInts()[0]);
+            break;
+        case UnrealCore::PackedTag::FLOAT_VALUE:
+            result.setFloatValue(params.getFloats()[0]);
+            break;
+        case UnrealCore::PackedTag::STR_VALUE:
+            result.setStrValue(params.getStrs()[0]);
+            break;
+        default:
+            result.getUeClass().setTypeName("void");
+            break;
+    }
+}
+#endif  // UNREAL_CORE_TESTING
+
+/**
+ * unreal_core.set_param_encoding
+ * 
+ * args:
+ *   encoding: "auto" packs scalar params (callFunctionPacked) when the server supports it,
+ *             "v1" always sends a list of Argument, "v2" always packs
+ */
+static PyObject* unreal_core_set_param_encoding(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_param_encoding", nargs, 1, 1)) {
+        return NULL;
+    }
+    const char* encoding_name = unpack_str_arg("set_param_encoding", args, 0);
+    if (encoding_name == NULL) {
+        return NULL;
+    }
+
+    for (int encoding = PARAM_ENCODING_AUTO; encoding <= PARAM_ENCODING_V2; encoding++) {
+        if (strcmp(encoding_name, param_encoding_names[encoding]) == 0) {
+            param_encoding = (ParamEncoding)encoding;
+            Py_RETURN_NONE;
+        }
+    }
+    PyErr_Format(PyExc_ValueError, "unknown param encoding '%s'", encoding_name);
+    return NULL;
+}
+
+/**
+ * unreal_core.call_function
+ * call rpc function (callFunction) to call a function
+ * 
+ * args:
+ *   object: pyobject
+ *   ue_class: ue class name
+ *   function_name: str
+ *   params: sequence of struct Argument or plain values
+ * 
+ * returns:
+ *   return value: struct Argument
+ *   out param value: list of struct Argument
+ */
+static PyObject* unreal_core_call_function(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    if (!check_positional_args("call_function", nargs, 5, 5) ||
+        !check_arg_type("call_function", args, 1, &UnrealObject_Type) ||
+        !check_arg_type("call_function", args, 2, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    PyObject* object = args[0];
+    UnrealObject* unreal_object = (UnrealObject*)args[1];
+    ClassProp* ue_class = (ClassProp*)args[2];
+    const char* function_name = unpack_str_arg("call_function", args, 3);
+    if (function_name == NULL) {
+        return NULL;
+    }
+    SequenceItems params;
+    if (!params.open(args[4], "call_function() argument 5 must be a sequence")) {
+        return NULL;
+    }
+
+    return call_function_with_values(object, unreal_object, ue_class, args[3], function_name, params.items, params.size);
+}
+
+/**
+ * unreal_core.call
+ * call rpc function (callFunction) with plain python values as positional params,
+ * values are converted straight into the request with the same rules as Argument
+ * 
+ * args:
+ *   object: pyobject
+ *   unreal_object: UnrealObject
+ *   ue_class: ue class name
+ *   function_name: str
+ *   *values: param values, an Argument is passed through as is
+ * 
+ * returns:
+ *   same as call_function
+ */
+static PyObject* unreal_core_call(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    if (!check_positional_args("call", nargs, 4, PY_SSIZE_T_MAX) ||
+        !check_arg_type("call", args, 1, &UnrealObject_Type) ||
+        !check_arg_type("call", args, 2, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    PyObject* object = args[0];
+    UnrealObject* unreal_object = (UnrealObject*)args[1];
+    ClassProp* ue_class = (ClassProp*)args[2];
+    const char* function_name = unpack_str_arg("call", args, 3);
+    if (function_name == NULL) {
+        return NULL;
+    }
+
+    return call_function_with_values(object, unreal_object, ue_class, args[3], function_name, args + 4, nargs - 4);
+}
+
+/**
+ * Prepared call
+ * a member function call with a fixed signature: the converter of every param is chosen once and
+ * the constant part of the request (class, function name, param names and classes) is built once
+ * into a skeleton message. each call copies the skeleton and only patches the value slots.
+ * 
+ * when every param is a scalar (bool, int, float, enum) the skeleton is a complete request template:
+ * the byte offsets of the value slots are resolved once from the schema and each call writes the raw
+ * values into the template before copying it, without going through the union setters.
+ * other signatures with a specialized encoder convert and write all values in one inlined pass
+ */
+typedef struct {
+    ArgumentConverter converter;
+    const char* value_type;   // type hint passed to the converter
+    bool scalar;              // fixed size value, can be patched in the template
+    ArgumentType slot_type;
+    kj::byte* slot;           // value slot in the template data section, NULL when not patched in place
+    uint8_t slot_bit;         // bit of the slot byte for bool values
+} PreparedParam;
+
+typedef struct {
+    PyObject_HEAD
+    ClassProp* ue_class;
+    std::string func_name;
+    std::vector<PreparedParam> plan;
+    capnp::MallocMessageBuilder* skeleton;
+    size_t skeleton_words;
+    bool patch_in_place;
+    SpecializedEncoder encoder;     // encode<Ts...> of the signature, NULL when not instantiated
+#if PY_VERSION_HEX >= 0x03090000
+    vectorcallfunc vectorcall;
+#endif
+} PreparedCall;
+
+// words reserved on top of the skeleton for the per call fields (own, call object and strings)
+#define PREPARED_CALL_EXTRA_WORDS 32
+
+static int convert_prepared_enum_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    return convert_marshalled<EnumValue>(dest, value);
+}
+
+static int convert_auto_argument(ArgumentValue* dest, PyObject* value, const char* value_type)
+{
+    return find_argument_converter(value)(dest, value, value_type);
+}
+
+static const ParamKind param_kinds[] = {
+    {"auto", convert_auto_argument, false, ARGUMENT_TYPE_BOOL},
+    {"bool", convert_bool_argument, true, ARGUMENT_TYPE_BOOL},
+    {"int", convert_int_argument, true, ARGUMENT_TYPE_INT},
+    {"float", convert_float_argument, true, ARGUMENT_TYPE_FLOAT},
+    {"str", convert_str_argument, false, ARGUMENT_TYPE_STRING},
+    {"enum", convert_prepared_enum_argument, true, ARGUMENT_TYPE_ENUM},
+    {"object", convert_object_argument, false, ARGUMENT_TYPE_OBJECT},
+    {"buffer", convert_buffer_argument, false, ARGUMENT_TYPE_DATA},
+    {"Vector2D", convert_vector2d_argument, false, ARGUMENT_TYPE_VECTOR2D},
+    {"Vector", convert_vector_argument, false, ARGUMENT_TYPE_VECTOR},
+    {"Rotator", convert_rotator_argument, false, ARGUMENT_TYPE_ROTATOR},
+    {"Quat", convert_quat_argument, false, ARGUMENT_TYPE_QUAT},
+    {"Transform", convert_transform_argument, false, ARGUMENT_TYPE_TRANSFORM},
+};
+
+static const ParamKind* find_param_kind(const char* kind_name)
+{
+    for (const ParamKind& kind : param_kinds) {
+        if (strcmp(kind.name, kind_name) == 0) {
+            return &kind;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * param kinds accepted in a signature, None or "auto" keeps the per call type dispatch
+ */
+static bool find_prepared_param(PyObject* kind, PreparedParam& param)
+{
+    param.value_type = NULL;
+    param.scalar = false;
+    param.slot = NULL;
+    param.slot_bit = 0;
+    if (kind == Py_None) {
+        param.converter = convert_auto_argument;
+        return true;
+    }
+
+    const char* kind_name = PyUnicode_Check(kind) ? PyUnicode_AsUTF8(kind) : NULL;
+    if (kind_name == NULL) {
+        PyErr_SetString(PyExc_TypeError, "param kind must be a str or None");
+        return false;
+    }
+
+    const ParamKind* param_kind = find_param_kind(kind_name);
+    if (param_kind == NULL) {
+        PyErr_Format(PyExc_ValueError, "unknown param kind '%s'", kind_name);
+        return false;
+    }
+    param.converter = param_kind->converter;
+    param.scalar = param_kind->scalar;
+    param.slot_type = param_kind->slot_type;
+    return true;
+}
+
+/**
+ * unreal_core.register_converter
+ * convert values of a python type without the generic object path. subclasses use the converter of
+ * their nearest registered base, registering a type again replaces its converter
+ * 
+ * args:
+ *   pytype: the type
+ *   encoder: callable returning the value as wire_kind, None with "fields"
+ *   decoder: callable or None. with "fields" it is called with the fields of received structs of the
+ *            type in order (None calls pytype), otherwise with results whose ue class is named like
+ *            pytype
+ *   wire_kind: "fields" sends a dataclass, NamedTuple or attrs class as a struct of its fields,
+ *              or a param kind of prepare, e.g. "str" or "Vector"
+ */
+static PyObject* unreal_core_register_converter(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("register_converter", nargs, 4, 4)) {
+        return NULL;
+    }
+    if (!PyType_Check(args[0])) {
+        PyErr_Format(PyExc_TypeError, "register_converter() argument 1 must be a type, not %s", Py_TYPE(args[0])->tp_name);
+        return NULL;
+    }
+    PyObject* encoder = args[1] != Py_None ? args[1] : NULL;
+    PyObject* decoder = args[2] != Py_None ? args[2] : NULL;
+    if ((encoder != NULL && !PyCallable_Check(encoder)) || (decoder != NULL && !PyCallable_Check(decoder))) {
+        PyErr_SetString(PyExc_TypeError, "encoder and decoder must be callable or None");
+        return NULL;
+    }
+    const char* wire_kind = unpack_str_arg("register_converter", args, 3);
+    if (wire_kind == NULL) {
+        return NULL;
+    }
+
+    PyTypeObject* type = (PyTypeObject*)args[0];
+    const char* dot = strrchr(type->tp_name, '.');
+    RegisteredType registration;
+    registration.type = type;
+    registration.type_name = dot != NULL ? dot + 1 : type->tp_name;
+    registration.encoder = encoder;
+    registration.decoder = decoder;
+    registration.wire_converter = NULL;
+    registration.wire_value_type = NULL;
+    registration.is_tuple = false;
+    registration.has_dict_fields = false;
+
+    if (strcmp(wire_kind, "fields") == 0) {
+        if (encoder != NULL) {
+            PyErr_SetString(PyExc_TypeError, "\"fields\" reads the fields itself, encoder must be None");
+            return NULL;
+        }
+        if (!resolve_struct_layout(&registration)) {
+            for (PyObject* key : registration.field_keys) {
+                Py_DECREF(key);
+            }
+            return NULL;
+        }
+    }
+    else {
+        PreparedParam param;
+        if (!find_prepared_param(args[3], param)) {
+            return NULL;
+        }
+        if (param.converter == convert_auto_argument || encoder == NULL) {
+            PyErr_Format(PyExc_ValueError, "wire kind '%s' needs an encoder and a fixed param kind", wire_kind);
+            return NULL;
+        }
+        registration.wire_converter = param.converter;
+        registration.wire_value_type = param.value_type;
+    }
+    Py_XINCREF(encoder);
+    Py_XINCREF(decoder);
+
+    // replaced in place, converted values keep pointing at the registration
+    auto it = registered_types.find(type);
+    RegisteredType* registered;
+    if (it != registered_types.end()) {
+        registered = it->second;
+        Py_XDECREF(registered->encoder);
+        Py_XDECREF(registered->decoder);
+        for (PyObject* key : registered->field_keys) {
+            Py_DECREF(key);
+        }
+        registered_type_names.erase(registered->type_name);
+        *registered = std::move(registration);
+    }
+    else {
+        Py_INCREF(type);
+        registered = new RegisteredType(std::move(registration));
+        registered_types.emplace(type, registered);
+    }
+    registered_type_names[registered->type_name] = registered;
+
+    // the type and its subclasses may already be remembered with the generic converters
+    if (argument_converters.emplace(type, convert_registered_argument).second) {
+        Py_INCREF(type);
+    }
+    for (auto& entry : argument_converters) {
+        if (PyType_IsSubtype(entry.first, type)) {
+            entry.second = convert_registered_argument;
+        }
+    }
+    for (auto& site : inline_caches) {
+        release_inline_cache_types(&site.second);
+    }
+    Py_RETURN_NONE;
+}
+
+/**
+ * resolve the value slot of a scalar param in the template, and select its union member once
+ */
+static void bind_prepared_slot(PreparedParam& param, UnrealCore::Argument::Builder template_arg)
+{
+    static const char* slot_field_names[] = {
+        "boolValue",    // ARGUMENT_TYPE_BOOL
+        "uintValue",    // ARGUMENT_TYPE_UINT
+        "intValue",     // ARGUMENT_TYPE_INT
+        "floatValue",   // ARGUMENT_TYPE_FLOAT
+        "strValue",     // ARGUMENT_TYPE_STRING
+        "enumValue",    // ARGUMENT_TYPE_ENUM
+        "object",       // ARGUMENT_TYPE_OBJECT
+    };
+
+    ArgumentValue zero;
+    zero.value_type = param.slot_type;
+    zero.uint_value = 0;
+    set_unreal_rpc_argument_value(zero, template_arg);
+
+    // slot offsets are in units of the field size
+    capnp::StructSchema argument_schema = capnp::Schema::from<UnrealCore::Argument>();
+    uint32_t offset = argument_schema.getFieldByName(slot_field_names[param.slot_type]).getProto().getSlot().getOffset();
+    kj::ArrayPtr<kj::byte> data = capnp::AnyStruct::Builder(kj::mv(template_arg)).getDataSection();
+    if (param.slot_type == ARGUMENT_TYPE_BOOL) {
+        param.slot = data.begin() + offset / 8;
+        param.slot_bit = offset % 8;
+    }
+    else {
+        param.slot = data.begin() + offset * sizeof(uint64_t);
+    }
+}
+
+/**
+ * write a converted value into its template slot. capnp data is little endian, as are all the
+ * platforms unreal engine runs on, so 64 bit values are copied as is
+ */
+static void patch_prepared_slot(const PreparedParam& param, const ArgumentValue& value)
+{
+    switch (param.slot_type) {
+        case ARGUMENT_TYPE_BOOL:
+            if (value.bool_value) {
+                *param.slot |= (kj::byte)(1u << param.slot_bit);
+            }
+            else {
+                *param.slot &= (kj::byte)~(1u << param.slot_bit);
+            }
+            break;
+        case ARGUMENT_TYPE_FLOAT:
+            memcpy(param.slot, &value.float_value, sizeof(double));
+            break;
+        default:
+            memcpy(param.slot, &value.int_value, sizeof(int64_t));
+            break;
+    }
+}
+
+// values holds one value per param of the plan
+static PyObject* send_prepared_call(PreparedCall* self, PyObject* object, UnrealObject* unreal_object, PyObject* const* values)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    Py_ssize_t params_size = (Py_ssize_t)self->plan.size();
+    if (self->patch_in_place) {
+        for (Py_ssize_t i = 0; i < params_size; i++) {
+            const PreparedParam& param = self->plan[i];
+            ArgumentValue converted;
+            if (param.converter(&converted, values[i], param.value_type) < 0) {
+                return NULL;
+            }
+            patch_prepared_slot(param, converted);
+        }
+    }
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto call_function_request = client.callFunctionRequest(capnp::MessageSize{self->skeleton_words + PREPARED_CALL_EXTRA_WORDS, 0});
+    auto skeleton = self->skeleton->getRoot<UnrealCore::CallFunctionParams>().asReader();
+    call_function_request.setUeClass(skeleton.getUeClass());
+    call_function_request.setFuncName(skeleton.getFuncName());
+    call_function_request.setParams(skeleton.getParams());
+    call_function_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
+
+    auto call_object = call_function_request.initCallObject();
+    call_object.setName(unreal_object->name);
+    call_object.setAddress(unreal_object->address);
+
+    auto params = call_function_request.getParams();
+    if (self->encoder != NULL) {
+        if (!self->encoder(values, params)) {
+            return NULL;
+        }
+    }
+    for (Py_ssize_t i = 0; i < params_size && !self->patch_in_place && self->encoder == NULL; i++) {
+        const PreparedParam& param = self->plan[i];
+        ArgumentValue converted;
+        if (param.converter(&converted, values[i], param.value_type) < 0) {
+            return NULL;
+        }
+
+        UnrealCore::Argument::Builder dest_arg = params[i];
+        bool written = set_unreal_rpc_argument_value(converted, dest_arg);
+        release_argument_value(converted);
+        if (!written) {
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(PyExc_RuntimeError, "Failure to create parameters needed for unreal rpc call.");
+            }
+            return NULL;
+        }
+    }
+
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::CallFunctionResults> result = call_function_request.send().wait(wait_scope);
+        return parse_call_function_response(result);
+    })
+}
+
+static PyObject* PreparedCall_call_impl(PreparedCall* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    Py_ssize_t params_size = (Py_ssize_t)self->plan.size();
+    if (!check_positional_args(self->func_name.c_str(), nargs, params_size + 2, params_size + 2) ||
+        !check_arg_type(self->func_name.c_str(), args, 1, &UnrealObject_Type)) {
+        return NULL;
+    }
+    return send_prepared_call(self, args[0], (UnrealObject*)args[1], args + 2);
+}
+
+#if PY_VERSION_HEX >= 0x03090000
+static PyObject* PreparedCall_vectorcall(PyObject* self, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        PyErr_SetString(PyExc_TypeError, "prepared calls take no keyword arguments");
+        return NULL;
+    }
+    return PreparedCall_call_impl((PreparedCall*)self, args, PyVectorcall_NARGS(nargsf));
+}
+#endif
+
+static PyObject* PreparedCall_call(PreparedCall* self, PyObject* args, PyObject* kwargs)
+{
+    if (kwargs != NULL && PyDict_GET_SIZE(kwargs) > 0) {
+        PyErr_SetString(PyExc_TypeError, "prepared calls take no keyword arguments");
+        return NULL;
+    }
+    return PreparedCall_call_impl(self, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+}
+
+static PyObject* PreparedCall_repr(PreparedCall* self)
+{
+    return PyUnicode_FromFormat("PreparedCall(ue_class=%s, func_name=%s, params=%zd)",
+        self->ue_class->type_name.c_str(), self->func_name.c_str(), (Py_ssize_t)self->plan.size());
+}
+
+static void PreparedCall_dealloc(PreparedCall* self)
+{
+    Py_XDECREF(self->ue_class);
+    delete self->skeleton;
+    self->func_name.~basic_string();
+    self->plan.~vector();
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyTypeObject PreparedCall_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.PreparedCall",       /* tp_name */
+    sizeof(PreparedCall),             /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)PreparedCall_dealloc,  /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)PreparedCall_repr,   /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    (ternaryfunc)PreparedCall_call,  /* tp_call */
+    (reprfunc)PreparedCall_repr,   /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Unreal Engine function call with a precompiled signature",  /* tp_doc */
+};
+
+// builds the request skeleton and param plan of a signature, see prepare
+static PreparedCall* compile_prepared_call(ClassProp* ue_class, const char* function_name, PyObject* signature_object, const char* error_message)
+{
+    SequenceItems signature;
+    if (!signature.open(signature_object, error_message)) {
+        return NULL;
+    }
+
+    PreparedCall* prepared = (PreparedCall*)PreparedCall_Type.tp_alloc(&PreparedCall_Type, 0);
+    if (prepared == NULL) {
+        return NULL;
+    }
+    new (&prepared->func_name) std::string(function_name);
+    new (&prepared->plan) std::vector<PreparedParam>();
+    prepared->skeleton = new capnp::MallocMessageBuilder();
+    prepared->patch_in_place = false;
+    prepared->encoder = NULL;
+    Py_INCREF(ue_class);
+    prepared->ue_class = ue_class;
+#if PY_VERSION_HEX >= 0x03090000
+    prepared->vectorcall = PreparedCall_vectorcall;
+#endif
+
+    auto skeleton = prepared->skeleton->initRoot<UnrealCore::CallFunctionParams>();
+    skeleton.initUeClass().setTypeName(ue_class->type_name);
+    skeleton.setFuncName(function_name);
+    auto params = skeleton.initParams((uint32_t)signature.size);
+    std::string signature_key;
+
+    for (Py_ssize_t i = 0; i < signature.size; i++) {
+        PyObject* entry = signature.items[i];
+        PyObject* name = entry;
+        PyObject* kind = Py_None;
+        if (PyTuple_Check(entry)) {
+            if (PyTuple_GET_SIZE(entry) != 2) {
+                PyErr_SetString(PyExc_ValueError, "signature entries must be a name or a (name, kind) pair");
+                Py_DECREF(prepared);
+                return NULL;
+            }
+            name = PyTuple_GET_ITEM(entry, 0);
+            kind = PyTuple_GET_ITEM(entry, 1);
+        }
+
+        const char* param_name = PyUnicode_Check(name) ? PyUnicode_AsUTF8(name) : NULL;
+        if (param_name == NULL) {
+            PyErr_SetString(PyExc_TypeError, "param name must be a str");
+            Py_DECREF(prepared);
+            return NULL;
+        }
+
+        PreparedParam param;
+        if (!find_prepared_param(kind, param)) {
+            Py_DECREF(prepared);
+            return NULL;
+        }
+        prepared->plan.push_back(param);
+        if (i > 0) {
+            signature_key.push_back(',');
+        }
+        signature_key.append(kind == Py_None ? "auto" : PyUnicode_AsUTF8(kind));
+
+        params[i].setName(param_name);
+        params[i].initUeClass().setTypeName(ue_class->type_name);
+    }
+
+    bool all_scalar = true;
+    for (const PreparedParam& param : prepared->plan) {
+        all_scalar = all_scalar && param.scalar;
+    }
+    if (all_scalar) {
+        for (Py_ssize_t i = 0; i < signature.size; i++) {
+            bind_prepared_slot(prepared->plan[i], params[i]);
+        }
+        prepared->patch_in_place = true;
+    }
+    else {
+        prepared->encoder = find_specialized_encoder(signature_key);
+    }
+
+    prepared->skeleton_words = prepared->skeleton->sizeInWords();
+    return prepared;
+}
+
+/**
+ * unreal_core.prepare
+ * compile the signature of a member function once, the returned PreparedCall is called as
+ * prepared(object, unreal_object, *values) and sends the same request as call_function
+ * 
+ * args:
+ *   ue_class: ue class name
+ *   function_name: str
+ *   signature: sequence of param names or (name, kind) pairs,
+ *              kind is one of "bool", "int", "float", "str", "enum", "object", "buffer", "Vector2D",
+ *              "Vector", "Rotator", "Quat", "Transform", "auto" or None
+ * 
+ * return:
+ *   PreparedCall
+ */
+static PyObject* unreal_core_prepare(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("prepare", nargs, 3, 3) ||
+        !check_arg_type("prepare", args, 0, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    ClassProp* ue_class = (ClassProp*)args[0];
+    const char* function_name = unpack_str_arg("prepare", args, 1);
+    if (function_name == NULL) {
+        return NULL;
+    }
+    return (PyObject*)compile_prepared_call(ue_class, function_name, args[2], "prepare() argument 3 must be a sequence");
+}
+
+/**
+ * UFunction
+ * member function of a ue class, declared in the class body:
+ * 
+ *     class MyObject:
+ *         add = unreal_core.UFunction(ClassProp("MyObject"), "Add", [("a", "int"), ("b", "int")])
+ * 
+ * obj.add(3, 4) sends the same request as prepare with obj and the ue object of obj. the type is a
+ * method descriptor, so the interpreter calls it through vectorcall with obj as the first argument
+ * instead of building a bound method
+ */
+typedef struct {
+    PyObject_HEAD
+    PreparedCall* prepared;
+#if PY_VERSION_HEX >= 0x03090000
+    vectorcallfunc vectorcall;
+#endif
+} UFunction;
+
+#if PY_VERSION_HEX >= 0x030D0000
+#define lookup_optional_attr PyObject_GetOptionalAttr
+#else
+#define lookup_optional_attr _PyObject_LookupAttr
+#endif
+
+/**
+ * ue object bound to a python object: the handle slot of generated classes, else the unreal object
+ * property of objects created from results or the _ue_obj attribute UE.py classes keep.
+ * new reference, a computed attribute may hand out an object nothing else holds
+ */
+static UnrealObject* find_bound_unreal_object(PyObject* object)
+{
+    Py_ssize_t offset = handle_offset_of(Py_TYPE(object));
+    if (offset >= 0) {
+        PyObject* handle = *(PyObject**)((char*)object + offset);
+        if (handle != NULL && PyObject_TypeCheck(handle, &UnrealObject_Type)) {
+            Py_INCREF(handle);
+            return (UnrealObject*)handle;
+        }
+    }
+
+    static PyObject* attribute_names[2] = {NULL, NULL};
+    if (attribute_names[0] == NULL) {
+        attribute_names[0] = PyUnicode_InternFromString(UNREAD_OBJECT_PROPERTY_NAME);
+        attribute_names[1] = PyUnicode_InternFromString("_ue_obj");
+        if (attribute_names[0] == NULL || attribute_names[1] == NULL) {
+            return NULL;
+        }
+    }
+
+    // missing attributes are skipped without raising and clearing an AttributeError
+    for (PyObject* attribute_name : attribute_names) {
+        PyObject* attribute = NULL;
+        int found = lookup_optional_attr(object, attribute_name, &attribute);
+        if (found < 0) {
+            return NULL;
+        }
+        if (found == 0) {
+            continue;
+        }
+        if (PyObject_TypeCheck(attribute, &UnrealObject_Type)) {
+            return (UnrealObject*)attribute;
+        }
+        Py_DECREF(attribute);
+    }
+    PyErr_Format(PyExc_TypeError, "'%s' object is not bound to a ue object", Py_TYPE(object)->tp_name);
+    return NULL;
+}
+
+static PyObject* UFunction_call_impl(UFunction* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    PreparedCall* prepared = self->prepared;
+    Py_ssize_t params_size = (Py_ssize_t)prepared->plan.size();
+    if (!check_positional_args(prepared->func_name.c_str(), nargs, params_size + 1, params_size + 1)) {
+        return NULL;
+    }
+    UnrealObject* unreal_object = find_bound_unreal_object(args[0]);
+    if (unreal_object == NULL) {
+        return NULL;
+    }
+    // held until the request is sent, the object may drop its handle while values convert
+    PyObject* result = send_prepared_call(prepared, args[0], unreal_object, args + 1);
+    Py_DECREF(unreal_object);
+    return result;
+}
+
+#if PY_VERSION_HEX >= 0x03090000
+static PyObject* UFunction_vectorcall(PyObject* self, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        PyErr_SetString(PyExc_TypeError, "ue functions take no keyword arguments");
+        return NULL;
+    }
+    return UFunction_call_impl((UFunction*)self, args, PyVectorcall_NARGS(nargsf));
+}
+#endif
+
+static PyObject* UFunction_call(UFunction* self, PyObject* args, PyObject* kwargs)
+{
+    if (kwargs != NULL && PyDict_GET_SIZE(kwargs) > 0) {
+        PyErr_SetString(PyExc_TypeError, "ue functions take no keyword arguments");
+        return NULL;
+    }
+    return UFunction_call_impl(self, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+}
+
+static PyObject* UFunction_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    ClassProp* ue_class = NULL;
+    const char* function_name = NULL;
+    PyObject* signature = NULL;
+    if (!PyArg_ParseTuple(args, "O!sO", &ClassProp_Type, &ue_class, &function_name, &signature)) {
+        return NULL;
+    }
+
+    UFunction* self = (UFunction*)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+#if PY_VERSION_HEX >= 0x03090000
+    self->vectorcall = UFunction_vectorcall;
+#endif
+    self->prepared = compile_prepared_call(ue_class, function_name, signature, "UFunction() argument 3 must be a sequence");
+    if (self->prepared == NULL) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject*)self;
+}
+
+static void UFunction_dealloc(UFunction* self)
+{
+    Py_XDECREF(self->prepared);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject* UFunction_repr(UFunction* self)
+{
+    return PyUnicode_FromFormat("UFunction(ue_class=%s, func_name=%s, params=%zd)",
+        self->prepared->ue_class->type_name.c_str(), self->prepared->func_name.c_str(), (Py_ssize_t)self->prepared->plan.size());
+}
+
+// bound method for attribute reads that are not a call, e.g. callbacks = obj.add
+static PyObject* UFunction_descr_get(UFunction* self, PyObject* object, PyObject* type)
+{
+    if (object == NULL) {
+        Py_INCREF(self);
+        return (PyObject*)self;
+    }
+    return PyMethod_New((PyObject*)self, object);
+}
+
+static PyObject* UFunction_get_name(UFunction* self, void* closure)
+{
+    return PyUnicode_FromStringAndSize(self->prepared->func_name.data(), (Py_ssize_t)self->prepared->func_name.size());
+}
+
+static PyGetSetDef UFunction_getset[] = {
+    {"__name__", (getter)UFunction_get_name, NULL, "ue function name", NULL},
+    {NULL}  /* Sentinel */
+};
+
+static PyTypeObject UFunction_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.UFunction",       /* tp_name */
+    sizeof(UFunction),             /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)UFunction_dealloc, /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)UFunction_repr,      /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    (ternaryfunc)UFunction_call,   /* tp_call */
+    (reprfunc)UFunction_repr,      /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Unreal Engine member function descriptor",  /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    0,                             /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    0,                             /* tp_methods */
+    0,                             /* tp_members */
+    UFunction_getset,              /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    (descrgetfunc)UFunction_descr_get,  /* tp_descr_get */
+    0,                             /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    UFunction_new,                 /* tp_new */
+};
+
+static PyObject* parse_call_static_function_results(const UnrealCore::CallStaticFunctionResults::Reader& result, LazyResponseOwner& response_owner)
+{
+    PyObject* return_value = parse_value_from_function_return(result.getReturn(), true, response_owner);
+    if (return_value == NULL) {
+        return NULL; 
+    }
+
+    // handle out params
+    auto out_params = result.getOutParams();
+    auto out_params_size = out_params.size();
+
+    PyObject* tuple = PyTuple_New(out_params_size + 1); // +1 for return value
+    PyTuple_SetItem(tuple, 0, return_value);
+
+    for (Py_ssize_t i = 0; i < out_params_size; ++i) {
+        // fixme: do not create new py object when out params is unreal object, directly return the passed in py object
+        PyObject* out_param = parse_value_from_function_return(out_params[i], false, response_owner); 
+        if (out_param == NULL) {
+            Py_DECREF(tuple);
+            return NULL;
+        }
+        PyTuple_SetItem(tuple, i + 1, out_param);
+    }
+
+    return tuple; 
+}
+
+#ifdef UNREAL_CORE_TESTING
+/**
+ * Stand-in server static functions
+ * the loopback server hands callStaticFunction to a python callable, so the local evaluation
+ * can be checked against a reference implementation without running unreal engine
+ */
+static PyObject* loopback_param_to_python(const UnrealCore::Argument::Reader& param)
+{
+    switch (param.which()) {
+        case UnrealCore::Argument::BOOL_VALUE:
+            return read_marshalled<bool>(param);
+        case UnrealCore::Argument::UINT_VALUE:
+            return read_marshalled<uint64_t>(param);
+        case UnrealCore::Argument::INT_VALUE:
+            return read_marshalled<int64_t>(param);
+        case UnrealCore::Argument::FLOAT_VALUE:
+            return read_marshalled<double>(param);
+        case UnrealCore::Argument::STR_VALUE:
+            return read_marshalled<Utf8Value>(param);
+        case UnrealCore::Argument::STR_UTF16_VALUE:
+            return read_utf16_string(param.getStrUtf16Value());
+        case UnrealCore::Argument::ENUM_VALUE:
+            return read_marshalled<EnumValue>(param);
+        case UnrealCore::Argument::VECTOR2_D_VALUE:
+            return read_marshalled<Vector2DValue>(param);
+        case UnrealCore::Argument::VECTOR_VALUE:
+            return read_marshalled<VectorValue>(param);
+        case UnrealCore::Argument::ROTATOR_VALUE:
+            return read_marshalled<RotatorValue>(param);
+        case UnrealCore::Argument::QUAT_VALUE:
+            return read_marshalled<QuatValue>(param);
+        case UnrealCore::Argument::TRANSFORM_VALUE:
+            return read_marshalled<TransformValue>(param);
+        default:
+            Py_RETURN_NONE;
+    }
+}
+
+static bool answer_loopback_static_function(UnrealCore::CallStaticFunctionParams::Reader params, UnrealCore::CallStaticFunctionResults::Builder results)
+{
+    auto call_params = params.getParams();
+    PyObject* py_params = PyTuple_New(call_params.size());
+    if (py_params == NULL) {
+        PyErr_Print();
+        return false;
+    }
+    for (uint32_t i = 0; i < call_params.size(); i++) {
+        PyObject* param = loopback_param_to_python(call_params[i]);
+        if (param == NULL) {
+            Py_DECREF(py_params);
+            PyErr_Print();
+            return false;
+        }
+        PyTuple_SET_ITEM(py_params, i, param);
+    }
+
+    PyObject* value = PyObject_CallFunction(loopback_static_function_handler, "ssN",
+        params.getUeClass().getTypeName().cStr(), params.getFuncName().cStr(), py_params);
+    if (value == NULL) {
+        PyErr_Print();
+        return false;
+    }
+
+    UnrealCore::Argument::Builder return_value = results.initReturn();
+    if (value == Py_None) {
+        return_value.initUeClass().setTypeName("void");
+        Py_DECREF(value);
+        return true;
+    }
+
+    ArgumentValue data;
+    if (find_argument_converter(value)(&data, value, NULL) < 0) {
+        Py_DECREF(value);
+        PyErr_Print();
+        return false;
+    }
+    return_value.initUeClass().setTypeName(Py_TYPE(value)->tp_name);
+    bool ok = set_unreal_rpc_argument_value(data, return_value);
+    release_argument_value(data);
+    Py_DECREF(value);
+    if (!ok) {
+        PyErr_Print();
+    }
+    return ok;
+}
+
+/**
+ * unreal_core.set_loopback_static_function_handler
+ * 
+ * args:
+ *   handler: callable (class_name, function_name, params) -> return value answering callStaticFunction
+ *            on the stand-in server (UNREAL_CORE_LOOPBACK), None restores the void answer
+ */
+static PyObject* unreal_core_set_loopback_static_function_handler(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_loopback_static_function_handler", nargs, 1, 1)) {
+        return NULL;
+    }
+    PyObject* handler = args[0];
+    if (handler != Py_None && !PyCallable_Check(handler)) {
+        PyErr_SetString(PyExc_TypeError, "set_loopback_static_function_handler() argument must be callable or None");
+        return NULL;
+    }
+
+    Py_XDECREF(loopback_static_function_handler);
+    loopback_static_function_handler = NULL;
+    if (handler != Py_None) {
+        Py_INCREF(handler);
+        loopback_static_function_handler = handler;
+    }
+    Py_RETURN_NONE;
+}
+
+/**
+ * unreal_core.set_loopback_class_hierarchy
+ * 
+ * args:
+ *   class_name: str
+ *   parents: sequence of str, from the direct parent up to the root
+ *   interfaces: sequence of str, implemented by the class or any parent
+ */
+static PyObject* unreal_core_set_loopback_class_hierarchy(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_loopback_class_hierarchy", nargs, 3, 3)) {
+        return NULL;
+    }
+    const char* class_name = unpack_str_arg("set_loopback_class_hierarchy", args, 0);
+    if (class_name == NULL) {
+        return NULL;
+    }
+
+    LoopbackClassHierarchy hierarchy;
+    std::vector<std::string>* lists[2] = {&hierarchy.parents, &hierarchy.interfaces};
+    for (int i = 0; i < 2; i++) {
+        SequenceItems names;
+        if (!names.open(args[i + 1], "set_loopback_class_hierarchy() parents and interfaces must be sequences of str")) {
+            return NULL;
+        }
+        for (Py_ssize_t j = 0; j < names.size; j++) {
+            const char* name = PyUnicode_Check(names.items[j]) ? PyUnicode_AsUTF8(names.items[j]) : NULL;
+            if (name == NULL) {
+                if (!PyErr_Occurred()) {
+                    PyErr_SetString(PyExc_TypeError, "set_loopback_class_hierarchy() parents and interfaces must be sequences of str");
+                }
+                return NULL;
+            }
+            lists[i]->push_back(name);
+        }
+    }
+    loopback_class_hierarchies[class_name] = std::move(hierarchy);
+    Py_RETURN_NONE;
+}
+#endif  // UNREAL_CORE_TESTING
+
+/**
+ * interned id of the ue class named by a ClassProp, a str or a generated wrapper class
+ */
+static int32_t class_id_from_arg(const char* func_name, PyObject* ue_class)
+{
+    if (PyObject_TypeCheck(ue_class, &ClassProp_Type)) {
+        const std::string& type_name = ((ClassProp*)ue_class)->type_name;
+        return intern_class_id(type_name.c_str(), type_name.size());
+    }
+    if (PyUnicode_Check(ue_class)) {
+        Py_ssize_t length = 0;
+        const char* type_name = PyUnicode_AsUTF8AndSize(ue_class, &length);
+        return type_name == NULL ? CLASS_ID_UNKNOWN : intern_class_id(type_name, (size_t)length);
+    }
+    if (PyType_Check(ue_class)) {
+        const char* type_name = ((PyTypeObject*)ue_class)->tp_name;
+        const char* dot = strrchr(type_name, '.');
+        type_name = dot == NULL ? type_name : dot + 1;
+        return intern_class_id(type_name, strlen(type_name));
+    }
+    PyErr_Format(PyExc_TypeError, "%s() argument 2 must be Class, str or type, not %.200s", func_name, Py_TYPE(ue_class)->tp_name);
+    return CLASS_ID_UNKNOWN;
+}
+
+static int object_is_a(const char* func_name, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (ue_core_client == NULL) {
+        ue_core_client = create_ue_core_client();
+        if (ue_core_client == NULL) {
+            PyErr_SetString(PyExc_RuntimeError, "unreal engine rpc server is not connected");
+            return -1;
+        }
+    }
+    if (!check_positional_args(func_name, nargs, 2, 2)) {
+        return -1;
+    }
+
+    int32_t class_id = class_id_from_arg(func_name, args[1]);
+    if (class_id == CLASS_ID_UNKNOWN) {
+        return -1;
+    }
+    if (PyObject_TypeCheck(args[0], &UnrealObject_Type)) {
+        return unreal_object_is_a((UnrealObject*)args[0], class_id);
+    }
+
+    UnrealObject* unreal_object = find_bound_unreal_object(args[0]);
+    if (unreal_object == NULL) {
+        return -1;
+    }
+    int result = unreal_object_is_a(unreal_object, class_id);
+    Py_DECREF(unreal_object);
+    return result;
+}
+
+/**
+ * unreal_core.is_a
+ * whether a ue object is, derives from or implements a ue class. the hierarchy of the object's class is
+ * fetched on its first check, later checks of any object of that class make no rpc
+ * 
+ * args:
+ *   object: UnrealObject or a python object bound to one
+ *   ue_class: Class, str or generated wrapper class
+ * 
+ * return:
+ *   bool
+ */
+static PyObject* unreal_core_is_a(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    int result = object_is_a("is_a", args, nargs);
+    if (result < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(result);
+}
+
+/**
+ * unreal_core.cast
+ * 
+ * args:
+ *   object: UnrealObject or a python object bound to one
+ *   ue_class: Class, str or generated wrapper class
+ * 
+ * return:
+ *   object when it is_a ue_class, None otherwise
+ */
+static PyObject* unreal_core_cast(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    int result = object_is_a("cast", args, nargs);
+    if (result < 0) {
+        return NULL;
+    }
+    if (result == 0) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(args[0]);
+    return args[0];
+}
+
+/**
+ * unreal_core.clear_class_hierarchies
+ * forget the fetched class hierarchies, e.g. after classes were reloaded in the editor
+ */
+static PyObject* unreal_core_clear_class_hierarchies(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    for (ClassHierarchy& hierarchy : class_hierarchies) {
+        hierarchy.fetched = false;
+        hierarchy.ancestors.clear();
+    }
+    Py_RETURN_NONE;
+}
+
+/**
+ * Local evaluation
+ * native implementations of whitelisted BlueprintPure static functions, matching the UE5
+ * KismetMathLibrary semantics (double precision, int32 wrap around, division by zero returning
+ * zero). call_static_function answers them without a round trip unless forced remote
+ */
+typedef enum {
+    LOCAL_EVALUATION_LOCAL = 0,         // registered functions run locally
+    LOCAL_EVALUATION_REMOTE = 1,        // every call goes to unreal engine
+    LOCAL_EVALUATION_CONFORMANCE = 2,   // run both, warn on mismatches and return the remote result
+} LocalEvaluationMode;
+
+static const char* local_evaluation_mode_names[] = {"local", "remote", "conformance"};
+
+#define LOCAL_FUNCTION_MAX_PARAMS 3
+// relative tolerance of the conformance comparison of floating point results
+#define LOCAL_CONFORMANCE_TOLERANCE 1.e-9
+
+typedef bool (*LocalFunction)(const ArgumentValue* params, ArgumentValue* result);
+
+typedef struct {
+    LocalFunction function;
+    ArgumentType param_types[LOCAL_FUNCTION_MAX_PARAMS];
+    int min_params;
+    int max_params;
+    double default_value;               // of a trailing optional float param
+    uint64_t local_calls;
+    uint64_t compared_calls;
+    uint64_t mismatches;
+} LocalFunctionEntry;
+
+static LocalEvaluationMode local_evaluation_mode = LOCAL_EVALUATION_LOCAL;
+static std::string local_function_key;  // reused to look up a function without allocating
+
+static inline bool set_local_float(ArgumentValue* result, double value)
+{
+    result->value_type = ARGUMENT_TYPE_FLOAT;
+    result->float_value = value;
+    return true;
+}
+
+static inline bool set_local_int32(ArgumentValue* result, int64_t value)
+{
+    result->value_type = ARGUMENT_TYPE_INT;
+    result->int_value = (int32_t)(uint32_t)value;
+    return true;
+}
+
+static inline bool set_local_vector(ArgumentValue* result, const VectorValue& value)
+{
+    result->value_type = ARGUMENT_TYPE_VECTOR;
+    result->vector_value = value;
+    return true;
+}
+
+#define P_FLOAT(i) (params[i].float_value)
+#define P_INT(i) (params[i].int_value)
+#define P_VECTOR(i) (params[i].vector_value)
+
+static std::unordered_map<std::string, LocalFunctionEntry> local_functions = {
+    // float, doubles since UE5
+    {"KismetMathLibrary.Add_DoubleDouble", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) + P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Subtract_DoubleDouble", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) - P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Multiply_DoubleDouble", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) * P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Divide_DoubleDouble", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(1) == 0.0 ? 0.0 : P_FLOAT(0) / P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Lerp", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) + P_FLOAT(2) * (P_FLOAT(1) - P_FLOAT(0)));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 3, 3}},
+    {"KismetMathLibrary.FClamp", {[](const ArgumentValue* params, ArgumentValue* result) {
+        double value = P_FLOAT(0);
+        return set_local_float(result, value < P_FLOAT(1) ? P_FLOAT(1) : (value < P_FLOAT(2) ? value : P_FLOAT(2)));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 3, 3}},
+    {"KismetMathLibrary.FMin", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) <= P_FLOAT(1) ? P_FLOAT(0) : P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.FMax", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) >= P_FLOAT(1) ? P_FLOAT(0) : P_FLOAT(1));
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Abs", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, std::fabs(P_FLOAT(0)));
+    }, {ARGUMENT_TYPE_FLOAT}, 1, 1}},
+    {"KismetMathLibrary.Sqrt", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, P_FLOAT(0) >= 0.0 ? std::sqrt(P_FLOAT(0)) : 0.0);
+    }, {ARGUMENT_TYPE_FLOAT}, 1, 1}},
+    {"KismetMathLibrary.Sin", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, std::sin(P_FLOAT(0)));
+    }, {ARGUMENT_TYPE_FLOAT}, 1, 1}},
+    {"KismetMathLibrary.Cos", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, std::cos(P_FLOAT(0)));
+    }, {ARGUMENT_TYPE_FLOAT}, 1, 1}},
+
+    // int32
+    {"KismetMathLibrary.Add_IntInt", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_int32(result, (int64_t)((uint32_t)P_INT(0) + (uint32_t)P_INT(1)));
+    }, {ARGUMENT_TYPE_INT, ARGUMENT_TYPE_INT}, 2, 2}},
+    {"KismetMathLibrary.Subtract_IntInt", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_int32(result, (int64_t)((uint32_t)P_INT(0) - (uint32_t)P_INT(1)));
+    }, {ARGUMENT_TYPE_INT, ARGUMENT_TYPE_INT}, 2, 2}},
+    {"KismetMathLibrary.Multiply_IntInt", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_int32(result, (int64_t)((uint32_t)P_INT(0) * (uint32_t)P_INT(1)));
+    }, {ARGUMENT_TYPE_INT, ARGUMENT_TYPE_INT}, 2, 2}},
+    {"KismetMathLibrary.Max", {[](const ArgumentValue* params, ArgumentValue* result) {
+        int32_t a = (int32_t)P_INT(0), b = (int32_t)P_INT(1);
+        return set_local_int32(result, a >= b ? a : b);
+    }, {ARGUMENT_TYPE_INT, ARGUMENT_TYPE_INT}, 2, 2}},
+    {"KismetMathLibrary.Min", {[](const ArgumentValue* params, ArgumentValue* result) {
+        int32_t a = (int32_t)P_INT(0), b = (int32_t)P_INT(1);
+        return set_local_int32(result, a <= b ? a : b);
+    }, {ARGUMENT_TYPE_INT, ARGUMENT_TYPE_INT}, 2, 2}},
+
+    // vector
+    {"KismetMathLibrary.MakeVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_vector(result, VectorValue{P_FLOAT(0), P_FLOAT(1), P_FLOAT(2)});
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 3, 3}},
+    {"KismetMathLibrary.Add_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_add<3>(&value.X, &P_VECTOR(0).X, &P_VECTOR(1).X);
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.Subtract_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_sub<3>(&value.X, &P_VECTOR(0).X, &P_VECTOR(1).X);
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.Multiply_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_mul<3>(&value.X, &P_VECTOR(0).X, &P_VECTOR(1).X);
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.Multiply_VectorFloat", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_scale<3>(&value.X, &P_VECTOR(0).X, P_FLOAT(1));
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.Divide_VectorFloat", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value = {0.0, 0.0, 0.0};
+        if (P_FLOAT(1) != 0.0) {
+            math_scale<3>(&value.X, &P_VECTOR(0).X, 1.0 / P_FLOAT(1));
+        }
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_FLOAT}, 2, 2}},
+    {"KismetMathLibrary.NegateVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_scale<3>(&value.X, &P_VECTOR(0).X, -1.0);
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR}, 1, 1}},
+    {"KismetMathLibrary.Dot_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, math_dot<3>(&P_VECTOR(0).X, &P_VECTOR(1).X));
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.Cross_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_vector(result, vector_cross(P_VECTOR(0), P_VECTOR(1)));
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.VSize", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, std::sqrt(math_dot<3>(&P_VECTOR(0).X, &P_VECTOR(0).X)));
+    }, {ARGUMENT_TYPE_VECTOR}, 1, 1}},
+    {"KismetMathLibrary.VSizeSquared", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_float(result, math_dot<3>(&P_VECTOR(0).X, &P_VECTOR(0).X));
+    }, {ARGUMENT_TYPE_VECTOR}, 1, 1}},
+    {"KismetMathLibrary.Vector_Distance", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue delta;
+        math_sub<3>(&delta.X, &P_VECTOR(1).X, &P_VECTOR(0).X);
+        return set_local_float(result, std::sqrt(math_dot<3>(&delta.X, &delta.X)));
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.VLerp", {[](const ArgumentValue* params, ArgumentValue* result) {
+        VectorValue value;
+        math_lerp<3>(&value.X, &P_VECTOR(0).X, &P_VECTOR(1).X, P_FLOAT(2));
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_FLOAT}, 3, 3}},
+    {"KismetMathLibrary.Normal", {[](const ArgumentValue* params, ArgumentValue* result) {
+        // FVector::GetSafeNormal(Tolerance)
+        const VectorValue& vector = P_VECTOR(0);
+        double square_sum = math_dot<3>(&vector.X, &vector.X);
+        VectorValue value = {0.0, 0.0, 0.0};
+        if (square_sum == 1.0) {
+            value = vector;
+        }
+        else if (square_sum >= P_FLOAT(1)) {
+            math_scale<3>(&value.X, &vector.X, 1.0 / std::sqrt(square_sum));
+        }
+        return set_local_vector(result, value);
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_FLOAT}, 1, 2, 1.e-4}},
+    {"KismetMathLibrary.EqualEqual_VectorVector", {[](const ArgumentValue* params, ArgumentValue* result) {
+        // FVector::Equals, per component within the tolerance
+        const VectorValue& a = P_VECTOR(0);
+        const VectorValue& b = P_VECTOR(1);
+        double tolerance = P_FLOAT(2);
+        result->value_type = ARGUMENT_TYPE_BOOL;
+        result->bool_value = std::fabs(a.X - b.X) <= tolerance && std::fabs(a.Y - b.Y) <= tolerance && std::fabs(a.Z - b.Z) <= tolerance;
+        return true;
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_FLOAT}, 2, 3, 1.e-4}},
+
+    // rotator and transform
+    {"KismetMathLibrary.MakeRotator", {[](const ArgumentValue* params, ArgumentValue* result) {
+        // params are Roll, Pitch, Yaw
+        result->value_type = ARGUMENT_TYPE_ROTATOR;
+        result->rotator_value = RotatorValue{P_FLOAT(1), P_FLOAT(2), P_FLOAT(0)};
+        return true;
+    }, {ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT, ARGUMENT_TYPE_FLOAT}, 3, 3}},
+    {"KismetMathLibrary.GreaterGreater_VectorRotator", {[](const ArgumentValue* params, ArgumentValue* result) {
+        // RotateVector: FRotator::RotateVector through its quaternion
+        return set_local_vector(result, quat_rotate_vector(rotator_to_quat(params[1].rotator_value), P_VECTOR(0)));
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_ROTATOR}, 2, 2}},
+    {"KismetMathLibrary.MakeTransform", {[](const ArgumentValue* params, ArgumentValue* result) {
+        // params are Location, Rotation, Scale
+        result->value_type = ARGUMENT_TYPE_TRANSFORM;
+        result->transform_value = TransformValue{rotator_to_quat(params[1].rotator_value), P_VECTOR(0), params[2].vector_value};
+        return true;
+    }, {ARGUMENT_TYPE_VECTOR, ARGUMENT_TYPE_ROTATOR, ARGUMENT_TYPE_VECTOR}, 3, 3}},
+    {"KismetMathLibrary.TransformLocation", {[](const ArgumentValue* params, ArgumentValue* result) {
+        return set_local_vector(result, transform_position(params[0].transform_value, P_VECTOR(1)));
+    }, {ARGUMENT_TYPE_TRANSFORM, ARGUMENT_TYPE_VECTOR}, 2, 2}},
+    {"KismetMathLibrary.ComposeTransforms", {[](const ArgumentValue* params, ArgumentValue* result) {
+        result->value_type = ARGUMENT_TYPE_TRANSFORM;
+        result->transform_value = transform_multiply(params[0].transform_value, params[1].transform_value);
+        return true;
+    }, {ARGUMENT_TYPE_TRANSFORM, ARGUMENT_TYPE_TRANSFORM}, 2, 2}},
+};
+
+#undef P_FLOAT
+#undef P_INT
+#undef P_VECTOR
+
+static LocalFunctionEntry* find_local_function(const std::string& class_name, const char* function_name)
+{
+    local_function_key.assign(class_name);
+    local_function_key.push_back('.');
+    local_function_key.append(function_name);
+    auto it = local_functions.find(local_function_key);
+    return it != local_functions.end() ? &it->second : NULL;
+}
+
+static PyObject* local_value_to_python(const ArgumentValue& value)
+{
+    switch (value.value_type) {
+        case ARGUMENT_TYPE_BOOL:
+            return PyBool_FromLong(value.bool_value);
+        case ARGUMENT_TYPE_INT:
+            return PyLong_FromLongLong(value.int_value);
+        case ARGUMENT_TYPE_FLOAT:
+            return PyFloat_FromDouble(value.float_value);
+        case ARGUMENT_TYPE_VECTOR:
+            return new_value_object<Vector>(&Vector_Type, value.vector_value);
+        case ARGUMENT_TYPE_ROTATOR:
+            return new_value_object<Rotator>(&Rotator_Type, value.rotator_value);
+        case ARGUMENT_TYPE_TRANSFORM:
+            return new_value_object<Transform>(&Transform_Type, value.transform_value);
+        default:
+            PyErr_SetString(PyExc_SystemError, "unsupported local function result");
+            return NULL;
+    }
+}
+
+/**
+ * run a local function on Argument params, with the call_static_function result shape (return,).
+ * NULL without an exception when the params do not fit the function, the call then goes remote
+ */
+static PyObject* evaluate_local_function(LocalFunctionEntry* entry, PyObject* const* items, Py_ssize_t size)
+{
+    if (size < entry->min_params || size > entry->max_params) {
+        return NULL;
+    }
+
+    ArgumentValue params[LOCAL_FUNCTION_MAX_PARAMS];
+    for (int i = 0; i < entry->max_params; i++) {
+        if (i >= size) {
+            params[i].value_type = ARGUMENT_TYPE_FLOAT;
+            params[i].float_value = entry->default_value;
+            continue;
+        }
+        if (!PyObject_TypeCheck(items[i], &Argument_Type)) {
+            return NULL;
+        }
+        const ArgumentValue& value = ((Argument*)items[i])->data;
+        if (value.value_type == entry->param_types[i]) {
+            params[i] = value;
+        }
+        else if (value.value_type == ARGUMENT_TYPE_INT && entry->param_types[i] == ARGUMENT_TYPE_FLOAT) {
+            // ints promote to float params as they do when unreal engine converts the param
+            params[i].value_type = ARGUMENT_TYPE_FLOAT;
+            params[i].float_value = (double)value.int_value;
+        }
+        else {
+            return NULL;
+        }
+    }
+
+    ArgumentValue result;
+    if (!entry->function(params, &result)) {
+        return NULL;
+    }
+    PyObject* value = local_value_to_python(result);
+    if (value == NULL) {
+        return NULL;
+    }
+    return Py_BuildValue("(N)", value);
+}
+
+/**
+ * conformance comparison: floats and value struct fields within a relative tolerance,
+ * everything else by equality
+ */
+static bool conformance_equal_doubles(const double* a, const double* b, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        double scale = std::max(std::fabs(a[i]), std::fabs(b[i]));
+        if (std::fabs(a[i] - b[i]) > LOCAL_CONFORMANCE_TOLERANCE * std::max(scale, 1.0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int conformance_equal(PyObject* local, PyObject* remote)
+{
+    if (PyFloat_Check(local) && PyFloat_Check(remote)) {
+        double a = PyFloat_AS_DOUBLE(local);
+        double b = PyFloat_AS_DOUBLE(remote);
+        return conformance_equal_doubles(&a, &b, 1);
+    }
+    if (Py_TYPE(local) == Py_TYPE(remote)) {
+        if (Py_TYPE(local) == &Vector_Type) {
+            return conformance_equal_doubles(&((Vector*)local)->value.X, &((Vector*)remote)->value.X, 3);
+        }
+        if (Py_TYPE(local) == &Rotator_Type) {
+            return conformance_equal_doubles(&((Rotator*)local)->value.Pitch, &((Rotator*)remote)->value.Pitch, 3);
+        }
+        if (Py_TYPE(local) == &Transform_Type) {
+            return conformance_equal_doubles((const double*)&((Transform*)local)->value, (const double*)&((Transform*)remote)->value, 10);
+        }
+    }
+    return PyObject_RichCompareBool(local, remote, Py_EQ);
+}
+
+/**
+ * unreal_core.set_local_evaluation
+ * 
+ * args:
+ *   mode: "local" runs the registered pure functions locally, "remote" sends every call to
+ *         unreal engine, "conformance" runs both, warns on mismatches and returns the remote result
+ */
+static PyObject* unreal_core_set_local_evaluation(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_local_evaluation", nargs, 1, 1)) {
+        return NULL;
+    }
+    const char* mode_name = unpack_str_arg("set_local_evaluation", args, 0);
+    if (mode_name == NULL) {
+        return NULL;
+    }
+
+    for (int mode = LOCAL_EVALUATION_LOCAL; mode <= LOCAL_EVALUATION_CONFORMANCE; mode++) {
+        if (strcmp(mode_name, local_evaluation_mode_names[mode]) == 0) {
+            local_evaluation_mode = (LocalEvaluationMode)mode;
+            Py_RETURN_NONE;
+        }
+    }
+    PyErr_Format(PyExc_ValueError, "unknown local evaluation mode '%s'", mode_name);
+    return NULL;
+}
+
+/**
+ * unreal_core.local_evaluation_stats
+ * 
+ * returns:
+ *   dict of "Class.Function" to (local calls, compared calls, mismatches) for every registered function
+ */
+static PyObject* unreal_core_local_evaluation_stats(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("local_evaluation_stats", nargs, 0, 0)) {
+        return NULL;
+    }
+
+    PyObject* stats = PyDict_New();
+    if (stats == NULL) {
+        return NULL;
+    }
+    for (const auto& item : local_functions) {
+        const LocalFunctionEntry& entry = item.second;
+        PyObject* counters = Py_BuildValue("(KKK)", (unsigned long long)entry.local_calls,
+            (unsigned long long)entry.compared_calls, (unsigned long long)entry.mismatches);
+        if (counters == NULL || PyDict_SetItemString(stats, item.first.c_str(), counters) < 0) {
+            Py_XDECREF(counters);
+            Py_DECREF(stats);
+            return NULL;
+        }
+        Py_DECREF(counters);
+    }
+    return stats;
+}
+
+static PyObject* call_static_function_remote(ClassProp* ue_class, const char* function_name, SequenceItems& params)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto call_static_function_request = client.callStaticFunctionRequest(request_size_hint(REQUEST_CALL_STATIC_FUNCTION));
+    call_static_function_request.initUeClass().setTypeName(ue_class->type_name);
+
+    call_static_function_request.setFuncName(function_name);
+
+    // handle params
+    Py_ssize_t list_size = params.size;
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder call_function_args = call_static_function_request.initParams(list_size);
+
+    if (!setup_unreal_rpc_arguments_from_list(params.items, call_function_args, list_size))
+    {
+        return NULL;
+    }
+
+    record_request_size(REQUEST_CALL_STATIC_FUNCTION, call_static_function_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::CallStaticFunctionResults> result = call_static_function_request.send().wait(wait_scope);
+        return parse_response(result, parse_call_static_function_results);
+    })
+}
+
+/**
+ * unreal_core.call_static_function
+ * call rpc function (callStaticFunction) to call a static function,
+ * whitelisted pure math functions are evaluated locally (see set_local_evaluation)
+ * 
+ * args:
+ *   ue_class: ue class name
+ *   function_name: str
+ *   params: sequence of struct Argument
+ * 
+ * returns:
+ *   return value: struct Argument
+ *   out param value: list of struct Argument
+ */
+static PyObject* unreal_core_call_static_function(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("call_static_function", nargs, 3, 3) ||
+        !check_arg_type("call_static_function", args, 0, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    ClassProp* ue_class = (ClassProp*)args[0];
+    const char* function_name = unpack_str_arg("call_static_function", args, 1);
+    if (function_name == NULL) {
+        return NULL;
+    }
+    SequenceItems params;
+    if (!params.open(args[2], "call_static_function() argument 3 must be a sequence")) {
+        return NULL;
+    }
+
+    LocalFunctionEntry* entry = NULL;
+    PyObject* local_result = NULL;
+    if (local_evaluation_mode != LOCAL_EVALUATION_REMOTE) {
+        entry = find_local_function(ue_class->type_name, function_name);
+        if (entry != NULL) {
+            local_result = evaluate_local_function(entry, params.items, params.size);
+            if (local_result == NULL && PyErr_Occurred()) {
+                return NULL;
+            }
+        }
+    }
+    if (local_result == NULL) {
+        return call_static_function_remote(ue_class, function_name, params);
+    }
+
+    entry->local_calls++;
+    if (local_evaluation_mode == LOCAL_EVALUATION_LOCAL) {
+        return local_result;
+    }
+
+    PyObject* remote_result = call_static_function_remote(ue_class, function_name, params);
+    if (remote_result == NULL) {
+        Py_DECREF(local_result);
+        return NULL;
+    }
+    entry->compared_calls++;
+    int equal = PyTuple_Check(remote_result) && PyTuple_GET_SIZE(remote_result) == 1 ?
+        conformance_equal(PyTuple_GET_ITEM(local_result, 0), PyTuple_GET_ITEM(remote_result, 0)) : 0;
+    if (equal < 0) {
+        Py_DECREF(local_result);
+        Py_DECREF(remote_result);
+        return NULL;
+    }
+    if (!equal) {
+        entry->mismatches++;
+        if (PyErr_WarnFormat(PyExc_RuntimeWarning, 1, "%s.%s: local result %R differs from remote result %R",
+                ue_class->type_name.c_str(), function_name, local_result, remote_result) < 0) {
+            Py_DECREF(local_result);
+            Py_DECREF(remote_result);
+            return NULL;
+        }
+    }
+    Py_DECREF(local_result);
+    return remote_result;
+}
+
+// getProperty of object for get_property, UProperty sends from its prepared skeleton
+static PyObject* send_get_property(PyObject* object, const std::string& type_name, const char* property_name)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto get_property_request = client.getPropertyRequest(request_size_hint(REQUEST_GET_PROPERTY));
+    get_property_request.initUeClass().setTypeName(type_name);
+    get_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
+    get_property_request.setPropertyName(property_name);
+
+    record_request_size(REQUEST_GET_PROPERTY, get_property_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::GetPropertyResults> result = get_property_request.send().wait(wait_scope);
+        return parse_response(result, [](const UnrealCore::GetPropertyResults::Reader& reader, LazyResponseOwner& response_owner) {
+            return parse_value_from_function_return(reader.getProperty(), false, response_owner);
+        });
+    })
+}
 
-    switch (argument->value_type) {
-        case ARGUMENT_TYPE_BOOL:
-            unreal_core_argument.setBoolValue(argument->bool_value);
-            break;
-        case ARGUMENT_TYPE_INT:
-            unreal_core_argument.setIntValue(argument->int_value);
-            break;
-        case ARGUMENT_TYPE_UINT:
-            unreal_core_argument.setUintValue(argument->uint_value);
-            break;
-        case ARGUMENT_TYPE_FLOAT:
-            unreal_core_argument.setFloatValue(argument->float_value);
-            break;
-        case ARGUMENT_TYPE_STRING:
-            unreal_core_argument.setStrValue(argument->str_value);
-            break;
-        case ARGUMENT_TYPE_ENUM:
-            unreal_core_argument.setEnumValue(argument->enum_value);
-            break;
-        case ARGUMENT_TYPE_OBJECT:
-        {
-            unreal_core_argument.initObject().setAddress(reinterpret_cast<uint64_t>(argument->object));
-            break;
+// setProperty of object, write_property fills the property argument and returns false with an error set
+template <typename Writer>
+static PyObject* send_set_property(PyObject* object, const std::string& type_name, Writer write_property)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto set_property_request = client.setPropertyRequest(request_size_hint(REQUEST_SET_PROPERTY));
+    set_property_request.initUeClass().setTypeName(type_name);
+    set_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
+    auto unreal_core_argument = set_property_request.initProperty();
+    if (!write_property(unreal_core_argument)) {
+        return NULL;
+    }
+
+    record_request_size(REQUEST_SET_PROPERTY, set_property_request.totalSize());
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        set_property_request.send().wait(wait_scope);
+        Py_RETURN_NONE;
+    })
+}
+
+/**
+ * unreal_core.get_property
+ * call rpc function (getProperty) to get a property
+ * 
+ * args:
+ *   ue_class: ue class name
+ *   object: pyobject
+ *   property_name: Property name
+ * 
+ */
+static PyObject* unreal_core_get_property(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("get_property", nargs, 3, 3) ||
+        !check_arg_type("get_property", args, 1, &ClassProp_Type)) {
+        return NULL;
+    }
+
+    PyObject* object = args[0];
+    ClassProp* ue_class = (ClassProp*)args[1];
+    const char* property_name = unpack_str_arg("get_property", args, 2);
+    if (property_name == NULL) {
+        return NULL;
+    }
+    return send_get_property(object, ue_class->type_name, property_name);
+}
+
+/**
+ * unreal_core.set_property
+ * call rpc function (setProperty) to set a property
+ * 
+ * args:
+ *   ue_class: ue class name
+ *   object: pyobject
+ *   property: struct Argument
+ */
+static PyObject* unreal_core_set_property(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("set_property", nargs, 3, 3) ||
+        !check_arg_type("set_property", args, 1, &ClassProp_Type) ||
+        !check_arg_type("set_property", args, 2, &Argument_Type)) {
+        return NULL;
+    }
+
+    PyObject* object = args[0];
+    ClassProp* ue_class = (ClassProp*)args[1];
+    PyObject* property_value = args[2];
+    return send_set_property(object, ue_class->type_name, [property_value](UnrealCore::Argument::Builder& unreal_core_argument) {
+        if (!create_unreal_rpc_argument(property_value, unreal_core_argument)) {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to create unreal core argument the property should be argument type");
+            return false;
         }
-        default:
-        {
+        return true;
+    });
+}
+
+/**
+ * UProperty
+ * data descriptor of a ue property, declared in the class body:
+ * 
+ *     class MyObject:
+ *         Health = unreal_core.UProperty(ClassProp("MyObject"), "float")
+ * 
+ * the property name comes from the attribute name when the class is created, the converter of assigned
+ * values from the param kind. like a prepared call, the constant part of the getProperty and setProperty
+ * requests (class, property name, the value's union member) is built once into skeletons when the name
+ * is known. each access copies the skeleton and adds the owner, values of scalar kinds are patched
+ * into the set skeleton in place. obj is the owner like with get_property and set_property
+ */
+typedef struct {
+    PyObject_HEAD
+    ClassProp* ue_class;
+    std::string name;
+    PreparedParam param;                        // converter of assigned values, slot for scalar kinds
+    capnp::MallocMessageBuilder* get_skeleton;  // NULL until the name is known
+    capnp::MallocMessageBuilder* set_skeleton;
+    size_t get_words;
+    size_t set_words;
+} UProperty;
+
+// words reserved on top of the skeletons for the owner and non scalar values
+#define UPROPERTY_EXTRA_WORDS 16
+
+static void prepare_uproperty_requests(UProperty* self)
+{
+    self->get_skeleton = new capnp::MallocMessageBuilder();
+    auto get_skeleton = self->get_skeleton->initRoot<UnrealCore::GetPropertyParams>();
+    get_skeleton.initUeClass().setTypeName(self->ue_class->type_name);
+    get_skeleton.setPropertyName(self->name);
+    self->get_words = self->get_skeleton->sizeInWords();
+
+    self->set_skeleton = new capnp::MallocMessageBuilder();
+    auto set_skeleton = self->set_skeleton->initRoot<UnrealCore::SetPropertyParams>();
+    set_skeleton.initUeClass().setTypeName(self->ue_class->type_name);
+    auto property = set_skeleton.initProperty();
+    property.setName(self->name);
+    property.initUeClass().setTypeName(self->ue_class->type_name);
+    if (self->param.scalar) {
+        bind_prepared_slot(self->param, property);
+    }
+    self->set_words = self->set_skeleton->sizeInWords();
+}
+
+static bool connect_uproperty_client()
+{
+    if (ue_core_client == NULL) {
+        ue_core_client = create_ue_core_client();
+        if (ue_core_client == NULL) {
+            PyErr_SetString(PyExc_RuntimeError, "unreal engine rpc server is not connected");
             return false;
         }
     }
     return true;
 }
 
+static PyObject* UProperty_new(PyTypeObject* type, PyObject* args, PyObject* kwds)
+{
+    static const char* keywords[] = {"ue_class", "kind", "name", NULL};
+    ClassProp* ue_class = NULL;
+    PyObject* kind = Py_None;
+    const char* name = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|Oz", (char**)keywords, &ClassProp_Type, &ue_class, &kind, &name)) {
+        return NULL;
+    }
+
+    UProperty* self = (UProperty*)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    new (&self->name) std::string(name != NULL ? name : "");
+    Py_INCREF(ue_class);
+    self->ue_class = ue_class;
+    self->get_skeleton = NULL;
+    self->set_skeleton = NULL;
+    if (!find_prepared_param(kind, self->param)) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    if (name != NULL) {
+        prepare_uproperty_requests(self);
+    }
+    return (PyObject*)self;
+}
+
+static void UProperty_dealloc(UProperty* self)
+{
+    Py_XDECREF(self->ue_class);
+    self->name.~basic_string();
+    delete self->get_skeleton;
+    delete self->set_skeleton;
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
 
-static bool setup_unreal_rpc_arguments_from_list(PyObject* src_args, capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder& dest_args, Py_ssize_t list_size)
+static PyObject* UProperty_repr(UProperty* self)
 {
-    for (uint32_t i = 0; i < list_size; i++) {
-        PyObject* item = PyList_GetItem(src_args, i);
-        if (item == NULL) {
-            PyErr_SetString(PyExc_RuntimeError, "Failed to get a parameter from the parameter list.");
-            return false;
-        }
+    return PyUnicode_FromFormat("UProperty(ue_class=%s, name=%s)", self->ue_class->type_name.c_str(), self->name.c_str());
+}
 
-        if (PyObject_TypeCheck(item, &Argument_Type)) {
-            Argument* argument = (Argument*)item;
-            dest_args[i].setName(argument->name);
-            dest_args[i].initUeClass().setTypeName(argument->ue_class->type_name);
+static PyObject* UProperty_set_name(UProperty* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("__set_name__", nargs, 2, 2)) {
+        return NULL;
+    }
+    const char* name = unpack_str_arg("__set_name__", args, 1);
+    if (name == NULL) {
+        return NULL;
+    }
+    if (self->get_skeleton == NULL) {
+        self->name = name;
+        prepare_uproperty_requests(self);
+    }
+    Py_RETURN_NONE;
+}
 
-            if (!create_unreal_rpc_argument(item, dest_args[i])) {
-                PyErr_SetString(PyExc_RuntimeError, "Failure to create parameters needed for unreal rpc call.");
-                return false;
+static PyObject* UProperty_descr_get(UProperty* self, PyObject* object, PyObject* type)
+{
+    if (object == NULL) {
+        Py_INCREF(self);
+        return (PyObject*)self;
+    }
+    if (self->get_skeleton == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "ue property has no name, declare it in a class body or pass name");
+        return NULL;
+    }
+    if (!connect_uproperty_client()) {
+        return NULL;
+    }
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto get_property_request = client.getPropertyRequest(capnp::MessageSize{self->get_words + UPROPERTY_EXTRA_WORDS, 0});
+    auto skeleton = self->get_skeleton->getRoot<UnrealCore::GetPropertyParams>().asReader();
+    get_property_request.setUeClass(skeleton.getUeClass());
+    get_property_request.setPropertyName(skeleton.getPropertyName());
+    get_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
+
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::GetPropertyResults> result = get_property_request.send().wait(wait_scope);
+        return parse_response(result, [](const UnrealCore::GetPropertyResults::Reader& reader, LazyResponseOwner& response_owner) {
+            return parse_value_from_function_return(reader.getProperty(), false, response_owner);
+        });
+    })
+}
+
+static PyObject* send_uproperty_value(UProperty* self, PyObject* object, PyObject* value)
+{
+    ArgumentValue converted;
+    if (self->param.converter(&converted, value, self->param.value_type) < 0) {
+        return NULL;
+    }
+    if (self->param.scalar) {
+        patch_prepared_slot(self->param, converted);
+    }
+
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto set_property_request = client.setPropertyRequest(capnp::MessageSize{self->set_words + UPROPERTY_EXTRA_WORDS, 0});
+    auto skeleton = self->set_skeleton->getRoot<UnrealCore::SetPropertyParams>().asReader();
+    set_property_request.setUeClass(skeleton.getUeClass());
+    set_property_request.setProperty(skeleton.getProperty());
+    set_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
+    if (!self->param.scalar) {
+        auto property = set_property_request.getProperty();
+        bool written = set_unreal_rpc_argument_value(converted, property);
+        release_argument_value(converted);
+        if (!written) {
+            if (!PyErr_Occurred()) {
+                PyErr_Format(PyExc_TypeError, "can't send the value of ue property '%s'", self->name.c_str());
             }
+            return NULL;
         }
-        else {
-            PyErr_SetString(PyExc_RuntimeError, "The type of the argument passed into the function must be the 'Argument' type.");
-            return false;
-        }
     }
 
-    return true;
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        set_property_request.send().wait(wait_scope);
+        Py_RETURN_NONE;
+    })
+}
+
+static int UProperty_descr_set(UProperty* self, PyObject* object, PyObject* value)
+{
+    if (value == NULL) {
+        PyErr_Format(PyExc_AttributeError, "can't delete ue property '%s'", self->name.c_str());
+        return -1;
+    }
+    if (self->set_skeleton == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "ue property has no name, declare it in a class body or pass name");
+        return -1;
+    }
+    if (!connect_uproperty_client()) {
+        return -1;
+    }
+
+    PyObject* result = send_uproperty_value(self, object, value);
+    if (result == NULL) {
+        return -1;
+    }
+    Py_DECREF(result);
+    return 0;
+}
+
+static PyObject* UProperty_get_name(UProperty* self, void* closure)
+{
+    return PyUnicode_FromStringAndSize(self->name.data(), (Py_ssize_t)self->name.size());
+}
+
+static PyMethodDef UProperty_methods[] = {
+    {"__set_name__", (PyCFunction)(void(*)(void))UProperty_set_name, METH_FASTCALL, "Take the property name from the attribute"},
+    {NULL}  /* Sentinel */
+};
+
+static PyGetSetDef UProperty_getset[] = {
+    {"name", (getter)UProperty_get_name, NULL, "ue property name", NULL},
+    {NULL}  /* Sentinel */
+};
+
+static PyTypeObject UProperty_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "unreal_core.UProperty",       /* tp_name */
+    sizeof(UProperty),             /* tp_basicsize */
+    0,                             /* tp_itemsize */
+    (destructor)UProperty_dealloc, /* tp_dealloc */
+    0,                             /* tp_print */
+    0,                             /* tp_getattr */
+    0,                             /* tp_setattr */
+    0,                             /* tp_reserved */
+    (reprfunc)UProperty_repr,      /* tp_repr */
+    0,                             /* tp_as_number */
+    0,                             /* tp_as_sequence */
+    0,                             /* tp_as_mapping */
+    0,                             /* tp_hash */
+    0,                             /* tp_call */
+    (reprfunc)UProperty_repr,      /* tp_str */
+    0,                             /* tp_getattro */
+    0,                             /* tp_setattro */
+    0,                             /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,            /* tp_flags */
+    "Unreal Engine property descriptor",  /* tp_doc */
+    0,                             /* tp_traverse */
+    0,                             /* tp_clear */
+    0,                             /* tp_richcompare */
+    0,                             /* tp_weaklistoffset */
+    0,                             /* tp_iter */
+    0,                             /* tp_iternext */
+    UProperty_methods,             /* tp_methods */
+    0,                             /* tp_members */
+    UProperty_getset,              /* tp_getset */
+    0,                             /* tp_base */
+    0,                             /* tp_dict */
+    (descrgetfunc)UProperty_descr_get,  /* tp_descr_get */
+    (descrsetfunc)UProperty_descr_set,  /* tp_descr_set */
+    0,                             /* tp_dictoffset */
+    0,                             /* tp_init */
+    0,                             /* tp_alloc */
+    UProperty_new,                 /* tp_new */
+};
+
+/**
+ * unreal_core.dump_reflection
+ * call rpc function (dumpReflection) to get the classes, properties, functions, enums and struct layouts
+ * of the engine, the input of generate_bindings.py
+ * 
+ * return:
+ *   str, JSON
+ */
+static PyObject* unreal_core_dump_reflection(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    CHECK_CLIENT_AND_RECREATE_IT()
+
+    if (!check_positional_args("dump_reflection", nargs, 0, 0)) {
+        return NULL;
+    }
+
+    auto dump_request = ue_core_client->ue_core.dumpReflectionRequest();
+    kj::WaitScope& wait_scope = io_context.waitScope;
+    CATCH_EXCEPTION_FOR_RPC_CALL({
+        capnp::Response<UnrealCore::DumpReflectionResults> result = dump_request.send().wait(wait_scope);
+        capnp::Text::Reader dump = result.getDump();
+        return PyUnicode_FromStringAndSize(dump.cStr(), (Py_ssize_t)dump.size());
+    })
+}
+
+static PyObject* unreal_core_find_class(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_load_class(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_load_object(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_bind_delegate(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_unbind_delegate(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_add_multicast_delegate(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_remove_multicast_delegate(PyObject* self, PyObject* args) 
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_register_overrided_class(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject* unreal_core_unregister_overrided_class(PyObject* self, PyObject* args)
+{
+    Py_RETURN_NONE;
 }
 
-/**
- * unreal_core.new_object
- * call rpc function (newObject) to create a new ue object
- * 
- * args:
- *   object: pyobject
- *   ue_class: ue class name
- *   flags: ue object flags
- *   construct_args: list of struct Argument
- * 
- * return:
- *   ue object address
- */
-static PyObject* unreal_core_new_object(PyObject* self, PyObject* args)
+static PyObject* unreal_core_new_container(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
 {
     CHECK_CLIENT_AND_RECREATE_IT()
 
-    PyObject* object = NULL;
-    ClassProp* ue_class = NULL;
-    char* object_name = NULL;
-    uint32_t flags = 0;
-    PyObject* construct_args = NULL;
-    
-    if (!PyArg_ParseTuple(args, "OO!sIO!", &object, &ClassProp_Type, &ue_class, &object_name, &flags, &PyList_Type, &construct_args))
-    {
+    if (!check_positional_args("new_container", nargs, 4, 4) ||
+        !check_arg_type("new_container", args, 1, &ClassProp_Type) ||
+        !check_arg_type("new_container", args, 2, &ClassProp_Type) ||
+        !check_arg_type("new_container", args, 3, &ClassProp_Type)) {
         return NULL;
     }
 
-    // if (object == Py_None)
-    // {
-    //     PyErr_SetString(PyExc_RuntimeError, "object can not be None.");
-    //     return NULL;
-    // }
-
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-
-    capnp::Request<UnrealCore::NewObjectParams, UnrealCore::NewObjectResults> new_object_request = client.newObjectRequest();
-    new_object_request.getUeClass().setTypeName(ue_class->type_name);
-    new_object_request.setFlags(flags);
-    new_object_request.setObjName(object_name);
-    new_object_request.getOwn().setAddress(reinterpret_cast<uint64_t>(object));
-    new_object_request.getOwn().setName(object_name);
-
-    // handle construct_args
-    // get list size
-    Py_ssize_t list_size = PyList_Size(construct_args);
-    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder new_object_args = new_object_request.initConstructArgs(list_size);
+    PyObject* self_object = args[0];
+    ClassProp* container_type = (ClassProp*)args[1];
+    ClassProp* value_type = (ClassProp*)args[2];
+    ClassProp* key_type = (ClassProp*)args[3];
 
-    if (!setup_unreal_rpc_arguments_from_list(construct_args, new_object_args, list_size))
-    {
+    if (self_object == Py_None) {
+        PyErr_SetString(PyExc_ValueError, "Must pass into self object rather than None");
         return NULL;
     }
 
+    UnrealCore::Client& client = ue_core_client->ue_core;
+
+    auto new_container_request = client.newContainerRequest(request_size_hint(REQUEST_NEW_CONTAINER));
+    new_container_request.initOwn().setAddress(reinterpret_cast<uint64_t>(self_object));
+    new_container_request.initContainerType().setTypeName(container_type->type_name);
+    new_container_request.initValueType().setTypeName(value_type->type_name);
+    new_container_request.initKeyType().setTypeName(key_type->type_name);
+
+    record_request_size(REQUEST_NEW_CONTAINER, new_container_request.totalSize());
     kj::WaitScope& wait_scope = io_context.waitScope;
     CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::NewObjectResults> result = new_object_request.send().wait(wait_scope);
-        
+        capnp::Response<UnrealCore::NewContainerResults> result = new_container_request.send().wait(wait_scope);
         UnrealObject* unreal_object = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type);
-        unreal_object->address = result.getObject().getAddress();
-        unreal_object->name = deep_copy_str(result.getObject().getName().cStr());
-
+        unreal_object->address = result.getContainer().getAddress();
+        unreal_object->name = deep_copy_str(container_type->type_name.c_str(), container_type->type_name.size());
+        unreal_object->class_id = CLASS_ID_UNKNOWN;
+        
         return (PyObject*)unreal_object;
-
     })
 }
 
-/**
- * unreal_core.destory_object
- * call rpc function (destoryObject) to destory a ue object
- * 
- * args:
- *   object: pyobject
- * 
- * return:
- *   bool
- */
-static PyObject* unreal_core_destory_object(PyObject* self, PyObject* args)
+static PyObject* unreal_core_destroy_container(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
 {
     CHECK_CLIENT_AND_RECREATE_IT()
 
-    PyObject* object = NULL;
-    if (!PyArg_ParseTuple(args, "O", &object)) {
+    if (!check_positional_args("destroy_container", nargs, 1, 1)) {
         return NULL;
     }
+    PyObject* self_object = args[0];
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto destory_object_request = client.destroyObjectRequest();
-    destory_object_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
+    if (self_object == Py_None) {
+        PyErr_SetString(PyExc_ValueError, "Must pass into self object rather than None");
+        return NULL;
+    }
 
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    auto destroy_container_request = client.destroyContainerRequest(request_size_hint(REQUEST_DESTROY_CONTAINER));
+    destroy_container_request.initOwn().setAddress(reinterpret_cast<uint64_t>(self_object));
+
+    record_request_size(REQUEST_DESTROY_CONTAINER, destroy_container_request.totalSize());
     kj::WaitScope& wait_scope = io_context.waitScope;
     CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::DestroyObjectResults> result = destory_object_request.send().wait(wait_scope);
-        if (result.getResult()) {
-            return Py_True;
-        }
-        else {
-            return Py_False;
-        }
+        destroy_container_request.send().wait(wait_scope);
+        Py_RETURN_NONE;
     })
 }
 
-static PyObject* create_object_from_specified_class(const char* class_type_name)
+/**
+ * Allocation counting, wraps the python object and memory allocators for the duration of a call
+ */
+static PyMemAllocatorEx original_mem_allocator;
+static PyMemAllocatorEx original_obj_allocator;
+static uint64_t counted_allocations = 0;
+
+static void* counting_malloc(void* ctx, size_t size)
+{
+    counted_allocations++;
+    PyMemAllocatorEx* original = (PyMemAllocatorEx*)ctx;
+    return original->malloc(original->ctx, size);
+}
+
+static void* counting_calloc(void* ctx, size_t nelem, size_t elsize)
 {
-    // PyObject* module_name = PyUnicode_FromString();
-    PyObject* py_module = PyImport_ImportModule(PYTHON_MODULE_NAME); // todo: Compatible with other Python versions
-    if (py_module == NULL) {
-        PyErr_SetString(PyExc_ImportError, "Failed to import unreal module");
-        return NULL;
+    counted_allocations++;
+    PyMemAllocatorEx* original = (PyMemAllocatorEx*)ctx;
+    return original->calloc(original->ctx, nelem, elsize);
+}
+
+static void* counting_realloc(void* ctx, void* ptr, size_t new_size)
+{
+    if (ptr == NULL) {
+        counted_allocations++;
     }
+    PyMemAllocatorEx* original = (PyMemAllocatorEx*)ctx;
+    return original->realloc(original->ctx, ptr, new_size);
+}
 
-    PyObject* py_class = PyObject_GetAttrString(py_module, class_type_name);
-    if (py_class == NULL || !PyType_Check(py_class)) {
-        char error_msg[128];
-        snprintf(error_msg, sizeof(error_msg), "Failed to find unreal class: %s", class_type_name);
-        PyErr_SetString(PyExc_ImportError, error_msg);
-        Py_DECREF(py_module);
+static void counting_free(void* ctx, void* ptr)
+{
+    PyMemAllocatorEx* original = (PyMemAllocatorEx*)ctx;
+    original->free(original->ctx, ptr);
+}
+
+/**
+ * unreal_core.count_allocations
+ * call a function several times and count the python heap allocations (PyMem/PyObject domains).
+ * capnp segments and other malloc/new allocations of the module are not counted
+ * 
+ * args:
+ *   func: callable without arguments
+ *   number: times to call func
+ * 
+ * return:
+ *   allocations per call: float
+ */
+static PyObject* unreal_core_count_allocations(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_positional_args("count_allocations", nargs, 1, 2)) {
         return NULL;
     }
 
-    PyObject* py_object = PyObject_New(PyObject, (PyTypeObject*)py_class);
-    if (py_object == NULL) {
-        PyErr_SetString(PyExc_MemoryError, "Failed to allocate memory for unreal object");
-        Py_DECREF(py_module);
-        Py_DECREF(py_class);
+    PyObject* func = args[0];
+    Py_ssize_t number = 1;
+    if (nargs > 1 && ((number = PyLong_AsSsize_t(args[1])) == -1 && PyErr_Occurred())) {
+        return NULL;
+    }
+    if (number <= 0) {
+        PyErr_SetString(PyExc_ValueError, "number must be positive");
         return NULL;
     }
 
-    Py_DECREF(py_module);
-    Py_DECREF(py_class);
-
-    return py_object;
-}
+    PyMem_GetAllocator(PYMEM_DOMAIN_MEM, &original_mem_allocator);
+    PyMem_GetAllocator(PYMEM_DOMAIN_OBJ, &original_obj_allocator);
+    PyMemAllocatorEx counting_mem_allocator = {&original_mem_allocator, counting_malloc, counting_calloc, counting_realloc, counting_free};
+    PyMemAllocatorEx counting_obj_allocator = {&original_obj_allocator, counting_malloc, counting_calloc, counting_realloc, counting_free};
+    PyMem_SetAllocator(PYMEM_DOMAIN_MEM, &counting_mem_allocator);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &counting_obj_allocator);
+
+    counted_allocations = 0;
+    PyObject* result = Py_None;
+    for (Py_ssize_t i = 0; i < number && result != NULL; i++) {
+        result = PyObject_CallObject(func, NULL);
+        Py_XDECREF(result);
+    }
+    uint64_t allocations = counted_allocations;
 
-static PyObject* send_pyobject_to_unreal_engine(PyObject* py_object, UnrealObject* unreal_object, const char* class_type_name)
-{
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto create_py_object_request = client.registerCreatedPyObjectRequest();
-    create_py_object_request.initPyObject().setAddress(reinterpret_cast<uint64_t>(py_object));
-    create_py_object_request.initUnrealObject().setAddress(unreal_object->address);
-    create_py_object_request.initUeClass().setTypeName(class_type_name);
+    PyMem_SetAllocator(PYMEM_DOMAIN_MEM, &original_mem_allocator);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &original_obj_allocator);
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        create_py_object_request.send().wait(wait_scope);
-        return Py_True;
-    })
+    if (result == NULL) {
+        return NULL;
+    }
+    return PyFloat_FromDouble((double)allocations / (double)number);
 }
 
-static PyObject* parse_value_from_function_return(const  UnrealCore::Argument::Reader& return_value, bool is_retrun_value)
+/**
+ * unreal_core.time_encode
+ * encode the same values into a params list with the generic path (type dispatch and a switch per
+ * value) and with the specialized encode<Ts...> of the signature, for the marshalling benchmark
+ * 
+ * args:
+ *   signature: sequence of prepare() param kinds
+ *   values: sequence of param values
+ *   number: times to encode
+ * 
+ * return:
+ *   (generic ns per encode, specialized ns per encode or None when the signature has no encoder)
+ */
+static PyObject* unreal_core_time_encode(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
 {
-    // Initialize the object's fields
-    const char* class_type_name = return_value.getUeClass().getTypeName().cStr();
-
-    if (class_type_name != NULL && strcmp(class_type_name, "void") == 0) {
-        return Py_None;
+    if (!check_positional_args("time_encode", nargs, 3, 3)) {
+        return NULL;
+    }
+    SequenceItems signature;
+    SequenceItems values;
+    if (!signature.open(args[0], "time_encode() argument 1 must be a sequence") ||
+        !values.open(args[1], "time_encode() argument 2 must be a sequence")) {
+        return NULL;
+    }
+    Py_ssize_t number = PyLong_AsSsize_t(args[2]);
+    if (number == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (number <= 0 || signature.size != values.size) {
+        PyErr_SetString(PyExc_ValueError, "number must be positive and values must match the signature");
+        return NULL;
     }
 
-    // maybe unuse
-    const char* name = return_value.getName().cStr();
-
-    // Set the value based on the return type
-    switch (return_value.which()) {
-        case UnrealCore::Argument::BOOL_VALUE:
-        {
-            bool value = return_value.getBoolValue();
-            if (PyBool_Check(value)) {
-                return Py_True;
-            }
-            else {
-                return Py_False;
-            }
+    std::string signature_key;
+    for (Py_ssize_t i = 0; i < signature.size; i++) {
+        const char* kind_name = PyUnicode_Check(signature.items[i]) ? PyUnicode_AsUTF8(signature.items[i]) : NULL;
+        if (kind_name == NULL) {
+            PyErr_SetString(PyExc_TypeError, "param kind must be a str");
+            return NULL;
         }
-        case UnrealCore::Argument::UINT_VALUE:
-            return PyLong_FromUnsignedLongLong(return_value.getUintValue());
-        case UnrealCore::Argument::INT_VALUE:
-            return PyLong_FromLongLong(return_value.getIntValue());
-        case UnrealCore::Argument::FLOAT_VALUE:
-            return PyFloat_FromDouble(return_value.getFloatValue());
-        case UnrealCore::Argument::STR_VALUE:
-            return PyUnicode_FromString(return_value.getStrValue().cStr());
-        case UnrealCore::Argument::ENUM_VALUE:
-            return PyLong_FromLongLong(return_value.getEnumValue());
-        case UnrealCore::Argument::OBJECT:
-        {
-            if (!is_retrun_value) {
-                uint64_t address = return_value.getObject().getAddress();
-                void* object = (void*)address;
-                return (PyObject*)object;
-            }
+        if (i > 0) {
+            signature_key.push_back(',');
+        }
+        signature_key.append(kind_name);
+    }
 
-            // Handle the case where return value is an unreal object:
-            // 1. Create a corresponding pyobject based on the class name
-            // 2. Set the obtained unreal object to the corresponding property
-            // 3. Return the created pyobject
-            // Create a new UnrealObject for object returns
-            UnrealObject* obj = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type);
-            if (obj == NULL) {
-                obj = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type); // try again
-            }
-            obj->address = return_value.getObject().getAddress();
-            obj->name = deep_copy_str(return_value.getObject().getName().cStr());
-            PyObject* py_object = create_object_from_specified_class(class_type_name);
-            if (py_object == NULL) {
+    uint32_t size = (uint32_t)values.size;
+    auto generic_start = std::chrono::steady_clock::now();
+    for (Py_ssize_t n = 0; n < number; n++) {
+        capnp::MallocMessageBuilder message(256);
+        ArgumentListBuilder params = message.initRoot<UnrealCore::CallFunctionParams>().initParams(size);
+        for (uint32_t i = 0; i < size; i++) {
+            ArgumentValue converted;
+            if (find_argument_converter(values.items[i])(&converted, values.items[i], NULL) < 0) {
                 return NULL;
             }
-            // set unreal object to the py object's property, property name is UNREAD_OBJECT_PROPERTY_NAME
-            if (PyObject_SetAttrString(py_object, UNREAD_OBJECT_PROPERTY_NAME, (PyObject*)obj) != 0) {
-                PyErr_SetString(PyExc_AttributeError, "Failed to set unreal object to the py object's unreal objectproperty");
-                Py_DECREF(py_object);
+            UnrealCore::Argument::Builder dest_arg = params[i];
+            bool written = set_unreal_rpc_argument_value(converted, dest_arg);
+            release_argument_value(converted);
+            if (!written) {
+                if (!PyErr_Occurred()) {
+                    PyErr_SetString(PyExc_RuntimeError, "Failure to create parameters needed for unreal rpc call.");
+                }
                 return NULL;
             }
-
-            // register the py object to unreal engine
-            send_pyobject_to_unreal_engine(py_object, obj, class_type_name);
-
-            return py_object;
         }
-        default:
-        {
-            PyErr_SetString(PyExc_ValueError, "Unsupported return value type");
+    }
+    double generic_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - generic_start).count() / number;
+
+    SpecializedEncoder encoder = find_specialized_encoder(signature_key);
+    if (encoder == NULL) {
+        return Py_BuildValue("(dO)", generic_ns, Py_None);
+    }
+    auto specialized_start = std::chrono::steady_clock::now();
+    for (Py_ssize_t n = 0; n < number; n++) {
+        capnp::MallocMessageBuilder message(256);
+        ArgumentListBuilder params = message.initRoot<UnrealCore::CallFunctionParams>().initParams(size);
+        if (!encoder(values.items, params)) {
             return NULL;
         }
+    }
+    double specialized_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - specialized_start).count() / number;
+    return Py_BuildValue("(dd)", generic_ns, specialized_ns);
+}
 
+/**
+ * unreal_core.request_stats
+ * request sizing counters of every rpc method
+ * 
+ * return:
+ *   dict of method name -> dict(requests, message_words, hint_words, modeled_segments, modeled_words),
+ *   the modeled counters follow the capnp segment growth policy instead of counting allocations
+ */
+static PyObject* unreal_core_request_stats(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    PyObject* stats = PyDict_New();
+    if (stats == NULL) {
+        return NULL;
     }
 
-    return NULL;
+    for (int method = 0; method < REQUEST_METHOD_COUNT; method++) {
+        const RequestSizeStats& method_stats = request_size_stats[method];
+        PyObject* entry = Py_BuildValue("{sKsKsKsKsK}",
+            "requests", (unsigned long long)method_stats.requests,
+            "message_words", (unsigned long long)method_stats.message_words,
+            "hint_words", (unsigned long long)method_stats.hint_words,
+            "modeled_segments", (unsigned long long)method_stats.modeled_segments,
+            "modeled_words", (unsigned long long)method_stats.modeled_words);
+        if (entry == NULL || PyDict_SetItemString(stats, request_method_names[method], entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(stats);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+    return stats;
 }
 
 /**
- * unreal_core.call_function
- * call rpc function (callFunction) to call a function
+ * unreal_core.reset_request_stats
+ * clear the request size histograms and counters
  * 
  * args:
- *   object: pyobject
- *   ue_class: ue class name
- *   function_name: str
- *   params: list of struct Argument
- * 
- * returns:
- *   return value: struct Argument
- *   out param value: list of struct Argument
+ *   adaptive: bool, optional, size requests from the histograms (default) or always use the capnp default
  */
-static PyObject* unreal_core_call_function(PyObject* self, PyObject* args)
+static PyObject* unreal_core_reset_request_stats(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
 {
-    CHECK_CLIENT_AND_RECREATE_IT()
-
-    PyObject* object = NULL;
-    UnrealObject* unreal_object = NULL;
-    ClassProp* ue_class = NULL;
-    char* function_name = NULL;
-    PyObject* params = NULL;
-
-    if (!PyArg_ParseTuple(args, "OO!O!sO!", &object, &UnrealObject_Type, &unreal_object,
-                         &ClassProp_Type, &ue_class, &function_name, &PyList_Type, &params)) {
+    if (!check_positional_args("reset_request_stats", nargs, 0, 1)) {
         return NULL;
     }
+    if (nargs > 0) {
+        int adaptive = PyObject_IsTrue(args[0]);
+        if (adaptive < 0) {
+            return NULL;
+        }
+        adaptive_request_sizing = adaptive != 0;
+    }
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto call_function_request = client.callFunctionRequest();
-    call_function_request.initOwn().setAddress(reinterpret_cast<uint64_t>(object));
-    call_function_request.initUeClass().setTypeName(ue_class->type_name);
+    std::memset(request_size_stats, 0, sizeof(request_size_stats));
+    Py_RETURN_NONE;
+}
 
-    auto call_object = call_function_request.initCallObject();
-    call_object.setName(unreal_object->name);
-    call_object.setAddress(unreal_object->address);
+/**
+ * C API
+ * the UnrealCoreCAPI table of unreal_core_capi.h, exported as the capsule unreal_core._C_API. the functions
+ * build requests from C values and read responses into C buffers, no python object is created on the way.
+ * classes share the interned ids of the class hierarchy table, functions are interned here
+ */
+typedef struct {
+    int32_t class_id;
+    std::string function_name;
+    bool is_static;
+} CFunction;
 
-    call_function_request.setFuncName(function_name);
+static std::vector<CFunction> c_functions;
+static std::unordered_map<std::string, int32_t> c_function_ids;
+static std::string c_function_key;  // reused to look up a function without allocating
+static std::string capi_error;
 
-    // handle params
-    Py_ssize_t list_size = PyList_Size(params);
-    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder call_function_args = call_function_request.initParams((uint32_t)list_size);
+static int capi_fail(const char* message)
+{
+    capi_error.assign(message);
+    return -1;
+}
 
-    if (!setup_unreal_rpc_arguments_from_list(params, call_function_args, list_size))
-    {
-        return NULL;
+static bool capi_connect()
+{
+    if (ue_core_client == NULL) {
+        ue_core_client = create_ue_core_client();
+        if (ue_core_client == NULL) {
+            capi_fail("unreal engine rpc server is not connected");
+            return false;
+        }
     }
+    return true;
+}
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::CallFunctionResults> result = call_function_request.send().wait(wait_scope);
-        
-        PyObject* return_value = parse_value_from_function_return(result.getReturn(), true);
-        if (return_value == NULL) {
-            return NULL; 
-        }
+static bool capi_valid_class(int32_t class_id)
+{
+    if (class_id < 0 || (size_t)class_id >= class_names.size()) {
+        capi_fail("unknown class id");
+        return false;
+    }
+    return true;
+}
 
-        if (Py_None == return_value) {
-            return PyTuple_New(0);
+static bool write_c_value(const UEValue* value, UnrealCore::Argument::Builder& argument)
+{
+    switch (value->kind) {
+        case UE_VALUE_BOOL:
+            argument.setBoolValue(value->as.i != 0);
+            return true;
+        case UE_VALUE_INT:
+            argument.setIntValue(value->as.i);
+            return true;
+        case UE_VALUE_FLOAT:
+            argument.setFloatValue(value->as.f);
+            return true;
+        case UE_VALUE_STR:
+        {
+            if (value->as.str.data == NULL && value->as.str.size != 0) {
+                capi_fail("string value without data");
+                return false;
+            }
+            capnp::Text::Builder text = argument.initStrValue(value->as.str.size);
+            if (value->as.str.size != 0) {
+                memcpy(text.begin(), value->as.str.data, value->as.str.size);
+            }
+            return true;
+        }
+        case UE_VALUE_OBJECT:
+            argument.initObject().setAddress(value->as.object);
+            return true;
+        case UE_VALUE_VECTOR:
+        {
+            auto vector = argument.initVectorValue();
+            vector.setX(value->as.xyzw[0]);
+            vector.setY(value->as.xyzw[1]);
+            vector.setZ(value->as.xyzw[2]);
+            return true;
+        }
+        case UE_VALUE_ROTATOR:
+        {
+            auto rotator = argument.initRotatorValue();
+            rotator.setPitch(value->as.xyzw[0]);
+            rotator.setYaw(value->as.xyzw[1]);
+            rotator.setRoll(value->as.xyzw[2]);
+            return true;
+        }
+        case UE_VALUE_QUAT:
+        {
+            auto quat = argument.initQuatValue();
+            quat.setX(value->as.xyzw[0]);
+            quat.setY(value->as.xyzw[1]);
+            quat.setZ(value->as.xyzw[2]);
+            quat.setW(value->as.xyzw[3]);
+            return true;
         }
+        default:
+            capi_fail("value kind can not be sent");
+            return false;
+    }
+}
 
-        // handle out params
-        auto out_params = result.getOutParams();
-        auto out_params_size = out_params.size();
+// room for a string of size bytes and its NUL at *used of buffer, NULL when the buffer is too small
+static char* reserve_c_string(UEValue* value, size_t size, char* buffer, size_t capacity, size_t* used)
+{
+    value->kind = UE_VALUE_STR;
+    value->as.str.size = size;
+    value->as.str.data = NULL;
+    if (buffer == NULL || *used > capacity || capacity - *used < size + 1) {
+        capi_fail("string buffer too small, str.size holds the needed bytes");
+        return NULL;
+    }
+    char* dest = buffer + *used;
+    dest[size] = '\0';
+    value->as.str.data = dest;
+    *used += size + 1;
+    return dest;
+}
 
-        PyObject* tuple = PyTuple_New(out_params_size + 1); // +1 for return value
-        PyTuple_SetItem(tuple, 0, return_value);
+static int read_c_value(const UnrealCore::Argument::Reader& argument, UEValue* value, char* buffer, size_t capacity, size_t* used)
+{
+    if (argument.getUeClass().getTypeName() == "void") {
+        value->kind = UE_VALUE_NONE;
+        return 0;
+    }
 
-        for (Py_ssize_t i = 0; i < out_params_size; ++i) {
-            // fixme: do not create new py object when out params is unreal object, directly return the passed in py object
-            PyObject* out_param = parse_value_from_function_return(out_params[i], false);
-            if (out_param == NULL) {
-                Py_DECREF(tuple);
-                Py_DECREF(return_value);
-                return NULL;
+    switch (argument.which()) {
+        case UnrealCore::Argument::BOOL_VALUE:
+            value->kind = UE_VALUE_BOOL;
+            value->as.i = argument.getBoolValue();
+            return 0;
+        case UnrealCore::Argument::UINT_VALUE:
+            value->kind = UE_VALUE_INT;
+            value->as.i = (int64_t)argument.getUintValue();
+            return 0;
+        case UnrealCore::Argument::INT_VALUE:
+            value->kind = UE_VALUE_INT;
+            value->as.i = argument.getIntValue();
+            return 0;
+        case UnrealCore::Argument::ENUM_VALUE:
+            value->kind = UE_VALUE_INT;
+            value->as.i = argument.getEnumValue();
+            return 0;
+        case UnrealCore::Argument::FLOAT_VALUE:
+            value->kind = UE_VALUE_FLOAT;
+            value->as.f = argument.getFloatValue();
+            return 0;
+        case UnrealCore::Argument::STR_VALUE:
+        {
+            capnp::Text::Reader text = argument.getStrValue();
+            char* dest = reserve_c_string(value, text.size(), buffer, capacity, used);
+            if (dest == NULL) {
+                return -1;
             }
-
-            PyTuple_SetItem(tuple, i + 1, out_param);
+            memcpy(dest, text.begin(), text.size());
+            return 0;
         }
-
-        return tuple; 
-    })
+        case UnrealCore::Argument::STR_UTF16_VALUE:
+        {
+            capnp::Data::Reader data = argument.getStrUtf16Value();
+            const uint16_t* units = (const uint16_t*)data.begin();
+            size_t length = data.size() / sizeof(uint16_t);
+            char* dest = reserve_c_string(value, utf8_length_of_utf16(units, length), buffer, capacity, used);
+            if (dest == NULL) {
+                return -1;
+            }
+            utf8_from_utf16(units, length, dest);
+            return 0;
+        }
+        case UnrealCore::Argument::OBJECT:
+            value->kind = UE_VALUE_OBJECT;
+            value->as.object = argument.getObject().getAddress();
+            return 0;
+        case UnrealCore::Argument::VECTOR_VALUE:
+        {
+            auto vector = argument.getVectorValue();
+            value->kind = UE_VALUE_VECTOR;
+            value->as.xyzw[0] = vector.getX();
+            value->as.xyzw[1] = vector.getY();
+            value->as.xyzw[2] = vector.getZ();
+            return 0;
+        }
+        case UnrealCore::Argument::ROTATOR_VALUE:
+        {
+            auto rotator = argument.getRotatorValue();
+            value->kind = UE_VALUE_ROTATOR;
+            value->as.xyzw[0] = rotator.getPitch();
+            value->as.xyzw[1] = rotator.getYaw();
+            value->as.xyzw[2] = rotator.getRoll();
+            return 0;
+        }
+        case UnrealCore::Argument::QUAT_VALUE:
+        {
+            auto quat = argument.getQuatValue();
+            value->kind = UE_VALUE_QUAT;
+            value->as.xyzw[0] = quat.getX();
+            value->as.xyzw[1] = quat.getY();
+            value->as.xyzw[2] = quat.getZ();
+            value->as.xyzw[3] = quat.getW();
+            return 0;
+        }
+        default:
+            return capi_fail("value type can not be read through the C API");
+    }
 }
 
 /**
- * unreal_core.call_static_function
- * call rpc function (callStaticFunction) to call a static function
- * 
- * args:
- *   ue_class: ue class name
- *   function_name: str
- *   params: list of struct Argument
- * 
- * returns:
- *   return value: struct Argument
- *   out param value: list of struct Argument
+ * a call of the C API, built, sent and read in separate steps so compiled code can keep several in flight.
+ * callFunction and callStaticFunction differ in their request and response types only
  */
-static PyObject* unreal_core_call_static_function(PyObject* self, PyObject* args)
-{
-    CHECK_CLIENT_AND_RECREATE_IT()
+typedef enum {
+    C_CALL_BUILDING,
+    C_CALL_SENT,
+    C_CALL_DONE,
+    C_CALL_FAILED,
+} CCallState;
+
+struct UnrealCoreCall {
+    virtual ~UnrealCoreCall() noexcept(false) {}
+    virtual capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder params() = 0;
+    virtual void send() = 0;
+    virtual void wait() = 0;
+    virtual UnrealCore::Argument::Reader return_value() = 0;
+    virtual capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Reader out_params() = 0;
+
+    int32_t class_id = CLASS_ID_UNKNOWN;
+    CCallState state = C_CALL_BUILDING;
+};
 
-    ClassProp* ue_class = NULL;
-    char* function_name = NULL;
-    PyObject* params = NULL;
+template <typename Params, typename Results>
+class TypedUnrealCoreCall final : public UnrealCoreCall {
+public:
+    TypedUnrealCoreCall(capnp::Request<Params, Results>&& request, RequestMethod method) : request(kj::mv(request)), method(method) {}
 
-    if (!PyArg_ParseTuple(args, "O!sO!", &ClassProp_Type, &ue_class, &function_name, &PyList_Type, &params)) {
-        return NULL;
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder params() override
+    {
+        return request.getParams();
     }
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto call_static_function_request = client.callStaticFunctionRequest();
-    call_static_function_request.initUeClass().setTypeName(ue_class->type_name);
-
-    call_static_function_request.setFuncName(function_name);
-
-    // handle params
-    Py_ssize_t list_size = PyList_Size(params);
-    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Builder call_function_args = call_static_function_request.initParams(list_size);
-
-    if (!setup_unreal_rpc_arguments_from_list(params, call_function_args, list_size))
+    void send() override
     {
-        return NULL;
+        record_request_size(method, request.totalSize());
+        promise = kj::Promise<capnp::Response<Results>>(request.send());
     }
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::CallStaticFunctionResults> result = call_static_function_request.send().wait(wait_scope);
-        
-        PyObject* return_value = parse_value_from_function_return(result.getReturn(), true);
-        if (return_value == NULL) {
-            return NULL; 
+    void wait() override
+    {
+        KJ_IF_MAYBE(sent, promise) {
+            response = sent->wait(io_context.waitScope);
         }
+        promise = nullptr;
+    }
 
-        // handle out params
-        auto out_params = result.getOutParams();
-        auto out_params_size = out_params.size();
-
-        PyObject* tuple = PyTuple_New(out_params_size + 1); // +1 for return value
-        PyTuple_SetItem(tuple, 0, return_value);
+    UnrealCore::Argument::Reader return_value() override
+    {
+        KJ_IF_MAYBE(received, response) {
+            return received->getReturn();
+        }
+        return UnrealCore::Argument::Reader();
+    }
 
-        for (Py_ssize_t i = 0; i < out_params_size; ++i) {
-            // fixme: do not create new py object when out params is unreal object, directly return the passed in py object
-            PyObject* out_param = parse_value_from_function_return(out_params[i], false); 
-            PyTuple_SetItem(tuple, i + 1, out_param);
+    capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Reader out_params() override
+    {
+        KJ_IF_MAYBE(received, response) {
+            return received->getOutParams();
         }
+        return capnp::List<UnrealCore::Argument, capnp::Kind::STRUCT>::Reader();
+    }
 
-        return tuple; 
-    })
+private:
+    capnp::Request<Params, Results> request;
+    RequestMethod method;
+    kj::Maybe<kj::Promise<capnp::Response<Results>>> promise;
+    kj::Maybe<capnp::Response<Results>> response;
+};
 
+static const char* capi_last_error(void)
+{
+    return capi_error.c_str();
 }
 
-/**
- * unreal_core.get_property
- * call rpc function (getProperty) to get a property
- * 
- * args:
- *   ue_class: ue class name
- *   object: pyobject
- *   property_name: Property name
- * 
- */
-static PyObject* unreal_core_get_property(PyObject* self, PyObject* args)
+static int32_t capi_resolve_class(const char* class_name)
 {
-    CHECK_CLIENT_AND_RECREATE_IT()
-
-    ClassProp* ue_class = NULL;
-    PyObject* object = NULL;
-    char* property_name = NULL;
+    if (class_name == NULL) {
+        return capi_fail("class name is NULL");
+    }
+    return intern_class_id(class_name, strlen(class_name));
+}
 
-    if (!PyArg_ParseTuple(args, "OO!s", &object, &ClassProp_Type, &ue_class, &property_name)) {
-        return NULL;
+static int32_t capi_resolve_function(int32_t class_id, const char* function_name, uint32_t flags)
+{
+    if (!capi_valid_class(class_id)) {
+        return -1;
+    }
+    if (function_name == NULL) {
+        return capi_fail("function name is NULL");
     }
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto get_property_request = client.getPropertyRequest();
-    get_property_request.initUeClass().setTypeName(ue_class->type_name);
-    get_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
-    get_property_request.setPropertyName(property_name);
+    bool is_static = (flags & UE_FUNCTION_STATIC) != 0;
+    c_function_key.assign((const char*)&class_id, sizeof(class_id));
+    c_function_key.push_back(is_static ? 's' : 'm');
+    c_function_key.append(function_name);
+    auto it = c_function_ids.find(c_function_key);
+    if (it != c_function_ids.end()) {
+        return it->second;
+    }
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::GetPropertyResults> result = get_property_request.send().wait(wait_scope);
-        return parse_value_from_function_return(result.getProperty(), false);
-    })
+    int32_t function_id = (int32_t)c_functions.size();
+    c_functions.push_back(CFunction{class_id, function_name, is_static});
+    c_function_ids.emplace(c_function_key, function_id);
+    return function_id;
 }
 
-/**
- * unreal_core.set_property
- * call rpc function (setProperty) to set a property
- * 
- * args:
- *   ue_class: ue class name
- *   object: pyobject
- *   property: struct Argument
- */
-static PyObject* unreal_core_set_property(PyObject* self, PyObject* args)
+static UnrealCoreCall* capi_begin_call(int32_t function_id, uint64_t owner, uint64_t object_address, const char* object_name, uint32_t param_count)
 {
-    CHECK_CLIENT_AND_RECREATE_IT()
-
-    ClassProp* ue_class = NULL;
-    PyObject* object = NULL;
-    PyObject* property_value = NULL;
-
-    if (!PyArg_ParseTuple(args, "OO!O!", &object, &ClassProp_Type, &ue_class, &Argument_Type, &property_value)) {
+    if (function_id < 0 || (size_t)function_id >= c_functions.size()) {
+        capi_fail("unknown function id");
         return NULL;
     }
-
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto set_property_request = client.setPropertyRequest();
-    set_property_request.initUeClass().setTypeName(ue_class->type_name);
-    set_property_request.initOwner().setAddress(reinterpret_cast<uint64_t>(object));
-    auto unreal_core_argument = set_property_request.initProperty();
-    if (!create_unreal_rpc_argument(property_value, unreal_core_argument)) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create unreal core argument the property should be argument type");
+    if (!capi_connect()) {
         return NULL;
     }
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        set_property_request.send().wait(wait_scope);
-    })
-}
-
-static PyObject* unreal_core_find_class(PyObject* self, PyObject* args)
-{
-    Py_RETURN_NONE;
+    const CFunction& function = c_functions[function_id];
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    UnrealCoreCall* call;
+    if (function.is_static) {
+        auto request = client.callStaticFunctionRequest(request_size_hint(REQUEST_CALL_STATIC_FUNCTION));
+        request.initUeClass().setTypeName(class_names[function.class_id]);
+        request.setFuncName(function.function_name);
+        request.initParams(param_count);
+        call = new TypedUnrealCoreCall<UnrealCore::CallStaticFunctionParams, UnrealCore::CallStaticFunctionResults>(kj::mv(request), REQUEST_CALL_STATIC_FUNCTION);
+    }
+    else {
+        auto request = client.callFunctionRequest(request_size_hint(REQUEST_CALL_FUNCTION));
+        request.initOwn().setAddress(owner);
+        auto call_object = request.initCallObject();
+        call_object.setName(object_name != NULL ? object_name : "");
+        call_object.setAddress(object_address);
+        request.initUeClass().setTypeName(class_names[function.class_id]);
+        request.setFuncName(function.function_name);
+        request.initParams(param_count);
+        call = new TypedUnrealCoreCall<UnrealCore::CallFunctionParams, UnrealCore::CallFunctionResults>(kj::mv(request), REQUEST_CALL_FUNCTION);
+    }
+    call->class_id = function.class_id;
+    return call;
 }
 
-static PyObject* unreal_core_load_class(PyObject* self, PyObject* args)
+static int capi_encode_param(UnrealCoreCall* call, uint32_t index, const char* name, const UEValue* value)
 {
-    Py_RETURN_NONE;
-}
+    if (call == NULL || value == NULL) {
+        return capi_fail("call or value is NULL");
+    }
+    if (call->state != C_CALL_BUILDING) {
+        return capi_fail("params can only be encoded before the call is sent");
+    }
+    auto params = call->params();
+    if (index >= params.size()) {
+        return capi_fail("param index out of range");
+    }
 
-static PyObject* unreal_core_load_object(PyObject* self, PyObject* args)
-{
-    Py_RETURN_NONE;
+    UnrealCore::Argument::Builder param = params[index];
+    param.initUeClass().setTypeName(class_names[call->class_id]);
+    if (name != NULL) {
+        param.setName(name);
+    }
+    return write_c_value(value, param) ? 0 : -1;
 }
 
-static PyObject* unreal_core_bind_delegate(PyObject* self, PyObject* args)
+static int capi_send_call(UnrealCoreCall* call)
 {
-    Py_RETURN_NONE;
+    if (call == NULL || call->state != C_CALL_BUILDING) {
+        return capi_fail("call was already sent");
+    }
+    try {
+        call->send();
+    } catch (kj::Exception& e) {
+        call->state = C_CALL_FAILED;
+        return capi_fail(e.getDescription().cStr());
+    }
+    call->state = C_CALL_SENT;
+    return 0;
 }
 
-static PyObject* unreal_core_unbind_delegate(PyObject* self, PyObject* args)
+static int capi_wait_call(UnrealCoreCall* call)
 {
-    Py_RETURN_NONE;
+    if (call == NULL || call->state != C_CALL_SENT) {
+        return capi_fail("call was not sent");
+    }
+    try {
+        call->wait();
+    } catch (kj::Exception& e) {
+        call->state = C_CALL_FAILED;
+        return capi_fail(e.getDescription().cStr());
+    }
+    call->state = C_CALL_DONE;
+    return 0;
 }
 
-static PyObject* unreal_core_add_multicast_delegate(PyObject* self, PyObject* args)
+static int capi_read_result(UnrealCoreCall* call, int32_t index, UEValue* value, char* buffer, size_t capacity)
 {
-    Py_RETURN_NONE;
-}
+    if (call == NULL || value == NULL) {
+        return capi_fail("call or value is NULL");
+    }
+    if (call->state != C_CALL_DONE) {
+        return capi_fail("call has not finished");
+    }
 
-static PyObject* unreal_core_remove_multicast_delegate(PyObject* self, PyObject* args) 
-{
-    Py_RETURN_NONE;
+    size_t used = 0;
+    if (index < 0) {
+        return read_c_value(call->return_value(), value, buffer, capacity, &used);
+    }
+    auto out_params = call->out_params();
+    if ((uint32_t)index >= out_params.size()) {
+        return capi_fail("out param index out of range");
+    }
+    return read_c_value(out_params[index], value, buffer, capacity, &used);
 }
 
-static PyObject* unreal_core_register_overrided_class(PyObject* self, PyObject* args)
+static int32_t capi_out_param_count(UnrealCoreCall* call)
 {
-    Py_RETURN_NONE;
+    if (call == NULL || call->state != C_CALL_DONE) {
+        return capi_fail("call has not finished");
+    }
+    return (int32_t)call->out_params().size();
 }
 
-static PyObject* unreal_core_unregister_overrided_class(PyObject* self, PyObject* args)
+static void capi_end_call(UnrealCoreCall* call)
 {
-    Py_RETURN_NONE;
+    delete call;
 }
 
-static PyObject* unreal_core_new_container(PyObject* self, PyObject* args)
+/**
+ * getProperty of every name, all sent before the first is waited for, so the batch costs one round trip
+ */
+static int capi_get_properties(uint64_t owner, int32_t class_id, const char* const* names, uint32_t count, UEValue* values, char* buffer, size_t capacity)
 {
-    CHECK_CLIENT_AND_RECREATE_IT()
-
-    PyObject* self_object = NULL;
-    ClassProp* container_type = NULL;
-    ClassProp* value_type = NULL;
-    ClassProp* key_type = NULL;
-
-    if (!PyArg_ParseTuple(args, "OO!O!O!", &self_object, &ClassProp_Type, &container_type, &ClassProp_Type, &value_type, &ClassProp_Type, &key_type)) {
-        return NULL;
+    if (!capi_valid_class(class_id) || !capi_connect()) {
+        return -1;
     }
-
-    if (self_object == Py_None) {
-        PyErr_SetString(PyExc_ValueError, "Must pass into self object rather than None");
-        return NULL;
+    if (count != 0 && (names == NULL || values == NULL)) {
+        return capi_fail("names or values is NULL");
     }
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-
-    auto new_container_request = client.newContainerRequest();
-    new_container_request.initOwn().setAddress(reinterpret_cast<uint64_t>(self_object));
-    new_container_request.initContainerType().setTypeName(container_type->type_name);
-    new_container_request.initValueType().setTypeName(value_type->type_name);
-    new_container_request.initKeyType().setTypeName(key_type->type_name);
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    kj::Vector<kj::Promise<capnp::Response<UnrealCore::GetPropertyResults>>> promises(count);
+    try {
+        for (uint32_t i = 0; i < count; i++) {
+            if (names[i] == NULL) {
+                return capi_fail("property name is NULL");
+            }
+            auto get_property_request = client.getPropertyRequest(request_size_hint(REQUEST_GET_PROPERTY));
+            get_property_request.initUeClass().setTypeName(class_names[class_id]);
+            get_property_request.initOwner().setAddress(owner);
+            get_property_request.setPropertyName(names[i]);
+            record_request_size(REQUEST_GET_PROPERTY, get_property_request.totalSize());
+            promises.add(get_property_request.send());
+        }
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        capnp::Response<UnrealCore::NewContainerResults> result = new_container_request.send().wait(wait_scope);
-        UnrealObject* unreal_object = (UnrealObject*)PyObject_New(UnrealObject, &UnrealObject_Type);
-        unreal_object->address = result.getContainer().getAddress();
-        unreal_object->name = deep_copy_str(container_type->type_name.c_str());
-        
-        return (PyObject*)unreal_object;
-    })
+        size_t used = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            capnp::Response<UnrealCore::GetPropertyResults> result = promises[i].wait(io_context.waitScope);
+            if (read_c_value(result.getProperty(), &values[i], buffer, capacity, &used) < 0) {
+                return -1;
+            }
+        }
+    } catch (kj::Exception& e) {
+        return capi_fail(e.getDescription().cStr());
+    }
+    return 0;
 }
 
-static PyObject* unreal_core_destroy_container(PyObject* self, PyObject* args)
+// setProperty of every name, sent as one batch like capi_get_properties
+static int capi_set_properties(uint64_t owner, int32_t class_id, const char* const* names, const UEValue* values, uint32_t count)
 {
-    CHECK_CLIENT_AND_RECREATE_IT()
-
-    PyObject* self_object = NULL;
-
-    if (!PyArg_ParseTuple(args, "O", &self_object)) {
-        return NULL;
+    if (!capi_valid_class(class_id) || !capi_connect()) {
+        return -1;
     }
-
-    if (self_object == Py_None) {
-        PyErr_SetString(PyExc_ValueError, "Must pass into self object rather than None");
-        return NULL;
+    if (count != 0 && (names == NULL || values == NULL)) {
+        return capi_fail("names or values is NULL");
     }
 
-    UnrealCore::Client client = ue_core_client->client->bootstrap().castAs<UnrealCore>();
-    auto destroy_container_request = client.destroyContainerRequest();
-    destroy_container_request.initOwn().setAddress(reinterpret_cast<uint64_t>(self_object));
+    UnrealCore::Client& client = ue_core_client->ue_core;
+    kj::Vector<kj::Promise<capnp::Response<UnrealCore::SetPropertyResults>>> promises(count);
+    try {
+        for (uint32_t i = 0; i < count; i++) {
+            if (names[i] == NULL) {
+                return capi_fail("property name is NULL");
+            }
+            auto set_property_request = client.setPropertyRequest(request_size_hint(REQUEST_SET_PROPERTY));
+            set_property_request.initUeClass().setTypeName(class_names[class_id]);
+            set_property_request.initOwner().setAddress(owner);
+            auto property = set_property_request.initProperty();
+            property.initUeClass().setTypeName(class_names[class_id]);
+            property.setName(names[i]);
+            if (!write_c_value(&values[i], property)) {
+                return -1;
+            }
+            record_request_size(REQUEST_SET_PROPERTY, set_property_request.totalSize());
+            promises.add(set_property_request.send());
+        }
 
-    kj::WaitScope& wait_scope = io_context.waitScope;
-    CATCH_EXCEPTION_FOR_RPC_CALL({
-        destroy_container_request.send().wait(wait_scope);
-        Py_RETURN_NONE;
-    })
+        for (uint32_t i = 0; i < count; i++) {
+            promises[i].wait(io_context.waitScope);
+        }
+    } catch (kj::Exception& e) {
+        return capi_fail(e.getDescription().cStr());
+    }
+    return 0;
 }
 
+static const UnrealCoreCAPI unreal_core_capi = {
+    UNREAL_CORE_CAPI_VERSION,
+    sizeof(UnrealCoreCAPI),
+    capi_last_error,
+    capi_resolve_class,
+    capi_resolve_function,
+    capi_begin_call,
+    capi_encode_param,
+    capi_send_call,
+    capi_wait_call,
+    capi_read_result,
+    capi_out_param_count,
+    capi_end_call,
+    capi_get_properties,
+    capi_set_properties,
+};
+
 static PyMethodDef unreal_core_methods[] = {
-    {"new_object", unreal_core_new_object, METH_VARARGS, "Create a new unreal object"},
-    {"destory_object", unreal_core_destory_object, METH_VARARGS, "Destory a unreal object"},
-    {"new_container", unreal_core_new_container, METH_VARARGS, "Create a new container"},
-    {"destroy_container", unreal_core_destroy_container, METH_VARARGS, "Destroy a container"},
-    {"call_function", unreal_core_call_function, METH_VARARGS, "Call a function"},
-    {"call_static_function", unreal_core_call_static_function, METH_VARARGS, "Call a static function"},
-    {"get_property", unreal_core_get_property, METH_VARARGS, "Get a property"},
-    {"set_property", unreal_core_set_property, METH_VARARGS, "Set a property"},
+    {"new_object", (PyCFunction)(void(*)(void))unreal_core_new_object, METH_FASTCALL, "Create a new unreal object"},
+    {"destory_object", (PyCFunction)(void(*)(void))unreal_core_destory_object, METH_FASTCALL, "Destory a unreal object"},
+    {"new_container", (PyCFunction)(void(*)(void))unreal_core_new_container, METH_FASTCALL, "Create a new container"},
+    {"destroy_container", (PyCFunction)(void(*)(void))unreal_core_destroy_container, METH_FASTCALL, "Destroy a container"},
+    {"call_function", (PyCFunction)(void(*)(void))unreal_core_call_function, METH_FASTCALL, "Call a function"},
+    {"call", (PyCFunction)(void(*)(void))unreal_core_call, METH_FASTCALL, "Call a function with positional param values"},
+    {"inline_cache_stats", (PyCFunction)(void(*)(void))unreal_core_inline_cache_stats, METH_FASTCALL, "Hit and miss counts of the call inline caches"},
+    {"reset_inline_caches", (PyCFunction)(void(*)(void))unreal_core_reset_inline_caches, METH_FASTCALL, "Drop the call inline caches"},
+    {"prepare", (PyCFunction)(void(*)(void))unreal_core_prepare, METH_FASTCALL, "Compile a function signature into a PreparedCall"},
+    {"call_static_function", (PyCFunction)(void(*)(void))unreal_core_call_static_function, METH_FASTCALL, "Call a static function"},
+    {"set_local_evaluation", (PyCFunction)(void(*)(void))unreal_core_set_local_evaluation, METH_FASTCALL, "Evaluate pure math functions locally, remotely or both"},
+    {"local_evaluation_stats", (PyCFunction)(void(*)(void))unreal_core_local_evaluation_stats, METH_FASTCALL, "Local evaluation counters per function"},
+#ifdef UNREAL_CORE_TESTING
+    {"set_loopback_static_function_handler", (PyCFunction)(void(*)(void))unreal_core_set_loopback_static_function_handler, METH_FASTCALL, "Answer static function calls on the stand-in server from python"},
+    {"set_loopback_class_hierarchy", (PyCFunction)(void(*)(void))unreal_core_set_loopback_class_hierarchy, METH_FASTCALL, "Set the parents and interfaces the stand-in server answers for a class"},
+#endif
+    {"is_a", (PyCFunction)(void(*)(void))unreal_core_is_a, METH_FASTCALL, "Whether a ue object is, derives from or implements a ue class"},
+    {"cast", (PyCFunction)(void(*)(void))unreal_core_cast, METH_FASTCALL, "The object when it is a ue class, None otherwise"},
+    {"clear_class_hierarchies", (PyCFunction)(void(*)(void))unreal_core_clear_class_hierarchies, METH_FASTCALL, "Forget the fetched class hierarchies"},
+    {"get_property", (PyCFunction)(void(*)(void))unreal_core_get_property, METH_FASTCALL, "Get a property"},
+    {"set_property", (PyCFunction)(void(*)(void))unreal_core_set_property, METH_FASTCALL, "Set a property"},
+    {"count_allocations", (PyCFunction)(void(*)(void))unreal_core_count_allocations, METH_FASTCALL, "Count PyMem/PyObject heap allocations per call of a function"},
+    {"time_encode", (PyCFunction)(void(*)(void))unreal_core_time_encode, METH_FASTCALL, "Time generic against specialized param encoding"},
+    {"set_text_view_threshold", (PyCFunction)(void(*)(void))unreal_core_set_text_view_threshold, METH_FASTCALL, "Return large Text results as memoryviews"},
+    {"set_lazy_results", (PyCFunction)(void(*)(void))unreal_core_set_lazy_results, METH_FASTCALL, "Decode function results on access"},
+    {"set_param_encoding", (PyCFunction)(void(*)(void))unreal_core_set_param_encoding, METH_FASTCALL, "Choose the param encoding of function calls"},
+    {"set_string_encoding", (PyCFunction)(void(*)(void))unreal_core_set_string_encoding, METH_FASTCALL, "Choose the wire encoding of strings"},
+    {"register_converter", (PyCFunction)(void(*)(void))unreal_core_register_converter, METH_FASTCALL, "Register the encoder and decoder of a python type"},
+    {"request_stats", (PyCFunction)(void(*)(void))unreal_core_request_stats, METH_FASTCALL, "Request sizing counters of every rpc method"},
+    {"dump_reflection", (PyCFunction)(void(*)(void))unreal_core_dump_reflection, METH_FASTCALL, "Reflection dump of the engine classes as JSON"},
+    {"clear_class_cache", (PyCFunction)(void(*)(void))unreal_core_clear_class_cache, METH_FASTCALL, "Forget the python classes found for returned objects"},
+    {"reset_request_stats", (PyCFunction)(void(*)(void))unreal_core_reset_request_stats, METH_FASTCALL, "Clear the request sizing counters"},
+    {"transform_points", (PyCFunction)(void(*)(void))unreal_core_transform_points, METH_FASTCALL, "Transform a float64 buffer of points"},
+    {"compose_transforms", (PyCFunction)(void(*)(void))unreal_core_compose_transforms, METH_FASTCALL, "Compose float64 buffers of transforms"},
+    {"quat_slerp_many", (PyCFunction)(void(*)(void))unreal_core_quat_slerp_many, METH_FASTCALL, "Slerp float64 buffers of quats"},
+    {"look_at_many", (PyCFunction)(void(*)(void))unreal_core_look_at_many, METH_FASTCALL, "Look at rotations of float64 buffers of points"},
+    {"set_batch_threads", (PyCFunction)(void(*)(void))unreal_core_set_batch_threads, METH_FASTCALL, "Split large batches across threads"},
     {NULL, NULL, 0, NULL}
 };
 
 static void clean_ue_core_client_inner()
 {
     if (ue_core_client != NULL) {
-        kj::Own<capnp::TwoPartyClient> TMP_cleint = kj::mv(ue_core_client->client);
-        kj::Own<kj::AsyncIoStream> TMP_connection = kj::mv(ue_core_client->connection);
-        free(ue_core_client);
+        delete ue_core_client;
         ue_core_client = NULL;
     }
 
@@ -1278,6 +8209,11 @@ static struct PyModuleDef unreal_core_module = {
 PyMODINIT_FUNC PyInit_unreal_core(void)
 {
     PyObject* m;
+#if PY_VERSION_HEX >= 0x03090000
+    // calling the exact types goes through vectorcall, subclasses keep using tp_new/tp_init
+    Argument_Type.tp_vectorcall = Argument_vectorcall;
+    UnrealObject_Type.tp_vectorcall = UnrealObject_vectorcall;
+#endif
     if (PyType_Ready(&ClassProp_Type) < 0) {
         return NULL;
     }
@@ -1290,8 +8226,52 @@ PyMODINIT_FUNC PyInit_unreal_core(void)
     if (PyType_Ready(&UnrealObject_Type) < 0) {
         return NULL;
     }
+    // the number protocol and methods refer back to the types, so they are attached here
+    Vector2D_Type.tp_as_number = &Vector2D_as_number;
+    Vector2D_Type.tp_methods = Vector2D_methods;
+    Vector_Type.tp_as_number = &Vector_as_number;
+    Vector_Type.tp_methods = Vector_methods;
+    Quat_Type.tp_as_number = &Quat_as_number;
+    Quat_Type.tp_methods = Quat_methods;
+    Transform_Type.tp_as_number = &Transform_as_number;
+    Transform_Type.tp_methods = Transform_methods;
+    if (PyType_Ready(&Vector2D_Type) < 0 || PyType_Ready(&Vector_Type) < 0 || PyType_Ready(&Rotator_Type) < 0 ||
+        PyType_Ready(&Quat_Type) < 0 || PyType_Ready(&Transform_Type) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&ResponseOwner_Type) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&ResponseView_Type) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&ResultView_Type) < 0) {
+        return NULL;
+    }
+#if PY_VERSION_HEX >= 0x03090000
+    PreparedCall_Type.tp_vectorcall_offset = offsetof(PreparedCall, vectorcall);
+    PreparedCall_Type.tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+    UFunction_Type.tp_vectorcall_offset = offsetof(UFunction, vectorcall);
+    UFunction_Type.tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL | Py_TPFLAGS_METHOD_DESCRIPTOR;
+#endif
+    if (PyType_Ready(&PreparedCall_Type) < 0) {
+        return NULL;
+    }
+
+    if (PyType_Ready(&UProperty_Type) < 0 || PyType_Ready(&UFunction_Type) < 0) {
+        return NULL;
+    }
 
+#ifdef UNREAL_CORE_TESTING
+    if (getenv(LOOPBACK_ENV_NAME) != NULL) {
+        ue_core_client = create_loopback_ue_core_client();
+    }
+    else {
+        ue_core_client = create_ue_core_client();
+    }
+#else
     ue_core_client = create_ue_core_client();
+#endif
     if (ue_core_client == NULL) {
         PyErr_SetString(PyExc_RuntimeError, "connect to unreal engine rpc server failed, run unreal engine at first.");
         return NULL;
@@ -1331,6 +8311,52 @@ PyMODINIT_FUNC PyInit_unreal_core(void)
         return NULL;
     }
 
+    Py_INCREF(&PreparedCall_Type);
+    if (PyModule_AddObject(m, "PreparedCall", (PyObject*)&PreparedCall_Type) < 0) {
+        Py_DECREF(&PreparedCall_Type);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&UProperty_Type);
+    if (PyModule_AddObject(m, "UProperty", (PyObject*)&UProperty_Type) < 0) {
+        Py_DECREF(&UProperty_Type);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&UFunction_Type);
+    if (PyModule_AddObject(m, "UFunction", (PyObject*)&UFunction_Type) < 0) {
+        Py_DECREF(&UFunction_Type);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&ResultView_Type);
+    if (PyModule_AddObject(m, "ResultView", (PyObject*)&ResultView_Type) < 0) {
+        Py_DECREF(&ResultView_Type);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    PyTypeObject* value_types[] = {&Vector2D_Type, &Vector_Type, &Rotator_Type, &Quat_Type, &Transform_Type};
+    for (PyTypeObject* value_type : value_types) {
+        Py_INCREF(value_type);
+        if (PyModule_AddObject(m, strrchr(value_type->tp_name, '.') + 1, (PyObject*)value_type) < 0) {
+            Py_DECREF(value_type);
+            Py_DECREF(m);
+            return NULL;
+        }
+    }
+
+    // compiled extensions reach the C API through PyCapsule_Import(UNREAL_CORE_CAPI_NAME)
+    PyObject* capi = PyCapsule_New((void*)&unreal_core_capi, UNREAL_CORE_CAPI_NAME, NULL);
+    if (capi == NULL || PyModule_AddObject(m, "_C_API", capi) < 0) {
+        Py_XDECREF(capi);
+        Py_DECREF(m);
+        return NULL;
+    }
+
     Py_AtExit(clean_ue_core_client_inner);
     
     return m;
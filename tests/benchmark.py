@@ -0,0 +1,787 @@
+import array
+import os
+import subprocess
+import sys
+import tempfile
+import time
+import timeit
+import tracemalloc
+import types
+from dataclasses import dataclass
+from enum import Enum
+from typing import NamedTuple
+
+# answer rpc calls from the in-process stand-in server so the benchmarks run without unreal engine,
+# needs unreal_core built with UNREAL_CORE_TESTING=1
+os.environ.setdefault("UNREAL_CORE_LOOPBACK", "1")
+
+import unreal_core
+from unreal_core import ClassProp, Argument, UnrealObject
+
+
+class BenchEnum(Enum):
+    FIRST = 1
+    SECOND = 2
+
+
+class BenchObject:
+    pass
+
+
+@dataclass
+class BenchHit:
+    actor: str
+    distance: float
+    bone: int
+
+
+@dataclass
+class BenchSlotsHit:
+    __slots__ = ("actor", "distance", "bone")
+    actor: str
+    distance: float
+    bone: int
+
+
+class BenchTupleHit(NamedTuple):
+    actor: str
+    distance: float
+    bone: int
+
+
+class BenchTag:
+    def __init__(self, name):
+        self.name = name
+
+
+def report(label, number, elapsed):
+    print(f"{label:<40} {number / elapsed:>14,.0f} ops/s  {elapsed / number * 1e9:>8.1f} ns/op")
+
+
+def bench_target(class_name="MyObject"):
+    """
+    class, python owner and ue object the loopback calls of a benchmark go to
+    """
+    return ClassProp(class_name), BenchObject(), UnrealObject(0x1000, "bench")
+
+
+def bench_argument_construction(number=200000):
+    """
+    Argument construction throughput for every value kind handled by the type dispatch table
+    """
+    ue_class = ClassProp("MyObject")
+    obj = BenchObject()
+    cases = [
+        ("bool", True, None),
+        ("int", 1, None),
+        ("int as enum", 1, "enum"),
+        ("float", 1.0, None),
+        ("float as int", 1.0, "int"),
+        ("str", "value", None),
+        ("enum", BenchEnum.SECOND, None),
+        ("object", obj, None),
+    ]
+
+    print("== Argument construction")
+    for label, value, hint in cases:
+        if hint is None:
+            elapsed = timeit.timeit(lambda: Argument("a", ue_class, value), number=number)
+        else:
+            elapsed = timeit.timeit(lambda: Argument("a", ue_class, value, hint), number=number)
+        report(f"Argument({label})", number, elapsed)
+
+
+def bench_module_calls(number=100000):
+    """
+    Per-call overhead of the module functions: argument unpacking, request building and
+    dispatch to the in-process stand-in server
+    """
+    ue_class, obj, unreal_object = bench_target()
+    no_args = []
+    two_args = [Argument("a", ue_class, 1), Argument("b", ue_class, 2.0)]
+    prop = Argument("value", ue_class, 1)
+
+    cases = [
+        ("UnrealObject(address, name)", lambda: UnrealObject(0x1000, "bench")),
+        ("call_function(0 args)", lambda: unreal_core.call_function(obj, unreal_object, ue_class, "Func", no_args)),
+        ("call_function(2 args)", lambda: unreal_core.call_function(obj, unreal_object, ue_class, "Func", two_args)),
+        ("call_static_function(2 args)", lambda: unreal_core.call_static_function(ue_class, "Func", two_args)),
+        ("get_property", lambda: unreal_core.get_property(obj, ue_class, "value")),
+        ("set_property", lambda: unreal_core.set_property(obj, ue_class, prop)),
+    ]
+
+    print("== Module calls (loopback)")
+    for label, func in cases:
+        elapsed = timeit.timeit(func, number=number)
+        report(label, number, elapsed)
+
+
+def bench_positional_call(number=100000):
+    """
+    call_function with an Argument per param against call() with plain values,
+    time and PyMem/PyObject heap allocations per call
+    """
+    ue_class, obj, unreal_object = bench_target()
+
+    def with_arguments():
+        return unreal_core.call_function(obj, unreal_object, ue_class, "Add",
+                                         [Argument("a", ue_class, 1, "int"), Argument("b", ue_class, 2, "int")])
+
+    def with_values():
+        return unreal_core.call(obj, unreal_object, ue_class, "Add", 1, 2)
+
+    print("== Positional call (loopback)")
+    for label, func in [("call_function([Argument, Argument])", with_arguments), ("call(obj, ..., 1, 2)", with_values)]:
+        elapsed = timeit.timeit(func, number=number)
+        allocations = unreal_core.count_allocations(func, 1000)
+        report(label, number, elapsed)
+        print(f"{'':<40} {allocations:>14.1f} PyMem allocations/call")
+
+
+def bench_prepared_call(number=100000):
+    """
+    call_function against a PreparedCall for the same two-param function
+    """
+    ue_class, obj, unreal_object = bench_target("Actor")
+    prepared = unreal_core.prepare(ue_class, "SetActorScale", [("Scale", "float"), ("bSweep", "bool")])
+
+    def with_call_function():
+        return unreal_core.call_function(obj, unreal_object, ue_class, "SetActorScale",
+                                         [Argument("Scale", ue_class, 2.0), Argument("bSweep", ue_class, False)])
+
+    def with_prepared():
+        return prepared(obj, unreal_object, 2.0, False)
+
+    print("== Prepared call (loopback)")
+    for label, func in [("call_function", with_call_function), ("PreparedCall", with_prepared)]:
+        elapsed = timeit.timeit(func, number=number)
+        report(label, number, elapsed)
+
+
+def bench_inline_cache(number=100000):
+    """
+    call() at a monomorphic call site against one whose param types keep changing,
+    followed by the inline cache hit rates
+    """
+    ue_class, obj, unreal_object = bench_target()
+    mixed = [(1, 2.0, "a"), (1.0, 2, "a"), ("a", 1, 2.0)]
+    counter = iter(range(sys.maxsize))
+
+    def monomorphic():
+        return unreal_core.call(obj, unreal_object, ue_class, "Mono", 1, 2.0, "a")
+
+    def polymorphic():
+        return unreal_core.call(obj, unreal_object, ue_class, "Poly", *mixed[next(counter) % 3])
+
+    unreal_core.reset_inline_caches()
+    print("== Inline cache (loopback)")
+    for label, func in [("monomorphic", monomorphic), ("polymorphic", polymorphic)]:
+        elapsed = timeit.timeit(func, number=number)
+        report(label, number, elapsed)
+    for site, (hits, misses, state) in sorted(unreal_core.inline_cache_stats().items()):
+        print(f"{site:<40} {hits / max(hits + misses, 1):>14.1%} hit rate  ({state})")
+
+
+def bench_request_sizing(number=100000):
+    """
+    call_function with the capnp default first segment against histogram sized requests,
+    time and the segments and bytes per call modeled on the capnp growth policy
+    """
+    ue_class, obj, unreal_object = bench_target()
+    params = [Argument("a", ue_class, 1), Argument("b", ue_class, 2.0), Argument("c", ue_class, "x" * 64)]
+
+    def func():
+        return unreal_core.call_function(obj, unreal_object, ue_class, "Func", params)
+
+    print("== Request sizing (loopback)")
+    unreal_core.set_param_encoding("v1")
+    for label, adaptive in [("default first segment", False), ("adaptive first segment", True)]:
+        unreal_core.reset_request_stats(adaptive)
+        elapsed = timeit.timeit(func, number=number)
+        stats = unreal_core.request_stats()["callFunction"]
+        report(label, number, elapsed)
+        print(f"{'':<40} {stats['modeled_segments'] / stats['requests']:>14.2f} modeled segments/call"
+              f"  {stats['modeled_words'] * 8 / stats['requests']:>8.0f} modeled bytes/call")
+    unreal_core.set_param_encoding("auto")
+
+
+def bench_request_template(number=100000):
+    """
+    prepared calls patched in place (scalar kinds) against per value marshalling (auto kinds)
+    for a growing number of float params
+    """
+    ue_class, obj, unreal_object = bench_target()
+
+    print("== Request template (loopback)")
+    for count in (1, 4, 16):
+        names = [f"p{i}" for i in range(count)]
+        values = [float(i) for i in range(count)]
+        templated = unreal_core.prepare(ue_class, "Func", [(name, "float") for name in names])
+        marshalled = unreal_core.prepare(ue_class, "Func", [(name, "auto") for name in names])
+        for label, prepared in [("template", templated), ("per value", marshalled)]:
+            elapsed = timeit.timeit(lambda: prepared(obj, unreal_object, *values), number=number)
+            report(f"{label} ({count} params)", number, elapsed)
+
+
+def bench_large_strings(number=2000):
+    """
+    round trip of large str params through the echoing stand-in server,
+    results built as str against memoryviews of the response
+    """
+    ue_class, obj, unreal_object = bench_target()
+
+    print("== Large strings (loopback)")
+    for size in (1024, 64 * 1024, 1024 * 1024):
+        text = "x" * size
+        argument = Argument("Text", ue_class, text)
+        for label, threshold in [("str", 0), ("memoryview", 4096)]:
+            unreal_core.set_text_view_threshold(threshold)
+            elapsed = timeit.timeit(lambda: unreal_core.call_function(obj, unreal_object, ue_class, "Echo", [argument]),
+                                    number=number)
+            report(f"{label} ({size // 1024}KB)", number, elapsed)
+            print(f"{'':<40} {size * number / elapsed / 1e9:>14.2f} GB/s")
+    unreal_core.set_text_view_threshold(0)
+
+
+def bench_buffers(number=2000):
+    """
+    round trip of numeric arrays through the echoing stand-in server, sent from buffers and
+    returned as memoryviews, against the same values passed as a list of float Arguments
+    """
+    ue_class, obj, unreal_object = bench_target()
+
+    print("== Buffers (loopback)")
+    for count in (16, 1024, 64 * 1024):
+        for code in ("f", "d"):
+            values = array.array(code, range(count))
+            argument = Argument("Values", ue_class, values)
+            elapsed = timeit.timeit(lambda: unreal_core.call_function(obj, unreal_object, ue_class, "Echo", [argument]),
+                                    number=number)
+            report(f"array('{code}') ({count} items)", number, elapsed)
+            print(f"{'':<40} {count * values.itemsize * number / elapsed / 1e9:>14.2f} GB/s")
+        if count <= 1024:
+            arguments = [Argument(f"v{i}", ue_class, float(i)) for i in range(count)]
+            elapsed = timeit.timeit(lambda: unreal_core.call_function(obj, unreal_object, ue_class, "Echo", arguments),
+                                    number=number)
+            report(f"float Arguments ({count} items)", number, elapsed)
+
+
+class RemoteVector2D:
+    """
+    Vector2D as it used to be bound, a remote object behind an address
+    """
+    def __init__(self, X, Y):
+        self._ue_class = ClassProp("Vector2D")
+        self._ue_obj = unreal_core.new_object(self, self._ue_class, "vector", 0,
+                                              [Argument("X", self._ue_class, X), Argument("Y", self._ue_class, Y)])
+
+    @property
+    def X(self):
+        return unreal_core.get_property(self, self._ue_class, "X")
+
+    @property
+    def Y(self):
+        return unreal_core.get_property(self, self._ue_class, "Y")
+
+
+def bench_value_structs(number=50000):
+    """
+    construct a Vector2D, pass it to a function and read X and Y back, with a remote object
+    against the value struct carried inline in the message
+    """
+    ue_class, obj, unreal_object = bench_target()
+
+    def remote():
+        vector = RemoteVector2D(1.0, 2.0)
+        unreal_core.call(obj, unreal_object, ue_class, "TestVector", vector)
+        return vector.X, vector.Y
+
+    def inline():
+        vector = unreal_core.Vector2D(1.0, 2.0)
+        unreal_core.call(obj, unreal_object, ue_class, "TestVector", vector)
+        return vector.X, vector.Y
+
+    transform = unreal_core.Transform(unreal_core.Quat(), unreal_core.Vector(1.0, 2.0, 3.0), unreal_core.Vector(1.0, 1.0, 1.0))
+
+    print("== Value structs (loopback)")
+    for label, func in [("remote Vector2D", remote), ("inline Vector2D", inline),
+                        ("Transform round trip", lambda: unreal_core.call(obj, unreal_object, ue_class, "Echo", transform))]:
+        elapsed = timeit.timeit(func, number=number)
+        report(label, number, elapsed)
+
+
+class PyVector:
+    """
+    pure python equivalent of unreal_core.Vector
+    """
+    __slots__ = ("X", "Y", "Z")
+
+    def __init__(self, X=0.0, Y=0.0, Z=0.0):
+        self.X = X
+        self.Y = Y
+        self.Z = Z
+
+    def __add__(self, other):
+        return PyVector(self.X + other.X, self.Y + other.Y, self.Z + other.Z)
+
+    def __mul__(self, scale):
+        return PyVector(self.X * scale, self.Y * scale, self.Z * scale)
+
+    def dot(self, other):
+        return self.X * other.X + self.Y * other.Y + self.Z * other.Z
+
+    def cross(self, other):
+        return PyVector(self.Y * other.Z - self.Z * other.Y,
+                        self.Z * other.X - self.X * other.Z,
+                        self.X * other.Y - self.Y * other.X)
+
+    def normalized(self):
+        square_sum = self.dot(self)
+        if square_sum < 1e-8:
+            return PyVector()
+        return self * (1.0 / square_sum ** 0.5)
+
+    def lerp(self, other, alpha):
+        return PyVector(self.X + (other.X - self.X) * alpha,
+                        self.Y + (other.Y - self.Y) * alpha,
+                        self.Z + (other.Z - self.Z) * alpha)
+
+
+def bench_vector_math(number=500000):
+    """
+    native value struct math against the same operations on a pure python vector
+    """
+    print("== Vector math")
+    for label, vector_type in [("python", PyVector), ("native", unreal_core.Vector)]:
+        a = vector_type(1.0, 2.0, 3.0)
+        b = vector_type(4.0, 5.0, 6.0)
+        cases = [
+            ("add", lambda: a + b),
+            ("scale", lambda: a * 2.0),
+            ("dot", lambda: a.dot(b)),
+            ("cross", lambda: a.cross(b)),
+            ("normalized", lambda: a.normalized()),
+            ("lerp", lambda: a.lerp(b, 0.25)),
+        ]
+        for op, func in cases:
+            elapsed = timeit.timeit(func, number=number)
+            report(f"{label} {op}", number, elapsed)
+
+    rotation = unreal_core.Quat(0.0, 0.0, 0.7071067811865476, 0.7071067811865476)
+    transform = unreal_core.Transform(rotation, unreal_core.Vector(1.0, 2.0, 3.0), unreal_core.Vector(2.0, 2.0, 2.0))
+    point = unreal_core.Vector(1.0, 0.0, 0.0)
+    for label, func in [("native quat rotate", lambda: rotation * point),
+                        ("native transform_position", lambda: transform.transform_position(point)),
+                        ("native transform compose", lambda: transform * transform)]:
+        elapsed = timeit.timeit(func, number=number)
+        report(label, number, elapsed)
+
+
+def bench_batch_kernels(number=20):
+    """
+    points per second of transform_points against a python loop over Transform.transform_position,
+    on the calling thread and split across worker threads
+    """
+    rotation = unreal_core.Quat(0.0, 0.0, 0.7071067811865476, 0.7071067811865476)
+    transform = unreal_core.Transform(rotation, unreal_core.Vector(1.0, 2.0, 3.0), unreal_core.Vector(2.0, 2.0, 2.0))
+
+    print("== Batch kernels")
+    points = [unreal_core.Vector(float(i), 0.0, 1.0) for i in range(10000)]
+    elapsed = timeit.timeit(lambda: [transform.transform_position(point) for point in points], number=number)
+    print(f"{'python loop (10000 points)':<40} {len(points) * number / elapsed:>14,.0f} points/s")
+
+    for count in (10000, 100000, 1000000):
+        buffer = array.array("d", bytes(count * 3 * 8))
+        out = array.array("d", bytes(count * 3 * 8))
+        for threads in sorted({1, os.cpu_count() or 1}):
+            unreal_core.set_batch_threads(threads)
+            elapsed = timeit.timeit(lambda: unreal_core.transform_points(transform, buffer, out), number=number)
+            print(f"{f'transform_points ({count} points, {threads} threads)':<40} {count * number / elapsed:>14,.0f} points/s")
+    unreal_core.set_batch_threads(1)
+
+    quats = array.array("d", [0.0, 0.0, 0.0, 1.0] * 100000)
+    targets = array.array("d", [rotation.X, rotation.Y, rotation.Z, rotation.W] * 100000)
+    elapsed = timeit.timeit(lambda: unreal_core.quat_slerp_many(quats, targets, 0.5), number=number)
+    print(f"{'quat_slerp_many (100000 quats)':<40} {100000 * number / elapsed:>14,.0f} quats/s")
+
+
+def bench_local_evaluation(number=100000):
+    """
+    call_static_function of whitelisted KismetMathLibrary functions evaluated locally
+    against the same calls forced through the stand-in server
+    """
+    math_library = ClassProp("KismetMathLibrary")
+    float_args = [Argument("A", math_library, 1.5), Argument("B", math_library, 2.5)]
+    vector_args = [Argument("A", math_library, unreal_core.Vector(1.0, 2.0, 3.0)),
+                   Argument("B", math_library, unreal_core.Vector(4.0, 5.0, 6.0))]
+
+    print("== Local evaluation")
+    for mode in ("local", "remote"):
+        unreal_core.set_local_evaluation(mode)
+        for label, function_name, args in [("Add_DoubleDouble", "Add_DoubleDouble", float_args),
+                                           ("Cross_VectorVector", "Cross_VectorVector", vector_args)]:
+            elapsed = timeit.timeit(lambda: unreal_core.call_static_function(math_library, function_name, args), number=number)
+            report(f"{label} ({mode})", number, elapsed)
+    unreal_core.set_local_evaluation("local")
+
+
+def bench_lazy_results(number=100000):
+    """
+    call() returning an eagerly decoded tuple against a ResultView when only the return value is used
+    """
+    ue_class, obj, unreal_object = bench_target()
+    payload = "x" * 256
+
+    print("== Lazy results (loopback)")
+    for enabled in (False, True):
+        unreal_core.set_lazy_results(enabled)
+        label = "ResultView" if enabled else "tuple"
+        elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", payload, 1, 2.0), number=number)
+        report(f"call, result unused ({label})", number, elapsed)
+        elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", payload, 1, 2.0)[0], number=number)
+        report(f"call, return value ({label})", number, elapsed)
+    unreal_core.set_lazy_results(False)
+
+
+def bench_param_encoding(number=100000):
+    """
+    message bytes and time per call of the Argument list encoding (v1) against packed params (v2)
+    for typical signatures
+    """
+    ue_class, obj, unreal_object = bench_target()
+    signatures = [
+        ("(int, float)", [1, 2.0]),
+        ("(str, int, float, bool)", ["name", 1, 2.0, True]),
+        ("10 scalars", [1, 2.0, "a", True, 5, 6.0, "b", False, 9, 10.0]),
+        ("10 named Arguments", [Argument(f"p{i}", ue_class, float(i)) for i in range(10)]),
+    ]
+
+    print("== Param encoding (loopback)")
+    for label, values in signatures:
+        for encoding, method in (("v1", "callFunction"), ("v2", "callFunctionPacked")):
+            unreal_core.set_param_encoding(encoding)
+            unreal_core.reset_request_stats()
+            elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", *values), number=number)
+            stats = unreal_core.request_stats()[method]
+            report(f"{label} {encoding}", number, elapsed)
+            print(f"{'':<40} {stats['message_words'] * 8 / stats['requests']:>14.0f} bytes/call")
+    unreal_core.set_param_encoding("auto")
+
+
+def bench_marshal_templates(number=200000):
+    """
+    encoding the signatures prepare() sends through encode<Ts...> against the generic type dispatch.
+    bool, int, float and enum only signatures are patched in place, see bench_request_template
+    """
+    vector = unreal_core.Vector(1.0, 2.0, 3.0)
+    rotator = unreal_core.Rotator(10.0, 20.0, 30.0)
+    signatures = [
+        (["str"], ["/Game/Maps/Arena"]),
+        (["str", "int", "float", "bool"], ["Hero", 7, 1.5, True]),
+        (["Vector"], [vector]),
+        (["Vector", "Rotator", "Vector"], [vector, rotator, vector]),
+    ]
+
+    print("== Marshal templates")
+    for kinds, values in signatures:
+        label = ",".join(kinds)
+        generic_ns, specialized_ns = unreal_core.time_encode(kinds, values, number)
+        print(f"{f'{label} generic':<40} {generic_ns:>8.1f} ns/encode")
+        print(f"{f'{label} specialized':<40} {specialized_ns:>8.1f} ns/encode  {generic_ns / specialized_ns:>5.2f}x")
+
+
+def check_string_round_trips(obj, unreal_object, ue_class):
+    """
+    every str layout through both transcoders, at lengths around the 8 and 16 unit SIMD lanes so the
+    scalar tails run too. lone surrogates have no UTF-8 form and only travel as UTF-16
+    """
+    layouts = {
+        "latin1": "Hero_\u00e9\u00ff",
+        "UCS2": "\u82f1\u96c4_\u20ac\u00e9",
+        "UCS4": "a\U0001F600\u4e2d\U00010348",
+        "lone surrogates": "x\ud800y\udfff",
+        "UCS4 with a lone surrogate": "\U0001F600\udc00b",
+    }
+    lengths = (0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 100)
+    for encoding in ("utf8", "utf16"):
+        unreal_core.set_string_encoding(encoding)
+        for layout, pattern in layouts.items():
+            for length in lengths:
+                value = (pattern * length)[:length]
+                if encoding == "utf8" and any(0xD800 <= ord(char) <= 0xDFFF for char in value):
+                    try:
+                        unreal_core.call(obj, unreal_object, ue_class, "Func", value)
+                    except UnicodeEncodeError:
+                        continue
+                    raise AssertionError(f"{layout} of length {length} was sent as UTF-8")
+                result = unreal_core.call(obj, unreal_object, ue_class, "Func", value)[0]
+                assert result == value, f"{layout} of length {length} changed through {encoding}: {result!r}"
+    unreal_core.set_string_encoding("auto")
+
+
+def bench_string_encoding(number=50000):
+    """
+    string params and results echoed by the stand-in server as UTF-8 Text against UTF-16 Data,
+    for asset paths, names with non latin characters and JSON blobs
+    """
+    ue_class, obj, unreal_object = bench_target()
+    json_blob = "{" + ", ".join(f'"key_{i}": "value {i}"' for i in range(200)) + "}"
+    workloads = [
+        ("asset path", "/Game/Characters/Hero/Meshes/SK_Hero_Body.SK_Hero_Body"),
+        ("name (CJK)", "\u82f1\u96c4\u89d2\u8272_\u8eab\u4f53\u7f51\u683c"),
+        ("name (emoji)", "Hero \U0001F600 Body"),
+        (f"JSON blob ({len(json_blob)} chars)", json_blob),
+    ]
+
+    print("== String encoding (loopback)")
+    unreal_core.set_param_encoding("v1")
+    check_string_round_trips(obj, unreal_object, ue_class)
+    for label, value in workloads:
+        for encoding in ("utf8", "utf16"):
+            unreal_core.set_string_encoding(encoding)
+            assert unreal_core.call(obj, unreal_object, ue_class, "Func", value)[0] == value
+            elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", value), number=number)
+            report(f"{label} {encoding}", number, elapsed)
+    unreal_core.set_string_encoding("auto")
+    unreal_core.set_param_encoding("auto")
+
+
+def bench_user_converters(number=100000):
+    """
+    user types echoed by the stand-in server: dataclass, slots dataclass and NamedTuple sent as structs
+    through register_converter, against a python encoder to str and passing the fields by hand
+    """
+    ue_class, obj, unreal_object = bench_target()
+    unreal_core.register_converter(BenchHit, None, None, "fields")
+    unreal_core.register_converter(BenchSlotsHit, None, None, "fields")
+    unreal_core.register_converter(BenchTupleHit, None, None, "fields")
+    unreal_core.register_converter(BenchTag, lambda tag: tag.name, None, "str")
+
+    print("== User type converters (loopback)")
+    unreal_core.set_param_encoding("v1")
+    for label, value in [("dataclass", BenchHit("Hero", 12.5, 3)),
+                         ("slots dataclass", BenchSlotsHit("Hero", 12.5, 3)),
+                         ("NamedTuple", BenchTupleHit("Hero", 12.5, 3))]:
+        assert unreal_core.call(obj, unreal_object, ue_class, "Func", value)[0] == value
+        elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", value), number=number)
+        report(f"{label} fields", number, elapsed)
+
+    hit = BenchHit("Hero", 12.5, 3)
+    elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", hit.actor, hit.distance, hit.bone), number=number)
+    report("dataclass fields by hand", number, elapsed)
+    tag = BenchTag("Hero")
+    elapsed = timeit.timeit(lambda: unreal_core.call(obj, unreal_object, ue_class, "Func", tag), number=number)
+    report("python encoder to str", number, elapsed)
+    unreal_core.set_param_encoding("auto")
+
+
+class WrappedActor:
+    """
+    property access the way UE.py wraps it, an Argument and a module call per access
+    """
+    _ue_class = ClassProp("MyActor")
+
+    @property
+    def Health(self):
+        return unreal_core.get_property(self, self._ue_class, "Health")
+
+    @Health.setter
+    def Health(self, value):
+        unreal_core.set_property(self, self._ue_class, Argument("Health", self._ue_class, value, "float"))
+
+
+class DescribedActor:
+    Health = unreal_core.UProperty(ClassProp("MyActor"), "float")
+
+
+def bench_property_access(number=200000):
+    """
+    attribute access throughput of a ue property through a python @property wrapper against the
+    UProperty descriptor, both answered by the stand-in server
+    """
+    print("== Property access (loopback)")
+    for label, actor in [("@property", WrappedActor()), ("UProperty", DescribedActor())]:
+        actor.Health = 100.0
+        assert actor.Health == 100.0
+        elapsed = timeit.timeit(lambda: actor.Health, number=number)
+        report(f"{label} get", number, elapsed)
+        elapsed = timeit.timeit("actor.Health = 50.0", globals={"actor": actor}, number=number)
+        report(f"{label} set", number, elapsed)
+
+
+class ArgumentCallActor:
+    """
+    member function the way UE.py wrapped it, Argument objects and a list per call
+    """
+    _ue_class = ClassProp("MyObject")
+    _ue_obj = UnrealObject(0x1000, "bench")
+
+    def add(self, a, b):
+        arg1 = Argument("a", self._ue_class, a, "int")
+        arg2 = Argument("b", self._ue_class, b, "int")
+        return unreal_core.call_function(self, self._ue_obj, self._ue_class, "Add", [arg1, arg2])
+
+
+class DescribedCallActor:
+    _ue_obj = UnrealObject(0x1000, "bench")
+    add = unreal_core.UFunction(ClassProp("MyObject"), "Add", [("a", "int"), ("b", "int")])
+
+
+def bench_ufunction_call(number=200000):
+    """
+    per call cost of obj.add(3, 4) through the Argument / call_function wrapper against the UFunction
+    descriptor, both answered by the stand-in server
+    """
+    print("== Member function call (loopback)")
+    for label, actor in [("Argument wrapper", ArgumentCallActor()), ("UFunction", DescribedCallActor())]:
+        assert actor.add(3, 4)[0] == 3
+        elapsed = timeit.timeit("actor.add(3, 4)", globals={"actor": actor}, number=number)
+        report(label, number, elapsed)
+
+
+# run in a fresh interpreter, prints import seconds, first class access seconds and resident MB
+MEASURE_IMPORT = """
+import sys, time
+sys.path.insert(0, sys.argv[1])
+start = time.perf_counter()
+import py_unreal
+imported = time.perf_counter()
+py_unreal.SyntheticActor0
+touched = time.perf_counter()
+try:
+    import psutil
+    resident = psutil.Process().memory_info().rss / 2 ** 20
+except ImportError:
+    import resource
+    resident = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / 2 ** 10
+print(imported - start, touched - imported, resident)
+"""
+
+
+def bench_class_namespace(count=10000):
+    """
+    import time and resident memory of generated bindings for count classes, with the lazy module
+    __getattr__ against importing every class module up front
+    """
+    sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "pyunreal"))
+    import generate_bindings
+
+    print(f"== Class namespace ({count} classes, fresh interpreter)")
+    dump = generate_bindings.synthetic_dump(count)
+    for label, lazy in [("lazy", True), ("eager", False)]:
+        with tempfile.TemporaryDirectory() as root:
+            generate_bindings.generate(dump, os.path.join(root, "py_unreal"), lazy)
+            output = subprocess.run([sys.executable, "-c", MEASURE_IMPORT, root], check=True,
+                                    capture_output=True, text=True).stdout
+            imported, touched, resident = (float(value) for value in output.split())
+            print(f"{label:<10} import {imported * 1e3:>9.1f} ms  first class {touched * 1e3:>7.2f} ms  {resident:>8.1f} MB resident")
+
+
+class DictActor:
+    pass
+
+
+class SlotsActor:
+    __slots__ = ("unreal_object",)
+
+    # unreal_core fills the slot directly, a setattr fallback would fail here
+    def __setattr__(self, name, value):
+        raise AttributeError(f"{type(self).__name__}.{name} is read-only")
+
+
+def bench_object_returns(count=10000):
+    """
+    return count actors from the stand-in server, wrappers with an instance dict get the unreal object
+    through setattr, __slots__ wrappers at the slot offset when they are allocated
+    """
+    ue_class, obj, unreal_object = bench_target("Actor")
+    # the stand-in server echoes an object param with the class it was created with
+    target = BenchObject()
+    unreal_core.new_object(target, ue_class, "target", 0, [])
+    previous = sys.modules.get("py_unreal")
+    namespace = sys.modules["py_unreal"] = types.ModuleType("py_unreal")
+
+    print(f"== Object returns ({count} actors, loopback)")
+    for label, wrapper in [("instance dict", DictActor), ("__slots__", SlotsActor)]:
+        namespace.Actor = wrapper
+        unreal_core.clear_class_cache()
+        actor = unreal_core.call(obj, unreal_object, ue_class, "Func", target)[0]
+        assert type(actor) is wrapper and isinstance(actor.unreal_object, UnrealObject)
+
+        start = time.perf_counter()
+        actors = [unreal_core.call(obj, unreal_object, ue_class, "Func", target)[0] for _ in range(count)]
+        report(label, count, time.perf_counter() - start)
+        del actors
+
+        tracemalloc.start()
+        actors = [unreal_core.call(obj, unreal_object, ue_class, "Func", target)[0] for _ in range(count)]
+        size, _ = tracemalloc.get_traced_memory()
+        tracemalloc.stop()
+        print(f"{label:<40} {size / count:>14,.0f} bytes/actor")
+        del actors
+
+    unreal_core.clear_class_cache()
+    if previous is None:
+        del sys.modules["py_unreal"]
+    else:
+        sys.modules["py_unreal"] = previous
+
+
+def bench_class_checks(count=10000):
+    """
+    filter count new actors by type, is_a asks the stand-in server for the hierarchy of Actor on the
+    first check and answers the rest from the ancestor bit set
+    """
+    ue_class = ClassProp("Actor")
+    owners = [BenchObject() for _ in range(count)]
+    actors = [unreal_core.new_object(owner, ue_class, "actor", 0, []) for owner in owners]
+
+    unreal_core.set_loopback_class_hierarchy("Actor", ["Object"], ["Interface_AssetUserData"])
+    unreal_core.clear_class_hierarchies()
+    unreal_core.reset_request_stats()
+    print(f"== Class checks ({count} actors, loopback)")
+    for label, check in [
+        ("is_a(actor, Class)", lambda actor: unreal_core.is_a(actor, ue_class)),
+        ("is_a(actor, str) miss", lambda actor: unreal_core.is_a(actor, "Pawn")),
+        ("cast(actor, interface)", lambda actor: unreal_core.cast(actor, "Interface_AssetUserData")),
+    ]:
+        start = time.perf_counter()
+        matched = sum(1 for actor in actors if check(actor))
+        report(label, count, time.perf_counter() - start)
+        print(f"{'  matched':<40} {matched:>14,}")
+
+    stats = unreal_core.request_stats()
+    for method in ["staticClass", "getClassHierarchy"]:
+        print(f"{method + ' rpcs':<40} {stats[method]['requests']:>14,}")
+
+
+BENCHMARKS = {
+    "argument": bench_argument_construction,
+    "calls": bench_module_calls,
+    "call": bench_positional_call,
+    "prepared": bench_prepared_call,
+    "inline_cache": bench_inline_cache,
+    "sizing": bench_request_sizing,
+    "template": bench_request_template,
+    "strings": bench_large_strings,
+    "buffers": bench_buffers,
+    "structs": bench_value_structs,
+    "math": bench_vector_math,
+    "batch": bench_batch_kernels,
+    "local": bench_local_evaluation,
+    "lazy": bench_lazy_results,
+    "encoding": bench_param_encoding,
+    "marshal": bench_marshal_templates,
+    "strings16": bench_string_encoding,
+    "converters": bench_user_converters,
+    "properties": bench_property_access,
+    "ufunction": bench_ufunction_call,
+    "namespace": bench_class_namespace,
+    "returns": bench_object_returns,
+    "hierarchy": bench_class_checks,
+}
+
+if __name__ == "__main__":
+    names = sys.argv[1:] or list(BENCHMARKS)
+    for name in names:
+        BENCHMARKS[name]()
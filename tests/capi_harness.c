@@ -0,0 +1,276 @@
+/**
+ * checks and benchmark of the unreal_core C API (src/pyunreal/unreal_core/unreal_core_capi.h), run against
+ * the in-process stand-in server, so unreal_core must be built with UNREAL_CORE_TESTING=1. build it with the
+ * python unreal_core was installed for:
+ *
+ *     cc -std=c11 tests/capi_harness.c -Isrc/pyunreal/unreal_core $(python3-config --includes --ldflags --embed) -o capi_harness
+ *     ./capi_harness          checks, exits 1 when one fails
+ *     ./capi_harness bench    C API against the python api on the same calls
+ */
+#include <Python.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "unreal_core_capi.h"
+
+static const UnrealCoreCAPI* api;
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("FAILED %s:%d: %s (%s)\n", __FILE__, __LINE__, #condition, api->last_error()); \
+            failures++; \
+        } \
+    } while (0)
+
+static UEValue int_value(int64_t i)
+{
+    UEValue value;
+    value.kind = UE_VALUE_INT;
+    value.as.i = i;
+    return value;
+}
+
+static UEValue float_value(double f)
+{
+    UEValue value;
+    value.kind = UE_VALUE_FLOAT;
+    value.as.f = f;
+    return value;
+}
+
+static UEValue str_value(const char* str)
+{
+    UEValue value;
+    value.kind = UE_VALUE_STR;
+    value.as.str.data = str;
+    value.as.str.size = strlen(str);
+    return value;
+}
+
+// send a call of function with one param and wait for it, NULL when a step failed
+static UnrealCoreCall* echo(int32_t function, const UEValue* param)
+{
+    UnrealCoreCall* call = api->begin_call(function, 0x1000, 0x2000, "harness", 1);
+    if (call == NULL) {
+        return NULL;
+    }
+    if (api->encode_param(call, 0, "Value", param) < 0 || api->send_call(call) < 0 || api->wait_call(call) < 0) {
+        api->end_call(call);
+        return NULL;
+    }
+    return call;
+}
+
+static void check_ids(void)
+{
+    int32_t my_object = api->resolve_class("MyObject");
+    CHECK(my_object >= 0);
+    CHECK(api->resolve_class("MyObject") == my_object);
+    CHECK(api->resolve_class("Object") != my_object);
+
+    int32_t add = api->resolve_function(my_object, "Add", 0);
+    CHECK(add >= 0);
+    CHECK(api->resolve_function(my_object, "Add", 0) == add);
+    CHECK(api->resolve_function(my_object, "Add", UE_FUNCTION_STATIC) != add);
+    CHECK(api->resolve_function(-1, "Add", 0) < 0);
+    CHECK(api->begin_call(-1, 0, 0, NULL, 0) == NULL);
+}
+
+static void check_calls(void)
+{
+    int32_t my_object = api->resolve_class("MyObject");
+    int32_t add = api->resolve_function(my_object, "Add", 0);
+    UEValue result;
+    char buffer[64];
+
+    // the stand-in server echoes the first param
+    UEValue first = int_value(40);
+    UEValue second = int_value(2);
+    UnrealCoreCall* call = api->begin_call(add, 0x1000, 0x2000, "harness", 2);
+    CHECK(call != NULL);
+    CHECK(api->encode_param(call, 0, "a", &first) == 0);
+    CHECK(api->encode_param(call, 1, "b", &second) == 0);
+    CHECK(api->encode_param(call, 2, "c", &second) < 0);
+    CHECK(api->read_result(call, -1, &result, NULL, 0) < 0);
+    CHECK(api->send_call(call) == 0);
+    CHECK(api->encode_param(call, 0, "a", &first) < 0);
+    CHECK(api->wait_call(call) == 0);
+    CHECK(api->read_result(call, -1, &result, NULL, 0) == 0);
+    CHECK(result.kind == UE_VALUE_INT && result.as.i == 40);
+    CHECK(api->out_param_count(call) == 0);
+    CHECK(api->read_result(call, 0, &result, NULL, 0) < 0);
+    api->end_call(call);
+
+    UEValue text = str_value("unreal \xc3\xa9 \xe2\x82\xac");
+    call = echo(add, &text);
+    CHECK(call != NULL);
+    if (call != NULL) {
+        CHECK(api->read_result(call, -1, &result, buffer, 4) < 0);
+        CHECK(result.kind == UE_VALUE_STR && result.as.str.size == text.as.str.size);
+        CHECK(api->read_result(call, -1, &result, buffer, sizeof(buffer)) == 0);
+        CHECK(result.kind == UE_VALUE_STR && strcmp(result.as.str.data, text.as.str.data) == 0);
+        api->end_call(call);
+    }
+
+    UEValue vector;
+    vector.kind = UE_VALUE_VECTOR;
+    vector.as.xyzw[0] = 1.0;
+    vector.as.xyzw[1] = -2.5;
+    vector.as.xyzw[2] = 3.25;
+    call = echo(add, &vector);
+    CHECK(call != NULL);
+    if (call != NULL) {
+        CHECK(api->read_result(call, -1, &result, NULL, 0) == 0);
+        CHECK(result.kind == UE_VALUE_VECTOR && result.as.xyzw[0] == 1.0 && result.as.xyzw[1] == -2.5 && result.as.xyzw[2] == 3.25);
+        api->end_call(call);
+    }
+
+    // several calls in flight before the first wait
+    UnrealCoreCall* calls[8];
+    for (int i = 0; i < 8; i++) {
+        UEValue param = int_value(i * 10);
+        calls[i] = api->begin_call(add, 0x1000, 0x2000, NULL, 1);
+        CHECK(calls[i] != NULL && api->encode_param(calls[i], 0, NULL, &param) == 0 && api->send_call(calls[i]) == 0);
+    }
+    for (int i = 7; i >= 0; i--) {
+        CHECK(api->wait_call(calls[i]) == 0);
+        CHECK(api->read_result(calls[i], -1, &result, NULL, 0) == 0 && result.kind == UE_VALUE_INT && result.as.i == i * 10);
+        api->end_call(calls[i]);
+    }
+
+    // without a handler the stand-in server answers static functions with void
+    int32_t make_default = api->resolve_function(my_object, "MakeDefault", UE_FUNCTION_STATIC);
+    call = api->begin_call(make_default, 0, 0, NULL, 0);
+    CHECK(call != NULL && api->send_call(call) == 0 && api->wait_call(call) == 0);
+    CHECK(api->read_result(call, -1, &result, NULL, 0) == 0 && result.kind == UE_VALUE_NONE);
+    api->end_call(call);
+}
+
+static void check_properties(void)
+{
+    int32_t my_object = api->resolve_class("MyObject");
+    const char* names[3] = {"Health", "DisplayName", "Missing"};
+    UEValue values[3] = {float_value(75.5), str_value("hero")};
+    char buffer[16];
+
+    CHECK(api->set_properties(0x3000, my_object, names, values, 2) == 0);
+    memset(values, 0, sizeof(values));
+    CHECK(api->get_properties(0x3000, my_object, names, 3, values, buffer, 4) < 0);
+    CHECK(api->get_properties(0x3000, my_object, names, 3, values, buffer, sizeof(buffer)) == 0);
+    CHECK(values[0].kind == UE_VALUE_FLOAT && values[0].as.f == 75.5);
+    CHECK(values[1].kind == UE_VALUE_STR && strcmp(values[1].as.str.data, "hero") == 0);
+    CHECK(values[2].kind == UE_VALUE_NONE);
+    CHECK(api->get_properties(0x3000, -1, names, 1, values, buffer, sizeof(buffer)) < 0);
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char* label, int number, double elapsed)
+{
+    printf("%-40s %14.0f ops/s  %8.1f ns/op\n", label, number / elapsed, elapsed / number * 1e9);
+}
+
+static void bench(int count)
+{
+    int32_t actor = api->resolve_class("Actor");
+    int32_t add = api->resolve_function(actor, "Add", 0);
+    UEValue a = int_value(1);
+    UEValue b = int_value(2);
+    UEValue result;
+
+    printf("== C API (%d calls, loopback)\n", count);
+    double start = now();
+    for (int i = 0; i < count; i++) {
+        UnrealCoreCall* call = api->begin_call(add, 0x1000, 0x2000, NULL, 2);
+        api->encode_param(call, 0, NULL, &a);
+        api->encode_param(call, 1, NULL, &b);
+        api->send_call(call);
+        api->wait_call(call);
+        api->read_result(call, -1, &result, NULL, 0);
+        api->end_call(call);
+    }
+    report("call", count, now() - start);
+
+    UnrealCoreCall* calls[64];
+    start = now();
+    for (int i = 0; i < count; i += 64) {
+        for (int j = 0; j < 64; j++) {
+            calls[j] = api->begin_call(add, 0x1000, 0x2000, NULL, 2);
+            api->encode_param(calls[j], 0, NULL, &a);
+            api->encode_param(calls[j], 1, NULL, &b);
+            api->send_call(calls[j]);
+        }
+        for (int j = 0; j < 64; j++) {
+            api->wait_call(calls[j]);
+            api->read_result(calls[j], -1, &result, NULL, 0);
+            api->end_call(calls[j]);
+        }
+    }
+    report("call, 64 in flight", count / 64 * 64, now() - start);
+
+    const char* names[2] = {"X", "Y"};
+    UEValue values[2] = {float_value(1.0), float_value(2.0)};
+    api->set_properties(0x1000, actor, names, values, 2);
+    start = now();
+    for (int i = 0; i < count; i += 2) {
+        api->get_properties(0x1000, actor, names, 2, values, NULL, 0);
+    }
+    report("get_properties, 2 per batch", count / 2 * 2, now() - start);
+
+    char script[1024];
+    snprintf(script, sizeof(script),
+        "import time, unreal_core\n"
+        "from unreal_core import ClassProp, UnrealObject\n"
+        "ue_class, unreal_object, count = ClassProp('Actor'), UnrealObject(0x2000), %d\n"
+        "class Owner: pass\n"
+        "obj = Owner()\n"
+        "unreal_core.set_property(obj, ue_class, unreal_core.Argument('X', ue_class, 1.0))\n"
+        "def report(label, number, elapsed):\n"
+        "    print(f'{label:<40} {number / elapsed:>14,.0f} ops/s  {elapsed / number * 1e9:>8.1f} ns/op')\n"
+        "print(f'== python api ({count} calls, loopback)')\n"
+        "start = time.perf_counter()\n"
+        "for _ in range(count): unreal_core.call(obj, unreal_object, ue_class, 'Add', 1, 2)\n"
+        "report('call', count, time.perf_counter() - start)\n"
+        "start = time.perf_counter()\n"
+        "for _ in range(count): unreal_core.get_property(obj, ue_class, 'X')\n"
+        "report('get_property', count, time.perf_counter() - start)\n",
+        count);
+    PyRun_SimpleString(script);
+}
+
+int main(int argc, char** argv)
+{
+    // answer the calls from the stand-in server instead of unreal engine
+#ifdef _WIN32
+    _putenv("UNREAL_CORE_LOOPBACK=1");
+#else
+    setenv("UNREAL_CORE_LOOPBACK", "1", 1);
+#endif
+    Py_Initialize();
+    api = unreal_core_import_capi();
+    if (api == NULL) {
+        PyErr_Print();
+        return 1;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        bench(argc > 2 ? atoi(argv[2]) : 100000);
+    }
+    else {
+        check_ids();
+        check_calls();
+        check_properties();
+        printf(failures == 0 ? "C API checks passed\n" : "C API checks failed\n");
+    }
+
+    Py_Finalize();
+    return failures == 0 ? 0 : 1;
+}
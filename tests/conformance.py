@@ -0,0 +1,215 @@
+import math
+import os
+import sys
+import warnings
+
+# answer rpc calls from the in-process stand-in server, which hands static functions to the reference below.
+# needs unreal_core built with UNREAL_CORE_TESTING=1
+os.environ.setdefault("UNREAL_CORE_LOOPBACK", "1")
+
+import unreal_core
+from unreal_core import ClassProp, Argument, Vector, Rotator, Quat, Transform
+
+
+def wrap_int32(value):
+    return (value + 0x80000000) % 0x100000000 - 0x80000000
+
+
+# the reference computes on plain float tuples with math, Vector, Quat and Transform are only built for
+# the values it returns so the operators under test never check themselves
+def components(v):
+    return (v.X, v.Y, v.Z)
+
+
+def to_vector(v):
+    return Vector(*v)
+
+
+def add(a, b):
+    return (a[0] + b[0], a[1] + b[1], a[2] + b[2])
+
+
+def sub(a, b):
+    return (a[0] - b[0], a[1] - b[1], a[2] - b[2])
+
+
+def mul(a, b):
+    return (a[0] * b[0], a[1] * b[1], a[2] * b[2])
+
+
+def scale(a, s):
+    return (a[0] * s, a[1] * s, a[2] * s)
+
+
+def dot(a, b):
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+
+
+def cross(a, b):
+    return (a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0])
+
+
+def rotator_quat(pitch, yaw, roll):
+    # FRotator::Quaternion, as (X, Y, Z, W)
+    half = math.pi / 360.0
+    sp, cp = math.sin(math.fmod(pitch, 360.0) * half), math.cos(math.fmod(pitch, 360.0) * half)
+    sy, cy = math.sin(math.fmod(yaw, 360.0) * half), math.cos(math.fmod(yaw, 360.0) * half)
+    sr, cr = math.sin(math.fmod(roll, 360.0) * half), math.cos(math.fmod(roll, 360.0) * half)
+    return (cr * sp * sy - sr * cp * cy, -cr * sp * cy - sr * cp * sy,
+            cr * cp * sy - sr * sp * cy, cr * cp * cy + sr * sp * sy)
+
+
+def quat_multiply(a, b):
+    # FQuat::operator*, b applied first
+    ax, ay, az, aw = a
+    bx, by, bz, bw = b
+    return (aw * bx + ax * bw + ay * bz - az * by,
+            aw * by - ax * bz + ay * bw + az * bx,
+            aw * bz + ax * by - ay * bx + az * bw,
+            aw * bw - ax * bx - ay * by - az * bz)
+
+
+def rotate(q, v):
+    # FQuat::RotateVector
+    qx, qy, qz, qw = q
+    x, y, z = v
+    tx, ty, tz = 2.0 * (qy * z - qz * y), 2.0 * (qz * x - qx * z), 2.0 * (qx * y - qy * x)
+    return (x + qw * tx + (qy * tz - qz * ty),
+            y + qw * ty + (qz * tx - qx * tz),
+            z + qw * tz + (qx * ty - qy * tx))
+
+
+def transform_parts(t):
+    r = t.Rotation
+    return (r.X, r.Y, r.Z, r.W), components(t.Translation), components(t.Scale3D)
+
+
+def transform_position(rotation, translation, scale3d, v):
+    # FTransform::TransformPosition: scale, then rotate, then translate
+    return add(rotate(rotation, mul(scale3d, v)), translation)
+
+
+def safe_normal(v, tolerance=1.e-4):
+    v = components(v)
+    square_sum = dot(v, v)
+    if square_sum == 1.0:
+        return to_vector(v)
+    if square_sum < tolerance:
+        return Vector(0.0, 0.0, 0.0)
+    return to_vector(scale(v, 1.0 / math.sqrt(square_sum)))
+
+
+def transform_location(t, v):
+    return to_vector(transform_position(*transform_parts(t), components(v)))
+
+
+def compose(a, b):
+    # FTransform::Multiply, a applied first. the rotation product is not normalized
+    a_rotation, a_translation, a_scale = transform_parts(a)
+    b_rotation, b_translation, b_scale = transform_parts(b)
+    return Transform(Quat(*quat_multiply(b_rotation, a_rotation)),
+                     to_vector(transform_position(b_rotation, b_translation, b_scale, a_translation)),
+                     to_vector(mul(a_scale, b_scale)))
+
+
+def vector_size(v):
+    return math.sqrt(dot(v, v))
+
+
+# reference implementations of the functions call_static_function evaluates locally, written from the UE sources
+REFERENCE = {
+    "Add_DoubleDouble": lambda a, b: a + b,
+    "Subtract_DoubleDouble": lambda a, b: a - b,
+    "Multiply_DoubleDouble": lambda a, b: a * b,
+    "Divide_DoubleDouble": lambda a, b: 0.0 if b == 0.0 else a / b,
+    "Lerp": lambda a, b, alpha: a + alpha * (b - a),
+    "FClamp": lambda value, low, high: low if value < low else (value if value < high else high),
+    "FMin": lambda a, b: min(a, b),
+    "FMax": lambda a, b: max(a, b),
+    "Abs": lambda a: abs(a),
+    "Sqrt": lambda a: math.sqrt(a) if a >= 0.0 else 0.0,
+    "Sin": math.sin,
+    "Cos": math.cos,
+    "Add_IntInt": lambda a, b: wrap_int32(a + b),
+    "Subtract_IntInt": lambda a, b: wrap_int32(a - b),
+    "Multiply_IntInt": lambda a, b: wrap_int32(a * b),
+    "Max": lambda a, b: max(a, b),
+    "Min": lambda a, b: min(a, b),
+    "MakeVector": lambda x, y, z: Vector(x, y, z),
+    "Add_VectorVector": lambda a, b: to_vector(add(components(a), components(b))),
+    "Subtract_VectorVector": lambda a, b: to_vector(sub(components(a), components(b))),
+    "Multiply_VectorVector": lambda a, b: to_vector(mul(components(a), components(b))),
+    "Multiply_VectorFloat": lambda a, b: to_vector(scale(components(a), b)),
+    "Divide_VectorFloat": lambda a, b: Vector(0.0, 0.0, 0.0) if b == 0.0 else to_vector(tuple(x / b for x in components(a))),
+    "NegateVector": lambda a: to_vector(scale(components(a), -1.0)),
+    "Dot_VectorVector": lambda a, b: dot(components(a), components(b)),
+    "Cross_VectorVector": lambda a, b: to_vector(cross(components(a), components(b))),
+    "VSize": lambda a: vector_size(components(a)),
+    "VSizeSquared": lambda a: dot(components(a), components(a)),
+    "Vector_Distance": lambda a, b: vector_size(sub(components(b), components(a))),
+    "VLerp": lambda a, b, alpha: to_vector(add(components(a), scale(sub(components(b), components(a)), alpha))),
+    "Normal": safe_normal,
+    "EqualEqual_VectorVector": lambda a, b, tolerance=1.e-4:
+        abs(a.X - b.X) <= tolerance and abs(a.Y - b.Y) <= tolerance and abs(a.Z - b.Z) <= tolerance,
+    "MakeRotator": lambda roll, pitch, yaw: Rotator(pitch, yaw, roll),
+    "GreaterGreater_VectorRotator": lambda a, b: to_vector(rotate(rotator_quat(b.Pitch, b.Yaw, b.Roll), components(a))),
+    "MakeTransform": lambda location, rotation, scale3d:
+        Transform(Quat(*rotator_quat(rotation.Pitch, rotation.Yaw, rotation.Roll)), location, scale3d),
+    "TransformLocation": transform_location,
+    "ComposeTransforms": compose,
+}
+
+
+def reference_handler(class_name, function_name, params):
+    return REFERENCE[function_name](*params)
+
+
+def samples():
+    a = Vector(1.0, -2.5, 3.25)
+    b = Vector(-4.0, 0.5, 6.0)
+    rotator = Rotator(30.0, 400.0, -75.0)
+    t1 = Transform(Quat(*rotator_quat(10.0, 20.0, 30.0)), Vector(1.0, 2.0, 3.0), Vector(1.0, 2.0, 0.5))
+    t2 = Transform(Quat(*rotator_quat(-45.0, 90.0, 0.0)), Vector(-3.0, 0.0, 7.0), Vector(2.0, 2.0, 2.0))
+    return [
+        ("Add_DoubleDouble", [1.5, 2.25]), ("Subtract_DoubleDouble", [1.5, 2.25]),
+        ("Multiply_DoubleDouble", [1.5, -2.25]), ("Divide_DoubleDouble", [1.0, 3.0]),
+        ("Divide_DoubleDouble", [1.0, 0.0]), ("Lerp", [1.0, 5.0, 0.25]), ("FClamp", [7.0, 0.0, 5.0]),
+        ("FMin", [1.0, 2.0]), ("FMax", [1, 2.0]), ("Abs", [-3.5]), ("Sqrt", [2.0]), ("Sqrt", [-1.0]),
+        ("Sin", [0.5]), ("Cos", [0.5]),
+        ("Add_IntInt", [0x7fffffff, 1]), ("Subtract_IntInt", [-0x80000000, 1]),
+        ("Multiply_IntInt", [65536, 65536]), ("Max", [3, -7]), ("Min", [3, -7]),
+        ("MakeVector", [1.0, 2.0, 3]), ("Add_VectorVector", [a, b]), ("Subtract_VectorVector", [a, b]),
+        ("Multiply_VectorVector", [a, b]), ("Multiply_VectorFloat", [a, 2.5]),
+        ("Divide_VectorFloat", [a, 4.0]), ("Divide_VectorFloat", [a, 0.0]), ("NegateVector", [a]),
+        ("Dot_VectorVector", [a, b]), ("Cross_VectorVector", [a, b]), ("VSize", [a]), ("VSizeSquared", [a]),
+        ("Vector_Distance", [a, b]), ("VLerp", [a, b, 0.75]), ("Normal", [a]), ("Normal", [Vector(0.001, 0.0, 0.0)]),
+        ("Normal", [Vector(0.001, 0.0, 0.0), 1.e-8]), ("EqualEqual_VectorVector", [a, Vector(a.X + 5.e-5, a.Y, a.Z)]),
+        ("EqualEqual_VectorVector", [a, b, 10.0]), ("MakeRotator", [10.0, 20.0, 30.0]),
+        ("GreaterGreater_VectorRotator", [a, rotator]), ("MakeTransform", [a, rotator, b]),
+        ("TransformLocation", [t1, a]), ("ComposeTransforms", [t1, t2]),
+    ]
+
+
+if __name__ == "__main__":
+    math_library = ClassProp("KismetMathLibrary")
+    unreal_core.set_loopback_static_function_handler(reference_handler)
+    unreal_core.set_local_evaluation("conformance")
+
+    with warnings.catch_warnings():
+        warnings.simplefilter("always")
+        for function_name, values in samples():
+            args = [Argument(f"P{i}", math_library, value) for i, value in enumerate(values)]
+            unreal_core.call_static_function(math_library, function_name, args)
+
+    unreal_core.set_local_evaluation("local")
+    unreal_core.set_loopback_static_function_handler(None)
+
+    failed = False
+    for key, (local, compared, mismatches) in sorted(unreal_core.local_evaluation_stats().items()):
+        if compared == 0:
+            print(f"{key:<50} not covered")
+        elif mismatches != 0:
+            print(f"{key:<50} {mismatches}/{compared} mismatches")
+            failed = True
+    print("conformance failed" if failed else "conformance passed")
+    sys.exit(1 if failed else 0)
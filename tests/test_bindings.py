@@ -0,0 +1,140 @@
+import copy
+import importlib
+import os
+import sys
+import tempfile
+
+# answer rpc calls from the in-process stand-in server, which the generated classes call into.
+# needs unreal_core built with UNREAL_CORE_TESTING=1
+os.environ.setdefault("UNREAL_CORE_LOOPBACK", "1")
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "pyunreal"))
+
+import unreal_core
+from unreal_core import UnrealObject
+import generate_bindings
+
+PACKAGE_NAME = "generated_bindings"
+
+DUMP = {
+    "classes": [
+        {"name": "Object", "parent": None, "interfaces": [], "properties": [], "functions": []},
+        {"name": "MyObject", "parent": "Object", "interfaces": [],
+         "properties": [{"name": "Health", "type": "float"}, {"name": "DisplayName", "type": "str"}],
+         "functions": [
+             {"name": "Add", "params": [{"name": "a", "type": "int"}, {"name": "b", "type": "int"}], "return": "int"},
+             {"name": "GetPawn", "params": [], "return": "Pawn"},
+             {"name": "MakeDefault", "params": [], "return": "MyObject", "static": True},
+             {"name": "Scale", "params": [{"name": "Factor", "type": "float"}], "return": "float", "static": True},
+         ]},
+        {"name": "Pawn", "parent": "MyObject", "interfaces": [], "properties": [{"name": "Speed", "type": "float"}],
+         "functions": [{"name": "Jump", "params": [{"name": "Height", "type": "float"}], "return": None}]},
+    ],
+    "enums": [{"name": "MyEnum", "values": {"TEST": 0, "TEST2": 1, "TEST3": 2}}],
+    "structs": [{"name": "HitResult", "fields": [{"name": "Distance", "type": "float"}, {"name": "Actor", "type": "MyObject"}]}],
+}
+
+failures = []
+
+
+def check(condition, message):
+    if not condition:
+        failures.append(message)
+        print(f"FAILED {message}")
+
+
+def generated_files(out_dir):
+    files = set()
+    for root, _, names in os.walk(out_dir):
+        for name in names:
+            if name.endswith((".py", ".pyi")):
+                files.add(os.path.relpath(os.path.join(root, name), out_dir).replace(os.sep, "/"))
+    return files
+
+
+def regenerate(dump, out_dir):
+    """
+    generate again with every file dated to the epoch, returns the counts and the files written
+    """
+    for name in generated_files(out_dir):
+        os.utime(os.path.join(out_dir, name), (0, 0))
+    counts = generate_bindings.generate(dump, out_dir)
+    touched = {name for name in generated_files(out_dir) if os.stat(os.path.join(out_dir, name)).st_mtime != 0}
+    return counts, touched
+
+
+def check_import(out_dir):
+    package = importlib.import_module(PACKAGE_NAME)
+    check({"MyObject", "Object", "Pawn"} <= set(dir(package)), "package lists its classes")
+    check(issubclass(package.Pawn, package.MyObject) and issubclass(package.MyObject, package.Object), "classes keep the dump hierarchy")
+    check(package.MyEnum.TEST3.value == 2, "enums keep their values")
+    check(package.HitResult(1.5, None).Distance == 1.5, "structs are dataclasses")
+    check(os.path.exists(os.path.join(out_dir, generate_bindings.CLASSES_PACKAGE, "Pawn.pyi")), "classes have stubs")
+    with open(os.path.join(out_dir, generate_bindings.CLASSES_PACKAGE, "MyObject.pyi")) as stub:
+        stub = stub.read()
+    check("def Add(self, a: int, b: int) -> tuple[int] | ResultView: ..." in stub, "stubs annotate the results of calls")
+    check("def MakeDefault() -> tuple[MyObject]: ..." in stub, "stubs annotate the results of static calls")
+
+    # the stand-in server echoes the first param and stores properties per owner
+    pawn = package.Pawn()
+    pawn.unreal_object = UnrealObject(0x2000, "pawn")
+    check(pawn.Add(40, 2)[0] == 40, "inherited functions call the server")
+    pawn.Health = 75.5
+    check(pawn.Health == 75.5, "properties round trip")
+    package.MyObject.MakeDefault()
+
+    # static functions send their params with the declared kind, an int for a float param arrives as a float
+    unreal_core.set_loopback_static_function_handler(lambda class_name, function_name, params: params[0])
+    scaled = package.MyObject.Scale(2)[0]
+    unreal_core.set_loopback_static_function_handler(None)
+    check(type(scaled) is float and scaled == 2.0, f"static params convert with their kind, got {scaled!r}")
+
+
+def check_generator(out_root):
+    out_dir = os.path.join(out_root, PACKAGE_NAME)
+    sys.path.insert(0, out_root)
+
+    written, unchanged, removed = generate_bindings.generate(DUMP, out_dir)
+    all_files = generated_files(out_dir)
+    check((written, unchanged, removed) == (len(all_files), 0, 0), f"first run writes every file, got {(written, unchanged, removed)}")
+    check_import(out_dir)
+
+    counts, touched = regenerate(DUMP, out_dir)
+    check(counts == (0, len(all_files), 0) and not touched, f"second run writes nothing, got {counts} {sorted(touched)}")
+
+    # rename Pawn, the classes referring to it change with it
+    renamed = copy.deepcopy(DUMP)
+    renamed["classes"][2]["name"] = "Character"
+    renamed["classes"][1]["functions"][1]["return"] = "Character"
+    counts, touched = regenerate(renamed, out_dir)
+    expected = {"_classes/Character.py", "_classes/Character.pyi", "_classes/MyObject.py", "_classes/MyObject.pyi",
+                "__init__.py", "__init__.pyi", "_structs.py"}
+    check(touched == expected, f"rename rewrites the affected files, got {sorted(touched)}")
+    check(counts == (len(expected), len(all_files) - len(expected), 2), f"rename counts, got {counts}")
+    check(not os.path.exists(os.path.join(out_dir, "_classes", "Pawn.py")) and not os.path.exists(os.path.join(out_dir, "_classes", "Pawn.pyi")),
+          "rename removes the files of the old name")
+
+    # delete the enum, its module is rewritten but stays
+    deleted = copy.deepcopy(renamed)
+    deleted["enums"] = []
+    counts, touched = regenerate(deleted, out_dir)
+    check(touched == {"_enums.py", "_structs.py"} and counts == (2, len(all_files) - 2, 0), f"enum delete, got {counts} {sorted(touched)}")
+
+    # delete a class nothing refers to
+    del deleted["classes"][2]
+    deleted["classes"][1]["functions"].pop(1)
+    counts, touched = regenerate(deleted, out_dir)
+    expected = {"_classes/MyObject.py", "_classes/MyObject.pyi", "__init__.py", "__init__.pyi", "_structs.py"}
+    check(touched == expected and counts == (len(expected), len(all_files) - 2 - len(expected), 2),
+          f"class delete, got {counts} {sorted(touched)}")
+    check(generated_files(out_dir) == all_files - {"_classes/Pawn.py", "_classes/Pawn.pyi"}, "class delete leaves the other files")
+
+
+def main():
+    with tempfile.TemporaryDirectory() as out_root:
+        check_generator(out_root)
+    print("binding generator checks failed" if failures else "binding generator checks passed")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
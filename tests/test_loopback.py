@@ -0,0 +1,163 @@
+import os
+import sys
+
+# answer rpc calls from the in-process stand-in server. needs unreal_core built with UNREAL_CORE_TESTING=1
+os.environ.setdefault("UNREAL_CORE_LOOPBACK", "1")
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "pyunreal"))
+
+import unreal_core
+from unreal_core import Argument, ClassProp, UnrealObject
+
+failures = []
+
+
+def check(condition, message):
+    if not condition:
+        failures.append(message)
+        print(f"FAILED {message}")
+
+
+class Owner:
+    pass
+
+
+def check_class_checks():
+    # new_object records the class of the object on the stand-in server, which answers staticClass with it
+    owner = Owner()
+    actor = unreal_core.new_object(owner, ClassProp("Actor"), "actor", 0, [])
+    unreal_core.set_loopback_class_hierarchy("Actor", ["Object"], ["Interface_AssetUserData"])
+    unreal_core.clear_class_hierarchies()
+
+    check(unreal_core.is_a(actor, ClassProp("Actor")), "is_a matches the class itself")
+    check(unreal_core.is_a(actor, "Object"), "is_a matches a parent")
+    check(unreal_core.is_a(actor, "Interface_AssetUserData"), "is_a matches an interface")
+    check(not unreal_core.is_a(actor, "Pawn"), "is_a misses an unrelated class")
+    check(unreal_core.cast(actor, "Object") is actor, "cast returns the object on a match")
+    check(unreal_core.cast(actor, "Pawn") is None, "cast returns None for an unrelated class")
+
+    # objects the server knows nothing about are plain Objects
+    unknown = UnrealObject(0x5000, "unknown")
+    check(unreal_core.is_a(unknown, "Object") and not unreal_core.is_a(unknown, "Actor"), "unknown objects are Objects")
+
+    # a python object bound to a ue object checks that object
+    bound = Owner()
+    bound.unreal_object = actor
+    check(unreal_core.is_a(bound, "Interface_AssetUserData"), "is_a follows the bound ue object")
+    check(unreal_core.cast(bound, "Pawn") is None, "cast of a bound object returns None for an unrelated class")
+
+
+def call_results(values):
+    obj = Owner()
+    unreal_object = UnrealObject(0x1000, "loopback")
+    return unreal_core.call(obj, unreal_object, ClassProp("MyObject"), "Func", *values)
+
+
+def check_lazy_results():
+    # the stand-in server echoes the first param, a void return has no results
+    for values in [["unreal é €", 1, 2.0], [7], [2.5], [True], [Owner()], []]:
+        unreal_core.set_lazy_results(False)
+        eager = call_results(values)
+        unreal_core.set_lazy_results(True)
+        view = call_results(values)
+        check(type(eager) is tuple, f"eager results are a tuple for {values!r}")
+        check(len(view) == len(eager), f"ResultView length {len(view)} against {len(eager)} for {values!r}")
+        check(tuple(view) == eager, f"ResultView items {tuple(view)!r} against {eager!r}")
+        check(all(view[i] == eager[i] and view[i - len(eager)] == eager[i] for i in range(len(eager))),
+              f"ResultView indexing matches the tuple for {values!r}")
+        check(view.return_value == (eager[0] if eager else None), f"ResultView return_value for {values!r}")
+        try:
+            view[len(eager)]
+            check(False, f"ResultView index past the end raises for {values!r}")
+        except IndexError:
+            pass
+    unreal_core.set_lazy_results(False)
+
+
+def check_param_encoding():
+    # both encodings of the same params give the same results from the stand-in server
+    ue_class = ClassProp("MyObject")
+    signatures = [
+        [1, 2.0],
+        [-(2 ** 40), "name"],
+        [3.25, 1],
+        ["unreal é € \U0001f600", 1, 2.0, True],
+        [False, "a"],
+        [""],
+        [Argument("Speed", ue_class, 1.5), Argument("Count", ue_class, 3)],
+        [Argument("Name", ue_class, "hero"), 2.0],
+        [Owner(), 1],
+        [],
+    ]
+    for values in signatures:
+        results = {}
+        for encoding in ("v1", "v2"):
+            unreal_core.set_param_encoding(encoding)
+            unreal_core.reset_request_stats()
+            results[encoding] = call_results(values)
+            method = "callFunction" if encoding == "v1" else "callFunctionPacked"
+            check(unreal_core.request_stats()[method]["requests"] == 1, f"{encoding} sends {method} for {values!r}")
+        check(results["v1"] == results["v2"], f"v1 {results['v1']!r} against v2 {results['v2']!r} for {values!r}")
+
+    # call_function takes the same path as call
+    arguments = [Argument("Speed", ue_class, 4.0)]
+    results = {}
+    for encoding in ("v1", "v2"):
+        unreal_core.set_param_encoding(encoding)
+        results[encoding] = unreal_core.call_function(Owner(), UnrealObject(0x1000, "loopback"), ue_class, "Func", arguments)
+    check(results["v1"] == results["v2"] == (4.0,), f"call_function v1 {results['v1']!r} against v2 {results['v2']!r}")
+    unreal_core.set_param_encoding("auto")
+
+
+def check_prepared_strings():
+    # a lone surrogate has no UTF-8 form, it only reaches the server when strs travel as UTF-16
+    obj = Owner()
+    unreal_object = UnrealObject(0x1000, "loopback")
+    lone = "a\ud800b"
+    # "str" has a specialized encoder, "str,bool" goes through the per param converters
+    for signature in ([("Name", "str")], [("Name", "str"), ("Flag", "bool")]):
+        prepared = unreal_core.prepare(ClassProp("MyObject"), "Func", signature)
+        values = [lone, True][:len(signature)]
+        unreal_core.set_string_encoding("utf16")
+        check(prepared(obj, unreal_object, *values)[0] == lone, f"prepared {signature} calls send UTF-16 strings")
+        unreal_core.set_string_encoding("utf8")
+        try:
+            prepared(obj, unreal_object, *values)
+            check(False, f"prepared {signature} calls send UTF-8 strings")
+        except UnicodeEncodeError:
+            pass
+    unreal_core.set_string_encoding("auto")
+
+
+class Hero:
+    Health = unreal_core.UProperty(ClassProp("Hero"), "float")
+    Alive = unreal_core.UProperty(ClassProp("Hero"), "bool")
+    Title = unreal_core.UProperty(ClassProp("Hero"), "str")
+    Anything = unreal_core.UProperty(ClassProp("Hero"))
+
+
+def check_properties():
+    # the stand-in server stores properties per owner, scalar kinds are patched into the prepared request
+    first, second = Hero(), Hero()
+    first.Health, second.Health = 75, 20.5
+    first.Alive, second.Alive = True, False
+    first.Title = "hero é"
+    first.Anything = 3
+    check(type(first.Health) is float and first.Health == 75.0, f"float property converts ints, got {first.Health!r}")
+    check(second.Health == 20.5, "patched values do not leak between owners")
+    check(first.Alive is True and second.Alive is False, "bool property round trips")
+    check(first.Title == "hero é", "str property round trips")
+    check(first.Anything == 3, "properties without a kind dispatch on the value")
+
+
+def main():
+    check_class_checks()
+    check_lazy_results()
+    check_param_encoding()
+    check_prepared_strings()
+    check_properties()
+    print("loopback checks failed" if failures else "loopback checks passed")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())